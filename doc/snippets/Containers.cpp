@@ -40,6 +40,7 @@
 #include "Corrade/Containers/EnumSet.hpp"
 #include "Corrade/Containers/Function.h"
 #include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/InlineFunction.h"
 #include "Corrade/Containers/Iterable.h"
 #include "Corrade/Containers/LinkedList.h"
 #include "Corrade/Containers/Optional.h"
@@ -47,6 +48,7 @@
 #include "Corrade/Containers/Pointer.h"
 #include "Corrade/Containers/Reference.h"
 #include "Corrade/Containers/ScopeGuard.h"
+#include "Corrade/Containers/SoaArray.h"
 #include "Corrade/Containers/StaticArray.h"
 #include "Corrade/Containers/StridedArrayView.h"
 #include "Corrade/Containers/StridedBitArrayView.h"
@@ -653,6 +655,35 @@ Containers::ArrayTuple data{
 }
 #endif
 
+{
+struct Vector3 { float x, y, z; };
+/* [SoaArray-usage] */
+/* Positions, velocities and remaining lifetime of particles */
+Containers::SoaArray<Vector3, Vector3, float> particles;
+particles.reserve(1000);
+particles.append({0.0f, 1.0f, 0.0f}, {0.5f, 2.0f, 0.0f}, 3.0f);
+DOXYGEN_ELLIPSIS()
+
+/* Integrate, touching only the first two columns */
+Containers::ArrayView<Vector3> positions = particles.column<0>();
+Containers::ArrayView<const Vector3> velocities = particles.column<1>();
+for(std::size_t i = 0; i != particles.size(); ++i) {
+    positions[i].x += velocities[i].x*0.016f;
+    DOXYGEN_ELLIPSIS()
+}
+
+/* Remove dead particles, order doesn't matter */
+for(std::size_t i = particles.size(); i != 0; --i)
+    if(particles.column<2>()[i - 1] <= 0.0f)
+        particles.removeUnordered(i - 1);
+
+/* Columns can be sliced as strided views */
+Containers::StridedArrayView1D<float> heights =
+    Containers::stridedArrayView(particles.column<0>()).slice(&Vector3::y);
+/* [SoaArray-usage] */
+static_cast<void>(heights);
+}
+
 {
 /* [StaticArrayView-usage] */
 Containers::ArrayView<int> data;
@@ -835,6 +866,29 @@ static_cast<Containers::Function<float(float)>&>(b)(3.56f);         // 4.0f
 /* [Function-usage-type-erased] */
 }
 
+/* MSVC 2015 cannot capture arrays by value, skip this snippet there */
+#ifndef CORRADE_MSVC2015_COMPATIBILITY
+{
+/* [InlineFunction-usage] */
+/* Six pointers, would be allocated by a Function */
+float* targets[6]{DOXYGEN_ELLIPSIS()};
+Containers::InlineFunction<void(float), 48> setAll = [targets](float value) {
+    for(float* target: targets) *target = value;
+};
+
+/* A non-trivial state is stored inline as well */
+Containers::String name = DOXYGEN_ELLIPSIS({});
+Containers::InlineFunction<bool(Containers::StringView), 32> matches =
+    [name](Containers::StringView other) { return name == other; };
+
+// Containers::InlineFunction<void(float), 16> setAllSmall =          // error
+//    [targets](float value) { DOXYGEN_ELLIPSIS() };
+/* [InlineFunction-usage] */
+static_cast<void>(setAll);
+static_cast<void>(matches);
+}
+#endif
+
 {
 /* [enumSetDebugOutput-usage] */
 // prints Feature::Fast|Feature::Cheap
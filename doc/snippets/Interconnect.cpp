@@ -25,10 +25,13 @@
 */
 
 #include <string>
+#include <thread>
 
 #include "Corrade/Interconnect/Emitter.h"
+#include "Corrade/Interconnect/EventQueue.h"
 #include "Corrade/Interconnect/Receiver.h"
 #include "Corrade/Interconnect/StateMachine.h"
+#include "Corrade/Utility/DebugStl.h"
 
 #define DOXYGEN_ELLIPSIS(...) __VA_ARGS__
 
@@ -87,12 +90,52 @@ Interconnect::connect(postman, &Postman::messageDelivered,
 /* [Emitter-connect-member-slot] */
 }
 
+{
+/* [Emitter-batch] */
+Postman postman;
+Interconnect::connect(postman, &Postman::paymentRequired,
+    [](int amount) { Utility::Debug{} << "pay" << amount; });
+
+{
+    Interconnect::Emitter::Batch batch{postman};
+    for(int amount: {10, 20, 30})
+        postman.paymentRequired(amount);
+} // prints just "pay 30"
+/* [Emitter-batch] */
+}
+
 {
 /* [Emitter-disconnectSignal] */
 Postman postman;
 postman.disconnectSignal(&Postman::messageDelivered);
 /* [Emitter-disconnectSignal] */
 }
+
+{
+bool running{};
+/* [EventQueue] */
+Postman postman;
+Interconnect::EventQueue queue;
+
+/* Prints the message only once the queue is processed */
+Interconnect::connect(postman, &Postman::messageDelivered, queue,
+    [](const std::string& message, int) {
+        Utility::Debug{} << "received" << message;
+    });
+
+/* Deliver messages from a worker thread */
+std::thread worker{[&postman]{
+    postman.messageDelivered("hello from a worker");
+}};
+
+/* Process the events on the main thread */
+while(running) {
+    queue.processEvents();
+    DOXYGEN_ELLIPSIS()
+}
+/* [EventQueue] */
+worker.join();
+}
 }
 
 {
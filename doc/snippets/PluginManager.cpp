@@ -87,6 +87,22 @@ if(loadState & (PluginManager::LoadState::WrongPluginVersion|
 /* [LoadStates] */
 }
 #endif
+
+{
+/* [Manager-instantiatePooled] */
+for(Containers::StringView file: {"a.zip", "b.zip", "c.zip"}) {
+    /* Takes a previously recycled instance, if there's any */
+    Containers::Pointer<AbstractFilesystem> filesystem =
+        manager.instantiatePooled("ZipFilesystem");
+
+    // use the filesystem to read the file ...
+
+    /* Calls AbstractPlugin::resetForReuse() and puts the instance back */
+    manager.recycle(Utility::move(filesystem));
+    DOXYGEN_ELLIPSIS(static_cast<void>(file);)
+}
+/* [Manager-instantiatePooled] */
+}
 }
 
 /* The include is already above, so doing it again here should be harmless */
@@ -32,6 +32,7 @@
 
 #include "Corrade/Containers/Array.h"
 #include "Corrade/Containers/BitArray.h"
+#include "Corrade/Containers/Function.h"
 #include "Corrade/Containers/GrowableArray.h"
 #include "Corrade/Containers/Optional.h"
 #include "Corrade/Containers/Pair.h"
@@ -41,11 +42,14 @@
 #include "Corrade/Utility/Algorithms.h"
 #include "Corrade/Utility/Arguments.h"
 #include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/BitAlgorithms.h"
 #include "Corrade/Utility/Configuration.h"
 #include "Corrade/Utility/DebugStl.h"
 #include "Corrade/Utility/Endianness.h"
 #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)) || defined(CORRADE_TARGET_EMSCRIPTEN)
+#include "Corrade/Utility/DirectoryWatcher.h"
 #include "Corrade/Utility/FileWatcher.h"
+#include "Corrade/Utility/FileWatchSet.h"
 #endif
 #include "Corrade/Utility/Format.h"
 #include "Corrade/Utility/FormatStl.h"
@@ -54,6 +58,7 @@
 #include "Corrade/Utility/Macros.h"
 #include "Corrade/Utility/Memory.h"
 #include "Corrade/Utility/Path.h"
+#include "Corrade/Utility/PoolAllocator.h"
 #include "Corrade/Utility/Resource.h"
 #include "Corrade/Utility/Sha1.h"
 #include "Corrade/Utility/StlMath.h"
@@ -405,6 +410,26 @@ Utility::flipInPlace<0>(pixels);
 /* [Algorithms-flipInPlace] */
 }
 
+{
+/* [maskFromPredicate] */
+Containers::StridedArrayView1D<const float> values = DOXYGEN_ELLIPSIS({});
+
+/* Pick all positive values */
+Containers::BitArray mask{NoInit, values.size()};
+Containers::Array<float> positive{NoInit,
+    Utility::maskFromPredicate(values, [](float a) { return a > 0.0f; }, mask)};
+Utility::copyMasked(values, mask, positive);
+/* [maskFromPredicate] */
+
+/* [expandMasked] */
+/* Process the positive values and put them back to their original
+   positions */
+for(float& i: positive) i = std::sqrt(i);
+Containers::Array<float> output{ValueInit, values.size()};
+Utility::expandMasked(positive, output, mask);
+/* [expandMasked] */
+}
+
 {
 typedef float __m256;
 std::size_t size{};
@@ -437,6 +462,43 @@ for(Foo& f: data) new(&f) Foo{index++};
 /* [allocateAligned-NoInit] */
 }
 
+{
+/* [PoolAllocated] */
+struct Event: Utility::PoolAllocated {
+    int type;
+    float x, y;
+};
+
+/* Both go through Utility::poolAllocate() */
+Containers::Pointer<Event> a{new Event{}};
+Containers::Pointer<Event> b = Containers::pointer<Event>();
+/* [PoolAllocated] */
+}
+
+{
+/* [poolPointer] */
+struct Shape {
+    virtual ~Shape() = default;
+    DOXYGEN_ELLIPSIS()
+};
+struct Circle: Shape {
+    explicit Circle(float radius): radius{radius} {}
+    float radius;
+};
+
+Containers::Pointer<Shape> shape = Utility::poolPointer<Circle>(5.0f);
+/* [poolPointer] */
+}
+
+{
+int a{}, b{}, c{}, d{}, e{};
+/* [pooled] */
+Containers::Function<void()> f = Utility::pooled([a, b, c, d, e]{
+    DOXYGEN_ELLIPSIS(static_cast<void>(a + b + c + d + e);)
+});
+/* [pooled] */
+}
+
 {
 /* [Configuration-usage] */
 Utility::Configuration conf{"my.conf"};
@@ -767,6 +829,39 @@ if(watcher.hasChanged()) {
 }
 /* [FileWatcher] */
 }
+
+{
+/* [FileWatchSet] */
+Utility::FileWatchSet watchers;
+std::size_t settings = watchers.add("settings.conf");
+std::size_t shader = watchers.add("shader.glsl");
+
+// in the main application loop
+for(std::size_t id: watchers.changedFiles()) {
+    if(id == settings) {
+        // reload the settings
+    } else if(id == shader) {
+        // recompile the shader
+    }
+}
+/* [FileWatchSet] */
+}
+
+{
+/* [DirectoryWatcher] */
+Utility::DirectoryWatcher watcher{"assets"};
+watcher.setDebounce(100);
+
+// in the main application loop
+for(const Containers::Pair<Containers::String, Utility::DirectoryWatcher::Change>& change: watcher.changes()) {
+    if(change.second() == Utility::DirectoryWatcher::Change::Deleted) {
+        // unload assets/<change.first()>
+    } else {
+        // (re)load assets/<change.first()>
+    }
+}
+/* [DirectoryWatcher] */
+}
 #endif
 
 {
@@ -83,6 +83,8 @@
 #  CORRADE_BUILD_CPU_RUNTIME_DISPATCH - Defined if built with code paths
 #   optimized for multiple architectres with the best matching variant selected
 #   at runtime based on detected CPU features
+#  CORRADE_BUILD_STARTUP_PROFILING - Defined if built with startup profiling
+#   instrumentation
 #  CORRADE_TARGET_UNIX          - Defined if compiled for some Unix flavor
 #   (Linux, BSD, macOS)
 #  CORRADE_TARGET_APPLE         - Defined if compiled for Apple platforms
@@ -331,6 +333,7 @@ set(_corradeFlags
     BUILD_STATIC_UNIQUE_GLOBALS
     BUILD_MULTITHREADED
     BUILD_CPU_RUNTIME_DISPATCH
+    BUILD_STARTUP_PROFILING
     TARGET_UNIX
     TARGET_APPLE
     TARGET_IOS
@@ -619,6 +622,14 @@ foreach(_component ${Corrade_FIND_COMPONENTS})
         elseif(_component STREQUAL PluginManager)
             # -ldl is handled by Utility now
 
+            # Loading of multiple plugins is done on multiple threads
+            if(CORRADE_BUILD_MULTITHREADED AND NOT CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT)
+                set(THREADS_PREFER_PTHREAD_FLAG TRUE)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Corrade::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Threads::Threads)
+            endif()
+
         # TestSuite library has some additional files. If those are not found,
         # set the component _FOUND variable to false so it works properly both
         # when the component is required and when it's optional.
@@ -675,6 +686,14 @@ foreach(_component ${Corrade_FIND_COMPONENTS})
                 set_property(TARGET Corrade::${_component} APPEND PROPERTY
                     INTERFACE_LINK_LIBRARIES ${CMAKE_DL_LIBS})
             endif()
+            # Path::listEntriesRecursive() lists directories on multiple
+            # threads
+            if(CORRADE_BUILD_MULTITHREADED AND NOT CORRADE_TARGET_EMSCRIPTEN)
+                set(THREADS_PREFER_PTHREAD_FLAG TRUE)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Corrade::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Threads::Threads)
+            endif()
             # AndroidLogStreamBuffer class needs to be linked to log library
             if(CORRADE_TARGET_ANDROID)
                 set_property(TARGET Corrade::${_component} APPEND PROPERTY
@@ -617,9 +617,20 @@ function(corrade_add_resource name input)
     foreach(arg ${ARGN})
         if(arg STREQUAL SINGLE)
             set(single_file --single)
+        elseif(arg STREQUAL BLOB)
+            set(blob ON)
         endif()
     endforeach()
 
+    if(blob)
+        if(single_file)
+            message(FATAL_ERROR "corrade_add_resource(): SINGLE and BLOB can't be used together")
+        endif()
+        if(NOT CORRADE_TARGET_UNIX OR NOT CORRADE_TARGET_GCC)
+            message(SEND_ERROR "corrade_add_resource(): BLOB is supported only with GCC or Clang on Unix platforms")
+        endif()
+    endif()
+
     # See _CORRADE_USE_NO_TARGET_CHECKS in Corrade's root CMakeLists
     if(NOT _CORRADE_USE_NO_TARGET_CHECKS AND NOT TARGET Corrade::rc)
         if(CMAKE_CROSSCOMPILING)
@@ -656,8 +667,19 @@ function(corrade_add_resource name input)
         list(APPEND dependencies ${name}-dependencies)
     endif()
 
-    # Output file name
+    # Output file name. If the data go into a blob, it's an extra output.
+    # Unless it's a single file, compressed data of unchanged files are cached
+    # in a directory next to it for faster recompilation.
     set(out "${CMAKE_CURRENT_BINARY_DIR}/resource_${name}.cpp")
+    if(NOT single_file)
+        set(cache_dir --cache-dir "${CMAKE_CURRENT_BINARY_DIR}/resource_${name}.cache")
+    endif()
+    set(outputs "${out}")
+    if(blob)
+        set(out_blob "${CMAKE_CURRENT_BINARY_DIR}/resource_${name}.bin")
+        list(APPEND outputs "${out_blob}")
+        set(blob_file --blob "${out_blob}")
+    endif()
 
     # Tell CMake to re-run and update the dependency list when the resource
     # list file changes (otherwise it parses the file only during the explicit
@@ -674,8 +696,8 @@ function(corrade_add_resource name input)
         set(command Corrade::rc)
     endif()
     add_custom_command(
-        OUTPUT "${out}"
-        COMMAND ${command} ${single_file} ${name} "${input}" "${out}"
+        OUTPUT ${outputs}
+        COMMAND ${command} ${single_file} ${blob_file} ${cache_dir} ${name} "${input}" "${out}"
         DEPENDS Corrade::rc ${input} ${dependencies}
         COMMENT "Compiling data resource file ${out}"
         WORKING_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}")
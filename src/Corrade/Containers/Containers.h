@@ -46,6 +46,7 @@ template<class T, class = void(*)(T*, std::size_t)> class Array;
 
 template<class> class ArrayView;
 class ArrayTuple;
+template<class...> class SoaArray;
 template<std::size_t, class> class StaticArrayView;
 template<class T> using ArrayView1 = StaticArrayView<1, T>;
 template<class T> using ArrayView2 = StaticArrayView<2, T>;
@@ -116,6 +117,7 @@ template<class> class AnyReference;
 
 class FunctionData;
 template<class> class Function;
+template<class, std::size_t> class InlineFunction;
 class ScopeGuard;
 
 enum class StringViewFlag: std::size_t;
@@ -0,0 +1,320 @@
+#ifndef Corrade_Containers_InlineFunction_h
+#define Corrade_Containers_InlineFunction_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::InlineFunction<R(Args...), size> "Corrade::Containers::InlineFunction"
+ * @m_since_latest
+ */
+
+#include <cstring>
+
+#include "Corrade/Containers/Function.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+
+/* Used by InlineFunction to store member function pointers, which are then
+   handled the same way as any other trivial functor */
+template<class Instance, class MemberFunction, class R, class ...Args> struct InlineMemberFunction {
+    R operator()(Args... args) const {
+        return (instance->*function)(Utility::forward<Args>(args)...);
+    }
+
+    Instance* instance;
+    MemberFunction function;
+};
+
+}
+
+/**
+@brief Function wrapper with inline storage
+@m_since_latest
+
+See the @ref InlineFunction<R(Args...), size> specialization.
+*/
+template<class, std::size_t> class InlineFunction;
+
+/**
+@brief Function wrapper with inline storage
+@tparam size    Inline storage size in bytes
+@m_since_latest
+
+Like @ref Function<R(Args...)> "Function", but with the inline storage size
+given by the @p size template parameter instead of being just large enough to
+fit a member function pointer. Anything that doesn't fit into @p size bytes
+fails to compile instead of being allocated on heap --- in other words, an
+@ref InlineFunction never allocates. It's meant to be used in places where
+capturing lambdas are common and allocating their state for every binding
+would be too expensive:
+
+@snippet Containers.cpp InlineFunction-usage
+
+Compared to @ref Function<R(Args...)> "Function", the stored functor doesn't
+need to be trivially copyable --- a move-only or a non-trivially-destructible
+functor is stored inline as well, its move constructor and destructor being
+called when the wrapper is moved or destructed. Trivially copyable functors
+are moved with a plain copy of the storage. The functor is expected to have
+a @cpp noexcept @ce move constructor and an alignment not larger than
+@cpp alignof(void*) @ce or @cpp alignof(double) @ce, whichever is larger.
+
+Free function pointers, member function pointers and functors convertible to
+function pointers are supported as well. Member function pointers are stored
+together with the instance pointer, which needs @cpp 3*sizeof(void*) @ce bytes
+of inline storage on most platforms, so a too small @p size may not be enough
+to fit them.
+
+Unlike @ref Function<R(Args...)> "Function", this class doesn't derive from
+the type-erased @ref FunctionData and thus can't be stored in a type-erased
+way.
+*/
+template<class R, class ...Args, std::size_t size> class InlineFunction<R(Args...), size> {
+    static_assert(size >= sizeof(void*), "inline storage has to be at least large enough for a function pointer");
+
+    public:
+        /** @brief Function type */
+        typedef R(Type)(Args...);
+
+        enum: std::size_t {
+            Size = size     /**< Inline storage size */
+        };
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates a @cpp nullptr @ce function.
+         * @see @ref operator bool()
+         */
+        /*implicit*/ InlineFunction(std::nullptr_t = nullptr) noexcept: _call{}, _manage{} {}
+
+        /**
+         * @brief Wrap a free function pointer
+         *
+         * If @p f is @cpp nullptr @ce, the constructor is equivalent to
+         * @ref InlineFunction(std::nullptr_t).
+         */
+        /*implicit*/ InlineFunction(R(*f)(Args...)) noexcept;
+
+        /**
+         * @brief Wrap a member function pointer
+         *
+         * Default, @cpp & @ce, @cpp const @ce and @cpp const & @ce overloads
+         * are supported. If @p f is @cpp nullptr @ce, the constructor is
+         * equivalent to @ref InlineFunction(std::nullptr_t).
+         */
+        template<class Instance, class Class> /*implicit*/ InlineFunction(Instance& instance, R(Class::*f)(Args...)) noexcept: InlineFunction{nullptr} {
+            if(f) emplace(Implementation::InlineMemberFunction<Instance, R(Class::*)(Args...), R, Args...>{&instance, f});
+        }
+        /** @overload */
+        template<class Instance, class Class> /*implicit*/ InlineFunction(Instance& instance, R(Class::*f)(Args...) &) noexcept: InlineFunction{nullptr} {
+            if(f) emplace(Implementation::InlineMemberFunction<Instance, R(Class::*)(Args...) &, R, Args...>{&instance, f});
+        }
+        /** @overload */
+        template<class Instance, class Class> /*implicit*/ InlineFunction(Instance& instance, R(Class::*f)(Args...) const) noexcept: InlineFunction{nullptr} {
+            if(f) emplace(Implementation::InlineMemberFunction<Instance, R(Class::*)(Args...) const, R, Args...>{&instance, f});
+        }
+        /** @overload */
+        template<class Instance, class Class> /*implicit*/ InlineFunction(Instance& instance, R(Class::*f)(Args...) const &) noexcept: InlineFunction{nullptr} {
+            if(f) emplace(Implementation::InlineMemberFunction<Instance, R(Class::*)(Args...) const &, R, Args...>{&instance, f});
+        }
+
+        /**
+         * @brief Create a null member function pointer
+         *
+         * Equivalent to @ref InlineFunction(std::nullptr_t).
+         */
+        template<class Instance> /*implicit*/ InlineFunction(Instance&, std::nullptr_t) noexcept: InlineFunction{nullptr} {}
+
+        /**
+         * @brief Wrap a lambda or a functor
+         *
+         * The functor is expected to *exactly* match the signature, same as
+         * with @ref Function<R(Args...)> "Function". Fails to compile if the
+         * functor is larger than @p size, in which case either the inline
+         * storage size needs to be increased or a
+         * @ref Function<R(Args...)> "Function" used instead.
+         */
+        template<class F
+            #ifndef DOXYGEN_GENERATING_OUTPUT
+            , typename std::enable_if<std::is_convertible<typename std::decay<F>::type, R(*)(Args...)>::value || Implementation::IsFunctor<typename std::decay<F>::type, R(Args...)>::value, int>::type = 0
+            #endif
+        > /*implicit*/ InlineFunction(F&& f) noexcept: InlineFunction{nullptr, Utility::forward<F>(f)} {}
+
+        /** @brief Copying is not allowed */
+        InlineFunction(const InlineFunction<R(Args...), size>&) = delete;
+
+        /** @brief Move constructor */
+        InlineFunction(InlineFunction<R(Args...), size>&& other) noexcept: _call{other._call}, _manage{other._manage} {
+            moveFrom(other);
+        }
+
+        ~InlineFunction() {
+            if(_manage) _manage(_storage, nullptr);
+        }
+
+        /** @brief Copying is not allowed */
+        InlineFunction<R(Args...), size>& operator=(const InlineFunction<R(Args...), size>&) = delete;
+
+        /** @brief Move assignment */
+        InlineFunction<R(Args...), size>& operator=(InlineFunction<R(Args...), size>&& other) noexcept {
+            if(&other != this) {
+                if(_manage) _manage(_storage, nullptr);
+                _call = other._call;
+                _manage = other._manage;
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Whether the function pointer is non-null
+         *
+         * Returns @cpp false @ce if the instance was default-constructed,
+         * constructed from a @cpp nullptr @ce free or member function pointer
+         * or moved out, @cpp true @ce otherwise.
+         */
+        explicit operator bool() const { return _call; }
+
+        /**
+         * @brief Call the function pointer
+         *
+         * Expects that the pointer is not @cpp nullptr @ce.
+         * @see @ref operator bool()
+         */
+        R operator()(Args... args) {
+            return CORRADE_CONSTEXPR_DEBUG_ASSERT(_call, "Containers::InlineFunction: the function is null"),
+                _call(_storage, Utility::forward<Args>(args)...);
+        }
+
+    private:
+        union Storage {
+            char data[size];
+            /* Only for alignment */
+            void* pointer;
+            double number;
+        };
+
+        /* Functor convertible to a function pointer, delegates to the function
+           pointer variant */
+        template<class F, typename std::enable_if<std::is_convertible<typename std::decay<F>::type, R(*)(Args...)>::value, int>::type = 0> explicit InlineFunction(std::nullptr_t, F&& f) noexcept: InlineFunction{static_cast<R(*)(Args...)>(f)} {}
+
+        /* Any other functor */
+        template<class F, typename std::enable_if<!std::is_convertible<typename std::decay<F>::type, R(*)(Args...)>::value, int>::type = 0> explicit InlineFunction(std::nullptr_t, F&& f) noexcept: InlineFunction{nullptr} {
+            emplace(Utility::forward<F>(f));
+        }
+
+        template<class F> void emplace(F&& f) noexcept;
+
+        void moveFrom(InlineFunction<R(Args...), size>& other) noexcept {
+            /* Trivially copyable functors and function pointers have no
+               manager, copy the whole storage. Otherwise the manager
+               move-constructs the functor and destructs the original. */
+            if(_manage)
+                _manage(_storage, &other._storage);
+            else if(_call)
+                std::memcpy(_storage.data, other._storage.data, size);
+            other._call = nullptr;
+            other._manage = nullptr;
+        }
+
+        Storage _storage;
+        R(*_call)(Storage&, Args...);
+        /* If src is not nullptr, move-constructs dst from src and destructs
+           src, otherwise destructs dst. Null for trivially copyable
+           functors. */
+        void(*_manage)(Storage& dst, Storage* src);
+};
+
+/* It parses various stuff from below as VARIABLES IN THE CORRADE NAMESPACE!
+   What a dumpster fire of a broken tool. */
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template<class R, class ...Args, std::size_t size> InlineFunction<R(Args...), size>::InlineFunction(R(*f)(Args...)) noexcept: InlineFunction{nullptr} {
+    if(!f) return;
+
+    reinterpret_cast<R(*&)(Args...)>(_storage.data) = f;
+    /* The + is to decay the lambda to a function pointer. MSVC 2015 says it's
+       "illegal on a class" so there it's an explicit cast to the function
+       pointer type (and the parentheses are for both to have only one
+       ifdef). */
+    _call =
+        #ifndef CORRADE_MSVC2015_COMPATIBILITY
+        +
+        #else
+        static_cast<R(*)(Storage&, Args...)>
+        #endif
+    ([](Storage& storage, Args... args) -> R {
+        return reinterpret_cast<R(*&)(Args...)>(storage.data)(Utility::forward<Args>(args)...);
+    });
+}
+
+template<class R, class ...Args, std::size_t size> template<class F> void InlineFunction<R(Args...), size>::emplace(F&& f) noexcept {
+    typedef typename std::decay<F>::type Functor;
+    static_assert(sizeof(Functor) <= size, "functor too large to be stored inline, increase the inline storage size");
+    static_assert(alignof(Functor) <= alignof(Storage), "functor alignment too large to be stored inline");
+    static_assert(std::is_nothrow_move_constructible<Functor>::value, "functor is expected to be nothrow move-constructible");
+
+    /* The () instead of {} works around GCC 4.8 attempting to initialize the
+       first member instead of performing a copy, same as in Function */
+    new(&_storage.data) Functor(Utility::forward<F>(f));
+    _call =
+        #ifndef CORRADE_MSVC2015_COMPATIBILITY
+        +
+        #else
+        static_cast<R(*)(Storage&, Args...)>
+        #endif
+    ([](Storage& storage, Args... args) -> R {
+        return reinterpret_cast<Functor&>(storage.data)(Utility::forward<Args>(args)...);
+    });
+
+    if(
+        #ifndef CORRADE_NO_STD_IS_TRIVIALLY_TRAITS
+        std::is_trivially_copyable<Functor>::value
+        #else
+        __has_trivial_copy(Functor) && __has_trivial_destructor(Functor)
+        #endif
+    ) return;
+
+    _manage =
+        #ifndef CORRADE_MSVC2015_COMPATIBILITY
+        +
+        #else
+        static_cast<void(*)(Storage&, Storage*)>
+        #endif
+    ([](Storage& dst, Storage* src) {
+        if(src) {
+            Functor& srcFunctor = reinterpret_cast<Functor&>(src->data);
+            new(&dst.data) Functor(Utility::move(srcFunctor));
+            srcFunctor.~Functor();
+        } else reinterpret_cast<Functor&>(dst.data).~Functor();
+    });
+}
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,387 @@
+#ifndef Corrade_Containers_SoaArray_h
+#define Corrade_Containers_SoaArray_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::SoaArray
+ * @m_since_latest
+ */
+
+#include <cstring>
+#include <type_traits>
+
+#include "Corrade/Containers/ArrayTuple.h"
+#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Containers/sequenceHelpers.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    template<std::size_t i, class First, class ...Next> struct SoaArrayType: SoaArrayType<i - 1, Next...> {};
+    template<class First, class ...Next> struct SoaArrayType<0, First, Next...> {
+        typedef First Type;
+    };
+
+    /* Each column is a distinct base, so the type can be deduced from just
+       the index in soaArrayColumn() below */
+    template<std::size_t i, class T> struct SoaArrayColumn {
+        ArrayView<T> view;
+    };
+    template<class, class...> struct SoaArrayColumns;
+    template<std::size_t ...sequence, class ...Types> struct SoaArrayColumns<Sequence<sequence...>, Types...>: SoaArrayColumn<sequence, Types>... {};
+
+    template<std::size_t i, class T> inline ArrayView<T>& soaArrayColumn(SoaArrayColumn<i, T>& column) {
+        return column.view;
+    }
+    template<std::size_t i, class T> inline const ArrayView<T>& soaArrayColumn(const SoaArrayColumn<i, T>& column) {
+        return column.view;
+    }
+
+    template<class...> struct SoaArrayTriviallyCopyable: std::true_type {};
+    template<class First, class ...Next> struct SoaArrayTriviallyCopyable<First, Next...>: std::integral_constant<bool,
+        #ifndef CORRADE_NO_STD_IS_TRIVIALLY_TRAITS
+        std::is_trivially_copyable<First>::value
+        #else
+        __has_trivial_copy(First) && __has_trivial_destructor(First)
+        #endif
+        && SoaArrayTriviallyCopyable<Next...>::value> {};
+}
+
+/**
+@brief Growable structure-of-arrays container
+@m_since_latest
+
+Stores a set of columns of types @p Types, all having the same size, in a
+single allocation. Compared to an array of structures, accessing a single
+property of all items touches only memory of given column, and compared to
+having several dedicated @ref Containers-Array-growable "growable arrays",
+there's just one allocation and one capacity for all of them, so growing the
+container involves just a single reallocation and the columns can't get out of
+sync. Memory layout of the allocation is the same as with @ref ArrayTuple ---
+columns are placed one after another, each padded to the alignment of its
+type.
+
+@snippet Containers.cpp SoaArray-usage
+
+Columns are accessed with @ref column() as @ref ArrayView instances, which are
+implicitly convertible to @ref StridedArrayView, allowing for example to
+@ref StridedArrayView::slice() "slice" a column to a particular member.
+Similarly to @ref Array, the views are invalidated on every operation that
+causes a reallocation, i.e. when the capacity gets exceeded.
+
+@section Containers-SoaArray-growth Growth strategy
+
+When @ref append() or @ref resize() exceeds current capacity, the capacity is
+increased by 50%, but to at least eight items and at least the desired size.
+Use @ref reserve() to preallocate memory if you know the final size upfront
+and @ref shrink() to free unused capacity. Items are removed using
+@ref removeUnordered(), which moves the last item into the place of the
+removed one in each column, and @ref removeSuffix(), neither of which ever
+reallocates.
+
+@section Containers-SoaArray-trivial Trivially copyable types only
+
+To keep reallocation and removal a plain memory copy, all @p Types are
+required to be trivially copyable, which is checked with a
+@cpp static_assert() @ce. For non-trivial types use dedicated
+@ref Array instances instead.
+*/
+template<class ...Types> class SoaArray {
+    static_assert(sizeof...(Types), "at least one column type expected");
+    static_assert(Implementation::SoaArrayTriviallyCopyable<Types...>::value, "only trivially copyable types are supported");
+
+    public:
+        /** @brief Column type */
+        template<std::size_t i> using Type = typename Implementation::SoaArrayType<i, Types...>::Type;
+
+        /** @brief Column count */
+        enum: std::size_t { ColumnCount = sizeof...(Types) };
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates a zero-sized container with zero capacity, doesn't allocate.
+         */
+        /*implicit*/ SoaArray() noexcept: _size{} {}
+
+        /**
+         * @brief Construct a value-initialized container
+         *
+         * Allocates exactly @p size items in each column, value-initializing
+         * them.
+         * @see @ref SoaArray(Corrade::NoInitT, std::size_t)
+         */
+        explicit SoaArray(Corrade::ValueInitT, std::size_t size): SoaArray{Corrade::NoInit, size} {
+            valueInitialize(typename Implementation::GenerateSequence<sizeof...(Types)>::Type{}, 0, size);
+        }
+
+        /**
+         * @brief Construct a value-initialized container
+         *
+         * Alias to @ref SoaArray(Corrade::ValueInitT, std::size_t).
+         */
+        explicit SoaArray(std::size_t size): SoaArray{Corrade::ValueInit, size} {}
+
+        /**
+         * @brief Construct a container without initializing its contents
+         *
+         * Allocates exactly @p size items in each column, leaving their
+         * contents uninitialized.
+         */
+        explicit SoaArray(Corrade::NoInitT, std::size_t size): SoaArray{} {
+            reallocate(typename Implementation::GenerateSequence<sizeof...(Types)>::Type{}, size);
+            _size = size;
+        }
+
+        /** @brief Copying is not allowed */
+        SoaArray(const SoaArray<Types...>&) = delete;
+
+        /**
+         * @brief Move constructor
+         *
+         * Resets data pointers, size and capacity of @p other to zero.
+         */
+        SoaArray(SoaArray<Types...>&& other) noexcept: _data{Utility::move(other._data)}, _columns(other._columns), _size{other._size} {
+            other._columns = Columns{};
+            other._size = 0;
+        }
+
+        /** @brief Copying is not allowed */
+        SoaArray<Types...>& operator=(const SoaArray<Types...>&) = delete;
+
+        /**
+         * @brief Move assignment
+         *
+         * Swaps the contents of the two instances.
+         */
+        SoaArray<Types...>& operator=(SoaArray<Types...>&& other) noexcept {
+            using Utility::swap;
+            swap(_data, other._data);
+            swap(_columns, other._columns);
+            swap(_size, other._size);
+            return *this;
+        }
+
+        /** @brief Item count */
+        std::size_t size() const { return _size; }
+
+        /** @brief Whether the container is empty */
+        bool isEmpty() const { return !_size; }
+
+        /**
+         * @brief Capacity
+         *
+         * Count of items that can be stored without a reallocation. Always
+         * at least @ref size().
+         */
+        std::size_t capacity() const {
+            return Implementation::soaArrayColumn<0>(_columns).size();
+        }
+
+        /**
+         * @brief Column
+         *
+         * The returned view has @ref size() items and is invalidated once
+         * the container reallocates.
+         */
+        template<std::size_t i> ArrayView<Type<i>> column() {
+            return Implementation::soaArrayColumn<i>(_columns).prefix(_size);
+        }
+
+        /** @overload */
+        template<std::size_t i> ArrayView<const Type<i>> column() const {
+            return Implementation::soaArrayColumn<i>(_columns).prefix(_size);
+        }
+
+        /**
+         * @brief Reserve given capacity
+         * @return New capacity
+         *
+         * If @p capacity is not larger than current @ref capacity(), does
+         * nothing. Otherwise reallocates all columns to exactly @p capacity
+         * items, preserving their contents.
+         */
+        std::size_t reserve(std::size_t capacity) {
+            if(capacity > this->capacity())
+                reallocate(typename Implementation::GenerateSequence<sizeof...(Types)>::Type{}, capacity);
+            return this->capacity();
+        }
+
+        /**
+         * @brief Resize the container
+         *
+         * If @p size is larger than current @ref size(), the new items are
+         * value-initialized, reallocating if the capacity isn't large
+         * enough. If it's smaller, items at the end are dropped and the
+         * capacity stays the same.
+         * @see @ref resize(Corrade::NoInitT, std::size_t)
+         */
+        void resize(std::size_t size) {
+            const std::size_t oldSize = _size;
+            resize(Corrade::NoInit, size);
+            if(size > oldSize)
+                valueInitialize(typename Implementation::GenerateSequence<sizeof...(Types)>::Type{}, oldSize, size);
+        }
+
+        /**
+         * @brief Resize the container without initializing new items
+         *
+         * Like @ref resize(std::size_t), but the new items are left
+         * uninitialized.
+         */
+        void resize(Corrade::NoInitT, std::size_t size) {
+            grow(size);
+            _size = size;
+        }
+
+        /**
+         * @brief Append an item
+         * @return Index of the appended item
+         *
+         * Copies @p values to the end of corresponding columns, reallocating
+         * if the capacity isn't large enough.
+         */
+        std::size_t append(const Types&... values) {
+            const std::size_t index = append(Corrade::NoInit, 1);
+            set(typename Implementation::GenerateSequence<sizeof...(Types)>::Type{}, index, values...);
+            return index;
+        }
+
+        /**
+         * @brief Append items without initializing them
+         * @return Index of the first appended item
+         *
+         * Grows the container by @p count items, reallocating if the capacity
+         * isn't large enough. The new items are left uninitialized and are
+         * expected to be filled through @ref column() afterwards.
+         */
+        std::size_t append(Corrade::NoInitT, std::size_t count) {
+            const std::size_t index = _size;
+            grow(_size + count);
+            _size += count;
+            return index;
+        }
+
+        /**
+         * @brief Remove an item, without preserving order
+         *
+         * Moves the last item in each column to @p index and shrinks the size
+         * by one. Expects that @p index is less than @ref size(). Never
+         * reallocates.
+         * @see @ref removeSuffix()
+         */
+        void removeUnordered(std::size_t index) {
+            CORRADE_DEBUG_ASSERT(index < _size,
+                "Containers::SoaArray::removeUnordered(): index" << index << "out of range for" << _size << "items", );
+            --_size;
+            if(index != _size)
+                copyItem(typename Implementation::GenerateSequence<sizeof...(Types)>::Type{}, _size, index);
+        }
+
+        /**
+         * @brief Remove items from the end
+         *
+         * Expects that @p count is not larger than @ref size(). Never
+         * reallocates.
+         * @see @ref clear()
+         */
+        void removeSuffix(std::size_t count) {
+            CORRADE_DEBUG_ASSERT(count <= _size,
+                "Containers::SoaArray::removeSuffix(): can't remove" << count << "items from a container of size" << _size, );
+            _size -= count;
+        }
+
+        /**
+         * @brief Clear the container
+         *
+         * Sets the size to zero, the capacity stays the same.
+         */
+        void clear() { _size = 0; }
+
+        /**
+         * @brief Shrink the capacity to the size
+         *
+         * If @ref capacity() is larger than @ref size(), reallocates all
+         * columns to exactly @ref size() items.
+         */
+        void shrink() {
+            if(capacity() > _size)
+                reallocate(typename Implementation::GenerateSequence<sizeof...(Types)>::Type{}, _size);
+        }
+
+    private:
+        typedef Implementation::SoaArrayColumns<typename Implementation::GenerateSequence<sizeof...(Types)>::Type, Types...> Columns;
+
+        void grow(std::size_t desired) {
+            const std::size_t current = capacity();
+            if(desired <= current) return;
+            const std::size_t grown = current < 8 ? 8 : current + current/2;
+            reallocate(typename Implementation::GenerateSequence<sizeof...(Types)>::Type{}, grown > desired ? grown : desired);
+        }
+
+        template<std::size_t ...sequence> void reallocate(Implementation::Sequence<sequence...>, std::size_t capacity) {
+            Columns columns;
+            ArrayTuple data{{
+                ArrayTuple::Item{Corrade::NoInit, capacity, Implementation::soaArrayColumn<sequence>(columns)}...
+            }};
+
+            /* Copy the existing contents over. Guarding against zero size
+               to not call memcpy() with null pointers. */
+            if(_size) {
+                int expand[]{(std::memcpy(Implementation::soaArrayColumn<sequence>(columns).data(), Implementation::soaArrayColumn<sequence>(_columns).data(), _size*sizeof(Type<sequence>)), 0)...};
+                static_cast<void>(expand);
+            }
+
+            _data = Utility::move(data);
+            _columns = columns;
+        }
+
+        template<std::size_t ...sequence> void valueInitialize(Implementation::Sequence<sequence...>, std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i) {
+                int expand[]{(Implementation::construct(Implementation::soaArrayColumn<sequence>(_columns)[i]), 0)...};
+                static_cast<void>(expand);
+            }
+        }
+
+        template<std::size_t ...sequence> void set(Implementation::Sequence<sequence...>, std::size_t index, const Types&... values) {
+            int expand[]{(Implementation::soaArrayColumn<sequence>(_columns)[index] = values, 0)...};
+            static_cast<void>(expand);
+        }
+
+        template<std::size_t ...sequence> void copyItem(Implementation::Sequence<sequence...>, std::size_t from, std::size_t to) {
+            int expand[]{(Implementation::soaArrayColumn<sequence>(_columns)[to] = Implementation::soaArrayColumn<sequence>(_columns)[from], 0)...};
+            static_cast<void>(expand);
+        }
+
+        ArrayTuple _data;
+        Columns _columns;
+        std::size_t _size;
+};
+
+}}
+
+#endif
@@ -27,6 +27,7 @@
 #include <functional>
 
 #include "Corrade/Containers/Function.h"
+#include "Corrade/Containers/InlineFunction.h"
 #ifdef CORRADE_MSVC2015_COMPATIBILITY
 #include "Corrade/Containers/StaticArray.h"
 #endif
@@ -50,6 +51,9 @@ struct FunctionBenchmark: TestSuite::Tester {
     void functionStatefulLambda();
     void functionLargeStatefulLambda();
 
+    void inlineFunctionStatefulLambda();
+    void inlineFunctionLargeStatefulLambda();
+
     void stlFunctionPointer();
     void stlFunctionPointerInline();
     void stlFunctionMemberPointer();
@@ -57,6 +61,10 @@ struct FunctionBenchmark: TestSuite::Tester {
     void stlFunctionLambda();
     void stlFunctionStatefulLambda();
     void stlFunctionLargeStatefulLambda();
+
+    void constructFunctionLargeStatefulLambda();
+    void constructInlineFunctionLargeStatefulLambda();
+    void constructStlFunctionLargeStatefulLambda();
 };
 
 FunctionBenchmark::FunctionBenchmark() {
@@ -73,13 +81,20 @@ FunctionBenchmark::FunctionBenchmark() {
                    &FunctionBenchmark::functionStatefulLambda,
                    &FunctionBenchmark::functionLargeStatefulLambda,
 
+                   &FunctionBenchmark::inlineFunctionStatefulLambda,
+                   &FunctionBenchmark::inlineFunctionLargeStatefulLambda,
+
                    &FunctionBenchmark::stlFunctionPointer,
                    &FunctionBenchmark::stlFunctionPointerInline,
                    &FunctionBenchmark::stlFunctionMemberPointer,
                    &FunctionBenchmark::stlFunctionMemberPointerInline,
                    &FunctionBenchmark::stlFunctionLambda,
                    &FunctionBenchmark::stlFunctionStatefulLambda,
-                   &FunctionBenchmark::stlFunctionLargeStatefulLambda}, 100);
+                   &FunctionBenchmark::stlFunctionLargeStatefulLambda,
+
+                   &FunctionBenchmark::constructFunctionLargeStatefulLambda,
+                   &FunctionBenchmark::constructInlineFunctionLargeStatefulLambda,
+                   &FunctionBenchmark::constructStlFunctionLargeStatefulLambda}, 100);
 }
 
 constexpr int Repeats = 100000;
@@ -242,6 +257,37 @@ void FunctionBenchmark::functionLargeStatefulLambda() {
     CORRADE_COMPARE(a, Repeats*8);
 }
 
+CORRADE_NEVER_INLINE void call(InlineFunction<void(), 48>& function) {
+    function();
+}
+
+void FunctionBenchmark::inlineFunctionStatefulLambda() {
+    int a = 0;
+    InlineFunction<void(), 48> f = [&a]{ a += 12; };
+
+    CORRADE_BENCHMARK(Repeats)
+        call(f);
+    CORRADE_COMPARE(a, Repeats*12);
+}
+
+void FunctionBenchmark::inlineFunctionLargeStatefulLambda() {
+    int a = 0, b = 0;
+    /* MSVC 2015 cannot capture arrays by value, let's capture a wrapper struct
+       instead */
+    #ifdef CORRADE_MSVC2015_COMPATIBILITY
+    Containers::StaticArray<5, int*> ptrs
+    #else
+    int* ptrs[5]
+    #endif
+        {&b, &a, &b, nullptr, &a};
+    /* Same size as in functionLargeStatefulLambda(), but stored inline */
+    InlineFunction<void(), 48> f = [ptrs]{ *ptrs[1] += 13; };
+
+    CORRADE_BENCHMARK(Repeats)
+        call(f);
+    CORRADE_COMPARE(a, Repeats*13);
+}
+
 void FunctionBenchmark::stlFunctionPointer() {
     int a = 0;
     std::function<void(int&)> f = increment2;
@@ -321,6 +367,58 @@ void FunctionBenchmark::stlFunctionLargeStatefulLambda() {
     CORRADE_COMPARE(a, Repeats*11);
 }
 
+/* The construction benchmarks create a new instance in each iteration and
+   call it once so the compiler can't optimize it away. Compared to the call
+   benchmarks above, this measures mainly the allocation overhead. */
+
+void FunctionBenchmark::constructFunctionLargeStatefulLambda() {
+    int a = 0, b = 0;
+    #ifdef CORRADE_MSVC2015_COMPATIBILITY
+    Containers::StaticArray<5, int*> ptrs
+    #else
+    int* ptrs[5]
+    #endif
+        {&b, &a, &b, nullptr, &a};
+
+    CORRADE_BENCHMARK(Repeats) {
+        Function<void()> f = [ptrs]{ *ptrs[1] += 14; };
+        call(f);
+    }
+    CORRADE_COMPARE(a, Repeats*14);
+}
+
+void FunctionBenchmark::constructInlineFunctionLargeStatefulLambda() {
+    int a = 0, b = 0;
+    #ifdef CORRADE_MSVC2015_COMPATIBILITY
+    Containers::StaticArray<5, int*> ptrs
+    #else
+    int* ptrs[5]
+    #endif
+        {&b, &a, &b, nullptr, &a};
+
+    CORRADE_BENCHMARK(Repeats) {
+        InlineFunction<void(), 48> f = [ptrs]{ *ptrs[1] += 15; };
+        call(f);
+    }
+    CORRADE_COMPARE(a, Repeats*15);
+}
+
+void FunctionBenchmark::constructStlFunctionLargeStatefulLambda() {
+    int a = 0, b = 0;
+    #ifdef CORRADE_MSVC2015_COMPATIBILITY
+    Containers::StaticArray<5, int*> ptrs
+    #else
+    int* ptrs[5]
+    #endif
+        {&b, &a, &b, nullptr, &a};
+
+    CORRADE_BENCHMARK(Repeats) {
+        std::function<void()> f = [ptrs]{ *ptrs[1] += 16; };
+        call(f);
+    }
+    CORRADE_COMPARE(a, Repeats*16);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::Containers::Test::FunctionBenchmark)
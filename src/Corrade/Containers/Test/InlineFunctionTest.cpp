@@ -0,0 +1,358 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/InlineFunction.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct InlineFunctionTest: TestSuite::Tester {
+    explicit InlineFunctionTest();
+
+    void resetCounters();
+
+    void constructDefault();
+    void constructFreeFunction();
+    void constructFreeFunctionNull();
+    void constructMemberFunction();
+    void constructMemberFunctionLvalue();
+    void constructMemberFunctionConst();
+    void constructMemberFunctionConstLvalue();
+    void constructMemberFunctionNull();
+    void constructMemberFunctionInBase();
+
+    void constructStatelessLambda();
+    void constructStatefulTrivialLambda();
+    void constructStatefulNonTrivialLambda();
+    void constructMoveOnlyFunctor();
+
+    void constructCopy();
+    void constructMove();
+    void constructMoveTrivial();
+    void moveAssign();
+    void moveAssignSelf();
+
+    void moveOnlyArgumentResult();
+};
+
+InlineFunctionTest::InlineFunctionTest() {
+    addTests({&InlineFunctionTest::constructDefault,
+              &InlineFunctionTest::constructFreeFunction,
+              &InlineFunctionTest::constructFreeFunctionNull,
+              &InlineFunctionTest::constructMemberFunction,
+              &InlineFunctionTest::constructMemberFunctionLvalue,
+              &InlineFunctionTest::constructMemberFunctionConst,
+              &InlineFunctionTest::constructMemberFunctionConstLvalue,
+              &InlineFunctionTest::constructMemberFunctionNull,
+              &InlineFunctionTest::constructMemberFunctionInBase,
+
+              &InlineFunctionTest::constructStatelessLambda,
+              &InlineFunctionTest::constructStatefulTrivialLambda,
+              &InlineFunctionTest::constructStatefulNonTrivialLambda});
+
+    addTests({&InlineFunctionTest::constructMoveOnlyFunctor},
+             &InlineFunctionTest::resetCounters,
+             &InlineFunctionTest::resetCounters);
+
+    addTests({&InlineFunctionTest::constructCopy});
+
+    addTests({&InlineFunctionTest::constructMove,
+              &InlineFunctionTest::constructMoveTrivial,
+              &InlineFunctionTest::moveAssign,
+              &InlineFunctionTest::moveAssignSelf},
+             &InlineFunctionTest::resetCounters,
+             &InlineFunctionTest::resetCounters);
+
+    addTests({&InlineFunctionTest::moveOnlyArgumentResult});
+}
+
+struct MoveOnlyAccumulator {
+    static int constructed;
+    static int destructed;
+    static int moved;
+
+    explicit MoveOnlyAccumulator() noexcept { ++constructed; }
+    MoveOnlyAccumulator(const MoveOnlyAccumulator&) = delete;
+    MoveOnlyAccumulator(MoveOnlyAccumulator&& other) noexcept: a{other.a} {
+        ++constructed;
+        ++moved;
+    }
+    ~MoveOnlyAccumulator() { ++destructed; }
+
+    MoveOnlyAccumulator& operator=(const MoveOnlyAccumulator&) = delete;
+    /* Clang says this one is unused, but removing it could have undesirable
+       consequences, so just suppress the warning */
+    CORRADE_UNUSED MoveOnlyAccumulator& operator=(MoveOnlyAccumulator&& other) noexcept {
+        a = other.a;
+        ++moved;
+        return *this;
+    }
+
+    int operator()(int value) {
+        a += value;
+        return a;
+    }
+
+    int a = 13;
+};
+
+int MoveOnlyAccumulator::constructed = 0;
+int MoveOnlyAccumulator::destructed = 0;
+int MoveOnlyAccumulator::moved = 0;
+
+void InlineFunctionTest::resetCounters() {
+    MoveOnlyAccumulator::constructed = MoveOnlyAccumulator::destructed = MoveOnlyAccumulator::moved = 0;
+}
+
+void InlineFunctionTest::constructDefault() {
+    InlineFunction<int(int), 32> a;
+    InlineFunction<int(int), 32> b = nullptr;
+    CORRADE_VERIFY(!a);
+    CORRADE_VERIFY(!b);
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<InlineFunction<int(int), 32>>::value);
+    CORRADE_VERIFY(std::is_nothrow_constructible<InlineFunction<int(int), 32>, std::nullptr_t>::value);
+
+    /* Implicit construction from nullptr is allowed */
+    CORRADE_VERIFY(std::is_convertible<std::nullptr_t, InlineFunction<int(int), 32>>::value);
+}
+
+int increment(int value) { return value + 1; }
+
+void InlineFunctionTest::constructFreeFunction() {
+    InlineFunction<int(int), 8> a = increment;
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a(3), 4);
+
+    /* The storage is exactly the size given plus the two pointers */
+    CORRADE_COMPARE(sizeof(InlineFunction<int(int), 48>), 48 + 2*sizeof(void*));
+}
+
+void InlineFunctionTest::constructFreeFunctionNull() {
+    int(*f)(int) = nullptr;
+    InlineFunction<int(int), 8> a = f;
+    CORRADE_VERIFY(!a);
+}
+
+struct Adder {
+    int add(int b) { return a += b; }
+    int addLvalue(int b) & { return a += b; }
+    int addConst(int b) const { return a + b; }
+    int addConstLvalue(int b) const & { return a + b*2; }
+
+    int a;
+};
+
+void InlineFunctionTest::constructMemberFunction() {
+    Adder adder{5};
+    InlineFunction<int(int), 3*sizeof(void*)> a{adder, &Adder::add};
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a(3), 8);
+    CORRADE_COMPARE(adder.a, 8);
+}
+
+void InlineFunctionTest::constructMemberFunctionLvalue() {
+    Adder adder{5};
+    InlineFunction<int(int), 3*sizeof(void*)> a{adder, &Adder::addLvalue};
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a(4), 9);
+    CORRADE_COMPARE(adder.a, 9);
+}
+
+void InlineFunctionTest::constructMemberFunctionConst() {
+    const Adder adder{5};
+    InlineFunction<int(int), 3*sizeof(void*)> a{adder, &Adder::addConst};
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a(4), 9);
+}
+
+void InlineFunctionTest::constructMemberFunctionConstLvalue() {
+    const Adder adder{5};
+    InlineFunction<int(int), 3*sizeof(void*)> a{adder, &Adder::addConstLvalue};
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a(4), 13);
+}
+
+void InlineFunctionTest::constructMemberFunctionNull() {
+    Adder adder{5};
+    int(Adder::*f)(int) = nullptr;
+    InlineFunction<int(int), 3*sizeof(void*)> a{adder, f};
+    InlineFunction<int(int), 3*sizeof(void*)> b{adder, nullptr};
+    CORRADE_VERIFY(!a);
+    CORRADE_VERIFY(!b);
+}
+
+struct DerivedAdder: Adder {
+    explicit DerivedAdder(int a): Adder{a} {}
+};
+
+void InlineFunctionTest::constructMemberFunctionInBase() {
+    DerivedAdder adder{7};
+    InlineFunction<int(int), 3*sizeof(void*)> a{adder, &DerivedAdder::add};
+    CORRADE_COMPARE(a(1), 8);
+    CORRADE_COMPARE(adder.a, 8);
+}
+
+void InlineFunctionTest::constructStatelessLambda() {
+    InlineFunction<int(int), 8> a = [](int value) { return value*3; };
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a(5), 15);
+}
+
+void InlineFunctionTest::constructStatefulTrivialLambda() {
+    /* Would be allocated by a Function */
+    int a = 0, b = 0;
+    int* ptrs[6]{&a, &b, &a, &b, &a, &b};
+    InlineFunction<void(int), 48> f = [ptrs](int value) {
+        for(int* i: ptrs) *i += value;
+    };
+    CORRADE_VERIFY(f);
+    f(2);
+    CORRADE_COMPARE(a, 6);
+    CORRADE_COMPARE(b, 6);
+}
+
+void InlineFunctionTest::constructStatefulNonTrivialLambda() {
+    String name = "hello, this is a string that's definitely allocated";
+    InlineFunction<bool(StringView), sizeof(String)> f = [name](StringView other) {
+        return name == other;
+    };
+    CORRADE_VERIFY(f);
+    CORRADE_VERIFY(f("hello, this is a string that's definitely allocated"));
+    CORRADE_VERIFY(!f("hello"));
+}
+
+void InlineFunctionTest::constructMoveOnlyFunctor() {
+    {
+        InlineFunction<int(int), 16> a = MoveOnlyAccumulator{};
+        CORRADE_VERIFY(a);
+        CORRADE_COMPARE(a(5), 18);
+        CORRADE_COMPARE(a(2), 20);
+
+        /* One temporary, one move into the storage */
+        CORRADE_COMPARE(MoveOnlyAccumulator::constructed, 2);
+        CORRADE_COMPARE(MoveOnlyAccumulator::moved, 1);
+        CORRADE_COMPARE(MoveOnlyAccumulator::destructed, 1);
+    }
+
+    CORRADE_COMPARE(MoveOnlyAccumulator::constructed, 2);
+    CORRADE_COMPARE(MoveOnlyAccumulator::destructed, 2);
+}
+
+void InlineFunctionTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<InlineFunction<int(int), 32>>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<InlineFunction<int(int), 32>>::value);
+}
+
+void InlineFunctionTest::constructMove() {
+    {
+        InlineFunction<int(int), 16> a = MoveOnlyAccumulator{};
+        CORRADE_COMPARE(a(2), 15);
+
+        InlineFunction<int(int), 16> b = Utility::move(a);
+        CORRADE_VERIFY(!a);
+        CORRADE_VERIFY(b);
+        CORRADE_COMPARE(b(3), 18);
+
+        CORRADE_COMPARE(MoveOnlyAccumulator::constructed, 3);
+        CORRADE_COMPARE(MoveOnlyAccumulator::moved, 2);
+        /* The temporary and the moved-out instance */
+        CORRADE_COMPARE(MoveOnlyAccumulator::destructed, 2);
+    }
+
+    CORRADE_COMPARE(MoveOnlyAccumulator::constructed, 3);
+    CORRADE_COMPARE(MoveOnlyAccumulator::destructed, 3);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<InlineFunction<int(int), 32>>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<InlineFunction<int(int), 32>>::value);
+}
+
+void InlineFunctionTest::constructMoveTrivial() {
+    int a = 0;
+    InlineFunction<void(), 32> f = [&a]{ a += 5; };
+    InlineFunction<void(), 32> g = Utility::move(f);
+    CORRADE_VERIFY(!f);
+    CORRADE_VERIFY(g);
+    g();
+    CORRADE_COMPARE(a, 5);
+}
+
+void InlineFunctionTest::moveAssign() {
+    {
+        InlineFunction<int(int), 16> a = MoveOnlyAccumulator{};
+        InlineFunction<int(int), 16> b = MoveOnlyAccumulator{};
+        CORRADE_COMPARE(a(2), 15);
+        CORRADE_COMPARE(b(7), 20);
+
+        b = Utility::move(a);
+        CORRADE_VERIFY(!a);
+        CORRADE_VERIFY(b);
+        CORRADE_COMPARE(b(1), 16);
+
+        /* Two temporaries, the original b destructed, a moved out */
+        CORRADE_COMPARE(MoveOnlyAccumulator::constructed, 5);
+        CORRADE_COMPARE(MoveOnlyAccumulator::destructed, 4);
+
+        /* Assigning a function pointer destructs the previous state */
+        b = increment;
+        CORRADE_COMPARE(b(1), 2);
+        CORRADE_COMPARE(MoveOnlyAccumulator::destructed, 5);
+    }
+
+    CORRADE_COMPARE(MoveOnlyAccumulator::constructed, 5);
+    CORRADE_COMPARE(MoveOnlyAccumulator::destructed, 5);
+}
+
+void InlineFunctionTest::moveAssignSelf() {
+    InlineFunction<int(int), 16> a = MoveOnlyAccumulator{};
+    InlineFunction<int(int), 16>& aRef = a;
+    a = Utility::move(aRef);
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a(2), 15);
+}
+
+struct MoveOnly {
+    explicit MoveOnly(int a): a{a} {}
+    MoveOnly(const MoveOnly&) = delete;
+    MoveOnly(MoveOnly&&) noexcept = default;
+    MoveOnly& operator=(const MoveOnly&) = delete;
+    MoveOnly& operator=(MoveOnly&&) noexcept = default;
+
+    int a;
+};
+
+void InlineFunctionTest::moveOnlyArgumentResult() {
+    int b = 3;
+    InlineFunction<MoveOnly(MoveOnly&&), 16> a = [b](MoveOnly&& value) {
+        return MoveOnly{value.a*b};
+    };
+    CORRADE_COMPARE(a(MoveOnly{5}).a, 15);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::InlineFunctionTest)
@@ -0,0 +1,372 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/SoaArray.h"
+#include "Corrade/Containers/StridedArrayView.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+
+namespace Corrade { namespace Containers { namespace Test { namespace {
+
+struct SoaArrayTest: TestSuite::Tester {
+    explicit SoaArrayTest();
+
+    void constructDefault();
+    void constructValueInit();
+    void constructNoInit();
+    void constructCopy();
+    void constructMove();
+
+    void layout();
+
+    void reserve();
+    void resize();
+    void resizeNoInit();
+    void append();
+    void appendNoInit();
+    void appendGrow();
+
+    void removeUnordered();
+    void removeUnorderedLast();
+    void removeUnorderedInvalid();
+    void removeSuffix();
+    void removeSuffixInvalid();
+    void clear();
+    void shrink();
+
+    void stridedColumn();
+};
+
+SoaArrayTest::SoaArrayTest() {
+    addTests({&SoaArrayTest::constructDefault,
+              &SoaArrayTest::constructValueInit,
+              &SoaArrayTest::constructNoInit,
+              &SoaArrayTest::constructCopy,
+              &SoaArrayTest::constructMove,
+
+              &SoaArrayTest::layout,
+
+              &SoaArrayTest::reserve,
+              &SoaArrayTest::resize,
+              &SoaArrayTest::resizeNoInit,
+              &SoaArrayTest::append,
+              &SoaArrayTest::appendNoInit,
+              &SoaArrayTest::appendGrow,
+
+              &SoaArrayTest::removeUnordered,
+              &SoaArrayTest::removeUnorderedLast,
+              &SoaArrayTest::removeUnorderedInvalid,
+              &SoaArrayTest::removeSuffix,
+              &SoaArrayTest::removeSuffixInvalid,
+              &SoaArrayTest::clear,
+              &SoaArrayTest::shrink,
+
+              &SoaArrayTest::stridedColumn});
+}
+
+struct Vec3 {
+    float x, y, z;
+};
+
+void SoaArrayTest::constructDefault() {
+    SoaArray<int, double> a;
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 0);
+    CORRADE_VERIFY(!a.column<0>().data());
+    CORRADE_VERIFY(!a.column<1>().data());
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<SoaArray<int, double>>::value);
+    CORRADE_COMPARE((SoaArray<int, double>::ColumnCount), 2);
+    CORRADE_VERIFY((std::is_same<SoaArray<int, double>::Type<1>, double>::value));
+}
+
+void SoaArrayTest::constructValueInit() {
+    SoaArray<int, char, double> a{Corrade::ValueInit, 3};
+    CORRADE_VERIFY(!a.isEmpty());
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.capacity(), 3);
+    CORRADE_COMPARE_AS(a.column<0>(), arrayView({0, 0, 0}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.column<1>(), arrayView({'\0', '\0', '\0'}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.column<2>(), arrayView({0.0, 0.0, 0.0}), TestSuite::Compare::Container);
+
+    /* Implicit ValueInit */
+    SoaArray<int, char, double> b{2};
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE_AS(b.column<0>(), arrayView({0, 0}), TestSuite::Compare::Container);
+}
+
+void SoaArrayTest::constructNoInit() {
+    SoaArray<int, char> a{Corrade::NoInit, 5};
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(a.capacity(), 5);
+    CORRADE_COMPARE(a.column<0>().size(), 5);
+    CORRADE_COMPARE(a.column<1>().size(), 5);
+}
+
+void SoaArrayTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<SoaArray<int, char>>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<SoaArray<int, char>>::value);
+}
+
+void SoaArrayTest::constructMove() {
+    SoaArray<int, char> a;
+    a.append(1, 'a');
+    a.append(2, 'b');
+    const int* data = a.column<0>().data();
+
+    SoaArray<int, char> b = Utility::move(a);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 0);
+    CORRADE_VERIFY(!a.column<0>().data());
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b.column<0>().data(), data);
+    CORRADE_COMPARE_AS(b.column<0>(), arrayView({1, 2}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(b.column<1>(), arrayView({'a', 'b'}), TestSuite::Compare::Container);
+
+    SoaArray<int, char> c{3};
+    c = Utility::move(b);
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(c.size(), 2);
+    CORRADE_COMPARE(c.column<0>().data(), data);
+    CORRADE_COMPARE_AS(c.column<1>(), arrayView({'a', 'b'}), TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<SoaArray<int, char>>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<SoaArray<int, char>>::value);
+}
+
+void SoaArrayTest::layout() {
+    SoaArray<char, double, short> a{Corrade::NoInit, 3};
+
+    /* All columns are in a single allocation, one after another, each aligned
+       for its type */
+    const char* column0 = a.column<0>().data();
+    const char* column1 = reinterpret_cast<const char*>(a.column<1>().data());
+    const char* column2 = reinterpret_cast<const char*>(a.column<2>().data());
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(column1) % alignof(double), 0);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(column2) % alignof(short), 0);
+    CORRADE_COMPARE(column1 - column0, 8);
+    CORRADE_COMPARE(column2 - column1, 3*8);
+}
+
+void SoaArrayTest::reserve() {
+    SoaArray<int, float> a;
+    a.append(3, 1.5f);
+    CORRADE_COMPARE(a.reserve(100), 100);
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(a.capacity(), 100);
+    CORRADE_COMPARE_AS(a.column<0>(), arrayView({3}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.column<1>(), arrayView({1.5f}), TestSuite::Compare::Container);
+
+    /* Reserving less is a no-op */
+    const int* data = a.column<0>().data();
+    CORRADE_COMPARE(a.reserve(50), 100);
+    CORRADE_COMPARE(a.column<0>().data(), data);
+}
+
+void SoaArrayTest::resize() {
+    SoaArray<int, float> a;
+    a.append(3, 1.5f);
+    a.resize(3);
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE_AS(a.column<0>(), arrayView({3, 0, 0}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.column<1>(), arrayView({1.5f, 0.0f, 0.0f}), TestSuite::Compare::Container);
+
+    /* Shrinking keeps the capacity */
+    const std::size_t capacity = a.capacity();
+    a.resize(1);
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(a.capacity(), capacity);
+    CORRADE_COMPARE_AS(a.column<0>(), arrayView({3}), TestSuite::Compare::Container);
+}
+
+void SoaArrayTest::resizeNoInit() {
+    SoaArray<int, float> a;
+    a.append(3, 1.5f);
+    a.resize(Corrade::NoInit, 20);
+    CORRADE_COMPARE(a.size(), 20);
+    CORRADE_COMPARE(a.capacity(), 20);
+    CORRADE_COMPARE(a.column<0>()[0], 3);
+    CORRADE_COMPARE(a.column<1>()[0], 1.5f);
+}
+
+void SoaArrayTest::append() {
+    SoaArray<int, char, Vec3> a;
+    CORRADE_COMPARE(a.append(1, 'a', Vec3{1.0f, 2.0f, 3.0f}), 0);
+    CORRADE_COMPARE(a.append(2, 'b', Vec3{4.0f, 5.0f, 6.0f}), 1);
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a.capacity(), 8);
+    CORRADE_COMPARE_AS(a.column<0>(), arrayView({1, 2}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.column<1>(), arrayView({'a', 'b'}), TestSuite::Compare::Container);
+    CORRADE_COMPARE(a.column<2>()[1].y, 5.0f);
+}
+
+void SoaArrayTest::appendNoInit() {
+    SoaArray<int, char> a;
+    a.append(1, 'a');
+    CORRADE_COMPARE(a.append(Corrade::NoInit, 3), 1);
+    CORRADE_COMPARE(a.size(), 4);
+    for(std::size_t i = 1; i != 4; ++i) {
+        a.column<0>()[i] = 10*i;
+        a.column<1>()[i] = 'a' + i;
+    }
+    CORRADE_COMPARE_AS(a.column<0>(), arrayView({1, 10, 20, 30}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.column<1>(), arrayView({'a', 'b', 'c', 'd'}), TestSuite::Compare::Container);
+}
+
+void SoaArrayTest::appendGrow() {
+    SoaArray<int, double> a;
+    const int* data = nullptr;
+    std::size_t reallocations = 0;
+    for(int i = 0; i != 100; ++i) {
+        a.append(i, i*0.5);
+        if(a.column<0>().data() != data) {
+            data = a.column<0>().data();
+            ++reallocations;
+        }
+    }
+
+    /* Starts with 8, then grows by 50% -- 8, 12, 18, 27, 40, 60, 90, 135 */
+    CORRADE_COMPARE(reallocations, 8);
+    CORRADE_COMPARE(a.capacity(), 135);
+    CORRADE_COMPARE(a.size(), 100);
+    for(int i = 0; i != 100; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(a.column<0>()[i], i);
+        CORRADE_COMPARE(a.column<1>()[i], i*0.5);
+    }
+}
+
+void SoaArrayTest::removeUnordered() {
+    SoaArray<int, char> a;
+    a.append(1, 'a');
+    a.append(2, 'b');
+    a.append(3, 'c');
+    a.append(4, 'd');
+    const std::size_t capacity = a.capacity();
+
+    a.removeUnordered(1);
+    CORRADE_COMPARE(a.capacity(), capacity);
+    CORRADE_COMPARE_AS(a.column<0>(), arrayView({1, 4, 3}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.column<1>(), arrayView({'a', 'd', 'c'}), TestSuite::Compare::Container);
+
+    a.removeUnordered(0);
+    CORRADE_COMPARE_AS(a.column<0>(), arrayView({3, 4}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.column<1>(), arrayView({'c', 'd'}), TestSuite::Compare::Container);
+}
+
+void SoaArrayTest::removeUnorderedLast() {
+    SoaArray<int, char> a;
+    a.append(1, 'a');
+    a.append(2, 'b');
+
+    a.removeUnordered(1);
+    CORRADE_COMPARE_AS(a.column<0>(), arrayView({1}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.column<1>(), arrayView({'a'}), TestSuite::Compare::Container);
+
+    a.removeUnordered(0);
+    CORRADE_VERIFY(a.isEmpty());
+}
+
+void SoaArrayTest::removeUnorderedInvalid() {
+    CORRADE_SKIP_IF_NO_DEBUG_ASSERT();
+
+    SoaArray<int, char> a{3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    a.removeUnordered(3);
+    CORRADE_COMPARE(out, "Containers::SoaArray::removeUnordered(): index 3 out of range for 3 items\n");
+}
+
+void SoaArrayTest::removeSuffix() {
+    SoaArray<int, char> a;
+    a.append(1, 'a');
+    a.append(2, 'b');
+    a.append(3, 'c');
+
+    a.removeSuffix(2);
+    CORRADE_COMPARE_AS(a.column<0>(), arrayView({1}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.column<1>(), arrayView({'a'}), TestSuite::Compare::Container);
+}
+
+void SoaArrayTest::removeSuffixInvalid() {
+    CORRADE_SKIP_IF_NO_DEBUG_ASSERT();
+
+    SoaArray<int, char> a{3};
+
+    Containers::String out;
+    Error redirectError{&out};
+    a.removeSuffix(4);
+    CORRADE_COMPARE(out, "Containers::SoaArray::removeSuffix(): can't remove 4 items from a container of size 3\n");
+}
+
+void SoaArrayTest::clear() {
+    SoaArray<int, char> a{5};
+    a.clear();
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(a.capacity(), 5);
+}
+
+void SoaArrayTest::shrink() {
+    SoaArray<int, char> a;
+    a.append(1, 'a');
+    a.append(2, 'b');
+    CORRADE_COMPARE(a.capacity(), 8);
+
+    a.shrink();
+    CORRADE_COMPARE(a.capacity(), 2);
+    CORRADE_COMPARE_AS(a.column<0>(), arrayView({1, 2}), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.column<1>(), arrayView({'a', 'b'}), TestSuite::Compare::Container);
+
+    /* Shrinking an empty container frees everything */
+    a.clear();
+    a.shrink();
+    CORRADE_COMPARE(a.capacity(), 0);
+}
+
+void SoaArrayTest::stridedColumn() {
+    SoaArray<Vec3, int> a;
+    a.append(Vec3{1.0f, 2.0f, 3.0f}, 5);
+    a.append(Vec3{4.0f, 5.0f, 6.0f}, 6);
+
+    StridedArrayView1D<float> y = stridedArrayView(a.column<0>()).slice(&Vec3::y);
+    CORRADE_COMPARE(y.size(), 2);
+    CORRADE_COMPARE(y.stride(), sizeof(Vec3));
+    CORRADE_COMPARE(y[0], 2.0f);
+    CORRADE_COMPARE(y[1], 5.0f);
+
+    /* Implicit conversion */
+    StridedArrayView1D<const int> b = a.column<1>();
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b[0], 5);
+    CORRADE_COMPARE(b[1], 6);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::SoaArrayTest)
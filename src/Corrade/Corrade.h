@@ -143,6 +143,22 @@ performance tradeoffs.
 #define CORRADE_BUILD_CPU_RUNTIME_DISPATCH
 #undef CORRADE_BUILD_CPU_RUNTIME_DISPATCH
 
+/**
+@brief Build with startup profiling
+@m_since_latest
+
+Defined if the library is built with instrumentation recording timestamps of
+static plugin initialization and finalization in plugin managers, resource
+group registration and the first resource lookup. The recorded data are accessible through
+@ref Corrade::Utility::startupProfileEvents() "Utility::startupProfileEvents()"
+and @ref Corrade::Utility::startupProfileReport() "Utility::startupProfileReport()".
+If not defined, the instrumentation is compiled out completely and the above
+APIs return empty data.
+@see @ref building-corrade, @ref corrade-cmake
+*/
+#define CORRADE_BUILD_STARTUP_PROFILING
+#undef CORRADE_BUILD_STARTUP_PROFILING
+
 /**
 @brief Debug build
 
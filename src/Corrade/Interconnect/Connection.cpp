@@ -37,11 +37,11 @@ Connection::Connection(
     #ifdef CORRADE_BUILD_DEPRECATED
     Emitter& emitter,
     #endif
-    Implementation::SignalData signal, Implementation::ConnectionData& data):
+    Implementation::SignalData signal, const std::size_t id):
     #ifdef CORRADE_BUILD_DEPRECATED
     _emitter{emitter},
     #endif
-    _signal{signal}, _data{&data} {}
+    _signal{signal}, _id{id} {}
 
 #ifdef CORRADE_BUILD_DEPRECATED
 /* LCOV_EXCL_START */
@@ -174,7 +174,7 @@ class CORRADE_INTERCONNECT_EXPORT Connection {
             #ifdef CORRADE_BUILD_DEPRECATED
             Emitter& emitter,
             #endif
-            Implementation::SignalData signal, Implementation::ConnectionData& data);
+            Implementation::SignalData signal, std::size_t id);
 
     private:
         /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
@@ -191,8 +191,9 @@ class CORRADE_INTERCONNECT_EXPORT Connection {
         Containers::Reference<Emitter> _emitter;
         #endif
         Implementation::SignalData _signal;
-        /* Note: this might become dangling at some point */
-        Implementation::ConnectionData* _data;
+        /* Unique within the emitter, stays the same even if the connection
+           data get moved to a different location */
+        std::size_t _id;
 };
 
 }}
@@ -26,6 +26,8 @@
 
 #include "Emitter.h"
 
+#include <new>
+
 #include "Corrade/Interconnect/Receiver.h"
 #include "Corrade/Interconnect/Implementation/ReceiverConnection.h"
 #include "Corrade/Utility/Assert.h"
@@ -37,7 +39,7 @@ namespace Implementation {
 ConnectionData::ConnectionData(ConnectionData&& other) noexcept:
     storage(other.storage), /* GCC 4.8 needs () */
     call{other.call},
-    lastHandledSignal{other.lastHandledSignal},
+    id{other.id},
     type{other.type}
 {
     if(type == ConnectionType::FunctorWithDestructor)
@@ -48,7 +50,7 @@ ConnectionData& ConnectionData::operator=(ConnectionData&& other) noexcept {
     using std::swap;
     swap(storage, other.storage);
     swap(call, other.call);
-    swap(lastHandledSignal, other.lastHandledSignal);
+    swap(id, other.id);
     swap(type, other.type);
     return *this;
 }
@@ -60,49 +62,254 @@ ConnectionData::~ConnectionData() {
 
 }
 
-Emitter::Emitter(): _lastHandledSignal{0}, _connectionsChanged{false} {}
+namespace {
+
+/* Below this many signals a linear search is faster than a hash lookup */
+constexpr std::size_t SignalTableMinSize = 8;
+
+Implementation::ConnectionData* allocateConnectionData(const std::size_t capacity) {
+    return static_cast<Implementation::ConnectionData*>(::operator new(capacity*sizeof(Implementation::ConnectionData)));
+}
+
+/* Moves an item to a different location and destroys the original. Cheaper
+   than a move assignment, which swaps. */
+inline void relocate(Implementation::ConnectionData& from, Implementation::ConnectionData* to) {
+    new(to) Implementation::ConnectionData{std::move(from)};
+    from.~ConnectionData();
+}
+
+void destroyConnectionData(Implementation::SignalConnections& connections) {
+    for(std::size_t i = 0; i != connections.size; ++i)
+        connections.data[i].~ConnectionData();
+    ::operator delete(connections.data);
+}
+
+}
+
+Emitter::Emitter(): _connectionCount{}, _lastConnectionId{}, _emitDepth{}, _batchDepth{}, _compactionNeeded{} {}
 
 Emitter::~Emitter() {
-    for(auto& connection: _connections) disconnectFromReceiver(connection.second);
+    for(Implementation::SignalConnections& connections: _signals) {
+        for(std::size_t i = 0; i != connections.size; ++i)
+            if(connections.data[i].call) disconnectFromReceiver(connections.data[i]);
+        destroyConnectionData(connections);
+    }
+
+    /* Not really possible to have anything here unless the emitter gets
+       deleted in its own slot, which is not allowed, but be nice */
+    for(Implementation::ConnectionData* data: _retiredConnectionData)
+        ::operator delete(data);
+}
+
+std::size_t Emitter::connectionIndex(const Implementation::SignalConnections& connections, const std::size_t id) {
+    std::size_t begin = 0, end = connections.size;
+    while(begin < end) {
+        const std::size_t middle = begin + (end - begin)/2;
+        if(connections.data[middle].id < id) begin = middle + 1;
+        else end = middle;
+    }
+
+    /* Connections removed during an emission are still present, but treated
+       as not being there */
+    return begin != connections.size && connections.data[begin].id == id && connections.data[begin].call ? begin : connections.size;
 }
 
 bool Emitter::isConnected(const Connection& connection) const {
-    auto range = _connections.equal_range(connection._signal);
-    for(auto it = range.first; it != range.second; ++it)
-        if(&it->second == &*connection._data) return true;
+    const std::size_t index = signalIndex(connection._signal);
+    if(index == _signals.size()) return false;
+
+    const Implementation::SignalConnections& connections = _signals[index];
+    return connectionIndex(connections, connection._id) != connections.size;
+}
+
+void Emitter::signalTableInsertLast() {
+    if(_signals.size() <= SignalTableMinSize) return;
 
-    return false;
+    /* Keep the load factor at most one half. If there's not enough space,
+       create a new table with all signals, otherwise add just the last
+       one. */
+    std::size_t begin = _signals.size() - 1;
+    if(_signals.size()*2 > _signalTable.size()) {
+        std::size_t size = 1;
+        while(size < _signals.size()*4) size *= 2;
+        _signalTable = std::vector<std::uint32_t>(size);
+        begin = 0;
+    }
+
+    const std::size_t mask = _signalTable.size() - 1;
+    for(std::size_t index = begin; index != _signals.size(); ++index) {
+        std::size_t i = signalTableHash(_signals[index].signal) & mask;
+        while(_signalTable[i]) i = (i + 1) & mask;
+        _signalTable[i] = std::uint32_t(index + 1);
+    }
 }
 
-Implementation::ConnectionData& Emitter::connectInternal(const Implementation::SignalData& signal, Implementation::ConnectionData&& data) {
+std::size_t Emitter::connectInternal(const Implementation::SignalData& signal, Implementation::ConnectionData&& data) {
+    /* Add a new signal entry if there's none yet */
+    std::size_t index = signalIndex(signal);
+    if(index == _signals.size()) {
+        _signals.push_back(Implementation::SignalConnections{signal, nullptr, 0, 0, 0});
+        signalTableInsertLast();
+    }
+    Implementation::SignalConnections& connections = _signals[index];
+
+    /* Grow the storage if there's no space left */
+    if(connections.size == connections.capacity) {
+        const std::size_t capacity = connections.capacity ? connections.capacity*2 : 4;
+        Implementation::ConnectionData* const newData = allocateConnectionData(capacity);
+        for(std::size_t i = 0; i != connections.size; ++i)
+            relocate(connections.data[i], newData + i);
+
+        /* If we're in an emission, the slot being called may be stored in
+           the original location, so it can't be freed yet */
+        if(_emitDepth) {
+            _retiredConnectionData.push_back(connections.data);
+            _compactionNeeded = true;
+        } else ::operator delete(connections.data);
+
+        connections.data = newData;
+        connections.capacity = capacity;
+    }
+
     /* Add connection to emitter */
-    Implementation::ConnectionData& out =
-    _connections.emplace(signal, std::move(data))->second;
-    _connectionsChanged = true;
+    Implementation::ConnectionData& out = *new(connections.data + connections.size) Implementation::ConnectionData{std::move(data)};
+    out.id = ++_lastConnectionId;
+    ++connections.size;
+    ++connections.count;
+    ++_connectionCount;
 
     /* Add connection to receiver, if this is member function connection */
-    if(data.type == Implementation::ConnectionType::Member)
-        out.storage.member.receiver->_connections.emplace_back(*this, signal, out);
+    if(out.type == Implementation::ConnectionType::Member)
+        out.storage.member.receiver->_connections.emplace_back(*this, signal, out.id);
 
-    /* Return reference to the final position */
-    return out;
+    return out.id;
+}
+
+void Emitter::removeConnection(Implementation::SignalConnections& connections, const std::size_t i) {
+    --connections.count;
+    --_connectionCount;
+
+    /* If we're in an emission, only mark the connection as removed. Moving
+       the others around could affect the slot that's currently being called
+       and possibly the connection being removed is the one being called. */
+    if(_emitDepth) {
+        connections.data[i].call = nullptr;
+        _compactionNeeded = true;
+        return;
+    }
+
+    /* Otherwise shift the remaining connections to preserve their order, and
+       thus also the ID ordering */
+    connections.data[i].~ConnectionData();
+    for(std::size_t j = i + 1; j != connections.size; ++j)
+        relocate(connections.data[j], connections.data + j - 1);
+    --connections.size;
+}
+
+bool Emitter::disconnectInternal(const Implementation::SignalData& signal, const std::size_t id, const bool fromReceiver) {
+    const std::size_t index = signalIndex(signal);
+    if(index == _signals.size()) return false;
+
+    Implementation::SignalConnections& connections = _signals[index];
+    const std::size_t i = connectionIndex(connections, id);
+    if(i == connections.size) return false;
+
+    if(!fromReceiver) disconnectFromReceiver(connections.data[i]);
+    removeConnection(connections, i);
+    return true;
 }
 
 void Emitter::disconnectInternal(const Implementation::SignalData& signal) {
-    auto range = _connections.equal_range(signal);
-    for(auto it = range.first; it != range.second; ++it)
-        disconnectFromReceiver(it->second);
+    const std::size_t index = signalIndex(signal);
+    if(index == _signals.size()) return;
+
+    /* Going backwards so the removal doesn't need to shift anything if not
+       in an emission */
+    Implementation::SignalConnections& connections = _signals[index];
+    for(std::size_t i = connections.size; i != 0; --i) {
+        if(!connections.data[i - 1].call) continue;
 
-    _connections.erase(range.first, range.second);
-    _connectionsChanged = true;
+        disconnectFromReceiver(connections.data[i - 1]);
+        removeConnection(connections, i - 1);
+    }
 }
 
 void Emitter::disconnectAllSignals() {
-    for(auto it = _connections.begin(); it != _connections.end(); ++it)
-        disconnectFromReceiver(it->second);
+    for(Implementation::SignalConnections& connections: _signals) {
+        for(std::size_t i = connections.size; i != 0; --i) {
+            if(!connections.data[i - 1].call) continue;
+
+            disconnectFromReceiver(connections.data[i - 1]);
+            removeConnection(connections, i - 1);
+        }
+    }
+
+    /* Signal entries can't be removed during an emission, so only free them
+       if not in one */
+    if(!_emitDepth) {
+        for(Implementation::SignalConnections& connections: _signals)
+            ::operator delete(connections.data);
+        _signals.clear();
+        _signalTable.clear();
+    }
+}
+
+void Emitter::compactConnections() {
+    for(Implementation::SignalConnections& connections: _signals) {
+        std::size_t out = 0;
+        for(std::size_t i = 0; i != connections.size; ++i) {
+            if(!connections.data[i].call)
+                connections.data[i].~ConnectionData();
+            else if(out++ != i)
+                relocate(connections.data[i], connections.data + out - 1);
+        }
+        connections.size = out;
+    }
 
-    _connections.clear();
-    _connectionsChanged = true;
+    for(Implementation::ConnectionData* data: _retiredConnectionData)
+        ::operator delete(data);
+    _retiredConnectionData.clear();
+    _compactionNeeded = false;
+}
+
+void Emitter::beginBatch() {
+    ++_batchDepth;
+}
+
+void Emitter::endBatch() {
+    CORRADE_ASSERT(_batchDepth,
+        "Interconnect::Emitter::endBatch(): no batch in progress", );
+    if(--_batchDepth) return;
+
+    /* Take the emissions out first, as the slots may begin a new batch and
+       emit into it */
+    std::vector<Implementation::BatchedEmission> emissions;
+    std::swap(emissions, _batchedEmissions);
+    for(Implementation::BatchedEmission& emission: emissions) {
+        /* If a slot began a new batch and left it open, the remaining
+           emissions go to it, same as any other emission would */
+        if(_batchDepth)
+            batchEmission(emission.signal, std::move(emission.emit));
+        else
+            emission.emit(*this, emission.signal);
+    }
+
+    /* Reuse the allocation for the next batch, unless a new batch was started
+       and left open by the slots */
+    if(_batchedEmissions.empty()) {
+        emissions.clear();
+        std::swap(emissions, _batchedEmissions);
+    }
+}
+
+void Emitter::batchEmission(const Implementation::SignalData& signal, Containers::Function<void(Emitter&, const Implementation::SignalData&)>&& emit) {
+    for(Implementation::BatchedEmission& emission: _batchedEmissions) {
+        if(emission.signal != signal) continue;
+        emission.emit = std::move(emit);
+        return;
+    }
+
+    _batchedEmissions.push_back({signal, std::move(emit)});
 }
 
 void Emitter::disconnectFromReceiver(const Implementation::ConnectionData& data) {
@@ -110,7 +317,7 @@ void Emitter::disconnectFromReceiver(const Implementation::ConnectionData& data)
 
     auto& receiverConnections = data.storage.member.receiver->_connections;
     for(auto end = receiverConnections.end(), rit = receiverConnections.begin(); rit != end; ++rit) {
-        if(&*rit->data != &data) continue;
+        if(&*rit->emitter != this || rit->id != data.id) continue;
 
         receiverConnections.erase(rit);
         return;
@@ -121,17 +328,7 @@ void Emitter::disconnectFromReceiver(const Implementation::ConnectionData& data)
 }
 
 bool disconnect(Emitter& emitter, const Connection& connection) {
-    auto range = emitter._connections.equal_range(connection._signal);
-    for(auto it = range.first; it != range.second; ++it) {
-        if(&it->second != &*connection._data) continue;
-
-        emitter.disconnectFromReceiver(it->second);
-        emitter._connections.erase(it);
-        emitter._connectionsChanged = true;
-        return true;
-    }
-
-    return false;
+    return emitter.disconnectInternal(connection._signal, connection._id, false);
 }
 
 }}
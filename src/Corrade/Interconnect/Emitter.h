@@ -33,9 +33,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "Corrade/Containers/Function.h"
 #include "Corrade/Interconnect/Connection.h"
 #include "Corrade/Utility/Assert.h"
 
@@ -165,11 +166,44 @@ struct CORRADE_INTERCONNECT_EXPORT ConnectionData {
     ConnectionData& operator=(ConnectionData&& other) noexcept;
 
     Storage storage;
+    /* Null if the connection was removed during an emission and waits for the
+       emitter to remove it for real */
     void(*call)();
-    std::uint32_t lastHandledSignal{};
+    /* Unique within the emitter, increasing in order of connection */
+    std::size_t id{};
     ConnectionType type;
 };
 
+/* Connections of a single signal, stored contiguously in the order they were
+   made. Compared to a node-based hash map, emitting a signal is a linear walk
+   through memory and making a connection allocates only if the capacity is
+   exhausted. As IDs are increasing, a connection can be found by a binary
+   search. */
+struct SignalConnections {
+    SignalData signal;
+    ConnectionData* data;
+    /* Including connections removed during an emission */
+    std::size_t size;
+    std::size_t capacity;
+    /* Excluding connections removed during an emission */
+    std::size_t count;
+};
+
+/* Emission of a single signal deferred until the end of a batch. Only the
+   last one is remembered for each signal. The function captures just the
+   arguments, with the emitter and signal passed from outside, so for small
+   trivially copyable arguments it fits into the inline storage and doesn't
+   need a heap allocation. */
+struct BatchedEmission {
+    SignalData signal;
+    Containers::Function<void(Emitter&, const SignalData&)> emit;
+};
+
+/* Arguments have to be copied in order to be batched */
+template<class ...Args> struct IsBatchable;
+template<> struct IsBatchable<>: std::true_type {};
+template<class First, class ...Next> struct IsBatchable<First, Next...>: std::integral_constant<bool, std::is_copy_constructible<typename std::decay<First>::type>::value && IsBatchable<Next...>::value> {};
+
 }
 
 /**
@@ -279,6 +313,13 @@ object is destroyed.
     then called more than once.
 @note In the slot you can add or remove connections, however you can't
     @cpp delete @ce the emitter object, as it would lead to undefined behavior.
+    Slots connected to the signal that's being emitted get called in the same
+    emission, slots disconnected from it aren't called anymore.
+
+Slots connected to a particular signal are called in the order in which they
+were connected. Connections are stored in a contiguous array per signal,
+emitting a signal is thus just a linear walk through memory with no
+allocations involved.
 
 You can connect any signal, as long as the emitter object is of proper type ---
 in particular, referring a signal from a derived type while passing an emitter
@@ -344,6 +385,25 @@ Convoluted example:
 
 @snippet Interconnect.cpp Emitter-connect-receiver-multiple-inheritance
 
+@section Interconnect-Emitter-batching Batched emission
+
+If a signal is emitted at a high rate, for example when a property changes
+several thousand times during a single frame, calling all connected slots on
+every change may be unnecessarily expensive. Emissions done between
+@ref beginBatch() and @ref endBatch(), or during the lifetime of a @ref Batch
+instance, are coalesced --- each signal is emitted just once at the end of the
+outermost batch, with the arguments passed to the last emission:
+
+@snippet Interconnect.cpp Emitter-batch
+
+The arguments are copied when the signal is emitted inside the batch. Signals
+are emitted in the order in which they were first emitted in the batch, to
+slots that are connected at the time the batch ends. Emissions done by the
+slots at that point aren't batched anymore, unless a slot begins a new batch.
+Signals that aren't connected to any slot at the time of the emission are
+ignored even in a batch. Signals with arguments that aren't copy-constructible
+can't be batched and are delivered immediately.
+
 @see @ref Receiver, @ref Connection
 @todo Allow move
 */
@@ -361,6 +421,8 @@ class CORRADE_INTERCONNECT_EXPORT Emitter {
                 constexpr explicit Signal() = default;
         };
 
+        class Batch;
+
         explicit Emitter();
 
         /** @brief Copying is not allowed */
@@ -382,7 +444,7 @@ class CORRADE_INTERCONNECT_EXPORT Emitter {
          *      @ref signalConnectionCount()
          */
         bool hasSignalConnections() const {
-            return !_connections.empty();
+            return _connectionCount;
         }
 
         /**
@@ -392,15 +454,7 @@ class CORRADE_INTERCONNECT_EXPORT Emitter {
          *      @ref signalConnectionCount()
          */
         template<class Emitter, class ...Args> bool hasSignalConnections(Signal(Emitter::*signal)(Args...)) const {
-            return _connections.count(
-                /* Still broken even on MSVC 2022. Maybe 2025 will be the year
-                   when MSVC can finally do plain C++11? */
-                #if !defined(CORRADE_TARGET_MSVC) || defined(CORRADE_TARGET_CLANG_CL) || _MSC_VER >= 1940
-                Implementation::SignalData(signal)
-                #else
-                Implementation::SignalData::create<Emitter, Args...>(signal)
-                #endif
-                ) != 0;
+            return signalConnectionCount(signal);
         }
 
         /**
@@ -421,7 +475,7 @@ class CORRADE_INTERCONNECT_EXPORT Emitter {
          * @see @ref Receiver::slotConnectionCount(),
          *      @ref hasSignalConnections()
          */
-        std::size_t signalConnectionCount() const { return _connections.size(); }
+        std::size_t signalConnectionCount() const { return _connectionCount; }
 
         /**
          * @brief Count of slots connected to given signal
@@ -430,7 +484,7 @@ class CORRADE_INTERCONNECT_EXPORT Emitter {
          *      @ref hasSignalConnections()
          */
         template<class Emitter, class ...Args> std::size_t signalConnectionCount(Signal(Emitter::*signal)(Args...)) const {
-            return _connections.count(
+            const std::size_t index = signalIndex(
                 /* Still broken even on MSVC 2022. Maybe 2025 will be the year
                    when MSVC can finally do plain C++11? */
                 #if !defined(CORRADE_TARGET_MSVC) || defined(CORRADE_TARGET_CLANG_CL) || _MSC_VER >= 1940
@@ -439,6 +493,7 @@ class CORRADE_INTERCONNECT_EXPORT Emitter {
                 Implementation::SignalData::create<Emitter, Args...>(signal)
                 #endif
                 );
+            return index == _signals.size() ? 0 : _signals[index].count;
         }
 
         /**
@@ -473,6 +528,40 @@ class CORRADE_INTERCONNECT_EXPORT Emitter {
          */
         void disconnectAllSignals();
 
+        /**
+         * @brief Begin a batch
+         * @m_since_latest
+         *
+         * Until a matching @ref endBatch() is called, emitted signals don't
+         * call the slots but are remembered, together with a copy of the
+         * arguments, and only the last emission of each signal is delivered
+         * at the end. Batches can be nested, in which case the signals are
+         * delivered at the end of the outermost batch. See
+         * @ref Interconnect-Emitter-batching for more information.
+         * @see @ref Batch
+         */
+        void beginBatch();
+
+        /**
+         * @brief End a batch
+         * @m_since_latest
+         *
+         * Expects that @ref beginBatch() was called before. If this ends the
+         * outermost batch, emits every signal that was emitted during the
+         * batch once, with the last arguments, in the order of its first
+         * emission.
+         * @see @ref Batch
+         */
+        void endBatch();
+
+        /**
+         * @brief Whether the emitter is in a batch
+         * @m_since_latest
+         *
+         * @see @ref beginBatch(), @ref endBatch()
+         */
+        bool isBatching() const { return _batchDepth; }
+
     protected:
         /* Nobody will need to have (and delete) Emitter*, thus this is faster
            than public pure virtual destructor */
@@ -512,15 +601,121 @@ class CORRADE_INTERCONNECT_EXPORT Emitter {
         #endif
         #endif
 
-        /* Returns the actual location of the connection in the hashmap */
-        Implementation::ConnectionData& connectInternal(const Implementation::SignalData& signal, Implementation::ConnectionData&& data);
+        /* Index into _signals, or _signals.size() if there's no such
+           signal. A linear search is faster than hashing for the few
+           distinct signals an emitter usually has, only emitters with many
+           connected signals such as a StateMachine go through
+           _signalTable. */
+        std::size_t signalIndex(const Implementation::SignalData& signal) const {
+            if(_signalTable.empty()) {
+                for(std::size_t i = 0; i != _signals.size(); ++i)
+                    if(_signals[i].signal == signal) return i;
+                return _signals.size();
+            }
+
+            const std::size_t mask = _signalTable.size() - 1;
+            for(std::size_t i = signalTableHash(signal) & mask; ; i = (i + 1) & mask) {
+                const std::uint32_t entry = _signalTable[i];
+                if(!entry) return _signals.size();
+                if(_signals[entry - 1].signal == signal) return entry - 1;
+            }
+        }
+
+        /* The SignalDataHash is just a XOR of the pointer bits, which for
+           functions that are close to each other in memory differ only in
+           a few bits. Multiply to spread those over the whole range. */
+        static std::size_t signalTableHash(const Implementation::SignalData& signal) {
+            return std::size_t((std::uint64_t(Implementation::SignalDataHash{}(signal))*0x9e3779b97f4a7c15ull) >> 32);
+        }
+
+        /* Adds the last entry of _signals to _signalTable, creating or
+           growing it as needed */
+        void signalTableInsertLast();
+
+        /* Returns ID of the new connection */
+        std::size_t connectInternal(const Implementation::SignalData& signal, Implementation::ConnectionData&& data);
         CORRADE_INTERCONNECT_LOCAL void disconnectFromReceiver(const Implementation::ConnectionData& data);
+        /* Index of the connection in given signal connections or
+           connections.size if not found */
+        CORRADE_INTERCONNECT_LOCAL static std::size_t connectionIndex(const Implementation::SignalConnections& connections, std::size_t id);
+        CORRADE_INTERCONNECT_LOCAL void removeConnection(Implementation::SignalConnections& connections, std::size_t i);
+        /* If fromReceiver is set, the receiver isn't notified as it's the one
+           removing the connection */
+        CORRADE_INTERCONNECT_LOCAL bool disconnectInternal(const Implementation::SignalData& signal, std::size_t id, bool fromReceiver);
 
         void disconnectInternal(const Implementation::SignalData& signal);
 
-        std::unordered_multimap<Implementation::SignalData, Implementation::ConnectionData, Implementation::SignalDataHash> _connections;
-        std::uint32_t _lastHandledSignal;
-        bool _connectionsChanged;
+        /* Called after the outermost emission finishes if any connections
+           were removed or reallocated during it */
+        void compactConnections();
+
+        /* Returns true if the emission got batched, false if the arguments
+           aren't copyable and the signal has to be emitted immediately. The
+           arguments are taken by reference to not copy or move them away in
+           the latter case. */
+        template<class Emitter_, class ...Args> bool batch(std::true_type, const Implementation::SignalData& signalData, Signal(Emitter_::*signal)(Args...), typename Implementation::Identity<Args>::Type&... args);
+        template<class ...T> bool batch(std::false_type, T&&...) { return false; }
+
+        /* Replaces a previous batched emission of the same signal, if any */
+        void batchEmission(const Implementation::SignalData& signal, Containers::Function<void(Emitter&, const Implementation::SignalData&)>&& emit);
+
+        /* Calls all connections of signal at given index */
+        template<class ...Args> void emitConnections(std::size_t index, typename Implementation::Identity<Args>::Type&&... args);
+
+        std::vector<Implementation::SignalConnections> _signals;
+        /* Open-addressing hash table of indices into _signals plus one, with
+           zero denoting an empty slot. Used only once there's more than a few
+           signals. Signal entries are never removed individually, so it only
+           needs to be updated when a new one is added or all are cleared. */
+        std::vector<std::uint32_t> _signalTable;
+        /* Connection storage that was reallocated during an emission. Kept
+           alive until the outermost emission finishes as the slot that caused
+           the reallocation may be stored inside. */
+        std::vector<Implementation::ConnectionData*> _retiredConnectionData;
+        std::size_t _connectionCount;
+        std::size_t _lastConnectionId;
+        std::uint32_t _emitDepth;
+        std::uint32_t _batchDepth;
+        bool _compactionNeeded;
+        /* In order of the first emission */
+        std::vector<Implementation::BatchedEmission> _batchedEmissions;
+};
+
+/**
+@brief Emitter batch scope
+@m_since_latest
+
+Calls @ref Emitter::beginBatch() on construction and @ref Emitter::endBatch()
+on destruction. See @ref Interconnect-Emitter-batching for more information.
+*/
+class Emitter::Batch {
+    public:
+        /** @brief Constructor */
+        explicit Batch(Emitter& emitter): _emitter(emitter) {
+            emitter.beginBatch();
+        }
+
+        /** @brief Copying is not allowed */
+        Batch(const Batch&) = delete;
+
+        /** @brief Moving is not allowed */
+        Batch(Batch&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Calls @ref Emitter::endBatch().
+         */
+        ~Batch() { _emitter.endBatch(); }
+
+        /** @brief Copying is not allowed */
+        Batch& operator=(const Batch&) = delete;
+
+        /** @brief Moving is not allowed */
+        Batch& operator=(Batch&&) = delete;
+
+    private:
+        Emitter& _emitter;
 };
 
 /** @relatesalso Emitter
@@ -620,10 +815,21 @@ for more information about connections.
 CORRADE_INTERCONNECT_EXPORT bool disconnect(Emitter& emitter, const Connection& connection);
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
+template<class Emitter_, class ...Args> bool Emitter::batch(std::true_type, const Implementation::SignalData& signalData, Signal(Emitter_::*)(Args...), typename Implementation::Identity<Args>::Type&... args) {
+    /* Copy the arguments for an emission at the end of the batch. They're
+       forwarded from the copies to match the slot signature in case some of
+       them are r-value references. The signal is looked up again as the
+       connections may change until the batch ends. */
+    batchEmission(signalData, [args...](Emitter& emitter, const Implementation::SignalData& signal) mutable {
+        const std::size_t index = emitter.signalIndex(signal);
+        if(index != emitter._signals.size())
+            emitter.emitConnections<Args...>(index, std::forward<Args>(args)...);
+    });
+    return true;
+}
+
 template<class Emitter_, class ...Args> Emitter::Signal Emitter::emit(Signal(Emitter_::*signal)(Args...), typename Implementation::Identity<Args>::Type... args) {
-    _connectionsChanged = false;
-    ++_lastHandledSignal;
-    auto range = _connections.equal_range(
+    const std::size_t index = signalIndex(
         /* Still broken even on MSVC 2022. Maybe 2025 will be the year when
            MSVC can finally do plain C++11? */
         #if !defined(CORRADE_TARGET_MSVC) || defined(CORRADE_TARGET_CLANG_CL) || _MSC_VER >= 1940
@@ -632,40 +838,31 @@ template<class Emitter_, class ...Args> Emitter::Signal Emitter::emit(Signal(Emi
         Implementation::SignalData::create<Emitter_, Args...>(signal)
         #endif
         );
-    auto it = range.first;
-    while(it != range.second) {
-        /* Caching this actually helps *immensely* with debug runtime perf */
-        Implementation::ConnectionData& data = it->second;
-
-        /* If not already handled, proceed and mark as such */
-        if(data.lastHandledSignal != _lastHandledSignal) {
-            data.lastHandledSignal = _lastHandledSignal;
-
-            reinterpret_cast<void(*)(Implementation::ConnectionData::Storage&, Args&&...)>(data.call)(data.storage, std::forward<Args>(args)...);
-
-            /* Connections changed by the slot, go through again */
-            if(_connectionsChanged) {
-                range = _connections.equal_range(
-                    /* Still broken even on MSVC 2022. Maybe 2025 will be the
-                       year when MSVC can finally do plain C++11? */
-                    #if !defined(CORRADE_TARGET_MSVC) || defined(CORRADE_TARGET_CLANG_CL) || _MSC_VER >= 1940
-                    Implementation::SignalData(signal)
-                    #else
-                    Implementation::SignalData::create<Emitter_, Args...>(signal)
-                    #endif
-                    );
-                it = range.first;
-                _connectionsChanged = false;
-                continue;
-            }
-        }
+    if(index == _signals.size()) return Signal();
 
-        /* Nothing called or changed, next connection */
-        ++it;
-    }
+    if(_batchDepth && batch(Implementation::IsBatchable<Args...>{}, _signals[index].signal, signal, args...))
+        return Signal();
 
+    emitConnections<Args...>(index, std::forward<Args>(args)...);
     return Signal();
 }
+
+template<class ...Args> void Emitter::emitConnections(const std::size_t index, typename Implementation::Identity<Args>::Type&&... args) {
+    /* Signal entries are never removed during an emission and removed
+       connections are only marked as such, so the indices stay valid even if
+       the slots change the connections. Connections added by the slots are
+       appended at the end and thus get called as well. The data pointer and
+       size is however fetched on every iteration as it may get reallocated. */
+    ++_emitDepth;
+    for(std::size_t i = 0; i < _signals[index].size; ++i) {
+        /* Caching this actually helps *immensely* with debug runtime perf */
+        Implementation::ConnectionData& data = _signals[index].data[i];
+        if(!data.call) continue;
+
+        reinterpret_cast<void(*)(Implementation::ConnectionData::Storage&, Args&&...)>(data.call)(data.storage, std::forward<Args>(args)...);
+    }
+    if(!--_emitDepth && _compactionNeeded) compactConnections();
+}
 #endif
 
 }}
@@ -0,0 +1,115 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "EventQueue.h"
+
+namespace Corrade { namespace Interconnect {
+
+namespace Implementation {
+
+struct EventQueueState {
+    /* Pushed to by any thread, taken as a whole by the consumer, so there's
+       no ABA problem. In reverse order of emission. */
+    std::atomic<QueuedEvent*> events{nullptr};
+    /* One for the EventQueue itself, one for each queued connection */
+    std::atomic<std::size_t> references{1};
+    std::atomic<bool> closed{false};
+};
+
+namespace {
+
+void dropEvents(QueuedEvent* events) {
+    while(events) {
+        QueuedEvent* const next = events->next;
+        events->process(events, false);
+        events = next;
+    }
+}
+
+}
+
+void eventQueueAcquire(EventQueueState& state) {
+    state.references.fetch_add(1, std::memory_order_relaxed);
+}
+
+void eventQueueRelease(EventQueueState& state) {
+    if(state.references.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+    /* An event could have been pushed after the queue got closed and drained,
+       delete those as well */
+    dropEvents(state.events.exchange(nullptr, std::memory_order_acquire));
+    delete &state;
+}
+
+void eventQueuePush(EventQueueState& state, QueuedEvent* const event) {
+    if(state.closed.load(std::memory_order_acquire)) {
+        event->process(event, false);
+        return;
+    }
+
+    QueuedEvent* head = state.events.load(std::memory_order_relaxed);
+    do {
+        event->next = head;
+    } while(!state.events.compare_exchange_weak(head, event, std::memory_order_release, std::memory_order_relaxed));
+}
+
+}
+
+EventQueue::EventQueue(): _state{new Implementation::EventQueueState} {}
+
+EventQueue::~EventQueue() {
+    _state->closed.store(true, std::memory_order_release);
+    Implementation::dropEvents(_state->events.exchange(nullptr, std::memory_order_acquire));
+    Implementation::eventQueueRelease(*_state);
+}
+
+bool EventQueue::hasPendingEvents() const {
+    return _state->events.load(std::memory_order_relaxed);
+}
+
+std::size_t EventQueue::processEvents() {
+    Implementation::QueuedEvent* events = _state->events.exchange(nullptr, std::memory_order_acquire);
+
+    /* The list is in reverse order of emission, turn it around */
+    Implementation::QueuedEvent* ordered = nullptr;
+    while(events) {
+        Implementation::QueuedEvent* const next = events->next;
+        events->next = ordered;
+        ordered = events;
+        events = next;
+    }
+
+    std::size_t count = 0;
+    while(ordered) {
+        Implementation::QueuedEvent* const next = ordered->next;
+        if(ordered->process(ordered, true)) ++count;
+        ordered = next;
+    }
+
+    return count;
+}
+
+}}
@@ -0,0 +1,288 @@
+#ifndef Corrade_Interconnect_EventQueue_h
+#define Corrade_Interconnect_EventQueue_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Interconnect::EventQueue, function @ref Corrade::Interconnect::connect(EmitterObject&, Interconnect::Emitter::Signal(Emitter::*)(Args...), EventQueue&, Functor&&)
+ * @m_since_latest
+ */
+
+#include <atomic>
+
+#include "Corrade/Interconnect/Emitter.h"
+#include "Corrade/Utility/Move.h"
+#ifdef CORRADE_BUILD_MULTITHREADED
+#include "Corrade/Utility/PoolAllocator.h"
+#endif
+
+namespace Corrade { namespace Interconnect {
+
+namespace Implementation {
+
+/* Allocated from the thread-caching pool as events are small, short-lived and
+   often allocated on a different thread than the one that frees them. Without
+   CORRADE_BUILD_MULTITHREADED the pool is shared by all threads and isn't
+   thread-safe, so the global allocator is used instead. */
+struct QueuedEvent
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    : Utility::PoolAllocated
+    #endif
+{
+    explicit QueuedEvent(bool(*process)(QueuedEvent*, bool)) noexcept: next{}, process{process} {}
+
+    QueuedEvent* next;
+    /* Calls the slot if `call` is set and the slot is still connected, then
+       deletes the event. Returns whether the slot was called. */
+    bool(*process)(QueuedEvent*, bool call);
+};
+
+struct EventQueueState;
+
+CORRADE_INTERCONNECT_EXPORT void eventQueueAcquire(EventQueueState& state);
+CORRADE_INTERCONNECT_EXPORT void eventQueueRelease(EventQueueState& state);
+/* Takes ownership of the event, deletes it right away if the queue is closed
+   already */
+CORRADE_INTERCONNECT_EXPORT void eventQueuePush(EventQueueState& state, QueuedEvent* event);
+
+/* Slot shared between the connection and all events in flight, so it stays
+   alive if the connection is removed while there are still events queued */
+template<class F> struct QueuedSlot {
+    template<class G> explicit QueuedSlot(G&& slot): slot(Utility::forward<G>(slot)) {}
+
+    void acquire() {
+        references.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void release() {
+        if(references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete this;
+    }
+
+    std::atomic<std::size_t> references{1};
+    std::atomic<bool> connected{true};
+    F slot;
+};
+
+template<class F, class Call> struct QueuedEventImplementation: QueuedEvent {
+    explicit QueuedEventImplementation(QueuedSlot<F>& slot, Call&& call): QueuedEvent{process}, slot(slot), call(Utility::move(call)) {
+        slot.acquire();
+    }
+
+    static bool process(QueuedEvent* event, bool call) {
+        auto* self = static_cast<QueuedEventImplementation<F, Call>*>(event);
+        const bool called = call && self->slot.connected.load(std::memory_order_acquire);
+        if(called) self->call(self->slot.slot);
+        self->slot.release();
+        delete self;
+        return called;
+    }
+
+    QueuedSlot<F>& slot;
+    Call call;
+};
+
+template<class F, class Call> QueuedEvent* queuedEvent(QueuedSlot<F>& slot, Call&& call) {
+    typedef QueuedEventImplementation<F, typename std::decay<Call>::type> Event;
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    /* PoolAllocated::operator new() doesn't get the alignment, so catch it
+       here instead of returning misaligned memory */
+    static_assert(alignof(Event) <= Utility::PoolAllocatorAlignment, "signal arguments with alignment larger than Utility::PoolAllocatorAlignment can't be queued");
+    #endif
+    return new Event{slot, Utility::forward<Call>(call)};
+}
+
+/* Functor stored in the emitter connection. Copies the arguments into an
+   event and pushes it to the queue. Non-trivially destructible, so it's
+   always heap-allocated by ConnectionData. */
+template<class F, class ...Args> class QueuedFunctor {
+    public:
+        template<class G> explicit QueuedFunctor(EventQueueState& queue, G&& slot): _queue{&queue}, _slot{new QueuedSlot<F>{Utility::forward<G>(slot)}} {
+            eventQueueAcquire(queue);
+        }
+
+        QueuedFunctor(const QueuedFunctor<F, Args...>&) = delete;
+
+        QueuedFunctor(QueuedFunctor<F, Args...>&& other) noexcept: _queue{other._queue}, _slot{other._slot} {
+            other._queue = nullptr;
+            other._slot = nullptr;
+        }
+
+        ~QueuedFunctor() {
+            if(!_slot) return;
+
+            /* Events that are still queued won't call the slot anymore */
+            _slot->connected.store(false, std::memory_order_release);
+            _slot->release();
+            eventQueueRelease(*_queue);
+        }
+
+        QueuedFunctor<F, Args...>& operator=(const QueuedFunctor<F, Args...>&) = delete;
+        QueuedFunctor<F, Args...>& operator=(QueuedFunctor<F, Args...>&&) = delete;
+
+        void operator()(Args... args) {
+            /* The arguments are copied into the lambda. When the event is
+               processed, by-value arguments are moved to the slot and
+               reference arguments get a reference to the copy. */
+            eventQueuePush(*_queue, queuedEvent(*_slot, [args...](F& slot) mutable {
+                slot(Utility::forward<Args>(args)...);
+            }));
+        }
+
+    private:
+        EventQueueState* _queue;
+        QueuedSlot<F>* _slot;
+};
+
+}
+
+/**
+@brief Queue for delivering signals to another thread
+@m_since_latest
+
+By default, @ref Emitter::emit() calls all connected slots synchronously on
+the thread that emitted the signal. Connecting a slot through an
+@ref EventQueue using
+@ref connect(EmitterObject&, Interconnect::Emitter::Signal(Emitter::*)(Args...), EventQueue&, Functor&&)
+makes the emission only copy the arguments into the queue, and the slot is
+then called from whichever thread calls @ref processEvents(), usually the
+thread that owns the queue:
+
+@snippet Interconnect.cpp EventQueue
+
+@section Interconnect-EventQueue-threading Thread safety
+
+Any number of emitters on any number of threads can push events into a single
+queue, the queue is a lock-free multiple-producer single-consumer list. The
+emitter itself however isn't thread-safe, so a particular emitter should be
+only used from a single thread at a time, including connecting, disconnecting
+and emitting.
+
+Disconnecting a queued connection, either explicitly with
+@ref disconnect() or through the emitter destruction, can safely race with
+@ref processEvents() on the queue thread. Events that were emitted before the
+disconnection but weren't processed yet are dropped. Note that the slot may be
+still executing on the queue thread at the point the disconnection is done,
+the slot itself is however kept alive until it finishes.
+
+Similarly, destroying the queue while emitters are still connected to it is
+safe. Pending events are dropped and subsequent emissions don't deliver
+anything, but the connections stay until they're removed from the emitter.
+
+@section Interconnect-EventQueue-arguments Argument handling
+
+All signal arguments are copied into the queue, including arguments passed by
+reference, which means that argument types have to be copyable. When the event
+is processed, copies of arguments passed by value are moved into the slot,
+while arguments passed by reference are passed as a reference to the copy. In
+particular, modifications done through a non-@cpp const @ce reference argument
+are thus not visible to the emitter. If @ref CORRADE_BUILD_MULTITHREADED is
+enabled, events are allocated using @ref Utility::poolAllocate(), so with small
+enough arguments a queued emission doesn't hit the system allocator. Arguments
+with alignment larger than @ref Utility::PoolAllocatorAlignment aren't
+supported in that case and are rejected at compile time. Otherwise the pool
+isn't thread-safe and the events are allocated with the global
+@cpp operator new @ce.
+*/
+class CORRADE_INTERCONNECT_EXPORT EventQueue {
+    public:
+        explicit EventQueue();
+
+        /** @brief Copying is not allowed */
+        EventQueue(const EventQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        EventQueue(EventQueue&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Drops all pending events. Emitters that are still connected to the
+         * queue don't deliver anything from this point on.
+         */
+        ~EventQueue();
+
+        /** @brief Copying is not allowed */
+        EventQueue& operator=(const EventQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        EventQueue& operator=(EventQueue&&) = delete;
+
+        /**
+         * @brief Whether there are any events waiting to be processed
+         *
+         * As other threads may be pushing to the queue concurrently, the
+         * returned value is only a snapshot.
+         */
+        bool hasPendingEvents() const;
+
+        /**
+         * @brief Process pending events
+         * @return Count of slots that were called
+         *
+         * Calls slots for all events that were queued up to this point, in
+         * the order in which they were emitted. Events emitted while
+         * processing, either from slots or from other threads, are processed
+         * in the next call. Events belonging to connections that were removed
+         * in the meantime are dropped. Expected to be called from a single
+         * thread at a time.
+         */
+        std::size_t processEvents();
+
+    private:
+        /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<class EmitterObject, class Emitter, class Functor, class ...Args> friend Connection connect(EmitterObject&, Interconnect::Emitter::Signal(Emitter::*)(Args...), EventQueue&, Functor&&);
+        #endif
+
+        Implementation::EventQueueState* _state;
+};
+
+/** @relatesalso EventQueue
+@brief Connect signal to a slot called through an event queue
+@param emitter       Emitter
+@param signal        Signal
+@param queue         Queue through which the slot is called
+@param slot          Slot
+@m_since_latest
+
+Like @ref connect(EmitterObject&, Interconnect::Emitter::Signal(Emitter::*)(Args...), Functor&&),
+but instead of calling @p slot directly, the signal arguments are copied into
+@p queue and @p slot gets called from @ref EventQueue::processEvents(). See
+the @ref EventQueue class documentation for more information.
+
+For member function slots, wrap the call into a lambda. Unlike with a direct
+member function connection, the connection isn't automatically removed when
+the receiving object is destroyed, so the queue should be destroyed or the
+connection removed before that.
+*/
+template<class EmitterObject, class Emitter, class Functor, class ...Args> Connection connect(EmitterObject& emitter, Interconnect::Emitter::Signal(Emitter::*signal)(Args...), EventQueue& queue, Functor&& slot) {
+    return connect(emitter, signal, Implementation::QueuedFunctor<typename std::decay<Functor>::type, Args...>{*queue._state, Utility::forward<Functor>(slot)});
+}
+
+}}
+
+#endif
@@ -32,11 +32,11 @@
 namespace Corrade { namespace Interconnect { namespace Implementation {
 
 struct ReceiverConnection {
-    explicit ReceiverConnection(Emitter& emitter, Implementation::SignalData signal, Implementation::ConnectionData& data) noexcept: emitter{emitter}, signal{signal}, data{data} {}
+    explicit ReceiverConnection(Emitter& emitter, Implementation::SignalData signal, std::size_t id) noexcept: emitter{emitter}, signal{signal}, id{id} {}
 
     Containers::Reference<Emitter> emitter;
     Implementation::SignalData signal;
-    Containers::Reference<Implementation::ConnectionData> data;
+    std::size_t id;
 };
 
 }}}
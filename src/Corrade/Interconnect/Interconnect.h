@@ -39,6 +39,7 @@ namespace Corrade { namespace Interconnect {
 
 class Connection;
 class Emitter;
+class EventQueue;
 class Receiver;
 
 namespace Implementation {
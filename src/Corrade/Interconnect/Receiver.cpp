@@ -42,16 +42,8 @@ bool Receiver::hasSlotConnections() const { return !_connections.empty(); }
 std::size_t Receiver::slotConnectionCount() const { return _connections.size(); }
 
 void Receiver::disconnectAllSlots() {
-    for(Implementation::ReceiverConnection& connection: _connections) {
-        auto range = connection.emitter->_connections.equal_range(connection.signal);
-        for(auto it = range.first; it != range.second; ++it) {
-            if(&it->second != &*connection.data) continue;
-
-            connection.emitter->_connections.erase(it);
-            connection.emitter->_connectionsChanged = true;
-            break;
-        }
-    }
+    for(Implementation::ReceiverConnection& connection: _connections)
+        connection.emitter->disconnectInternal(connection.signal, connection.id, true);
 
     _connections.clear();
 }
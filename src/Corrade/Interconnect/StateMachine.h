@@ -30,10 +30,39 @@
  * @brief Class @ref Corrade::Interconnect::StateMachine, @ref Corrade::Interconnect::StateTransition
  */
 
+#include "Corrade/Containers/sequenceHelpers.h"
 #include "Corrade/Interconnect/Emitter.h"
 
 namespace Corrade { namespace Interconnect {
 
+namespace Implementation {
+
+/* Jump tables with pointers to the entered() / exited() signals of each
+   state, and the stepped() signal of each state pair, to make step() a
+   constant-time lookup instead of a recursive search through all states */
+template<class Machine, class State, class> struct StateMachineStateSignals;
+template<class Machine, class State, std::size_t ...sequence> struct StateMachineStateSignals<Machine, State, Containers::Implementation::Sequence<sequence...>> {
+    typedef Emitter::Signal(Machine::*Signal)(State);
+
+    static constexpr Signal Entered[]{&Machine::template entered<State(sequence)>...};
+    static constexpr Signal Exited[]{&Machine::template exited<State(sequence)>...};
+};
+
+template<class Machine, class State, std::size_t ...sequence> constexpr typename StateMachineStateSignals<Machine, State, Containers::Implementation::Sequence<sequence...>>::Signal StateMachineStateSignals<Machine, State, Containers::Implementation::Sequence<sequence...>>::Entered[];
+template<class Machine, class State, std::size_t ...sequence> constexpr typename StateMachineStateSignals<Machine, State, Containers::Implementation::Sequence<sequence...>>::Signal StateMachineStateSignals<Machine, State, Containers::Implementation::Sequence<sequence...>>::Exited[];
+
+/* Indexed with previous*states + next */
+template<class Machine, class State, std::size_t states, class> struct StateMachineTransitionSignals;
+template<class Machine, class State, std::size_t states, std::size_t ...sequence> struct StateMachineTransitionSignals<Machine, State, states, Containers::Implementation::Sequence<sequence...>> {
+    typedef Emitter::Signal(Machine::*Signal)();
+
+    static constexpr Signal Stepped[]{&Machine::template stepped<State(sequence/states), State(sequence%states)>...};
+};
+
+template<class Machine, class State, std::size_t states, std::size_t ...sequence> constexpr typename StateMachineTransitionSignals<Machine, State, states, Containers::Implementation::Sequence<sequence...>>::Signal StateMachineTransitionSignals<Machine, State, states, Containers::Implementation::Sequence<sequence...>>::Stepped[];
+
+}
+
 /**
 @brief Transition between states
 
@@ -94,6 +123,16 @@ Finished. Please take the document.
 Printer is ready.
 @endcode
 
+@section Interconnect-StateMachine-performance Performance characteristics
+
+The transitions are stored in a flat table indexed by the current state and
+the input, and the signals to emit are looked up in jump tables generated at
+compile time, so @ref step() takes a constant time regardless of the state
+count. If nothing is connected to the machine, no signals are emitted at all.
+Note however that a @ref stepped() signal is instantiated for
+every pair of states, which means compile times grow quadratically with the
+state count.
+
 */
 template<std::size_t states, std::size_t inputs, class State, class Input> class StateMachine: public Emitter {
     public:
@@ -181,52 +220,8 @@ template<std::size_t states, std::size_t inputs, class State, class Input> class
             return _transitions[std::size_t(current)*inputs+std::size_t(input)];
         }
 
-        template<std::size_t current> Signal enteredInternal(State wanted, std::integral_constant<std::size_t, current>, State previous) {
-            return State(current-1) == wanted ? entered<State(current-1)>(previous) : enteredInternal(wanted, std::integral_constant<std::size_t, current-1>{}, previous);
-        }
-
-        /* LCOV_EXCL_START */
-        Signal enteredInternal(State, std::integral_constant<std::size_t, 0>, State) {
-            CORRADE_INTERNAL_ASSERT_UNREACHABLE();
-        }
-        /* LCOV_EXCL_STOP */
-
-        template<std::size_t current> Signal steppedInternal(State wantedPrevious, std::integral_constant<std::size_t, current>, State next) {
-            return State(current-1) == wantedPrevious ?
-                steppedNextInternal<State(current-1)>(next, std::integral_constant<std::size_t, states>{}) :
-                steppedInternal(wantedPrevious, std::integral_constant<std::size_t, current-1>{}, next);
-        }
-
-        /* LCOV_EXCL_START */
-        Signal steppedInternal(State, std::integral_constant<std::size_t, 0>, State) {
-            CORRADE_INTERNAL_ASSERT_UNREACHABLE();
-        }
-        /* LCOV_EXCL_STOP */
-
-        template<State previous, std::size_t current> Signal steppedNextInternal(State wantedNext, std::integral_constant<std::size_t, current>) {
-            return State(current-1) == wantedNext ? stepped<previous, State(current-1)>() : steppedNextInternal<previous>(wantedNext, std::integral_constant<std::size_t, current-1>{});
-        }
-
-        /* LCOV_EXCL_START */
-        template<State> Signal steppedNextInternal(State, std::integral_constant<std::size_t, 0>) {
-            CORRADE_INTERNAL_ASSERT_UNREACHABLE();
-        }
-        /* LCOV_EXCL_STOP */
-
-        template<std::size_t current> Signal exitedInternal(State wanted, std::integral_constant<std::size_t, current>, State next) {
-            return State(current-1) == wanted ? exited<State(current-1)>(next) : exitedInternal(wanted, std::integral_constant<std::size_t, current - 1>{}, next);
-        }
-
-        /* LCOV_EXCL_START */
-        Signal exitedInternal(State, std::integral_constant<std::size_t, 0>, State) {
-            CORRADE_INTERNAL_ASSERT_UNREACHABLE();
-        }
-        /* LCOV_EXCL_STOP */
-
         State _transitions[states*inputs];
         State _current;
-
-   private:
 };
 
 template<std::size_t states, std::size_t inputs, class State, class Input> StateMachine<states, inputs, State, Input>::StateMachine(): _transitions{}, _current{} {
@@ -246,13 +241,21 @@ template<std::size_t states, std::size_t inputs, class State, class Input> void
 template<std::size_t states, std::size_t inputs, class State, class Input> StateMachine<states, inputs, State, Input>& StateMachine<states, inputs, State, Input>::step(Input input) {
     const State next = at(_current, input);
 
-    if(next != _current) {
-        exitedInternal(_current, std::integral_constant<std::size_t, states>{}, next);
-        steppedInternal(_current, std::integral_constant<std::size_t, states>{}, next);
-        enteredInternal(next, std::integral_constant<std::size_t, states>{}, _current);
+    if(next == _current) return *this;
+
+    /* Nothing to emit, skip the signal lookups altogether */
+    if(!hasSignalConnections()) {
         _current = next;
+        return *this;
     }
 
+    typedef Implementation::StateMachineStateSignals<StateMachine<states, inputs, State, Input>, State, typename Containers::Implementation::GenerateSequence<states>::Type> StateSignals;
+    typedef Implementation::StateMachineTransitionSignals<StateMachine<states, inputs, State, Input>, State, states, typename Containers::Implementation::GenerateSequence<states*states>::Type> TransitionSignals;
+    (this->*StateSignals::Exited[std::size_t(_current)])(next);
+    (this->*TransitionSignals::Stepped[std::size_t(_current)*states + std::size_t(next)])();
+    (this->*StateSignals::Entered[std::size_t(next)])(_current);
+    _current = next;
+
     return *this;
 }
 
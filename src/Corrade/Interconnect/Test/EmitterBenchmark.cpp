@@ -0,0 +1,208 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/Optional.h"
+#include "Corrade/Interconnect/Emitter.h"
+#include "Corrade/Interconnect/Receiver.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Interconnect { namespace Test { namespace {
+
+/* Compared to Benchmark.cpp, which measures mainly the call overhead of
+   various slot types, this measures throughput of the emitter itself with
+   many signals and connections */
+struct EmitterBenchmark: TestSuite::Tester {
+    explicit EmitterBenchmark();
+
+    void emit16Signals4Slots();
+    void emit16Signals4SlotsMembers();
+    void emit1Signal1Slot();
+
+    void connectDisconnect1k();
+    void connectDisconnect1kReverse();
+    void connectDisconnect1k16Signals();
+    void connectDisconnect1kMembersReceiver();
+};
+
+EmitterBenchmark::EmitterBenchmark() {
+    addBenchmarks({&EmitterBenchmark::emit16Signals4Slots,
+                   &EmitterBenchmark::emit16Signals4SlotsMembers,
+                   &EmitterBenchmark::emit1Signal1Slot}, 25);
+
+    addBenchmarks({&EmitterBenchmark::connectDisconnect1k,
+                   &EmitterBenchmark::connectDisconnect1kReverse,
+                   &EmitterBenchmark::connectDisconnect1k16Signals,
+                   &EmitterBenchmark::connectDisconnect1kMembersReceiver}, 10);
+}
+
+int globalOutput;
+
+CORRADE_NEVER_INLINE void freeFunctionSlot() {
+    ++globalOutput;
+}
+
+/* Sixteen distinct signals, similarly to what a typical UI widget has */
+struct E: Emitter {
+    template<int i> Signal fire() {
+        #ifdef CORRADE_TARGET_MSVC
+        /* See Test::TemplatedPostman for why this is needed */
+        _functionHash = i;
+        #endif
+        return emit(&E::fire<i>);
+    }
+
+    #ifdef CORRADE_TARGET_MSVC
+    int _functionHash;
+    #endif
+};
+
+struct R: Receiver {
+    int output = 0;
+
+    void receive() { ++output; }
+};
+
+template<int ...i> struct Signals {
+    template<class F> static void forEach(F&& f) {
+        /* C++11 has no fold expressions */
+        int dummy[]{(f(&E::fire<i>), 0)...};
+        static_cast<void>(dummy);
+    }
+
+    static void fire(E& emitter) {
+        int dummy[]{(emitter.fire<i>(), 0)...};
+        static_cast<void>(dummy);
+    }
+};
+
+typedef Signals<0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15> Signals16;
+
+void EmitterBenchmark::emit16Signals4Slots() {
+    globalOutput = 0;
+
+    E emitter;
+    for(std::size_t i = 0; i != 4; ++i) Signals16::forEach([&emitter](Emitter::Signal(E::*signal)()) {
+        connect(emitter, signal, freeFunctionSlot);
+    });
+    CORRADE_COMPARE(emitter.signalConnectionCount(), 16*4);
+
+    CORRADE_BENCHMARK(100)
+        for(std::size_t i = 0; i != 100; ++i)
+            Signals16::fire(emitter);
+
+    CORRADE_COMPARE(globalOutput, 100*100*16*4);
+}
+
+void EmitterBenchmark::emit16Signals4SlotsMembers() {
+    E emitter;
+    R receiver;
+    for(std::size_t i = 0; i != 4; ++i) Signals16::forEach([&emitter, &receiver](Emitter::Signal(E::*signal)()) {
+        connect(emitter, signal, receiver, &R::receive);
+    });
+    CORRADE_COMPARE(emitter.signalConnectionCount(), 16*4);
+
+    CORRADE_BENCHMARK(100)
+        for(std::size_t i = 0; i != 100; ++i)
+            Signals16::fire(emitter);
+
+    CORRADE_COMPARE(receiver.output, 100*100*16*4);
+}
+
+void EmitterBenchmark::emit1Signal1Slot() {
+    globalOutput = 0;
+
+    E emitter;
+    connect(emitter, &E::fire<0>, freeFunctionSlot);
+
+    CORRADE_BENCHMARK(100)
+        for(std::size_t i = 0; i != 1600; ++i)
+            emitter.fire<0>();
+
+    CORRADE_COMPARE(globalOutput, 100*1600);
+}
+
+void EmitterBenchmark::connectDisconnect1k() {
+    E emitter;
+
+    CORRADE_BENCHMARK(10) {
+        Containers::Array<Containers::Optional<Connection>> connections{1000};
+        for(Containers::Optional<Connection>& connection: connections)
+            connection = connect(emitter, &E::fire<0>, freeFunctionSlot);
+        for(Containers::Optional<Connection>& connection: connections)
+            disconnect(emitter, *connection);
+    }
+
+    CORRADE_VERIFY(!emitter.hasSignalConnections());
+}
+
+void EmitterBenchmark::connectDisconnect1kReverse() {
+    E emitter;
+
+    CORRADE_BENCHMARK(10) {
+        Containers::Array<Containers::Optional<Connection>> connections{1000};
+        for(Containers::Optional<Connection>& connection: connections)
+            connection = connect(emitter, &E::fire<0>, freeFunctionSlot);
+        for(std::size_t i = connections.size(); i != 0; --i)
+            disconnect(emitter, *connections[i - 1]);
+    }
+
+    CORRADE_VERIFY(!emitter.hasSignalConnections());
+}
+
+void EmitterBenchmark::connectDisconnect1k16Signals() {
+    E emitter;
+
+    CORRADE_BENCHMARK(10) {
+        Containers::Array<Containers::Optional<Connection>> connections{1000};
+        std::size_t i = 0;
+        while(i < connections.size()) Signals16::forEach([&](Emitter::Signal(E::*signal)()) {
+            if(i < connections.size())
+                connections[i++] = connect(emitter, signal, freeFunctionSlot);
+        });
+        for(Containers::Optional<Connection>& connection: connections)
+            disconnect(emitter, *connection);
+    }
+
+    CORRADE_VERIFY(!emitter.hasSignalConnections());
+}
+
+void EmitterBenchmark::connectDisconnect1kMembersReceiver() {
+    E emitter;
+
+    CORRADE_BENCHMARK(10) {
+        R receiver;
+        for(std::size_t i = 0; i != 1000; ++i)
+            connect(emitter, &E::fire<0>, receiver, &R::receive);
+        /* The receiver destructor disconnects everything */
+    }
+
+    CORRADE_VERIFY(!emitter.hasSignalConnections());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Interconnect::Test::EmitterBenchmark)
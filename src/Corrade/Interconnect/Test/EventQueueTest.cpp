@@ -0,0 +1,428 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/Optional.h"
+#include "Corrade/Interconnect/EventQueue.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
+#include "Corrade/Utility/DebugStl.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <atomic>
+#include <thread>
+#endif
+
+namespace Corrade { namespace Interconnect { namespace Test { namespace {
+
+struct EventQueueTest: TestSuite::Tester {
+    explicit EventQueueTest();
+
+    void construct();
+
+    void processEvents();
+    void processEventsOrder();
+    void processEventsArgumentsCopied();
+    void processEventsReferenceArguments();
+    void processEventsEmitInSlot();
+
+    void disconnect();
+    void disconnectSignal();
+    void destroyEmitter();
+    void destroyQueue();
+    void slotDestructor();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void multithreaded();
+    void multithreadedDisconnect();
+    #endif
+};
+
+EventQueueTest::EventQueueTest() {
+    addTests({&EventQueueTest::construct,
+
+              &EventQueueTest::processEvents,
+              &EventQueueTest::processEventsOrder,
+              &EventQueueTest::processEventsArgumentsCopied,
+              &EventQueueTest::processEventsReferenceArguments,
+              &EventQueueTest::processEventsEmitInSlot,
+
+              &EventQueueTest::disconnect,
+              &EventQueueTest::disconnectSignal,
+              &EventQueueTest::destroyEmitter,
+              &EventQueueTest::destroyQueue,
+              &EventQueueTest::slotDestructor,
+
+              #ifndef CORRADE_TARGET_EMSCRIPTEN
+              &EventQueueTest::multithreaded,
+              &EventQueueTest::multithreadedDisconnect
+              #endif
+              });
+}
+
+class Postman: public Interconnect::Emitter {
+    public:
+        Signal newMessage(int price, const std::string& message) {
+            return emit(&Postman::newMessage, price, message);
+        }
+
+        Signal paymentRequested(int amount) {
+            return emit(&Postman::paymentRequested, amount);
+        }
+
+        Signal counterUpdated(int& counter) {
+            return emit(&Postman::counterUpdated, counter);
+        }
+};
+
+void EventQueueTest::construct() {
+    EventQueue queue;
+    CORRADE_VERIFY(!queue.hasPendingEvents());
+    CORRADE_COMPARE(queue.processEvents(), 0);
+}
+
+void EventQueueTest::processEvents() {
+    Postman postman;
+    EventQueue queue;
+
+    int money = 0;
+    Connection connection = Interconnect::connect(postman, &Postman::paymentRequested, queue, [&money](int amount) {
+        money += amount;
+    });
+    CORRADE_VERIFY(postman.isConnected(connection));
+    CORRADE_COMPARE(postman.signalConnectionCount(), 1);
+
+    /* The slot doesn't get called directly */
+    postman.paymentRequested(15);
+    postman.paymentRequested(27);
+    CORRADE_COMPARE(money, 0);
+    CORRADE_VERIFY(queue.hasPendingEvents());
+
+    /* Only once the events are processed */
+    CORRADE_COMPARE(queue.processEvents(), 2);
+    CORRADE_COMPARE(money, 42);
+    CORRADE_VERIFY(!queue.hasPendingEvents());
+
+    /* Processing again does nothing */
+    CORRADE_COMPARE(queue.processEvents(), 0);
+    CORRADE_COMPARE(money, 42);
+}
+
+void EventQueueTest::processEventsOrder() {
+    Postman postman;
+    EventQueue queue;
+
+    Containers::Array<int> out;
+    Interconnect::connect(postman, &Postman::paymentRequested, queue, [&out](int amount) {
+        arrayAppend(out, amount);
+    });
+    Interconnect::connect(postman, &Postman::newMessage, queue, [&out](int price, const std::string&) {
+        arrayAppend(out, -price);
+    });
+
+    postman.paymentRequested(1);
+    postman.newMessage(2, "");
+    postman.paymentRequested(3);
+    postman.paymentRequested(4);
+    postman.newMessage(5, "");
+
+    /* Events are processed in the order they were emitted, regardless of the
+       signal */
+    CORRADE_COMPARE(queue.processEvents(), 5);
+    CORRADE_COMPARE_AS(out, Containers::arrayView({
+        1, -2, 3, 4, -5
+    }), TestSuite::Compare::Container);
+}
+
+void EventQueueTest::processEventsArgumentsCopied() {
+    Postman postman;
+    EventQueue queue;
+
+    Containers::Array<std::string> messages;
+    Interconnect::connect(postman, &Postman::newMessage, queue, [&messages](int, const std::string& message) {
+        arrayAppend(messages, message);
+    });
+
+    {
+        std::string message = "hello";
+        postman.newMessage(0, message);
+        message = "this is not delivered";
+    }
+
+    CORRADE_COMPARE(queue.processEvents(), 1);
+    CORRADE_COMPARE(messages.size(), 1);
+    CORRADE_COMPARE(messages[0], "hello");
+}
+
+void EventQueueTest::processEventsReferenceArguments() {
+    Postman postman;
+    EventQueue queue;
+
+    /* The slot gets a reference to the queued copy, so the modification
+       isn't visible to the emitter */
+    int received = 0;
+    Interconnect::connect(postman, &Postman::counterUpdated, queue, [&received](int& counter) {
+        received = ++counter;
+    });
+
+    int counter = 41;
+    postman.counterUpdated(counter);
+    counter = 1337;
+
+    CORRADE_COMPARE(queue.processEvents(), 1);
+    CORRADE_COMPARE(received, 42);
+    CORRADE_COMPARE(counter, 1337);
+}
+
+void EventQueueTest::processEventsEmitInSlot() {
+    Postman postman;
+    EventQueue queue;
+
+    int called = 0;
+    Interconnect::connect(postman, &Postman::paymentRequested, queue, [&postman, &called](int amount) {
+        ++called;
+        if(amount) postman.paymentRequested(amount - 1);
+    });
+
+    /* Events emitted during processing are processed only in the next
+       round */
+    postman.paymentRequested(2);
+    CORRADE_COMPARE(queue.processEvents(), 1);
+    CORRADE_COMPARE(called, 1);
+    CORRADE_COMPARE(queue.processEvents(), 1);
+    CORRADE_COMPARE(called, 2);
+    CORRADE_COMPARE(queue.processEvents(), 1);
+    CORRADE_COMPARE(called, 3);
+    CORRADE_COMPARE(queue.processEvents(), 0);
+}
+
+void EventQueueTest::disconnect() {
+    Postman postman;
+    EventQueue queue;
+
+    int money = 0;
+    Connection connection = Interconnect::connect(postman, &Postman::paymentRequested, queue, [&money](int amount) {
+        money += amount;
+    });
+
+    postman.paymentRequested(15);
+    CORRADE_VERIFY(Interconnect::disconnect(postman, connection));
+    CORRADE_VERIFY(!postman.isConnected(connection));
+
+    /* The pending event is dropped */
+    CORRADE_COMPARE(queue.processEvents(), 0);
+    CORRADE_COMPARE(money, 0);
+
+    /* Emitting after disconnecting doesn't queue anything */
+    postman.paymentRequested(15);
+    CORRADE_VERIFY(!queue.hasPendingEvents());
+}
+
+void EventQueueTest::disconnectSignal() {
+    Postman postman;
+    EventQueue queue;
+
+    int money = 0;
+    Interconnect::connect(postman, &Postman::paymentRequested, queue, [&money](int amount) {
+        money += amount;
+    });
+    Interconnect::connect(postman, &Postman::newMessage, queue, [&money](int price, const std::string&) {
+        money += price*100;
+    });
+
+    postman.paymentRequested(15);
+    postman.newMessage(1, "hello");
+    postman.disconnectSignal(&Postman::paymentRequested);
+
+    /* Only the event for the remaining connection is delivered */
+    CORRADE_COMPARE(queue.processEvents(), 1);
+    CORRADE_COMPARE(money, 100);
+}
+
+void EventQueueTest::destroyEmitter() {
+    EventQueue queue;
+
+    int money = 0;
+    {
+        Postman postman;
+        Interconnect::connect(postman, &Postman::paymentRequested, queue, [&money](int amount) {
+            money += amount;
+        });
+        postman.paymentRequested(15);
+    }
+
+    /* The pending event is dropped */
+    CORRADE_COMPARE(queue.processEvents(), 0);
+    CORRADE_COMPARE(money, 0);
+}
+
+void EventQueueTest::destroyQueue() {
+    Postman postman;
+
+    int money = 0;
+    Connection connection = [&]{
+        EventQueue queue;
+        Connection connection = Interconnect::connect(postman, &Postman::paymentRequested, queue, [&money](int amount) {
+            money += amount;
+        });
+        /* Will get dropped with the queue */
+        postman.paymentRequested(15);
+        return connection;
+    }();
+
+    /* The connection is still there but emitting doesn't deliver anything
+       anywhere and the event gets deleted right away */
+    CORRADE_VERIFY(postman.isConnected(connection));
+    postman.paymentRequested(15);
+    CORRADE_COMPARE(money, 0);
+}
+
+void EventQueueTest::slotDestructor() {
+    struct Slot {
+        explicit Slot(int& destructed, int& called): destructed{&destructed}, called{&called} {}
+        Slot(const Slot& other): destructed{other.destructed}, called{other.called} {}
+        ~Slot() { ++*destructed; }
+
+        void operator()(int) { ++*called; }
+
+        int* destructed;
+        int* called;
+    };
+
+    Postman postman;
+    EventQueue queue;
+
+    int destructed = 0, called = 0;
+    {
+        Slot slot{destructed, called};
+        Interconnect::connect(postman, &Postman::paymentRequested, queue, slot);
+    }
+    /* The local instance got destroyed, the connection has its own copy */
+    CORRADE_COMPARE(destructed, 1);
+
+    /* Emitting and disconnecting keeps the slot alive for the pending events,
+       although they don't call it */
+    postman.paymentRequested(1);
+    postman.disconnectAllSignals();
+    CORRADE_COMPARE(destructed, 1);
+
+    /* Processing the events releases the slot */
+    CORRADE_COMPARE(queue.processEvents(), 0);
+    CORRADE_COMPARE(destructed, 2);
+    CORRADE_COMPARE(called, 0);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void EventQueueTest::multithreaded() {
+    constexpr std::size_t ThreadCount = 4;
+    constexpr int Count = 5000;
+
+    EventQueue queue;
+    Postman postmen[ThreadCount];
+
+    /* Slots are called only from the main thread, so there's no need for any
+       synchronization */
+    int last[ThreadCount];
+    std::size_t outOfOrder = 0;
+    long long sum = 0;
+    for(std::size_t i = 0; i != ThreadCount; ++i) {
+        last[i] = -1;
+        Interconnect::connect(postmen[i], &Postman::paymentRequested, queue, [i, &last, &outOfOrder, &sum](int amount) {
+            if(amount != last[i] + 1) ++outOfOrder;
+            last[i] = amount;
+            sum += amount;
+        });
+    }
+
+    std::thread threads[ThreadCount];
+    for(std::size_t i = 0; i != ThreadCount; ++i) threads[i] = std::thread{[i, &postmen]{
+        for(int j = 0; j != Count; ++j)
+            postmen[i].paymentRequested(j);
+    }};
+
+    /* Process concurrently with the emission until everything arrives */
+    std::size_t processed = 0;
+    while(processed != ThreadCount*Count)
+        processed += queue.processEvents();
+
+    for(std::thread& t: threads) t.join();
+
+    CORRADE_COMPARE(processed, ThreadCount*Count);
+    CORRADE_COMPARE(outOfOrder, 0);
+    CORRADE_COMPARE(sum, static_cast<long long>(ThreadCount*Count*(Count - 1)/2));
+    CORRADE_VERIFY(!queue.hasPendingEvents());
+}
+
+void EventQueueTest::multithreadedDisconnect() {
+    constexpr int Count = 1000;
+
+    EventQueue queue;
+    std::atomic<bool> processing{true};
+    std::size_t processed = 0;
+
+    /* Process on a separate thread while the main thread emits and
+       disconnects */
+    std::thread consumer{[&queue, &processing, &processed]{
+        while(processing.load())
+            processed += queue.processEvents();
+        processed += queue.processEvents();
+    }};
+
+    std::size_t called = 0;
+    std::size_t emitted = 0;
+    {
+        Postman postman;
+        for(int i = 0; i != Count; ++i) {
+            Connection connection = Interconnect::connect(postman, &Postman::paymentRequested, queue, [&called](int) {
+                ++called;
+            });
+            postman.paymentRequested(i);
+            postman.paymentRequested(i);
+            /* Every emission reaches all connections that are still there */
+            emitted += 2*postman.signalConnectionCount();
+            if(i % 2) Interconnect::disconnect(postman, connection);
+        }
+
+        /* The rest gets disconnected here, racing with the processing as
+           well */
+    }
+
+    processing = false;
+    consumer.join();
+
+    /* Can't really verify much except that all calls were counted and it
+       didn't crash. Sanitizers would catch the rest. */
+    CORRADE_COMPARE(called, processed);
+    CORRADE_COMPARE_AS(processed, emitted, TestSuite::Compare::LessOrEqual);
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Interconnect::Test::EventQueueTest)
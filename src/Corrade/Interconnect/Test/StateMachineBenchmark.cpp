@@ -0,0 +1,109 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Interconnect/StateMachine.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Format.h"
+
+namespace Corrade { namespace Interconnect { namespace Test { namespace {
+
+struct StateMachineBenchmark: TestSuite::Tester {
+    explicit StateMachineBenchmark();
+
+    template<std::size_t states> void step();
+    template<std::size_t states> void stepNoConnections();
+};
+
+StateMachineBenchmark::StateMachineBenchmark() {
+    addBenchmarks<StateMachineBenchmark>({&StateMachineBenchmark::step<16>,
+                                         &StateMachineBenchmark::step<64>,
+                                         &StateMachineBenchmark::step<256>,
+                                         &StateMachineBenchmark::stepNoConnections<256>}, 25);
+}
+
+enum class State: std::uint8_t {};
+
+enum class Input: std::uint8_t {
+    Next,
+    Reset
+};
+
+/* A ring of states, similarly to a protocol going through its phases */
+template<std::size_t states> void setupTransitions(StateMachine<states, 2, State, Input>& machine) {
+    for(std::size_t i = 0; i != states; ++i) machine.addTransitions({
+        {State(i), Input::Next, State((i + 1) % states)},
+        {State(i), Input::Reset, State(0)}
+    });
+}
+
+template<std::size_t states> void StateMachineBenchmark::step() {
+    setTestCaseTemplateName(Utility::format("{}", states));
+
+    typedef StateMachine<states, 2, State, Input> Machine;
+    Machine machine;
+    setupTransitions(machine);
+
+    /* Connect to entering and exiting every state, which is what a typical
+       use would do, and which makes the emitter contain a signal for each.
+       The stepped() signals aren't connected, so their lookup fails in
+       every step. */
+    typedef Implementation::StateMachineStateSignals<Machine, State, typename Containers::Implementation::GenerateSequence<states>::Type> StateSignals;
+    std::size_t entered = 0;
+    std::size_t exited = 0;
+    for(std::size_t i = 0; i != states; ++i) {
+        Interconnect::connect(machine, StateSignals::Entered[i], [&entered](State) {
+            ++entered;
+        });
+        Interconnect::connect(machine, StateSignals::Exited[i], [&exited](State) {
+            ++exited;
+        });
+    }
+
+    CORRADE_BENCHMARK(100)
+        for(std::size_t i = 0; i != 1000; ++i)
+            machine.step(Input::Next);
+
+    CORRADE_COMPARE(entered, 100*1000);
+    CORRADE_COMPARE(exited, 100*1000);
+}
+
+template<std::size_t states> void StateMachineBenchmark::stepNoConnections() {
+    setTestCaseTemplateName(Utility::format("{}", states));
+
+    typedef StateMachine<states, 2, State, Input> Machine;
+    Machine machine;
+    setupTransitions(machine);
+
+    CORRADE_BENCHMARK(100)
+        for(std::size_t i = 0; i != 1000; ++i)
+            machine.step(Input::Next);
+
+    CORRADE_COMPARE(std::size_t(machine.current()), 100*1000 % states);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Interconnect::Test::StateMachineBenchmark)
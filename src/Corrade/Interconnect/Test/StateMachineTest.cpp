@@ -35,11 +35,13 @@ struct StateMachineTest: TestSuite::Tester {
 
     void signalData();
     void test();
+    void manyConnectedStates();
 };
 
 StateMachineTest::StateMachineTest() {
     addTests({&StateMachineTest::signalData,
-              &StateMachineTest::test});
+              &StateMachineTest::test,
+              &StateMachineTest::manyConnectedStates});
 }
 
 enum class State: std::uint8_t {
@@ -114,6 +116,54 @@ void StateMachineTest::test() {
         "start entered, previous 1\n");
 }
 
+void StateMachineTest::manyConnectedStates() {
+    /* With more than a few connected signals the emitter switches from a
+       linear search to a hash table, verify the lookup still delivers each
+       signal to the right slot */
+    enum class ManyState: std::uint8_t {};
+    typedef Interconnect::StateMachine<32, 1, ManyState, Input> ManyStateMachine;
+    typedef Implementation::StateMachineStateSignals<ManyStateMachine, ManyState, Containers::Implementation::GenerateSequence<32>::Type> StateSignals;
+
+    ManyStateMachine machine;
+    for(std::size_t i = 0; i != 32; ++i)
+        machine.addTransitions({{ManyState(i), Input::KeyA, ManyState((i + 1) % 32)}});
+
+    /* Sums of the previous / next states passed to the slots */
+    std::size_t entered[32]{};
+    std::size_t exited[32]{};
+    for(std::size_t i = 0; i != 32; ++i) {
+        Interconnect::connect(machine, StateSignals::Entered[i], [&entered, i](ManyState previous) {
+            entered[i] += std::size_t(previous);
+        });
+        Interconnect::connect(machine, StateSignals::Exited[i], [&exited, i](ManyState next) {
+            exited[i] += std::size_t(next);
+        });
+    }
+    Interconnect::connect(machine, &ManyStateMachine::stepped<ManyState(7), ManyState(8)>, [&entered]() {
+        entered[8] += 1000;
+    });
+
+    /* Going twice around the ring */
+    for(std::size_t i = 0; i != 64; ++i)
+        machine.step(Input::KeyA);
+    for(std::size_t i = 0; i != 32; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(entered[i], 2*((i + 31) % 32) + (i == 8 ? 2000 : 0));
+        CORRADE_COMPARE(exited[i], 2*((i + 1) % 32));
+    }
+
+    /* After removing all connections, only new connections get called */
+    machine.disconnectAllSignals();
+    std::size_t enteredAgain = 0;
+    Interconnect::connect(machine, StateSignals::Entered[5], [&enteredAgain](ManyState) {
+        ++enteredAgain;
+    });
+    for(std::size_t i = 0; i != 32; ++i)
+        machine.step(Input::KeyA);
+    CORRADE_COMPARE(enteredAgain, 1);
+    CORRADE_COMPARE(entered[5], 2*4);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::Interconnect::Test::StateMachineTest)
@@ -28,6 +28,7 @@
 #include <string>
 
 #include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/Optional.h"
 #include "Corrade/Containers/String.h"
 #include "Corrade/Containers/StringIterable.h"
 #include "Corrade/Interconnect/Emitter.h"
@@ -35,6 +36,7 @@
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/TestSuite/Compare/SortedContainer.h"
 #include "Corrade/TestSuite/Compare/Numeric.h"
+#include "Corrade/Utility/DebugStl.h"
 
 namespace Corrade { namespace Interconnect { namespace Test { namespace {
 
@@ -72,13 +74,24 @@ struct Test: TestSuite::Tester {
     void templatedSignal();
 
     void changeConnectionsInSlot();
+    void connectInSlotReallocate();
+    void disconnectInSlot();
     void deleteReceiverInSlot();
+    void emitOrder();
 
     void function();
     void capturingLambda();
     void stdFunction();
 
     void nonCopyableParameter();
+
+    void batch();
+    void batchNested();
+    void batchScope();
+    void batchConnectionsChanged();
+    void batchEmitInSlot();
+    void batchBeginInSlot();
+    void batchNonCopyableParameter();
 };
 
 class Postman: public Interconnect::Emitter {
@@ -172,13 +185,24 @@ Test::Test() {
               &Test::templatedSignal,
 
               &Test::changeConnectionsInSlot,
+              &Test::connectInSlotReallocate,
+              &Test::disconnectInSlot,
               &Test::deleteReceiverInSlot,
+              &Test::emitOrder,
 
               &Test::function,
               &Test::capturingLambda,
               &Test::stdFunction,
 
-              &Test::nonCopyableParameter});
+              &Test::nonCopyableParameter,
+
+              &Test::batch,
+              &Test::batchNested,
+              &Test::batchScope,
+              &Test::batchConnectionsChanged,
+              &Test::batchEmitInSlot,
+              &Test::batchBeginInSlot,
+              &Test::batchNonCopyableParameter});
 }
 
 void Test::signalData() {
@@ -860,6 +884,91 @@ void Test::changeConnectionsInSlot() {
     CORRADE_COMPARE(mailbox.money, 19);
 }
 
+void Test::connectInSlotReallocate() {
+    Postman postman;
+    int called = 0;
+    int calledNew = 0;
+
+    /* The lambda is stored inline in the connection data. Connecting more
+       slots from it causes the storage to be reallocated, the captured state
+       should still be accessible after. */
+    Interconnect::connect(postman, &Postman::paymentRequested, [&postman, &called, &calledNew](int amount) {
+        if(called++) return;
+
+        for(int i = 0; i != 15; ++i)
+            Interconnect::connect(postman, &Postman::paymentRequested, [&calledNew](int amount) {
+                calledNew += amount;
+            });
+
+        /* This would access freed memory if the original storage was
+           deallocated right away */
+        called += amount;
+    });
+
+    /* The newly added slots get called in the same emission */
+    postman.paymentRequested(3);
+    CORRADE_COMPARE(called, 4);
+    CORRADE_COMPARE(calledNew, 15*3);
+    CORRADE_COMPARE(postman.signalConnectionCount(&Postman::paymentRequested), 16);
+
+    postman.paymentRequested(1);
+    CORRADE_COMPARE(called, 5);
+    CORRADE_COMPARE(calledNew, 15*3 + 15);
+}
+
+void Test::disconnectInSlot() {
+    Postman postman;
+    Mailbox mailbox1, mailbox2;
+    int destructed = 0;
+    struct Destructor {
+        int* destructed;
+        ~Destructor() { ++*destructed; }
+    };
+    Destructor destructor{&destructed};
+
+    Connection c1 = Interconnect::connect(postman, &Postman::newMessage, mailbox1, &Mailbox::addMessage);
+    /* Heap-allocated because of the destructor */
+    Containers::Optional<Connection> self;
+    std::size_t countInSlot = 0;
+    self = Interconnect::connect(postman, &Postman::newMessage, [&postman, &self, &c1, &countInSlot, &destructed, destructor](int, Containers::StringView) {
+        /* Disconnecting an already called slot and the slot itself, which
+           should be deferred until the emission finishes */
+        CORRADE_VERIFY(Interconnect::disconnect(postman, c1));
+        CORRADE_VERIFY(Interconnect::disconnect(postman, *self));
+        countInSlot = postman.signalConnectionCount();
+        CORRADE_COMPARE(destructed, 0);
+    });
+    Interconnect::connect(postman, &Postman::newMessage, mailbox2, &Mailbox::addMessage);
+    /* Reset the count from the temporaries that got destroyed while
+       connecting */
+    destructed = 0;
+    CORRADE_COMPARE(postman.signalConnectionCount(), 3);
+
+    postman.newMessage(11, "hello");
+    CORRADE_COMPARE(countInSlot, 1);
+    CORRADE_COMPARE(destructed, 1);
+    CORRADE_COMPARE(postman.signalConnectionCount(), 1);
+    CORRADE_VERIFY(!postman.isConnected(c1));
+    CORRADE_VERIFY(!postman.isConnected(*self));
+    CORRADE_COMPARE(mailbox1.slotConnectionCount(), 0);
+    CORRADE_COMPARE(mailbox2.slotConnectionCount(), 1);
+    CORRADE_COMPARE_AS(mailbox1.messages, Containers::StringIterable{
+        "hello"
+    }, TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mailbox2.messages, Containers::StringIterable{
+        "hello"
+    }, TestSuite::Compare::Container);
+
+    /* The removed slots are not called anymore */
+    postman.newMessage(11, "again");
+    CORRADE_COMPARE_AS(mailbox1.messages, Containers::StringIterable{
+        "hello"
+    }, TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mailbox2.messages, (Containers::StringIterable{
+        "hello", "again"
+    }), TestSuite::Compare::Container);
+}
+
 void Test::deleteReceiverInSlot() {
     class SuicideMailbox: public Interconnect::Receiver {
         public:
@@ -888,6 +997,27 @@ void Test::deleteReceiverInSlot() {
     }, TestSuite::Compare::Container);
 }
 
+void Test::emitOrder() {
+    Postman postman;
+    std::string out;
+    Connection a = Interconnect::connect(postman, &Postman::paymentRequested, [&out](int) { out += "a"; });
+    Connection b = Interconnect::connect(postman, &Postman::paymentRequested, [&out](int) { out += "b"; });
+    Interconnect::connect(postman, &Postman::paymentRequested, [&out](int) { out += "c"; });
+    Interconnect::connect(postman, &Postman::paymentRequested, [&out](int) { out += "d"; });
+
+    /* Slots are called in the order they were connected */
+    postman.paymentRequested(0);
+    CORRADE_COMPARE(out, "abcd");
+
+    /* Which is preserved after disconnecting and connecting more */
+    CORRADE_VERIFY(Interconnect::disconnect(postman, b));
+    Interconnect::connect(postman, &Postman::paymentRequested, [&out](int) { out += "e"; });
+    CORRADE_VERIFY(Interconnect::disconnect(postman, a));
+    out = {};
+    postman.paymentRequested(0);
+    CORRADE_COMPARE(out, "cde");
+}
+
 void Test::function() {
     Containers::String out;
     Debug redirectDebug{&out};
@@ -959,6 +1089,211 @@ void Test::nonCopyableParameter() {
     CORRADE_COMPARE(receiver.received, 42);
 }
 
+void Test::batch() {
+    Postman postman;
+    std::string out;
+    Interconnect::connect(postman, &Postman::paymentRequested, [&out](int amount) {
+        out += std::to_string(amount) + ";";
+    });
+    Interconnect::connect(postman, &Postman::newMessage, [&out](int price, Containers::StringView message) {
+        out.append(message.data(), message.size());
+        out += std::to_string(price) + ";";
+    });
+
+    CORRADE_VERIFY(!postman.isBatching());
+    postman.beginBatch();
+    CORRADE_VERIFY(postman.isBatching());
+
+    /* Nothing gets called in a batch */
+    postman.paymentRequested(1);
+    postman.newMessage(3, "hello");
+    postman.paymentRequested(2);
+    postman.newMessage(4, "bye");
+    postman.paymentRequested(5);
+    CORRADE_COMPARE(out, "");
+
+    /* Each signal is emitted just once with the last arguments, in order of
+       the first emission */
+    postman.endBatch();
+    CORRADE_VERIFY(!postman.isBatching());
+    CORRADE_COMPARE(out, "5;bye4;");
+
+    /* Without a batch, slots get called directly again */
+    out = {};
+    postman.paymentRequested(6);
+    CORRADE_COMPARE(out, "6;");
+
+    /* An empty batch does nothing */
+    out = {};
+    postman.beginBatch();
+    postman.endBatch();
+    CORRADE_COMPARE(out, "");
+}
+
+void Test::batchNested() {
+    Postman postman;
+    std::string out;
+    Interconnect::connect(postman, &Postman::paymentRequested, [&out](int amount) {
+        out += std::to_string(amount) + ";";
+    });
+
+    postman.beginBatch();
+    postman.paymentRequested(1);
+    postman.beginBatch();
+    postman.paymentRequested(2);
+    postman.endBatch();
+
+    /* Delivered only at the end of the outermost batch */
+    CORRADE_VERIFY(postman.isBatching());
+    CORRADE_COMPARE(out, "");
+    postman.paymentRequested(3);
+    postman.endBatch();
+    CORRADE_COMPARE(out, "3;");
+}
+
+void Test::batchScope() {
+    Postman postman;
+    std::string out;
+    Interconnect::connect(postman, &Postman::paymentRequested, [&out](int amount) {
+        out += std::to_string(amount) + ";";
+    });
+
+    {
+        Emitter::Batch batch{postman};
+        CORRADE_VERIFY(postman.isBatching());
+        postman.paymentRequested(1);
+        postman.paymentRequested(2);
+        CORRADE_COMPARE(out, "");
+    }
+
+    CORRADE_VERIFY(!postman.isBatching());
+    CORRADE_COMPARE(out, "2;");
+}
+
+void Test::batchConnectionsChanged() {
+    Postman postman;
+    std::string out;
+
+    postman.beginBatch();
+
+    /* Not connected at the time of emission, ignored */
+    postman.paymentRequested(1);
+
+    Connection a = Interconnect::connect(postman, &Postman::paymentRequested, [&out](int amount) {
+        out += "a" + std::to_string(amount) + ";";
+    });
+    postman.paymentRequested(2);
+
+    /* Connections at the end of the batch get called */
+    CORRADE_VERIFY(Interconnect::disconnect(postman, a));
+    Interconnect::connect(postman, &Postman::paymentRequested, [&out](int amount) {
+        out += "b" + std::to_string(amount) + ";";
+    });
+
+    postman.endBatch();
+    CORRADE_COMPARE(out, "b2;");
+
+    /* If everything is disconnected, the emission does nothing */
+    out = {};
+    postman.beginBatch();
+    postman.paymentRequested(3);
+    postman.disconnectAllSignals();
+    postman.endBatch();
+    CORRADE_COMPARE(out, "");
+}
+
+void Test::batchEmitInSlot() {
+    Postman postman;
+    std::string out;
+    Interconnect::connect(postman, &Postman::paymentRequested, [&postman, &out](int amount) {
+        out += std::to_string(amount) + ";";
+        if(amount == 1) {
+            /* Emissions from slots at the end of a batch aren't batched */
+            postman.newMessage(1, "a");
+            postman.newMessage(2, "b");
+        } else if(amount == 2) {
+            /* Unless the slot begins a new batch */
+            Emitter::Batch batch{postman};
+            postman.newMessage(3, "c");
+            postman.newMessage(4, "d");
+        }
+    });
+    Interconnect::connect(postman, &Postman::newMessage, [&out](int price, Containers::StringView message) {
+        out.append(message.data(), message.size());
+        out += std::to_string(price) + ";";
+    });
+
+    postman.beginBatch();
+    postman.paymentRequested(1);
+    postman.endBatch();
+    CORRADE_COMPARE(out, "1;a1;b2;");
+
+    out = {};
+    postman.beginBatch();
+    postman.paymentRequested(2);
+    postman.endBatch();
+    CORRADE_COMPARE(out, "2;d4;");
+}
+
+void Test::batchBeginInSlot() {
+    Postman postman;
+    std::string out;
+    Interconnect::connect(postman, &Postman::paymentRequested, [&postman, &out](int amount) {
+        out += std::to_string(amount) + ";";
+        /* Begins a new batch and leaves it open */
+        postman.beginBatch();
+    });
+    Interconnect::connect(postman, &Postman::newMessage, [&out](int price, Containers::StringView message) {
+        out.append(message.data(), message.size());
+        out += std::to_string(price) + ";";
+    });
+
+    postman.beginBatch();
+    postman.paymentRequested(1);
+    postman.newMessage(2, "a");
+    postman.endBatch();
+
+    /* The emission that was batched after the slot is moved to the new
+       batch */
+    CORRADE_COMPARE(out, "1;");
+    CORRADE_VERIFY(postman.isBatching());
+
+    postman.newMessage(3, "b");
+    postman.endBatch();
+    CORRADE_COMPARE(out, "1;b3;");
+    CORRADE_VERIFY(!postman.isBatching());
+}
+
+void Test::batchNonCopyableParameter() {
+    struct NonCopyable {
+        explicit NonCopyable(int a): a{a} {}
+
+        NonCopyable(const NonCopyable&) = delete;
+        NonCopyable& operator=(const NonCopyable&) = delete;
+
+        int a;
+    };
+
+    struct E: Emitter {
+        Signal send(const NonCopyable& a) {
+            return emit(&E::send, a);
+        }
+    } emitter;
+
+    int received = 0;
+    Interconnect::connect(emitter, &E::send, [&received](const NonCopyable& a) {
+        received += a.a;
+    });
+
+    /* Can't be batched, gets delivered immediately */
+    emitter.beginBatch();
+    NonCopyable a{42};
+    emitter.send(a);
+    CORRADE_COMPARE(received, 42);
+    emitter.endBatch();
+    CORRADE_COMPARE(received, 42);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::Interconnect::Test::Test)
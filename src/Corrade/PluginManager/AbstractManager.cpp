@@ -27,25 +27,42 @@
 #include "AbstractManager.h"
 
 #include <algorithm> /* std::find() */
-#include <map>
 #include <set>
 #include <sstream>
+#include <vector>
 
 #include "Corrade/Containers/Array.h"
 #include "Corrade/Containers/GrowableArray.h"
 #include "Corrade/Containers/EnumSet.hpp"
 #include "Corrade/Containers/Optional.h"
+#include "Corrade/Containers/Pair.h"
 #include "Corrade/Containers/Reference.h"
 #include "Corrade/Containers/StringIterable.h"
+#include "Corrade/Containers/StringStl.h" /** @todo drop once Configuration is std::string-free */
 #include "Corrade/Containers/Implementation/RawForwardList.h"
 #include "Corrade/PluginManager/AbstractPlugin.h"
 #include "Corrade/PluginManager/Implementation/Plugin.h"
 #include "Corrade/Utility/Assert.h"
 #include "Corrade/Utility/Configuration.h"
+#ifdef CORRADE_BUILD_STARTUP_PROFILING
+#include "Corrade/Utility/StartupProfile.h"
+#endif
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+#include <chrono>
+#include <cstring>
+
+#include "Corrade/Utility/Math.h"
 #include "Corrade/Utility/Path.h"
 
+#ifdef CORRADE_TARGET_UNIX
+#include <sys/stat.h>
+#endif
+#ifdef CORRADE_BUILD_MULTITHREADED
+#include <atomic>
+#include <thread>
+#endif
+
 #ifndef CORRADE_TARGET_WINDOWS
 #include <dlfcn.h>
 #else
@@ -68,6 +85,65 @@ namespace Corrade { namespace PluginManager {
 
 using namespace Containers::Literals;
 
+namespace {
+
+/* Used instead of a std::map in order to be able to look up a StringView
+   without having to allocate a String for it. Entries are kept sorted by the
+   key, so the lookup is a binary search and the iteration order is the same
+   as it was with the std::map. Insertion and removal is linear, but that
+   happens only when scanning the plugin directory or loading a plugin from a
+   file, not in metadata(), loadState(), instantiate() and other lookup-heavy
+   APIs. */
+template<class T> class PluginRegistry {
+    public:
+        typedef Containers::Pair<Containers::String, T> Entry;
+
+        std::size_t size() const { return _entries.size(); }
+        bool isEmpty() const { return _entries.isEmpty(); }
+
+        Entry* begin() { return _entries.begin(); }
+        const Entry* begin() const { return _entries.begin(); }
+        Entry* end() { return _entries.end(); }
+        const Entry* end() const { return _entries.end(); }
+
+        /* Returns end() if not found */
+        Entry* find(const Containers::StringView key) {
+            Entry* const found = lowerBound(key);
+            return found != end() && found->first() == key ? found : end();
+        }
+        const Entry* find(const Containers::StringView key) const {
+            return const_cast<PluginRegistry<T>&>(*this).find(key);
+        }
+
+        /* Same as std::map::insert(), doesn't overwrite an existing entry and
+           returns it instead. The key is copied only if it's not global and
+           null-terminated. */
+        Containers::Pair<Entry*, bool> insert(const Containers::StringView key, T value) {
+            Entry* const found = lowerBound(key);
+            if(found != end() && found->first() == key)
+                return {found, false};
+            return {&arrayInsert(_entries, found - begin(), InPlaceInit, Containers::String::nullTerminatedGlobalView(key), Utility::move(value)), true};
+        }
+
+        /* Returns the entry after the erased one */
+        Entry* erase(Entry* const entry) {
+            const std::size_t index = entry - begin();
+            arrayRemove(_entries, index);
+            return begin() + index;
+        }
+
+    private:
+        Entry* lowerBound(const Containers::StringView key) {
+            return std::lower_bound(begin(), end(), key, [](const Entry& a, const Containers::StringView b) {
+                return a.first() < b;
+            });
+        }
+
+        Containers::Array<Entry> _entries;
+};
+
+}
+
 struct AbstractManager::State {
     explicit State(Containers::StringView pluginInterface,
         #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
@@ -83,6 +159,7 @@ struct AbstractManager::State {
 
     #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
     Containers::String pluginDirectory;
+    ManagerFlags flags;
     #endif
     /* These are all global, checked in the AbstractManager constructor */
     Containers::StringView pluginInterface;
@@ -99,7 +176,7 @@ struct AbstractManager::State {
        complication. So a String is used for implementer sanity. Given that it
        can hold up to 22 bytes in the SSO representation, majority of names
        should fit without allocation. */
-    std::map<Containers::String, Containers::Pointer<Implementation::Plugin>> plugins;
+    PluginRegistry<Containers::Pointer<Implementation::Plugin>> plugins;
     /* Similarly here, at least one Plugin itself contains the (owned) alias
        string. But it's not a 1:1 mapping, meaning that if the key would be a
        StringView pointing to *some* occurence of that alias, it could happen
@@ -108,12 +185,16 @@ struct AbstractManager::State {
        remaining occurences. Which is again very complicated, so it's again a
        String. Regarding the SSO case, aliases are generally shorter than names
        so even more of them should fit into 22 bytes. */
-    std::map<Containers::String, Implementation::Plugin&> aliases;
+    PluginRegistry<Implementation::Plugin*> aliases;
 
     std::set<AbstractManager*> externalManagers;
     #ifndef CORRADE_NO_ASSERT
     std::set<AbstractManager*> externalManagerUsedBy;
     #endif
+
+    /* Instances passed to recycle(), owned by the manager. Can't be a growable
+       Array for the same reason as Plugin::instances. */
+    std::vector<AbstractPlugin*> instancePool;
 };
 
 const int AbstractManager::Version = CORRADE_PLUGIN_VERSION;
@@ -228,6 +309,10 @@ AbstractManager::AbstractManager(const Containers::StringView pluginInterface, c
         /* The plugin doesn't belong to this manager, skip it */
         if(staticPlugin->interface != _state->pluginInterface) continue;
 
+        #ifdef CORRADE_BUILD_STARTUP_PROFILING
+        const std::uint64_t start = Utility::Implementation::startupProfileTimestamp();
+        #endif
+
         /* Assign the plugin to this manager, parse its metadata and
            initialize it (unless the plugin is metadata-less) */
         Utility::Configuration configuration;
@@ -241,48 +326,36 @@ AbstractManager::AbstractManager(const Containers::StringView pluginInterface, c
            to being linked to multiple dynamic libraries. That's likely an
            undesired buildsystem issue, but shouldn't be fatal, so print a
            warning and skip it */
-        const auto inserted = _state->plugins.emplace(
+        const auto inserted = _state->plugins.insert(
             /* The plugin name is guaranteed to be a global literal even though
                it's just a const char*, wrap it without copying */
-            Containers::String::nullTerminatedView(staticPlugin->plugin),
+            Containers::StringView{staticPlugin->plugin, Containers::StringViewFlag::Global},
             nullptr);
-        if(!inserted.second) {
+        if(!inserted.second()) {
             Utility::Warning{} << "PluginManager::Manager: duplicate static plugin" << staticPlugin->plugin << Utility::Debug::nospace << ", ignoring";
             continue;
         }
 
         /* If it got successfully inserted, create the actual plugin state */
-        inserted.first->second.emplace(*staticPlugin, Utility::move(configuration));
+        inserted.first()->second().emplace(*staticPlugin, Utility::move(configuration));
 
-        Implementation::Plugin& p = *inserted.first->second;
+        Implementation::Plugin& p = *inserted.first()->second();
 
         p.staticPlugin->initializer();
 
+        #ifdef CORRADE_BUILD_STARTUP_PROFILING
+        Utility::Implementation::recordStartupProfileEvent(Utility::StartupProfileEventType::StaticPluginImport, staticPlugin->plugin, start);
+        #endif
+
         /* The plugin is the best version of itself. If there was already
            an alias for this name, replace it. */
-        {
-            /* Of course std::map::find() would allocate a new string in order
-               to find it, prevent that from happening by wrapping it again */
-            /** @todo clean this up once we kill std::map */
-            const auto alias = _state->aliases.find(Containers::String::nullTerminatedView(staticPlugin->plugin));
-            if(alias != _state->aliases.end()) _state->aliases.erase(alias);
-            /* And here as well -- wrap the string to avoid a copy */
-            /* Libc++ frees the passed Plugin& reference when using
-               emplace(), causing double-free memory corruption later.
-               Everything is okay with insert(). */
-            /** @todo put back emplace() here when libc++ is fixed */
-            CORRADE_INTERNAL_ASSERT_OUTPUT(_state->aliases.insert({Containers::String::nullTerminatedView(staticPlugin->plugin), p}).second);
-        }
+        /* And here as well -- the name is global so it's not copied */
+        _state->aliases.insert(p.name, &p).first()->second() = &p;
 
         /* Add aliases to the list (only the ones that aren't already there
            are added) */
-        for(const Containers::String& alias: p.provides) {
-            /* Libc++ frees the passed Plugin& reference when using
-               emplace(), causing double-free memory corruption later.
-               Everything is okay with insert(). */
-            /** @todo put back emplace() here when libc++ is fixed */
-            _state->aliases.insert({alias, p});
-        }
+        for(const Containers::String& alias: p.provides)
+            _state->aliases.insert(alias, &p);
     }
 
     #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
@@ -309,7 +382,7 @@ AbstractManager::AbstractManager(const Containers::StringView pluginInterface, c
            CorradeUtility.dll as a plugin. Don't print the warning in case
            we have static plugins (the aliases are non-empty) -- in that case
            assume the user might want to only use static plugins. */
-        if(!_state->pluginDirectory && _state->aliases.empty())
+        if(!_state->pluginDirectory && _state->aliases.isEmpty())
             Utility::Warning{} << "PluginManager::Manager: none of the plugin search paths in" << pluginSearchPaths << "exists and pluginDirectory was not set, skipping plugin discovery";
     }
     #endif
@@ -335,16 +408,27 @@ AbstractManager::~AbstractManager() {
         CORRADE_INTERNAL_ASSERT_OUTPUT(manager->_state->externalManagerUsedBy.erase(this) == 1);
     #endif
 
+    /* Pooled instances have to be deleted while their plugins are still
+       loaded */
+    clearInstancePool();
+
     /* Unload all plugins */
-    for(std::pair<const Containers::String, Containers::Pointer<Implementation::Plugin>>& plugin: _state->plugins) {
+    for(Containers::Pair<Containers::String, Containers::Pointer<Implementation::Plugin>>& plugin: _state->plugins) {
         #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
         /* Try to unload the plugin (and all plugins that depend on it) */
-        unloadRecursiveInternal(*plugin.second);
+        unloadRecursiveInternal(*plugin.second());
         #endif
 
         /* Finalize static plugins before they get removed from the list */
-        if(plugin.second->loadState == LoadState::Static)
-            plugin.second->staticPlugin->finalizer();
+        if(plugin.second()->loadState == LoadState::Static) {
+            #ifdef CORRADE_BUILD_STARTUP_PROFILING
+            const std::uint64_t start = Utility::Implementation::startupProfileTimestamp();
+            #endif
+            plugin.second()->staticPlugin->finalizer();
+            #ifdef CORRADE_BUILD_STARTUP_PROFILING
+            Utility::Implementation::recordStartupProfileEvent(Utility::StartupProfileEventType::StaticPluginEject, plugin.second()->staticPlugin->plugin, start);
+            #endif
+        }
     }
 }
 
@@ -358,7 +442,7 @@ LoadState AbstractManager::unloadRecursiveInternal(Implementation::Plugin& plugi
     while(!plugin.usedBy.isEmpty()) {
         const auto found = _state->plugins.find(plugin.usedBy.front());
         CORRADE_INTERNAL_ASSERT(found != _state->plugins.end());
-        return unloadRecursiveInternal(*found->second);
+        return unloadRecursiveInternal(*found->second());
     }
 
     /* Unload the plugin */
@@ -375,6 +459,202 @@ Containers::StringView AbstractManager::pluginInterface() const {
 }
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+namespace {
+
+/* The index is saved with native endianness and type sizes as it's only
+   meant to be used on the machine where it was saved. An index saved on a
+   machine with different endianness fails the version check. Bump the version
+   if the layout changes. */
+constexpr Containers::StringView MetadataIndexFilename = ".corrade-plugin-index"_s;
+constexpr char MetadataIndexMagic[4]{'C', 'P', 'M', 'I'};
+constexpr std::uint32_t MetadataIndexVersion = 2;
+
+/* The header consists of the magic, a 32-bit version, a 64-bit directory
+   modification time and a 32-bit plugin count, written field by field so
+   there's no padding. It's followed by the plugin suffix and metadata suffix
+   strings and then the plugin entries, each containing the plugin name
+   string, metadata file size, metadata file modification time and a
+   serialized configuration, which is empty if the metadata aren't cached.
+   Strings and the serialized configuration are prefixed with a 32-bit size.
+   Nothing is aligned, values are read with memcpy(). */
+constexpr std::size_t MetadataIndexPluginCountOffset = sizeof(MetadataIndexMagic) + sizeof(std::uint32_t) + sizeof(std::int64_t);
+
+/* A serialized configuration group is a 32-bit entry count followed by the
+   entries in order, each starting with one of these */
+enum class MetadataIndexGroupEntry: std::uint8_t {
+    /* Followed by a key and a value string */
+    Value,
+    /* Followed by a name string and a serialized group */
+    Group
+};
+
+struct MetadataIndexEntry {
+    Containers::StringView name;
+    std::uint64_t metadataSize;
+    std::int64_t metadataModification;
+    Containers::ArrayView<const char> metadata;
+};
+
+void appendMetadataIndex(Containers::Array<char>& out, const void* const data, const std::size_t size) {
+    arrayAppend(out, Containers::arrayView(static_cast<const char*>(data), size));
+}
+
+template<class T> void appendMetadataIndex(Containers::Array<char>& out, const T& value) {
+    appendMetadataIndex(out, &value, sizeof(T));
+}
+
+void appendMetadataIndex(Containers::Array<char>& out, const Containers::StringView string) {
+    appendMetadataIndex(out, std::uint32_t(string.size()));
+    appendMetadataIndex(out, string.data(), string.size());
+}
+
+/* Comments and empty lines aren't preserved. Entries are written in the
+   order the group stores them, i.e. the same order in which
+   Configuration::save() would write them, and restored in the same order. */
+void appendMetadataIndexGroup(Containers::Array<char>& out, const Utility::ConfigurationGroup& group) {
+    appendMetadataIndex(out, std::uint32_t(group.valueCount() + group.groupCount()));
+    for(Containers::Pair<Containers::StringView, Containers::StringView> value: group.values()) {
+        appendMetadataIndex(out, MetadataIndexGroupEntry::Value);
+        appendMetadataIndex(out, value.first());
+        appendMetadataIndex(out, value.second());
+    }
+
+    for(Containers::Pair<Containers::StringView, Containers::Reference<const Utility::ConfigurationGroup>> subgroup: group.groups()) {
+        appendMetadataIndex(out, MetadataIndexGroupEntry::Group);
+        appendMetadataIndex(out, subgroup.first());
+        appendMetadataIndexGroup(out, *subgroup.second());
+    }
+}
+
+/* Used to validate the index entries. The values are only ever compared to
+   values produced by this same function, printing nothing if the file can't
+   be queried. */
+bool metadataFileStatus(const Containers::StringView filename, std::uint64_t& size, std::int64_t& modification) {
+    #ifdef CORRADE_TARGET_UNIX
+    /* A single stat() instead of Path::size() and Path::lastModification(),
+       the former of which opens the file */
+    struct stat result;
+    if(stat(Containers::String::nullTerminatedView(filename).data(), &result) != 0)
+        return false;
+
+    size = result.st_size;
+    /* See Path::lastModification() for details */
+    modification =
+        #ifdef CORRADE_TARGET_APPLE
+        std::int64_t(result.st_mtimespec.tv_sec)*1000000000 + result.st_mtimespec.tv_nsec
+        #elif defined(st_mtime)
+        std::int64_t(result.st_mtim.tv_sec)*1000000000 + result.st_mtim.tv_nsec
+        #else
+        std::int64_t(result.st_mtime)*1000000000
+        #endif
+        ;
+    return true;
+    #else
+    Utility::Error silenceError{nullptr};
+    const Containers::Optional<std::size_t> fileSize = Utility::Path::size(filename);
+    const Containers::Optional<std::int64_t> fileModification = Utility::Path::lastModification(filename);
+    if(!fileSize || !fileModification)
+        return false;
+
+    size = *fileSize;
+    modification = *fileModification;
+    return true;
+    #endif
+}
+
+/* All reads are bounds-checked, returning false if there's not enough data */
+bool readMetadataIndex(Containers::ArrayView<const char>& data, void* const out, const std::size_t size) {
+    if(data.size() < size) return false;
+    std::memcpy(out, data.data(), size);
+    data = data.exceptPrefix(size);
+    return true;
+}
+
+template<class T> bool readMetadataIndex(Containers::ArrayView<const char>& data, T& out) {
+    return readMetadataIndex(data, &out, sizeof(T));
+}
+
+bool readMetadataIndex(Containers::ArrayView<const char>& data, Containers::ArrayView<const char>& out) {
+    std::uint32_t size;
+    if(!readMetadataIndex(data, size) || data.size() < size) return false;
+    out = data.prefix(size);
+    data = data.exceptPrefix(size);
+    return true;
+}
+
+bool readMetadataIndex(Containers::ArrayView<const char>& data, Containers::StringView& out) {
+    Containers::ArrayView<const char> string;
+    if(!readMetadataIndex(data, string)) return false;
+    out = string;
+    return true;
+}
+
+bool readMetadataIndexGroup(Containers::ArrayView<const char>& data, Utility::ConfigurationGroup& group) {
+    std::uint32_t entryCount;
+    if(!readMetadataIndex(data, entryCount)) return false;
+    for(std::uint32_t i = 0; i != entryCount; ++i) {
+        MetadataIndexGroupEntry type;
+        Containers::StringView name;
+        if(!readMetadataIndex(data, type) || !readMetadataIndex(data, name) || name.isEmpty())
+            return false;
+
+        if(type == MetadataIndexGroupEntry::Value) {
+            Containers::StringView value;
+            if(!readMetadataIndex(data, value)) return false;
+            group.addValue(name, value);
+        } else if(type == MetadataIndexGroupEntry::Group) {
+            if(!readMetadataIndexGroup(data, *group.addGroup(name)))
+                return false;
+        } else return false;
+    }
+
+    return true;
+}
+
+/* Validates the whole index upfront so the entries can be used without any
+   further checks. Deserialization of the configurations is deferred until
+   it's known they're actually needed, only their bounds are checked here. */
+Containers::Optional<Containers::Array<MetadataIndexEntry>> parseMetadataIndex(Containers::ArrayView<const char> data, const Containers::StringView pluginSuffix, const Containers::StringView pluginMetadataSuffix, std::int64_t& directoryModification) {
+    char magic[sizeof(MetadataIndexMagic)];
+    std::uint32_t version;
+    std::int64_t indexDirectoryModification;
+    std::uint32_t pluginCount;
+    Containers::StringView indexPluginSuffix, indexPluginMetadataSuffix;
+    if(!readMetadataIndex(data, magic) ||
+       std::memcmp(magic, MetadataIndexMagic, sizeof(MetadataIndexMagic)) != 0 ||
+       !readMetadataIndex(data, version) ||
+       version != MetadataIndexVersion ||
+       !readMetadataIndex(data, indexDirectoryModification) ||
+       !readMetadataIndex(data, pluginCount) ||
+       !readMetadataIndex(data, indexPluginSuffix) ||
+       !readMetadataIndex(data, indexPluginMetadataSuffix))
+        return {};
+
+    /* Saved by a manager with different suffixes, can't be used */
+    if(indexPluginSuffix != pluginSuffix || indexPluginMetadataSuffix != pluginMetadataSuffix)
+        return {};
+
+    Containers::Array<MetadataIndexEntry> entries{NoInit, pluginCount};
+    for(MetadataIndexEntry& entry: entries) {
+        if(!readMetadataIndex(data, entry.name) ||
+           !readMetadataIndex(data, entry.metadataSize) ||
+           !readMetadataIndex(data, entry.metadataModification) ||
+           !readMetadataIndex(data, entry.metadata))
+            return {};
+    }
+
+    /* The entries are expected to be sorted for a binary search */
+    for(std::size_t i = 1; i < entries.size(); ++i)
+        if(!(entries[i - 1].name < entries[i].name)) return {};
+
+    if(!data.isEmpty()) return {};
+
+    directoryModification = indexDirectoryModification;
+    return entries;
+}
+
+}
+
 Containers::StringView AbstractManager::pluginDirectory() const {
     return _state->pluginDirectory;
 }
@@ -384,17 +664,17 @@ void AbstractManager::setPluginDirectory(const Containers::StringView directory)
 
     /* Remove aliases for unloaded plugins from the container. They need to be
        removed before plugins themselves */
-    auto ait = _state->aliases.cbegin();
-    while(ait != _state->aliases.cend()) {
-        if(ait->second.loadState & (LoadState::NotLoaded|LoadState::WrongMetadataFile))
+    auto ait = _state->aliases.begin();
+    while(ait != _state->aliases.end()) {
+        if(ait->second()->loadState & (LoadState::NotLoaded|LoadState::WrongMetadataFile))
             ait = _state->aliases.erase(ait);
         else ++ait;
     }
 
     /* Remove all unloaded plugins from the container */
-    auto it = _state->plugins.cbegin();
-    while(it != _state->plugins.cend()) {
-        if(it->second->loadState & (LoadState::NotLoaded|LoadState::WrongMetadataFile))
+    auto it = _state->plugins.begin();
+    while(it != _state->plugins.end()) {
+        if(it->second()->loadState & (LoadState::NotLoaded|LoadState::WrongMetadataFile))
             it = _state->plugins.erase(it);
         else ++it;
     }
@@ -406,73 +686,189 @@ void AbstractManager::setPluginDirectory(const Containers::StringView directory)
         when the directory doesn't exist, as a lot of existing code and tests
         relies on it. Figure out a better solution. */
     if(Utility::Path::exists(_state->pluginDirectory)) {
-        Containers::Optional<Containers::Array<Containers::String>> d = Utility::Path::list(
+        /* Use the metadata index, if there's any. See saveMetadataIndex() for
+           details. */
+        const Containers::String indexFilename = Utility::Path::join(_state->pluginDirectory, MetadataIndexFilename);
+        Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> indexData;
+        Containers::Array<MetadataIndexEntry> index;
+        std::int64_t indexDirectoryModification{};
+        if(Utility::Path::exists(indexFilename) && (indexData = Utility::Path::mapRead(indexFilename))) {
+            if(Containers::Optional<Containers::Array<MetadataIndexEntry>> parsed = parseMetadataIndex(*indexData, _state->pluginSuffix, _state->pluginMetadataSuffix, indexDirectoryModification))
+                index = *Utility::move(parsed);
+            else {
+                Utility::Warning{} << "PluginManager::Manager: ignoring invalid metadata index" << indexFilename;
+                indexData = Containers::NullOpt;
+            }
+        }
+
+        /* If the directory wasn't modified since the index was saved, take
+           the plugin names from the index. Otherwise list the directory. */
+        Containers::Array<Containers::StringView> names;
+        Containers::Optional<Containers::Array<Containers::String>> d;
+        if(indexData && Utility::Path::lastModification(_state->pluginDirectory) == indexDirectoryModification) {
+            names = Containers::Array<Containers::StringView>{NoInit, index.size()};
+            for(std::size_t i = 0; i != index.size(); ++i)
+                names[i] = index[i].name;
+        } else if((d = Utility::Path::list(
             _state->pluginDirectory,
             Utility::Path::ListFlag::SkipDirectories|
             Utility::Path::ListFlag::SkipDotAndDotDot|
-            Utility::Path::ListFlag::SortAscending);
-        if(d) for(const Containers::StringView filename: *d) {
-            /* File doesn't have module suffix, continue to next */
-            if(!filename.hasSuffix(_state->pluginSuffix))
-                continue;
+            Utility::Path::ListFlag::SortAscending)))
+        {
+            for(const Containers::StringView filename: *d) {
+                /* File doesn't have module suffix, continue to next */
+                if(!filename.hasSuffix(_state->pluginSuffix))
+                    continue;
 
-            /* Dig plugin name from filename */
-            const Containers::StringView name = filename.exceptSuffix(_state->pluginSuffix);
+                /* Dig plugin name from filename */
+                arrayAppend(names, filename.exceptSuffix(_state->pluginSuffix));
+            }
+        }
 
+        for(const Containers::StringView name: names) {
             /* Skip the plugin if it is among loaded */
             if(_state->plugins.find(name) != _state->plugins.end()) continue;
 
-            registerDynamicPlugin(name, Containers::Pointer<Implementation::Plugin>{InPlaceInit, name,
-                _state->pluginMetadataSuffix ? Utility::Path::join(_state->pluginDirectory, name + _state->pluginMetadataSuffix) : Containers::String{}});
+            const Containers::String metadataFilename = _state->pluginMetadataSuffix ? Utility::Path::join(_state->pluginDirectory, name + _state->pluginMetadataSuffix) : Containers::String{};
+
+            /* If the metadata file didn't change since the index was saved,
+               take the metadata from there instead of parsing the file. The
+               name array is sorted in both cases, so a binary search can be
+               used. */
+            if(metadataFilename && !index.isEmpty()) {
+                const MetadataIndexEntry* const entry = std::lower_bound(index.begin(), index.end(), name, [](const MetadataIndexEntry& a, const Containers::StringView b) {
+                    return a.name < b;
+                });
+                /* If the file is gone, the message about that gets printed by
+                   the regular code path below */
+                std::uint64_t size;
+                std::int64_t modification;
+                if(entry != index.end() && entry->name == name && !entry->metadata.isEmpty() && metadataFileStatus(metadataFilename, size, modification) && size == entry->metadataSize && modification == entry->metadataModification) {
+                    Utility::Configuration metadata{Utility::Configuration::Flag::ReadOnly};
+                    Containers::ArrayView<const char> metadataData = entry->metadata;
+                    if(readMetadataIndexGroup(metadataData, metadata) && metadataData.isEmpty())
+                    {
+                        registerDynamicPlugin(name, Containers::Pointer<Implementation::Plugin>{InPlaceInit, name, Utility::move(metadata)});
+                        continue;
+                    }
+                }
+            }
+
+            registerDynamicPlugin(name, Containers::Pointer<Implementation::Plugin>{InPlaceInit, name, metadataFilename});
         }
     }
 
     /* If some of the currently loaded plugins aliased plugins that were in the
        old plugin directory, these are no longer there. Refresh the alias list
        with the new plugins. */
-    for(std::pair<const Containers::String, Containers::Pointer<Implementation::Plugin>>& p: _state->plugins) {
+    for(Containers::Pair<Containers::String, Containers::Pointer<Implementation::Plugin>>& p: _state->plugins) {
         /* Add aliases to the list (only the ones that aren't already there are
            added, calling insert() won't overwrite the existing value) */
-        for(const Containers::String& alias: p.second->provides) {
-            /* Libc++ frees the passed Plugin& reference when using emplace(),
-               causing double-free memory corruption later. Everything is okay
-               with insert(). */
-            /** @todo put back emplace() here when libc++ is fixed */
-            _state->aliases.insert({alias, *p.second});
-        }
+        for(const Containers::String& alias: p.second()->provides)
+            _state->aliases.insert(alias, p.second().get());
     }
 }
 
 void AbstractManager::reloadPluginDirectory() {
     setPluginDirectory(pluginDirectory());
 }
+
+bool AbstractManager::saveMetadataIndex() const {
+    if(!_state->pluginDirectory) {
+        Utility::Error{} << "PluginManager::Manager::saveMetadataIndex(): plugin directory is not set";
+        return false;
+    }
+
+    const Containers::String filename = Utility::Path::join(_state->pluginDirectory, MetadataIndexFilename);
+
+    /* Creating the index file changes the directory modification time, so
+       make sure it exists before querying it. Overwriting it later doesn't
+       change the directory anymore. */
+    if(!Utility::Path::exists(filename) && !Utility::Path::write(filename, Containers::ArrayView<const void>{}))
+        return false;
+
+    const Containers::Optional<std::int64_t> directoryModification = Utility::Path::lastModification(_state->pluginDirectory);
+    /* List the directory again instead of using the plugins known to the
+       manager, as some of them may be loaded from a different location */
+    const Containers::Optional<Containers::Array<Containers::String>> list = Utility::Path::list(
+        _state->pluginDirectory,
+        Utility::Path::ListFlag::SkipDirectories|
+        Utility::Path::ListFlag::SkipDotAndDotDot|
+        Utility::Path::ListFlag::SortAscending);
+    if(!directoryModification || !list) {
+        Utility::Error{} << "PluginManager::Manager::saveMetadataIndex(): can't list" << _state->pluginDirectory;
+        return false;
+    }
+
+    Containers::Array<char> out;
+    appendMetadataIndex(out, MetadataIndexMagic);
+    appendMetadataIndex(out, MetadataIndexVersion);
+    appendMetadataIndex(out, *directoryModification);
+    /* Patched with the final plugin count below */
+    appendMetadataIndex(out, std::uint32_t{});
+    appendMetadataIndex(out, _state->pluginSuffix);
+    appendMetadataIndex(out, _state->pluginMetadataSuffix);
+
+    std::uint32_t pluginCount = 0;
+    for(const Containers::StringView filename: *list) {
+        if(!filename.hasSuffix(_state->pluginSuffix))
+            continue;
+
+        const Containers::StringView name = filename.exceptSuffix(_state->pluginSuffix);
+        appendMetadataIndex(out, name);
+        ++pluginCount;
+
+        /* Metadata files that don't exist or fail to parse aren't cached, the
+           error is then reported by the regular code path when the manager
+           is constructed */
+        std::uint64_t size{};
+        std::int64_t modification{};
+        Containers::Array<char> serialized;
+        if(_state->pluginMetadataSuffix) {
+            const Containers::String metadataFilename = Utility::Path::join(_state->pluginDirectory, name + _state->pluginMetadataSuffix);
+            if(metadataFileStatus(metadataFilename, size, modification)) {
+                Utility::Error silenceError{nullptr};
+                const Utility::Configuration configuration{metadataFilename, Utility::Configuration::Flag::ReadOnly};
+                if(configuration.isValid())
+                    appendMetadataIndexGroup(serialized, configuration);
+            }
+        }
+
+        appendMetadataIndex(out, size);
+        appendMetadataIndex(out, modification);
+        appendMetadataIndex(out, std::uint32_t(serialized.size()));
+        appendMetadataIndex(out, serialized.data(), serialized.size());
+    }
+
+    /* Patch the final plugin count into the header */
+    std::memcpy(out.data() + MetadataIndexPluginCountOffset, &pluginCount, sizeof(pluginCount));
+
+    return Utility::Path::write(filename, out);
+}
+
+ManagerFlags AbstractManager::flags() const {
+    return _state->flags;
+}
+
+void AbstractManager::setFlags(const ManagerFlags flags) {
+    _state->flags = flags;
+}
 #endif
 
 void AbstractManager::setPreferredPlugins(const Containers::StringView alias, const Containers::StringIterable& plugins) {
-    /* Of course std::map::find() would allocate a new String in order to
-       find it, prevent that from happening by wrapping a view */
-    /** @todo clean this up once we kill std::map */
-    auto foundAlias = _state->aliases.find(Containers::String::nullTerminatedView(alias));
+    auto foundAlias = _state->aliases.find(alias);
     CORRADE_ASSERT(foundAlias != _state->aliases.end(),
         "PluginManager::Manager::setPreferredPlugins():" << alias << "is not a known alias", );
 
     /* Replace the alias with the first candidate that exists */
     for(const Containers::StringView plugin: plugins) {
-        /* Of course std::map::find() would allocate a new String in order to
-           find it, prevent that from happening by wrapping a view */
-        /** @todo clean this up once we kill std::map */
-        auto foundPlugin = _state->plugins.find(Containers::String::nullTerminatedView(plugin));
+        auto foundPlugin = _state->plugins.find(plugin);
         if(foundPlugin == _state->plugins.end())
             continue;
 
-        CORRADE_ASSERT(std::find(foundPlugin->second->provides.begin(), foundPlugin->second->provides.end(), alias) != foundPlugin->second->provides.end(),
+        CORRADE_ASSERT(std::find(foundPlugin->second()->provides.begin(), foundPlugin->second()->provides.end(), alias) != foundPlugin->second()->provides.end(),
             "PluginManager::Manager::setPreferredPlugins():" << plugin << "does not provide" << alias, );
-        _state->aliases.erase(foundAlias);
-        /* Libc++ frees the passed Plugin& reference when using emplace(),
-           causing double-free memory corruption later. Everything is okay with
-           insert(). */
-        /** @todo put back emplace() here when libc++ is fixed */
-        _state->aliases.insert({Containers::String::nullTerminatedGlobalView(alias), *foundPlugin->second});
+        foundAlias->second() = foundPlugin->second().get();
         break;
     }
 }
@@ -480,45 +876,36 @@ void AbstractManager::setPreferredPlugins(const Containers::StringView alias, co
 Containers::Array<Containers::StringView> AbstractManager::pluginList() const {
     Containers::Array<Containers::StringView> names{NoInit, _state->plugins.size()};
     std::size_t i = 0;
-    for(const std::pair<const Containers::String, Containers::Pointer<Implementation::Plugin>>& plugin: _state->plugins)
-        new(&names[i++]) Containers::StringView{plugin.first};
+    for(const Containers::Pair<Containers::String, Containers::Pointer<Implementation::Plugin>>& plugin: _state->plugins)
+        new(&names[i++]) Containers::StringView{plugin.first()};
     return names;
 }
 
 Containers::Array<Containers::StringView> AbstractManager::aliasList() const {
     Containers::Array<Containers::StringView> names{NoInit, _state->aliases.size()};
     std::size_t i = 0;
-    for(const std::pair<const Containers::String, Implementation::Plugin&>& alias: _state->aliases)
-        new(&names[i++]) Containers::StringView{alias.first};
+    for(const Containers::Pair<Containers::String, Implementation::Plugin*>& alias: _state->aliases)
+        new(&names[i++]) Containers::StringView{alias.first()};
     return names;
 }
 
 const PluginMetadata* AbstractManager::metadata(const Containers::StringView plugin) const {
-    /* Of course std::map::find() would allocate a new String in order to
-       find it, prevent that from happening by wrapping a view */
-    /** @todo clean this up once we kill std::map */
-    auto found = _state->aliases.find(Containers::String::nullTerminatedView(plugin));
-    if(found != _state->aliases.end()) return &found->second;
+    auto found = _state->aliases.find(plugin);
+    if(found != _state->aliases.end()) return found->second();
 
     return nullptr;
 }
 
 PluginMetadata* AbstractManager::metadata(const Containers::StringView plugin) {
-    /* Of course std::map::find() would allocate a new String in order to
-       find it, prevent that from happening by wrapping a view */
-    /** @todo clean this up once we kill std::map */
-    auto found = _state->aliases.find(Containers::String::nullTerminatedView(plugin));
-    if(found != _state->aliases.end()) return &found->second;
+    auto found = _state->aliases.find(plugin);
+    if(found != _state->aliases.end()) return found->second();
 
     return nullptr;
 }
 
 LoadState AbstractManager::loadState(const Containers::StringView plugin) const {
-    /* Of course std::map::find() would allocate a new String in order to
-       find it, prevent that from happening by wrapping a view */
-    /** @todo clean this up once we kill std::map */
-    auto found = _state->aliases.find(Containers::String::nullTerminatedView(plugin));
-    if(found != _state->aliases.end()) return found->second.loadState;
+    auto found = _state->aliases.find(plugin);
+    if(found != _state->aliases.end()) return found->second()->loadState;
 
     return LoadState::NotFound;
 }
@@ -530,12 +917,8 @@ LoadState AbstractManager::load(const Containers::StringView plugin) {
         /* Dig plugin name from filename and verify it's not loaded at the moment */
         const Containers::StringView filename = Utility::Path::filename(plugin);
         const Containers::StringView name = filename.exceptSuffix(_state->pluginSuffix.size());
-        /* std::map::find() would allocate a new String in order to find it,
-           unfortunately as the name slice is not null-terminated we can't
-           prevent anything with String::nullTerminatedView() */
-        /** @todo clean this up once we kill std::map */
         const auto found = _state->plugins.find(name);
-        if(found != _state->plugins.end() && (found->second->loadState & LoadState::Loaded)) {
+        if(found != _state->plugins.end() && (found->second()->loadState & LoadState::Loaded)) {
             Utility::Error{} << "PluginManager::load():" << filename << "conflicts with currently loaded plugin of the same name";
             return LoadState::Used;
         }
@@ -566,9 +949,9 @@ LoadState AbstractManager::load(const Containers::StringView plugin) {
             if(found != _state->plugins.end()) {
                 /* Erase all aliases that reference this plugin, as they would
                    be dangling now. */
-                auto ait = _state->aliases.cbegin();
-                while(ait != _state->aliases.cend()) {
-                    if(&ait->second == found->second.get())
+                auto ait = _state->aliases.begin();
+                while(ait != _state->aliases.end()) {
+                    if(ait->second() == found->second().get())
                         ait = _state->aliases.erase(ait);
                     else ++ait;
                 }
@@ -583,15 +966,12 @@ LoadState AbstractManager::load(const Containers::StringView plugin) {
     }
     #endif
 
-    /* Of course std::map::find() would allocate a new String in order to
-       find it, prevent that from happening by wrapping a view */
-    /** @todo clean this up once we kill std::map */
-    auto found = _state->aliases.find(Containers::String::nullTerminatedView(plugin));
+    auto found = _state->aliases.find(plugin);
     if(found != _state->aliases.end()) {
         #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        return loadInternal(found->second);
+        return loadInternal(*found->second());
         #else
-        return found->second.loadState;
+        return found->second()->loadState;
         #endif
     }
 
@@ -605,49 +985,23 @@ LoadState AbstractManager::load(const Containers::StringView plugin) {
 }
 
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-LoadState AbstractManager::loadInternal(Implementation::Plugin& plugin) {
-    return loadInternal(plugin, Utility::Path::join(_state->pluginDirectory, plugin.name + _state->pluginSuffix));
-}
-
-LoadState AbstractManager::loadInternal(Implementation::Plugin& plugin, Containers::StringView filename) {
-    /* Plugin is not ready to load */
-    if(plugin.loadState != LoadState::NotLoaded) {
-        if(!(plugin.loadState & (LoadState::Static|LoadState::Loaded)))
-            Utility::Error{} << "PluginManager::Manager::load(): plugin" << plugin.name << "is not ready to load:" << plugin.loadState;
-        return plugin.loadState;
-    }
-
-    /* Load dependencies and remember their names for later. Their names will
-       be added to usedBy list only if everything goes well. */
-    Containers::Array<Containers::Reference<Implementation::Plugin>> dependencies;
-    arrayReserve(dependencies, plugin.depends.size());
-    for(const Containers::String& dependency: plugin.depends) {
-        /* If the dependency is not in our plugin manager, check the registered
-           external managers as well */
-        AbstractManager* dependencyManager = nullptr;
-        auto foundDependency = _state->plugins.find(dependency);
-        if(foundDependency != _state->plugins.end())
-            dependencyManager = this;
-        else for(AbstractManager* other: _state->externalManagers) {
-            foundDependency = other->_state->plugins.find(dependency);
-            if(foundDependency != other->_state->plugins.end()) {
-                dependencyManager = other;
-                break;
-            }
-        }
-
-        if(!dependencyManager || !(dependencyManager->loadInternal(*foundDependency->second) & LoadState::Loaded)) {
-            Utility::Error{} << "PluginManager::Manager::load(): unresolved dependency" << dependency << "of plugin" << plugin.name;
-            return LoadState::UnresolvedDependency;
-        }
+namespace {
 
-        arrayAppend(dependencies, *foundDependency->second);
-    }
+/* Opens the plugin binary, checks its version and interface, and calls its
+   initializer, or with ManagerFlag::LazyLoad saves it for later. On success
+   fills in the module, instancer, initializer and finalizer, the load state is
+   left for the caller to update. Doesn't touch anything except the plugin
+   itself, so it can be called for different plugins from multiple threads at
+   once. */
+LoadState openPlugin(Implementation::Plugin& plugin, const Containers::StringView filename, const Containers::StringView pluginInterface, const ManagerFlags flags) {
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 
     /* Open plugin file, make symbols globally available for next libs (which
-       may depend on this) */
+       may depend on this). RTLD_LOCAL would be faster to resolve, but
+       there's no way to know whether a plugin loaded later won't depend on
+       this one. */
     #ifndef CORRADE_TARGET_WINDOWS
-    void* module = dlopen(Containers::String::nullTerminatedView(filename).data(), RTLD_NOW|RTLD_GLOBAL);
+    void* module = dlopen(Containers::String::nullTerminatedView(filename).data(), (flags & ManagerFlag::LazyLoad ? RTLD_LAZY : RTLD_NOW)|RTLD_GLOBAL);
     #else
     HMODULE module = LoadLibraryW(Utility::Unicode::widen(filename));
     #endif
@@ -702,10 +1056,10 @@ LoadState AbstractManager::loadInternal(Implementation::Plugin& plugin, Containe
         #endif
         return LoadState::LoadFailed;
     }
-    if(version() != Version) {
+    if(version() != AbstractManager::Version) {
         Utility::Error{} << "PluginManager::Manager::load(): wrong version of plugin"
                 << plugin.name << Utility::Debug::nospace << ", expected"
-                << Version << "but got" << version();
+                << AbstractManager::Version << "but got" << version();
         #ifndef CORRADE_TARGET_WINDOWS
         dlclose(module);
         #else
@@ -748,8 +1102,8 @@ LoadState AbstractManager::loadInternal(Implementation::Plugin& plugin, Containe
         #endif
         return LoadState::LoadFailed;
     }
-    if(interface() != pluginInterface()) {
-        Utility::Error{} << "PluginManager::Manager::load(): wrong interface string of plugin" << plugin.name + ", expected" << pluginInterface() << "but got" << interface();
+    if(interface() != pluginInterface) {
+        Utility::Error{} << "PluginManager::Manager::load(): wrong interface string of plugin" << plugin.name + ", expected" << pluginInterface << "but got" << interface();
         #ifndef CORRADE_TARGET_WINDOWS
         dlclose(module);
         #else
@@ -863,32 +1217,294 @@ LoadState AbstractManager::loadInternal(Implementation::Plugin& plugin, Containe
         return LoadState::LoadFailed;
     }
 
-    /* Initialize plugin */
-    initializer();
+    /* Initialize plugin, unless it's deferred to the first instantiation */
+    if(flags & ManagerFlag::LazyLoad)
+        plugin.initializer = initializer;
+    else
+        initializer();
+
+    plugin.module = module;
+    plugin.instancer = instancer;
+    plugin.finalizer = finalizer;
+    plugin.loadDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    return LoadState::Loaded;
+}
+
+}
+#endif
+
+#ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+LoadState AbstractManager::loadInternal(Implementation::Plugin& plugin) {
+    return loadInternal(plugin, Utility::Path::join(_state->pluginDirectory, plugin.name + _state->pluginSuffix));
+}
+
+LoadState AbstractManager::loadInternal(Implementation::Plugin& plugin, Containers::StringView filename) {
+    /* Plugin is not ready to load */
+    if(plugin.loadState != LoadState::NotLoaded) {
+        if(!(plugin.loadState & (LoadState::Static|LoadState::Loaded)))
+            Utility::Error{} << "PluginManager::Manager::load(): plugin" << plugin.name << "is not ready to load:" << plugin.loadState;
+        return plugin.loadState;
+    }
+
+    /* Load dependencies and remember their names for later. Their names will
+       be added to usedBy list only if everything goes well. */
+    Containers::Array<Containers::Reference<Implementation::Plugin>> dependencies;
+    if(!loadDependencies(plugin, dependencies, nullptr))
+        return LoadState::UnresolvedDependency;
+
+    const LoadState state = openPlugin(plugin, filename, _state->pluginInterface, _state->flags);
+    if(state != LoadState::Loaded) return state;
 
     /* Everything is okay, add this plugin to usedBy list of each dependency */
     for(Implementation::Plugin& dependency: dependencies)
         arrayAppend(dependency.usedBy, plugin.name);
 
-    /* Update plugin object, set state to loaded */
     plugin.loadState = LoadState::Loaded;
-    plugin.module = module;
-    plugin.instancer = instancer;
-    plugin.finalizer = finalizer;
     return LoadState::Loaded;
 }
+
+bool AbstractManager::loadDependencies(Implementation::Plugin& plugin, Containers::Array<Containers::Reference<Implementation::Plugin>>& dependencies, const Containers::ArrayView<Implementation::Plugin* const> failed) {
+    arrayReserve(dependencies, plugin.depends.size());
+    for(const Containers::String& dependency: plugin.depends) {
+        /* If the dependency is not in our plugin manager, check the registered
+           external managers as well */
+        AbstractManager* dependencyManager = nullptr;
+        auto foundDependency = _state->plugins.find(dependency);
+        if(foundDependency != _state->plugins.end())
+            dependencyManager = this;
+        else for(AbstractManager* other: _state->externalManagers) {
+            foundDependency = other->_state->plugins.find(dependency);
+            if(foundDependency != other->_state->plugins.end()) {
+                dependencyManager = other;
+                break;
+            }
+        }
+
+        /* A dependency that already failed to load in the same batch isn't
+           attempted again, the failure was reported already */
+        if(!dependencyManager || std::find(failed.begin(), failed.end(), foundDependency->second().get()) != failed.end() || !(dependencyManager->loadInternal(*foundDependency->second()) & LoadState::Loaded)) {
+            Utility::Error{} << "PluginManager::Manager::load(): unresolved dependency" << dependency << "of plugin" << plugin.name;
+            return false;
+        }
+
+        arrayAppend(dependencies, *foundDependency->second());
+    }
+
+    return true;
+}
+#endif
+
+#ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+namespace {
+
+/* Adds the plugin and all its not-yet-loaded dependencies from the same
+   manager to the list. Dependencies from external managers are loaded
+   serially once the plugin's turn comes. */
+void collectPluginsToLoad(PluginRegistry<Containers::Pointer<Implementation::Plugin>>& plugins, Implementation::Plugin& plugin, Containers::Array<Implementation::Plugin*>& out) {
+    if(plugin.loadState != LoadState::NotLoaded || std::find(out.begin(), out.end(), &plugin) != out.end())
+        return;
+
+    arrayAppend(out, &plugin);
+    for(const Containers::String& dependency: plugin.depends) {
+        const auto found = plugins.find(dependency);
+        if(found != plugins.end())
+            collectPluginsToLoad(plugins, *found->second(), out);
+    }
+}
+
+struct PluginToOpen {
+    Implementation::Plugin* plugin;
+    Containers::Array<Containers::Reference<Implementation::Plugin>> dependencies;
+    Containers::String filename;
+    /* Errors printed while opening the plugin, printed from the calling
+       thread afterwards to have them in a deterministic order */
+    Containers::String errors;
+    LoadState state;
+};
+
+void openPlugins(Containers::ArrayView<PluginToOpen> plugins, const Containers::StringView pluginInterface, const ManagerFlags flags) {
+    auto open = [pluginInterface, flags](PluginToOpen& plugin) {
+        Utility::Error redirectError{&plugin.errors};
+        plugin.state = openPlugin(*plugin.plugin, plugin.filename, pluginInterface, flags);
+    };
+
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    /* The calling thread takes a part of the work as well */
+    const std::size_t threadCount = Utility::min(std::size_t(std::thread::hardware_concurrency()), plugins.size());
+    if(threadCount > 1) {
+        std::atomic<std::size_t> next{0};
+        auto worker = [&next, &plugins, &open]() {
+            for(std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < plugins.size(); )
+                open(plugins[i]);
+        };
+
+        Containers::Array<std::thread> threads{threadCount - 1};
+        for(std::thread& thread: threads)
+            thread = std::thread{worker};
+        worker();
+        for(std::thread& thread: threads)
+            thread.join();
+        return;
+    }
+    #endif
+
+    for(PluginToOpen& plugin: plugins)
+        open(plugin);
+}
+
+}
+#endif
+
+Containers::Array<LoadState> AbstractManager::load(const Containers::StringIterable& plugins) {
+    Containers::Array<LoadState> out{NoInit, plugins.size()};
+
+    #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    /* File paths, unknown plugins and plugins that are loaded already or
+       can't be loaded go through the single-plugin variant, which handles and
+       reports all those. File paths are processed first as they may replace
+       existing plugins of the same name. */
+    for(std::size_t i = 0; i != plugins.size(); ++i) {
+        if(plugins[i].hasSuffix(_state->pluginSuffix))
+            out[i] = load(plugins[i]);
+    }
+
+    Containers::Array<Implementation::Plugin*> requested{ValueInit, plugins.size()};
+    Containers::Array<Implementation::Plugin*> pending;
+    for(std::size_t i = 0; i != plugins.size(); ++i) {
+        const Containers::StringView plugin = plugins[i];
+        if(plugin.hasSuffix(_state->pluginSuffix))
+            continue;
+
+        const auto found = _state->aliases.find(plugin);
+        if(found == _state->aliases.end() || found->second()->loadState != LoadState::NotLoaded) {
+            out[i] = load(plugin);
+            continue;
+        }
+
+        requested[i] = found->second();
+        collectPluginsToLoad(_state->plugins, *found->second(), pending);
+    }
+
+    /* Process the plugins in waves, each containing plugins whose
+       dependencies were all processed in the previous waves. Dependency
+       resolution is done serially, as it may involve loading plugins from
+       external managers, opening the binaries and running the initializers is
+       then done for the whole wave in parallel. */
+    Containers::Array<Implementation::Plugin*> failed;
+    Containers::Array<LoadState> failedStates;
+    while(!pending.isEmpty()) {
+        /* Decide which plugins are ready before moving any of them to the
+           wave, otherwise a plugin could get scheduled together with its
+           dependency that was moved to the wave just before */
+        Containers::Array<bool> ready{DirectInit, pending.size(), true};
+        for(std::size_t i = 0; i != pending.size(); ++i) {
+            for(const Containers::String& dependency: pending[i]->depends) {
+                for(Implementation::Plugin* other: pending) if(other->name == dependency) {
+                    ready[i] = false;
+                    break;
+                }
+                if(!ready[i]) break;
+            }
+        }
+
+        Containers::Array<PluginToOpen> wave;
+        std::size_t stillPending = 0;
+        for(std::size_t i = 0; i != pending.size(); ++i) {
+            Implementation::Plugin& plugin = *pending[i];
+            if(!ready[i]) {
+                pending[stillPending++] = &plugin;
+                continue;
+            }
+
+            arrayAppend(wave, InPlaceInit, &plugin, Containers::Array<Containers::Reference<Implementation::Plugin>>{}, Utility::Path::join(_state->pluginDirectory, plugin.name + _state->pluginSuffix), Containers::String{}, LoadState::NotLoaded);
+        }
+
+        /* Nothing is ready, meaning the rest has circular dependencies */
+        if(wave.isEmpty()) {
+            for(Implementation::Plugin* plugin: pending) {
+                Utility::Error{} << "PluginManager::Manager::load(): circular dependency of plugin" << plugin->name;
+                arrayAppend(failed, plugin);
+                arrayAppend(failedStates, LoadState::UnresolvedDependency);
+            }
+            break;
+        }
+
+        arrayResize(pending, stillPending);
+
+        /* Resolve dependencies of the whole wave, put the plugins that can't
+           be loaded away */
+        std::size_t toOpen = 0;
+        for(std::size_t i = 0; i != wave.size(); ++i) {
+            if(loadDependencies(*wave[i].plugin, wave[i].dependencies, failed)) {
+                if(toOpen != i) wave[toOpen] = Utility::move(wave[i]);
+                ++toOpen;
+                continue;
+            }
+
+            arrayAppend(failed, wave[i].plugin);
+            arrayAppend(failedStates, LoadState::UnresolvedDependency);
+        }
+        arrayResize(wave, toOpen);
+
+        openPlugins(wave, _state->pluginInterface, _state->flags);
+
+        for(PluginToOpen& plugin: wave) {
+            if(plugin.errors)
+                Utility::Error{Utility::Debug::Flag::NoNewlineAtTheEnd} << plugin.errors;
+
+            if(plugin.state != LoadState::Loaded) {
+                arrayAppend(failed, plugin.plugin);
+                arrayAppend(failedStates, plugin.state);
+                continue;
+            }
+
+            for(Implementation::Plugin& dependency: plugin.dependencies)
+                arrayAppend(dependency.usedBy, plugin.plugin->name);
+            plugin.plugin->loadState = LoadState::Loaded;
+        }
+    }
+
+    for(std::size_t i = 0; i != plugins.size(); ++i) {
+        if(!requested[i]) continue;
+
+        if(requested[i]->loadState & LoadState::Loaded) {
+            out[i] = requested[i]->loadState;
+            continue;
+        }
+
+        const std::size_t found = std::find(failed.begin(), failed.end(), requested[i]) - failed.begin();
+        CORRADE_INTERNAL_ASSERT(found != failed.size());
+        out[i] = failedStates[found];
+    }
+    #else
+    for(std::size_t i = 0; i != plugins.size(); ++i)
+        out[i] = load(plugins[i]);
+    #endif
+
+    return out;
+}
+
+Containers::Array<LoadState> AbstractManager::loadAll() {
+    return load(pluginList());
+}
+
+#ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+std::uint64_t AbstractManager::loadDuration(const Containers::StringView plugin) const {
+    auto found = _state->aliases.find(plugin);
+    if(found != _state->aliases.end() && found->second()->loadState == LoadState::Loaded)
+        return found->second()->loadDuration;
+
+    return 0;
+}
 #endif
 
 LoadState AbstractManager::unload(const Containers::StringView plugin) {
-    /* Of course std::map::find() would allocate a new String in order to
-       find it, prevent that from happening by wrapping a view */
-    /** @todo clean this up once we kill std::map */
-    auto found = _state->aliases.find(Containers::String::nullTerminatedView(plugin));
+    auto found = _state->aliases.find(plugin);
     if(found != _state->aliases.end()) {
         #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        return unloadInternal(found->second);
+        return unloadInternal(*found->second());
         #else
-        return found->second.loadState;
+        return found->second()->loadState;
         #endif
     }
 
@@ -915,6 +1531,15 @@ LoadState AbstractManager::unloadInternal(Implementation::Plugin& plugin) {
         return LoadState::Required;
     }
 
+    /* Pooled instances are owned by the manager, delete them so they don't
+       prevent the plugin from being unloaded */
+    for(std::size_t i = _state->instancePool.size(); i != 0; --i) {
+        AbstractPlugin* const instance = _state->instancePool[i - 1];
+        if(instance->metadata() != &plugin) continue;
+        _state->instancePool.erase(_state->instancePool.begin() + i - 1);
+        delete instance;
+    }
+
     /* Plugin has active instances */
     if(!plugin.instances.empty()) {
         /* Check if all instances can be safely deleted */
@@ -937,11 +1562,11 @@ LoadState AbstractManager::unloadInternal(Implementation::Plugin& plugin) {
         Implementation::Plugin* dependency = nullptr;
         auto foundDependency = _state->plugins.find(*it);
         if(foundDependency != _state->plugins.end())
-            dependency = foundDependency->second.get();
+            dependency = foundDependency->second().get();
         else for(AbstractManager* other: _state->externalManagers) {
             foundDependency = other->_state->plugins.find(*it);
             if(foundDependency != other->_state->plugins.end()) {
-                dependency = foundDependency->second.get();
+                dependency = foundDependency->second().get();
                 break;
             }
         }
@@ -952,8 +1577,11 @@ LoadState AbstractManager::unloadInternal(Implementation::Plugin& plugin) {
         arrayRemove(dependency->usedBy, found - dependency->usedBy.begin());
     }
 
-    /* Finalize plugin */
-    plugin.finalizer();
+    /* Finalize plugin, if it was initialized at all */
+    if(plugin.initializer)
+        plugin.initializer = nullptr;
+    else
+        plugin.finalizer();
 
     /* Close the module */
     #ifndef CORRADE_TARGET_WINDOWS
@@ -988,6 +1616,49 @@ LoadState AbstractManager::unloadInternal(Implementation::Plugin& plugin) {
 }
 #endif
 
+#ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+void AbstractManager::initializeInternal(Implementation::Plugin& plugin) {
+    /* Static plugins and plugins that are already initialized */
+    if(!plugin.initializer) return;
+
+    /* Initialize dependencies first. If not found in this manager, try in
+       registered external managers. */
+    for(const Containers::String& dependency: plugin.depends) {
+        AbstractManager* dependencyManager = this;
+        auto foundDependency = _state->plugins.find(dependency);
+        if(foundDependency == _state->plugins.end()) for(AbstractManager* other: _state->externalManagers) {
+            foundDependency = other->_state->plugins.find(dependency);
+            if(foundDependency != other->_state->plugins.end()) {
+                dependencyManager = other;
+                break;
+            }
+        }
+        CORRADE_INTERNAL_ASSERT(foundDependency != dependencyManager->_state->plugins.end());
+
+        dependencyManager->initializeInternal(*foundDependency->second());
+    }
+
+    /* Reset the pointer first, so a plugin instantiating itself in the
+       initializer doesn't cause an infinite recursion */
+    void(*const initializer)() = plugin.initializer;
+    plugin.initializer = nullptr;
+    initializer();
+}
+#endif
+
+std::size_t AbstractManager::instancePoolSize() const {
+    return _state->instancePool.size();
+}
+
+void AbstractManager::clearInstancePool() {
+    /* Take the list out first so the instance destructors don't see a
+       partially cleared pool */
+    std::vector<AbstractPlugin*> instancePool;
+    std::swap(instancePool, _state->instancePool);
+    for(AbstractPlugin* const instance: instancePool)
+        delete instance;
+}
+
 void AbstractManager::registerExternalManager(AbstractManager& manager) {
     _state->externalManagers.insert(&manager);
     #ifndef CORRADE_NO_ASSERT
@@ -1000,45 +1671,30 @@ void AbstractManager::registerDynamicPlugin(const Containers::StringView name, C
        if it would be global in case of an unlikely scenario of coming from a
        filename as a string view literal passed directly to load(), we won't
        save anything */
-    const auto result = _state->plugins.emplace(name, Utility::move(plugin));
-    CORRADE_INTERNAL_ASSERT(result.second);
+    const auto result = _state->plugins.insert(name, Utility::move(plugin));
+    CORRADE_INTERNAL_ASSERT(result.second());
+    Implementation::Plugin& p = *result.first()->second();
 
     /* The plugin is the best version of itself. If there was already an
        alias for this name, replace it. */
-    {
-        /* std::map::find() would allocate a new String in order to find it,
-           unfortunately as the name slice is never null-terminated we can't
-           prevent anything with String::nullTerminatedView() */
-        /** @todo clean this up once we kill std::map */
-        const auto alias = _state->aliases.find(name);
-        if(alias != _state->aliases.end()) _state->aliases.erase(alias);
-        CORRADE_INTERNAL_ASSERT_OUTPUT(_state->aliases.insert({name, *result.first->second}).second);
-    }
+    _state->aliases.insert(name, &p).first()->second() = &p;
 
     /* Add aliases to the list. Calling insert() won't overwrite the
        existing value, which ensures that the above note is still held. */
-    for(const Containers::String& alias: result.first->second->provides) {
-        /* Libc++ frees the passed Plugin& reference when using emplace(),
-           causing double-free memory corruption later. Everything is okay
-           with insert(). */
-        /** @todo put back emplace() here when libc++ is fixed */
-        _state->aliases.insert({alias, *result.first->second});
-    }
+    for(const Containers::String& alias: p.provides)
+        _state->aliases.insert(alias, &p);
 }
 
 /* This function takes an alias name, since at the time of instantiation the
    real plugin name is not yet known */
 void AbstractManager::registerInstance(const Containers::StringView plugin, AbstractPlugin& instance, const PluginMetadata*& metadata) {
-    /* Of course std::map::find() would allocate a new String in order to
-       find it, prevent that from happening by wrapping a view */
-    /** @todo clean this up once we kill std::map */
     /** @todo assert proper interface */
-    auto found = _state->aliases.find(Containers::String::nullTerminatedView(plugin));
+    auto found = _state->aliases.find(plugin);
     CORRADE_ASSERT(found != _state->aliases.end(),
         "PluginManager::AbstractPlugin::AbstractPlugin(): attempt to register instance of plugin not known to given manager", );
 
-    found->second.instances.push_back(&instance);
-    metadata = &found->second;
+    found->second()->instances.push_back(&instance);
+    metadata = found->second();
 }
 
 /* This function however takes the real name, taken from the metadata. This is
@@ -1046,31 +1702,28 @@ void AbstractManager::registerInstance(const Containers::StringView plugin, Abst
    potential other APIs that redirect an alias to some other plugin, which
    would then lead to the instance not being found */
 void AbstractManager::reregisterInstance(const Containers::StringView plugin, AbstractPlugin& oldInstance, AbstractPlugin* const newInstance) {
-    /* Of course std::map::find() would allocate a new String in order to
-       find it, prevent that from happening by wrapping a view */
-    /** @todo clean this up once we kill std::map */
-    auto found = _state->plugins.find(Containers::String::nullTerminatedView(plugin));
+    auto found = _state->plugins.find(plugin);
     CORRADE_INTERNAL_ASSERT(found != _state->plugins.end());
 
-    auto pos = std::find(found->second->instances.begin(), found->second->instances.end(), &oldInstance);
-    CORRADE_INTERNAL_ASSERT(pos != found->second->instances.end());
+    auto pos = std::find(found->second()->instances.begin(), found->second()->instances.end(), &oldInstance);
+    CORRADE_INTERNAL_ASSERT(pos != found->second()->instances.end());
 
     /* If the plugin is being moved, replace the instance pointer. Otherwise
        remove it from the list, and if the list is empty, delete it fully. */
     if(newInstance) *pos = newInstance;
-    else found->second->instances.erase(pos);
+    else found->second()->instances.erase(pos);
 }
 
 Containers::Pointer<AbstractPlugin> AbstractManager::instantiateInternal(const Containers::StringView plugin) {
-    /* Of course std::map::find() would allocate a new String in order to
-       find it, prevent that from happening by wrapping a view */
-    /** @todo clean this up once we kill std::map */
-    auto found = _state->aliases.find(Containers::String::nullTerminatedView(plugin));
+    auto found = _state->aliases.find(plugin);
 
-    CORRADE_ASSERT(found != _state->aliases.end() && (found->second.loadState & LoadState::Loaded),
+    CORRADE_ASSERT(found != _state->aliases.end() && (found->second()->loadState & LoadState::Loaded),
         "PluginManager::Manager::instantiate(): plugin" << plugin << "is not loaded", nullptr);
 
-    return Containers::pointer(static_cast<AbstractPlugin*>(found->second.instancer(*this, plugin)));
+    #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    initializeInternal(*found->second());
+    #endif
+    return Containers::pointer(static_cast<AbstractPlugin*>(found->second()->instancer(*this, plugin)));
 }
 
 Containers::Pointer<AbstractPlugin> AbstractManager::loadAndInstantiateInternal(const Containers::StringView plugin) {
@@ -1082,13 +1735,57 @@ Containers::Pointer<AbstractPlugin> AbstractManager::loadAndInstantiateInternal(
         const Containers::StringView name = Utility::Path::filename(plugin).exceptSuffix(_state->pluginSuffix);
         auto found = _state->aliases.find(name);
         CORRADE_INTERNAL_ASSERT(found != _state->aliases.end());
-        return Containers::pointer(static_cast<AbstractPlugin*>(found->second.instancer(*this, name)));
+        initializeInternal(*found->second());
+        return Containers::pointer(static_cast<AbstractPlugin*>(found->second()->instancer(*this, name)));
     }
     #endif
 
     auto found = _state->aliases.find(plugin);
     CORRADE_INTERNAL_ASSERT(found != _state->aliases.end());
-    return Containers::pointer(static_cast<AbstractPlugin*>(found->second.instancer(*this, plugin)));
+    #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    initializeInternal(*found->second());
+    #endif
+    return Containers::pointer(static_cast<AbstractPlugin*>(found->second()->instancer(*this, plugin)));
+}
+
+Containers::Pointer<AbstractPlugin> AbstractManager::instantiatePooledInternal(const Containers::StringView plugin) {
+    auto found = _state->aliases.find(plugin);
+
+    CORRADE_ASSERT(found != _state->aliases.end() && (found->second()->loadState & LoadState::Loaded),
+        "PluginManager::Manager::instantiatePooled(): plugin" << plugin << "is not loaded", nullptr);
+
+    /* Take the most recently recycled instance, as it's the most likely to
+       be still in cache. The instance has to be of the plugin the name
+       currently resolves to, which may not be the case if
+       setPreferredPlugins() was called in the meantime. */
+    for(std::size_t i = _state->instancePool.size(); i != 0; --i) {
+        AbstractPlugin* const instance = _state->instancePool[i - 1];
+        if(instance->metadata() != found->second() || instance->plugin() != plugin)
+            continue;
+
+        _state->instancePool.erase(_state->instancePool.begin() + i - 1);
+        return Containers::Pointer<AbstractPlugin>{instance};
+    }
+
+    return instantiateInternal(plugin);
+}
+
+void AbstractManager::recycleInternal(Containers::Pointer<AbstractPlugin>&& instance) {
+    CORRADE_ASSERT(instance,
+        "PluginManager::Manager::recycle(): the instance is null", );
+    const PluginMetadata* const metadata = instance->metadata();
+    #ifndef CORRADE_NO_ASSERT
+    const auto found = metadata ? _state->plugins.find(metadata->name()) : _state->plugins.end();
+    #endif
+    CORRADE_ASSERT(found != _state->plugins.end() && found->second().get() == metadata,
+        "PluginManager::Manager::recycle(): the instance wasn't instantiated through this manager", );
+
+    /* If the plugin can't be reused, the instance gets deleted at the end of
+       the scope */
+    instance->configuration() = metadata->configuration();
+    if(!instance->resetForReuse()) return;
+
+    _state->instancePool.push_back(instance.release());
 }
 
 AbstractManager* AbstractManager::externalManagerInternal(const Containers::StringView pluginInterface) {
@@ -1156,6 +1853,13 @@ Plugin::Plugin(const Containers::StringView name, const Containers::StringView m
 }
 #endif
 
+#ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+Plugin::Plugin(const Containers::StringView name, Utility::Configuration&& metadata): Plugin{Utility::move(metadata), name, nullptr} {
+    module = nullptr;
+    loadState = LoadState::NotLoaded;
+}
+#endif
+
 /* staticPlugin.plugin is a pointer to a global string literal, make use of
    that to avoid a copy */
 Plugin::Plugin(const StaticPlugin& staticPlugin, Utility::Configuration&& configuration): Plugin{Utility::move(configuration), Containers::String::nullTerminatedGlobalView(Containers::StringView{staticPlugin.plugin, Containers::StringViewFlag::Global}), staticPlugin.instancer} {
@@ -1215,4 +1919,25 @@ Utility::Debug& operator<<(Utility::Debug& debug, const LoadStates value) {
         });
 }
 
+#ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+Utility::Debug& operator<<(Utility::Debug& debug, const ManagerFlag value) {
+    debug << "PluginManager::ManagerFlag" << Utility::Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case ManagerFlag::value: return debug << "::" #value;
+        _c(LazyLoad)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Utility::Debug::nospace << Utility::Debug::hex << std::uint8_t(value) << Utility::Debug::nospace << ")";
+}
+
+Utility::Debug& operator<<(Utility::Debug& debug, const ManagerFlags value) {
+    return Containers::enumSetDebugOutput(debug, value, "PluginManager::ManagerFlags{}", {
+        ManagerFlag::LazyLoad});
+}
+#endif
+
 }}
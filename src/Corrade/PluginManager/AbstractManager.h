@@ -27,9 +27,11 @@
 */
 
 /** @file
- * @brief Class @ref Corrade::PluginManager::AbstractManager, macro @ref CORRADE_PLUGIN_VERSION, @ref CORRADE_PLUGIN_REGISTER()
+ * @brief Class @ref Corrade::PluginManager::AbstractManager, enum @ref Corrade::PluginManager::LoadState, @ref Corrade::PluginManager::ManagerFlag, enum set @ref Corrade::PluginManager::LoadStates, @ref Corrade::PluginManager::ManagerFlags, macro @ref CORRADE_PLUGIN_VERSION, @ref CORRADE_PLUGIN_REGISTER()
  */
 
+#include <cstdint>
+
 #include "Corrade/Containers/EnumSet.h"
 #include "Corrade/Containers/Pointer.h"
 #include "Corrade/PluginManager/PluginManager.h"
@@ -199,6 +201,71 @@ CORRADE_ENUMSET_OPERATORS(LoadStates)
 /** @debugoperatorenum{LoadStates} */
 CORRADE_PLUGINMANAGER_EXPORT Utility::Debug& operator<<(Utility::Debug& debug, PluginManager::LoadStates value);
 
+#ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+/**
+@brief Plugin manager flag
+@m_since_latest
+
+@see @ref ManagerFlags, @ref AbstractManager::setFlags()
+@partialsupport Not available on platforms without
+    @ref CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT "dynamic plugin support".
+*/
+enum class ManagerFlag: unsigned char {
+    /**
+     * Load dynamic plugins lazily. The plugin binary is opened with lazy
+     * symbol binding, meaning that symbols are resolved by the dynamic
+     * loader only once they're used for the first time instead of all of
+     * them right when the binary is opened, and the plugin initializer is
+     * not called from @ref AbstractManager::load() but only right before
+     * the first instance of the plugin is created. Initializers of plugin
+     * dependencies are called before the initializer of the plugin itself.
+     * If the plugin gets unloaded without ever being instantiated, neither
+     * its initializer nor its finalizer is called.
+     *
+     * Useful for applications that load many plugins upfront but
+     * instantiate only a few of them in a given run. Note that with lazy
+     * binding, a plugin that references a symbol that can't be resolved is
+     * loaded successfully, and the failure happens only once the symbol is
+     * used, usually terminating the application. The binaries are still
+     * opened with global symbol visibility, as plugins can depend on symbols
+     * from other plugins. On Windows the symbols are always resolved when
+     * the library is loaded, so only the initializer is deferred.
+     * Affects only plugins loaded after the flag is set.
+     */
+    LazyLoad = 1 << 0
+};
+
+/**
+@debugoperatorenum{ManagerFlag}
+@m_since_latest
+
+@partialsupport Not available on platforms without
+    @ref CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT "dynamic plugin support".
+*/
+CORRADE_PLUGINMANAGER_EXPORT Utility::Debug& operator<<(Utility::Debug& debug, PluginManager::ManagerFlag value);
+
+/**
+@brief Plugin manager flags
+@m_since_latest
+
+@see @ref AbstractManager::setFlags()
+@partialsupport Not available on platforms without
+    @ref CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT "dynamic plugin support".
+*/
+typedef Containers::EnumSet<ManagerFlag> ManagerFlags;
+
+CORRADE_ENUMSET_OPERATORS(ManagerFlags)
+
+/**
+@debugoperatorenum{ManagerFlags}
+@m_since_latest
+
+@partialsupport Not available on platforms without
+    @ref CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT "dynamic plugin support".
+*/
+CORRADE_PLUGINMANAGER_EXPORT Utility::Debug& operator<<(Utility::Debug& debug, PluginManager::ManagerFlags value);
+#endif
+
 namespace Implementation {
     struct Plugin;
     struct StaticPlugin;
@@ -285,6 +352,68 @@ class CORRADE_PLUGINMANAGER_EXPORT AbstractManager {
          *      @ref CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT "dynamic plugin support".
          */
         void reloadPluginDirectory();
+
+        /**
+         * @brief Save a metadata index for the plugin directory
+         * @m_since_latest
+         *
+         * Lists the @ref pluginDirectory(), parses metadata files of all
+         * plugins found there and saves them into a compact binary index
+         * file named @cb{.sh} .corrade-plugin-index @ce in the same
+         * directory. The index is then used by @ref setPluginDirectory(),
+         * @ref reloadPluginDirectory() and by the manager constructor to
+         * avoid listing the directory and parsing the metadata files again:
+         *
+         * -    If the modification time of the directory matches the one
+         *      recorded in the index, the plugin list is taken from the index
+         *      instead of listing the directory
+         * -    If size and modification time of a metadata file match the
+         *      ones recorded in the index, the metadata are taken from the
+         *      index instead of parsing the file
+         *
+         * The index is memory-mapped and each entry that fails the above
+         * checks falls back to the regular code path, so an outdated index
+         * never results in outdated metadata, only in less time saved. The
+         * index is never created or updated implicitly --- it's meant to be
+         * saved once plugins are installed, similarly to how
+         * @cb{.sh} ldconfig @ce works. If the index can't be parsed, for
+         * example because it was saved on a platform with a different
+         * endianness, a warning is printed and it's ignored. Comments and
+         * empty lines from the metadata files aren't preserved in the index.
+         *
+         * Note that the modification time granularity may be as coarse as
+         * one second on some platforms, so metadata files modified right
+         * after the index was saved without changing their size may not be
+         * picked up. If the plugin directory isn't set, can't be listed or
+         * the index can't be written, prints a message to @ref Utility::Error
+         * and returns @cpp false @ce.
+         * @partialsupport Not available on platforms without
+         *      @ref CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT "dynamic plugin support".
+         */
+        bool saveMetadataIndex() const;
+
+        /**
+         * @brief Manager flags
+         * @m_since_latest
+         *
+         * No flags are set by default.
+         * @see @ref setFlags()
+         * @partialsupport Not available on platforms without
+         *      @ref CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT "dynamic plugin support".
+         */
+        ManagerFlags flags() const;
+
+        /**
+         * @brief Set manager flags
+         * @m_since_latest
+         *
+         * The flags affect only plugins loaded after this call, plugins that
+         * are already loaded are left untouched.
+         * @see @ref flags()
+         * @partialsupport Not available on platforms without
+         *      @ref CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT "dynamic plugin support".
+         */
+        void setFlags(ManagerFlags flags);
         #endif
 
         /**
@@ -393,6 +522,65 @@ class CORRADE_PLUGINMANAGER_EXPORT AbstractManager {
          */
         LoadState load(Containers::StringView plugin);
 
+        /**
+         * @brief Load multiple plugins
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref load(Containers::StringView) for each
+         * item in @p plugins, returning the load states in the same order,
+         * but the plugins are loaded concurrently where possible. The
+         * dependency graph of all @p plugins is resolved first, then the
+         * plugins are loaded in waves, each containing plugins whose
+         * dependencies were loaded in the previous waves. Within a wave,
+         * opening the plugin binaries and calling the plugin initializers is
+         * done on multiple threads, the rest including loading of
+         * dependencies from @ref registerExternalManager() "external managers"
+         * is done on the calling thread. Error messages are printed from the
+         * calling thread and in a deterministic order.
+         *
+         * A dependency that fails to load is not attempted again for each
+         * plugin that depends on it, plugins with circular dependencies fail
+         * with @ref LoadState::UnresolvedDependency. If
+         * @ref CORRADE_BUILD_MULTITHREADED is not enabled, everything is done
+         * on the calling thread. Note that on some platforms, such as Linux
+         * with glibc, the system dynamic loader serializes opening of
+         * libraries internally, so only part of the work may actually run in
+         * parallel.
+         * @see @ref loadAll(), @ref loadDuration()
+         * @partialsupport On platforms without
+         *      @ref CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT "dynamic plugin support"
+         *      the plugins are only looked up, returning either
+         *      @ref LoadState::Static or @ref LoadState::NotFound.
+         */
+        Containers::Array<LoadState> load(const Containers::StringIterable& plugins);
+
+        /**
+         * @brief Load all plugins
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref load(const Containers::StringIterable&)
+         * with @ref pluginList().
+         */
+        Containers::Array<LoadState> loadAll();
+
+        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+        /**
+         * @brief Time it took to load a plugin
+         * @m_since_latest
+         *
+         * Time in nanoseconds spent opening the plugin binary, including the
+         * global constructors executed by the system dynamic loader, and
+         * calling the plugin initializer. Time spent loading dependencies of
+         * the plugin isn't included, and neither is the initializer if the
+         * plugin was loaded with @ref ManagerFlag::LazyLoad. Returns
+         * @cpp 0 @ce if the plugin is not found, not loaded or is static.
+         * @see @ref load()
+         * @partialsupport Not available on platforms without
+         *      @ref CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT "dynamic plugin support".
+         */
+        std::uint64_t loadDuration(Containers::StringView plugin) const;
+        #endif
+
         /**
          * @brief Unload a plugin
          *
@@ -421,6 +609,22 @@ class CORRADE_PLUGINMANAGER_EXPORT AbstractManager {
          */
         void registerExternalManager(AbstractManager& manager);
 
+        /**
+         * @brief Count of instances in the instance pool
+         * @m_since_latest
+         *
+         * @see @ref Manager::instantiatePooled(), @ref Manager::recycle()
+         */
+        std::size_t instancePoolSize() const;
+
+        /**
+         * @brief Delete all instances in the instance pool
+         * @m_since_latest
+         *
+         * @see @ref Manager::instantiatePooled(), @ref Manager::recycle()
+         */
+        void clearInstancePool();
+
     protected:
         /**
          * @brief Destructor
@@ -452,6 +656,8 @@ class CORRADE_PLUGINMANAGER_EXPORT AbstractManager {
 
         Containers::Pointer<AbstractPlugin> instantiateInternal(Containers::StringView plugin);
         Containers::Pointer<AbstractPlugin> loadAndInstantiateInternal(Containers::StringView plugin);
+        Containers::Pointer<AbstractPlugin> instantiatePooledInternal(Containers::StringView plugin);
+        void recycleInternal(Containers::Pointer<AbstractPlugin>&& instance);
         AbstractManager* externalManagerInternal(Containers::StringView pluginInterface);
 
     private:
@@ -465,8 +671,12 @@ class CORRADE_PLUGINMANAGER_EXPORT AbstractManager {
         #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
         CORRADE_PLUGINMANAGER_LOCAL LoadState loadInternal(Implementation::Plugin& plugin);
         CORRADE_PLUGINMANAGER_LOCAL LoadState loadInternal(Implementation::Plugin& plugin, Containers::StringView filename);
+        /* Dependencies that are in the `failed` list aren't attempted to be
+           loaded again */
+        CORRADE_PLUGINMANAGER_LOCAL bool loadDependencies(Implementation::Plugin& plugin, Containers::Array<Containers::Reference<Implementation::Plugin>>& dependencies, Containers::ArrayView<Implementation::Plugin* const> failed);
         CORRADE_PLUGINMANAGER_LOCAL LoadState unloadInternal(Implementation::Plugin& plugin);
         CORRADE_PLUGINMANAGER_LOCAL LoadState unloadRecursiveInternal(Implementation::Plugin& plugin);
+        CORRADE_PLUGINMANAGER_LOCAL void initializeInternal(Implementation::Plugin& plugin);
         #endif
 
         Containers::Pointer<State> _state;
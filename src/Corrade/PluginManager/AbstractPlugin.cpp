@@ -104,6 +104,8 @@ AbstractPlugin::~AbstractPlugin() {
 
 bool AbstractPlugin::canBeDeleted() { return false; }
 
+bool AbstractPlugin::resetForReuse() { return false; }
+
 Containers::StringView AbstractPlugin::plugin() const {
     CORRADE_ASSERT(_state, "PluginManager::AbstractPlugin::plugin(): can't be called on a moved-out plugin", {});
     return _state->plugin;
@@ -291,6 +291,25 @@ class CORRADE_PLUGINMANAGER_EXPORT AbstractPlugin {
          */
         virtual bool canBeDeleted();
 
+        /**
+         * @brief Reset the instance for reuse
+         * @m_since_latest
+         *
+         * Called from @ref Manager::recycle() when an instance is returned
+         * to the manager instance pool. The implementation is expected to
+         * bring the instance to a state equivalent to a freshly created one,
+         * for example by closing any opened files and discarding cached
+         * data, and return @cpp true @ce. If @cpp false @ce is returned, the
+         * instance is deleted instead of being put into the pool. The
+         * @ref configuration() is restored to the defaults from
+         * @ref PluginMetadata::configuration() before this function is
+         * called. Default implementation returns @cpp false @ce, which means
+         * instances of plugins that don't implement this function are never
+         * pooled. See @ref Manager::instantiatePooled() for more
+         * information.
+         */
+        virtual bool resetForReuse();
+
         /**
          * @brief Plugin identifier string
          *
@@ -26,6 +26,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstdint>
 #include <vector>
 
 #include "Corrade/Containers/Array.h"
@@ -80,6 +81,14 @@ struct Plugin: PluginMetadata {
         HMODULE module;
         #endif
     };
+
+    /* Set for dynamic plugins loaded with ManagerFlag::LazyLoad until they're
+       first instantiated, null otherwise */
+    void(*initializer)(){};
+
+    /* In nanoseconds, excluding dependencies. Set for dynamic plugins that
+       are loaded. */
+    std::uint64_t loadDuration{};
     #else
     const StaticPlugin* staticPlugin;
     #endif
@@ -98,6 +107,10 @@ struct Plugin: PluginMetadata {
     #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
     /* Constructor for dynamic plugins. Defined in AbstractManager.cpp. */
     explicit Plugin(Containers::StringView name, Containers::StringView metadata);
+
+    /* Constructor for dynamic plugins with metadata coming from the metadata
+       index. Defined in AbstractManager.cpp. */
+    explicit Plugin(Containers::StringView name, Utility::Configuration&& metadata);
     #endif
 
     /* Constructor for static plugins. Defined in AbstractManager.cpp. */
@@ -82,6 +82,21 @@ order to avoid double-free issues, you have to call
 instances returned from @ref Manager::instantiate() or
 @ref Manager::loadAndInstantiate().
 
+@subsection PluginManager-Manager-reload-pooling Instance pooling
+
+If the same plugin is instantiated and destroyed at a high rate and creating
+an instance is expensive, the instances can be reused instead. An instance
+returned from @ref instantiatePooled() is taken from a per-manager pool if
+there's one available for given plugin, and once not needed anymore, it's
+given back to the manager using @ref recycle() instead of being destroyed. The
+instance gets reset using @ref AbstractPlugin::resetForReuse(), which the
+plugin has to implement in order to be pooled:
+
+@snippet PluginManager.cpp Manager-instantiatePooled
+
+Pooled instances are deleted on @ref clearInstancePool(), when their plugin
+gets unloaded or when the manager is destroyed.
+
 @section PluginManager-Manager-data Plugin-specific data and configuration
 
 Besides the API provided by a particular plugin interface after given plugin is
@@ -211,6 +226,34 @@ template<class T> class Manager: public AbstractManager {
          */
         Containers::Pointer<T> loadAndInstantiate(Containers::StringView plugin);
 
+        /**
+         * @brief Instantiate a plugin, reusing a pooled instance if possible
+         * @m_since_latest
+         *
+         * If there's an instance previously passed to @ref recycle() that was
+         * instantiated under the same @p plugin name, takes it out of the
+         * instance pool and returns it, otherwise delegates to
+         * @ref instantiate(). The plugin must be already successfully loaded
+         * by this manager. The returned value is never @cpp nullptr @ce. See
+         * @ref PluginManager-Manager-reload-pooling for more information.
+         * @see @ref instancePoolSize(), @ref clearInstancePool()
+         */
+        Containers::Pointer<T> instantiatePooled(Containers::StringView plugin);
+
+        /**
+         * @brief Return an instance to the instance pool
+         * @m_since_latest
+         *
+         * Restores @ref AbstractPlugin::configuration() of @p instance to the
+         * defaults and calls @ref AbstractPlugin::resetForReuse() on it. If
+         * that returns @cpp true @ce, the instance is put into the instance
+         * pool to be reused by a subsequent @ref instantiatePooled() call,
+         * otherwise it's deleted. Expects that @p instance is not
+         * @cpp nullptr @ce and was instantiated through this manager. See
+         * @ref PluginManager-Manager-reload-pooling for more information.
+         */
+        void recycle(Containers::Pointer<T>&& instance);
+
         /**
          * @brief Retrieve an external plugin manager
          * @m_since_latest
@@ -58,6 +58,14 @@ template<class T> Containers::Pointer<T> Manager<T>::loadAndInstantiate(const Co
     return Containers::pointerCast<T>(loadAndInstantiateInternal(plugin));
 }
 
+template<class T> Containers::Pointer<T> Manager<T>::instantiatePooled(const Containers::StringView plugin) {
+    return Containers::pointerCast<T>(instantiatePooledInternal(plugin));
+}
+
+template<class T> void Manager<T>::recycle(Containers::Pointer<T>&& instance) {
+    recycleInternal(Containers::Pointer<AbstractPlugin>{Utility::move(instance)});
+}
+
 }}
 
 #endif
@@ -43,6 +43,8 @@ class AbstractDeletable: public AbstractPlugin {
 
         bool canBeDeleted() { return true; }
 
+        bool resetForReuse() { return true; }
+
     protected:
         unsigned int* _var;
 };
@@ -0,0 +1,210 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/Pointer.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/PluginManager/Manager.hpp"
+#include "Corrade/PluginManager/PluginMetadata.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Debug.h"
+
+#include "AbstractAnimal.h"
+
+static void importPlugin() {
+    CORRADE_PLUGIN_IMPORT(Canary)
+    CORRADE_PLUGIN_IMPORT(Dird)
+}
+
+namespace Corrade { namespace PluginManager { namespace Test { namespace {
+
+struct ManagerBenchmark: TestSuite::Tester {
+    explicit ManagerBenchmark();
+
+    void metadata();
+    void metadataNotNullTerminated();
+    void loadState();
+    void loadStateNotNullTerminated();
+    void instantiate();
+    void instantiateNotNullTerminated();
+
+    void instantiateDestroy();
+    void instantiateDestroyPooled();
+
+    #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    void loadAllInstantiateOne();
+    void loadAllInstantiateOneLazy();
+    #endif
+};
+
+using namespace Containers::Literals;
+
+constexpr std::size_t Repeats = 1000;
+
+/* A plugin name that's a slice of a larger string, such as when coming from a
+   user-provided list. Used to verify the lookup doesn't need to make a
+   null-terminated copy. */
+constexpr Containers::StringView NotNullTerminated = "Canary,Dird"_s.prefix(6);
+
+ManagerBenchmark::ManagerBenchmark() {
+    addBenchmarks({&ManagerBenchmark::metadata,
+                   &ManagerBenchmark::metadataNotNullTerminated,
+                   &ManagerBenchmark::loadState,
+                   &ManagerBenchmark::loadStateNotNullTerminated,
+                   &ManagerBenchmark::instantiate,
+                   &ManagerBenchmark::instantiateNotNullTerminated,
+
+                   &ManagerBenchmark::instantiateDestroy,
+                   &ManagerBenchmark::instantiateDestroyPooled}, 100);
+
+    #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    addBenchmarks({&ManagerBenchmark::loadAllInstantiateOne,
+                   &ManagerBenchmark::loadAllInstantiateOneLazy}, 10);
+    #endif
+
+    importPlugin();
+}
+
+void ManagerBenchmark::metadata() {
+    /* With dynamic plugin support this also includes everything from the
+       animals directory, making the registry a bit larger */
+    PluginManager::Manager<AbstractAnimal> manager;
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(Repeats)
+        count += manager.metadata("Canary"_s)->provides().size();
+
+    CORRADE_COMPARE(count, Repeats);
+}
+
+void ManagerBenchmark::metadataNotNullTerminated() {
+    PluginManager::Manager<AbstractAnimal> manager;
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(Repeats)
+        count += manager.metadata(NotNullTerminated)->provides().size();
+
+    CORRADE_COMPARE(count, Repeats);
+}
+
+void ManagerBenchmark::loadState() {
+    PluginManager::Manager<AbstractAnimal> manager;
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(Repeats)
+        count += manager.loadState("Canary"_s) == LoadState::Static;
+
+    CORRADE_COMPARE(count, Repeats);
+}
+
+void ManagerBenchmark::loadStateNotNullTerminated() {
+    PluginManager::Manager<AbstractAnimal> manager;
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(Repeats)
+        count += manager.loadState(NotNullTerminated) == LoadState::Static;
+
+    CORRADE_COMPARE(count, Repeats);
+}
+
+void ManagerBenchmark::instantiate() {
+    PluginManager::Manager<AbstractAnimal> manager;
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(Repeats)
+        count += manager.instantiate("Canary"_s)->legCount();
+
+    CORRADE_COMPARE(count, 2*Repeats);
+}
+
+void ManagerBenchmark::instantiateNotNullTerminated() {
+    PluginManager::Manager<AbstractAnimal> manager;
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(Repeats)
+        count += manager.instantiate(NotNullTerminated)->legCount();
+
+    CORRADE_COMPARE(count, 2*Repeats);
+}
+
+void ManagerBenchmark::instantiateDestroy() {
+    PluginManager::Manager<AbstractAnimal> manager;
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        Containers::Pointer<AbstractAnimal> animal = manager.instantiate("Canary"_s);
+        count += animal->legCount();
+    }
+
+    CORRADE_COMPARE(count, 2*Repeats);
+}
+
+void ManagerBenchmark::instantiateDestroyPooled() {
+    PluginManager::Manager<AbstractAnimal> manager;
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        Containers::Pointer<AbstractAnimal> animal = manager.instantiatePooled("Canary"_s);
+        count += animal->legCount();
+        manager.recycle(Utility::move(animal));
+    }
+
+    CORRADE_COMPARE(count, 2*Repeats);
+    CORRADE_COMPARE(manager.instancePoolSize(), 1);
+}
+
+#ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+/* Simulates a tool that loads all plugins upfront but uses just one of them */
+void ManagerBenchmark::loadAllInstantiateOne() {
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(10) {
+        PluginManager::Manager<AbstractAnimal> manager;
+        /* Some of the test plugins have unresolvable dependencies */
+        Utility::Error silenceError{nullptr};
+        manager.loadAll();
+        count += manager.instantiate("Dog"_s)->legCount();
+    }
+
+    CORRADE_COMPARE(count, 4*10);
+}
+
+void ManagerBenchmark::loadAllInstantiateOneLazy() {
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(10) {
+        PluginManager::Manager<AbstractAnimal> manager;
+        manager.setFlags(ManagerFlag::LazyLoad);
+        /* Some of the test plugins have unresolvable dependencies */
+        Utility::Error silenceError{nullptr};
+        manager.loadAll();
+        count += manager.instantiate("Dog"_s)->legCount();
+    }
+
+    CORRADE_COMPARE(count, 4*10);
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::PluginManager::Test::ManagerBenchmark)
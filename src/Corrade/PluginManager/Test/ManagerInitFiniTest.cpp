@@ -41,6 +41,8 @@ struct ManagerInitFiniTest: TestSuite::Tester {
     void staticPlugin();
     #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
     void dynamicPlugin();
+    void dynamicPluginLazyLoad();
+    void dynamicPluginLazyLoadNotInstantiated();
     #endif
 };
 
@@ -48,6 +50,8 @@ ManagerInitFiniTest::ManagerInitFiniTest() {
     addTests({&ManagerInitFiniTest::staticPlugin,
               #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
               &ManagerInitFiniTest::dynamicPlugin,
+              &ManagerInitFiniTest::dynamicPluginLazyLoad,
+              &ManagerInitFiniTest::dynamicPluginLazyLoadNotInstantiated,
               #endif
               });
 
@@ -98,6 +102,68 @@ void ManagerInitFiniTest::dynamicPlugin() {
        destruction */
     CORRADE_COMPARE(out, "Static plugin finalized\n");
 }
+
+void ManagerInitFiniTest::dynamicPluginLazyLoad() {
+    Containers::String out;
+    Debug redirectDebug{&out};
+
+    {
+        PluginManager::Manager<InitFini> manager;
+        manager.setFlags(ManagerFlag::LazyLoad);
+        CORRADE_COMPARE(manager.flags(), ManagerFlag::LazyLoad);
+        CORRADE_COMPARE(out, "Static plugin initialized\n");
+
+        /* Initialization is deferred until the first instantiation */
+        out = {};
+        CORRADE_COMPARE(manager.load("InitFiniDynamic"), LoadState::Loaded);
+        CORRADE_COMPARE(out, "");
+
+        CORRADE_VERIFY(manager.instantiate("InitFiniDynamic"));
+        CORRADE_COMPARE(out, "Dynamic plugin initialized\n");
+
+        /* And it's done just once */
+        out = {};
+        CORRADE_VERIFY(manager.instantiate("InitFiniDynamic"));
+        CORRADE_COMPARE(out, "");
+
+        /* Finalization is right before manager unloads them, same as
+           usual */
+        CORRADE_COMPARE(manager.unload("InitFiniDynamic"), LoadState::NotLoaded);
+        CORRADE_COMPARE(out, "Dynamic plugin finalized\n");
+
+        /* Loading again defers the initialization again */
+        out = {};
+        CORRADE_VERIFY(manager.loadAndInstantiate("InitFiniDynamic"));
+        CORRADE_COMPARE(out, "Dynamic plugin initialized\n");
+
+        out = {};
+    }
+
+    CORRADE_COMPARE(out,
+        "Dynamic plugin finalized\n"
+        "Static plugin finalized\n");
+}
+
+void ManagerInitFiniTest::dynamicPluginLazyLoadNotInstantiated() {
+    Containers::String out;
+    Debug redirectDebug{&out};
+
+    {
+        PluginManager::Manager<InitFini> manager;
+        manager.setFlags(ManagerFlag::LazyLoad);
+        CORRADE_COMPARE(out, "Static plugin initialized\n");
+
+        out = {};
+        CORRADE_COMPARE(manager.load("InitFiniDynamic"), LoadState::Loaded);
+        CORRADE_COMPARE(out, "");
+
+        /* A plugin that was never initialized isn't finalized either */
+        CORRADE_COMPARE(manager.unload("InitFiniDynamic"), LoadState::NotLoaded);
+        CORRADE_COMPARE(out, "");
+    }
+
+    CORRADE_COMPARE(out, "Static plugin finalized\n");
+}
 #endif
 
 }}}}
@@ -24,8 +24,12 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring> /* std::memcpy() */
+
 #include "Corrade/Containers/Array.h"
 #include "Corrade/Containers/Optional.h"
+#include "Corrade/Containers/Pair.h"
+#include "Corrade/Containers/Reference.h"
 #include "Corrade/Containers/ScopeGuard.h"
 #include "Corrade/Containers/StringIterable.h"
 #include "Corrade/PluginManager/Manager.hpp"
@@ -38,6 +42,7 @@
 #include "Corrade/Utility/DebugStl.h" /** @todo remove once Configuration is std::string-free */
 #include "Corrade/Utility/Format.h"
 #include "Corrade/Utility/Path.h"
+#include "Corrade/Utility/StartupProfile.h"
 #include "Corrade/Utility/System.h"
 
 #include "AbstractAnimal.h"
@@ -55,6 +60,9 @@
 
 #ifdef CORRADE_TARGET_UNIX
 #include <unistd.h> /* geteuid() */
+#ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+#include <dlfcn.h> /* dlopen() */
+#endif
 #endif
 
 static void importPlugin() {
@@ -106,6 +114,7 @@ struct ManagerTest: TestSuite::Tester {
     void unloadNonexistent();
 
     void staticPlugin();
+    void staticPluginStartupProfile();
     #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
     void dynamicPlugin();
     void dynamicPluginLoadAndInstantiate();
@@ -123,6 +132,13 @@ struct ManagerTest: TestSuite::Tester {
     #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
     void configurationImplicit();
     #endif
+
+    void instancePool();
+    void instancePoolDifferentName();
+    void instancePoolNotResettable();
+    void instancePoolUnload();
+    void instancePoolInvalid();
+
     void deletable();
     void hierarchy();
     void destructionHierarchy();
@@ -132,9 +148,22 @@ struct ManagerTest: TestSuite::Tester {
     void crossManagerDependenciesWrongDestructionOrder();
     void unresolvedDependencies();
 
+    void loadMultiple();
+    void loadMultipleSharedDependency();
+    void loadMultipleFailed();
+    void loadMultipleFailedCrossManager();
+    void loadMultipleFailedOpen();
+    void loadAll();
+
     void reloadPluginDirectory();
     void restoreAliasesAfterPluginDirectoryChange();
 
+    void metadataIndex();
+    void metadataIndexRoundTrip();
+    void metadataIndexOutdated();
+    void metadataIndexInvalid();
+    void saveMetadataIndexNoPluginDirectory();
+
     void staticProvides();
     #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
     void dynamicProvides();
@@ -154,6 +183,10 @@ struct ManagerTest: TestSuite::Tester {
 
     void debugLoadState();
     void debugLoadStates();
+    #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    void debugManagerFlag();
+    void debugManagerFlags();
+    #endif
 };
 
 using namespace Containers::Literals;
@@ -197,6 +230,7 @@ ManagerTest::ManagerTest() {
               &ManagerTest::unloadNonexistent,
 
               &ManagerTest::staticPlugin,
+              &ManagerTest::staticPluginStartupProfile,
               #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
               &ManagerTest::dynamicPlugin,
               &ManagerTest::dynamicPluginLoadAndInstantiate,
@@ -214,6 +248,12 @@ ManagerTest::ManagerTest() {
               #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
               &ManagerTest::configurationImplicit,
               #endif
+
+              &ManagerTest::instancePool,
+              &ManagerTest::instancePoolDifferentName,
+              &ManagerTest::instancePoolNotResettable,
+              &ManagerTest::instancePoolUnload,
+              &ManagerTest::instancePoolInvalid,
               &ManagerTest::deletable,
               &ManagerTest::hierarchy,
               &ManagerTest::destructionHierarchy,
@@ -223,9 +263,22 @@ ManagerTest::ManagerTest() {
               &ManagerTest::crossManagerDependenciesWrongDestructionOrder,
               &ManagerTest::unresolvedDependencies,
 
+              &ManagerTest::loadMultiple,
+              &ManagerTest::loadMultipleSharedDependency,
+              &ManagerTest::loadMultipleFailed,
+              &ManagerTest::loadMultipleFailedCrossManager,
+              &ManagerTest::loadMultipleFailedOpen,
+              &ManagerTest::loadAll,
+
               &ManagerTest::reloadPluginDirectory,
               &ManagerTest::restoreAliasesAfterPluginDirectoryChange,
 
+              &ManagerTest::metadataIndex,
+              &ManagerTest::metadataIndexRoundTrip,
+              &ManagerTest::metadataIndexOutdated,
+              &ManagerTest::metadataIndexInvalid,
+              &ManagerTest::saveMetadataIndexNoPluginDirectory,
+
               &ManagerTest::staticProvides,
               #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
               &ManagerTest::dynamicProvides,
@@ -244,7 +297,12 @@ ManagerTest::ManagerTest() {
               &ManagerTest::generatedMetadata,
 
               &ManagerTest::debugLoadState,
-              &ManagerTest::debugLoadStates});
+              &ManagerTest::debugLoadStates,
+              #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+              &ManagerTest::debugManagerFlag,
+              &ManagerTest::debugManagerFlags,
+              #endif
+              });
 
     importPlugin();
 }
@@ -674,6 +732,37 @@ void ManagerTest::staticPlugin() {
     CORRADE_COMPARE(manager.unload("Canary"), LoadState::Static);
 }
 
+void ManagerTest::staticPluginStartupProfile() {
+    #ifndef CORRADE_BUILD_STARTUP_PROFILING
+    CORRADE_SKIP("CORRADE_BUILD_STARTUP_PROFILING not enabled, can't test");
+    #else
+    const std::size_t importCount = Utility::startupProfileEventCount(Utility::StartupProfileEventType::StaticPluginImport);
+    const std::size_t ejectCount = Utility::startupProfileEventCount(Utility::StartupProfileEventType::StaticPluginEject);
+
+    {
+        /* Canary is the only static plugin for this interface, the import
+           gets recorded when the manager parses its metadata and calls the
+           initializer */
+        PluginManager::Manager<AbstractAnimal> manager{"nonexistent"};
+        CORRADE_COMPARE(Utility::startupProfileEventCount(Utility::StartupProfileEventType::StaticPluginImport), importCount + 1);
+        CORRADE_COMPARE(Utility::startupProfileEventCount(Utility::StartupProfileEventType::StaticPluginEject), ejectCount);
+    }
+
+    /* The finalizer gets called on manager destruction */
+    CORRADE_COMPARE(Utility::startupProfileEventCount(Utility::StartupProfileEventType::StaticPluginEject), ejectCount + 1);
+
+    const Utility::StartupProfileEvent* found = nullptr;
+    for(const Utility::StartupProfileEvent& event: Utility::startupProfileEvents()) {
+        if(event.type == Utility::StartupProfileEventType::StaticPluginImport && event.name == "Canary"_s) {
+            found = &event;
+            break;
+        }
+    }
+    CORRADE_VERIFY(found);
+    CORRADE_VERIFY(found->timestamp);
+    #endif
+}
+
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
 void ManagerTest::dynamicPlugin() {
     PluginManager::Manager<AbstractAnimal> manager;
@@ -917,6 +1006,114 @@ void ManagerTest::configurationImplicit() {
 }
 #endif
 
+void ManagerTest::instancePool() {
+    PluginManager::Manager<AbstractAnimal> manager;
+    CORRADE_COMPARE(manager.instancePoolSize(), 0);
+
+    /* The pool is empty, so this creates a new instance */
+    Containers::Pointer<AbstractAnimal> animal = manager.instantiatePooled("Canary");
+    CORRADE_VERIFY(animal);
+    AbstractAnimal* pointer = animal.get();
+    animal->configuration().setValue("name", "Bird!!");
+    CORRADE_COMPARE(animal->name(), "Bird!!");
+
+    manager.recycle(Utility::move(animal));
+    CORRADE_VERIFY(!animal);
+    CORRADE_COMPARE(manager.instancePoolSize(), 1);
+
+    /* The same instance is reused, with the configuration restored */
+    Containers::Pointer<AbstractAnimal> reused = manager.instantiatePooled("Canary");
+    CORRADE_COMPARE(reused.get(), pointer);
+    CORRADE_COMPARE(reused->plugin(), "Canary");
+    CORRADE_COMPARE(reused->name(), "Achoo");
+    CORRADE_COMPARE(manager.instancePoolSize(), 0);
+
+    /* The pool is empty again, so this creates a new instance */
+    Containers::Pointer<AbstractAnimal> another = manager.instantiatePooled("Canary");
+    CORRADE_VERIFY(another.get() != pointer);
+
+    manager.recycle(Utility::move(reused));
+    manager.recycle(Utility::move(another));
+    CORRADE_COMPARE(manager.instancePoolSize(), 2);
+
+    manager.clearInstancePool();
+    CORRADE_COMPARE(manager.instancePoolSize(), 0);
+
+    /* Instances left in the pool get deleted on manager destruction */
+    manager.recycle(manager.instantiate("Canary"));
+    CORRADE_COMPARE(manager.instancePoolSize(), 1);
+}
+
+void ManagerTest::instancePoolDifferentName() {
+    PluginManager::Manager<AbstractAnimal> manager;
+
+    Containers::Pointer<AbstractAnimal> animal = manager.instantiatePooled("Canary");
+    AbstractAnimal* pointer = animal.get();
+    manager.recycle(Utility::move(animal));
+    CORRADE_COMPARE(manager.instancePoolSize(), 1);
+
+    /* The instance in the pool was instantiated under a different name, so
+       it isn't reused */
+    Containers::Pointer<AbstractAnimal> alias = manager.instantiatePooled("JustSomeBird");
+    CORRADE_VERIFY(alias.get() != pointer);
+    CORRADE_COMPARE(alias->plugin(), "JustSomeBird");
+    CORRADE_COMPARE(manager.instancePoolSize(), 1);
+}
+
+void ManagerTest::instancePoolNotResettable() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("All static test plugins are resettable");
+    #else
+    PluginManager::Manager<AbstractAnimal> manager;
+    CORRADE_COMPARE(manager.load("Dog"), LoadState::Loaded);
+
+    /* Dog doesn't implement resetForReuse(), so the instance gets deleted */
+    manager.recycle(manager.instantiatePooled("Dog"));
+    CORRADE_COMPARE(manager.instancePoolSize(), 0);
+
+    /* It's not alive anymore, so the plugin can be unloaded */
+    CORRADE_COMPARE(manager.unload("Dog"), LoadState::NotLoaded);
+    #endif
+}
+
+void ManagerTest::instancePoolUnload() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("Can't test because static plugins can't be unloaded");
+    #else
+    PluginManager::Manager<AbstractDeletable> manager;
+    CORRADE_COMPARE(manager.load("Deletable"), LoadState::Loaded);
+
+    unsigned int var = 0;
+    Containers::Pointer<AbstractDeletable> deletable = manager.instantiatePooled("Deletable");
+    deletable->set(&var);
+    manager.recycle(Utility::move(deletable));
+    CORRADE_COMPARE(manager.instancePoolSize(), 1);
+    CORRADE_COMPARE(var, 0);
+
+    /* Pooled instances get deleted on unload */
+    CORRADE_COMPARE(manager.unload("Deletable"), LoadState::NotLoaded);
+    CORRADE_COMPARE(manager.instancePoolSize(), 0);
+    CORRADE_COMPARE(var, 0xDEADBEEF);
+    #endif
+}
+
+void ManagerTest::instancePoolInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    PluginManager::Manager<AbstractAnimal> manager;
+    PluginManager::Manager<AbstractAnimal> another;
+
+    Containers::String out;
+    Error redirectError{&out};
+    manager.instantiatePooled("Nonexistent");
+    manager.recycle(nullptr);
+    manager.recycle(another.instantiate("Canary"));
+    CORRADE_COMPARE(out,
+        "PluginManager::Manager::instantiatePooled(): plugin Nonexistent is not loaded\n"
+        "PluginManager::Manager::recycle(): the instance is null\n"
+        "PluginManager::Manager::recycle(): the instance wasn't instantiated through this manager\n");
+}
+
 void ManagerTest::deletable() {
     #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
     CORRADE_SKIP("Can't test because static plugins can't be unloaded");
@@ -1108,6 +1305,208 @@ void ManagerTest::unresolvedDependencies() {
     #endif
 }
 
+void ManagerTest::loadMultiple() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("Loading multiple plugins at once is meaningful only for dynamic plugins");
+    #else
+    PluginManager::Manager<AbstractAnimal> manager;
+
+    /* Dog is a dependency of PitBull and is listed explicitly as well, it
+       should get loaded just once. Canary is static. */
+    CORRADE_COMPARE_AS(manager.load({"PitBull", "Canary", "Dog"}),
+        Containers::arrayView({LoadState::Loaded, LoadState::Static, LoadState::Loaded}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(manager.loadState("PitBull"), LoadState::Loaded);
+    CORRADE_COMPARE(manager.loadState("Dog"), LoadState::Loaded);
+    CORRADE_COMPARE_AS(manager.metadata("Dog")->usedBy(),
+        Containers::StringIterable{"PitBull"},
+        TestSuite::Compare::Container);
+
+    /* Duration is recorded only for dynamic plugins that are loaded */
+    CORRADE_VERIFY(manager.loadDuration("PitBull"));
+    CORRADE_VERIFY(manager.loadDuration("Dog"));
+    CORRADE_COMPARE(manager.loadDuration("Canary"), 0);
+    CORRADE_COMPARE(manager.loadDuration("Nonexistent"), 0);
+
+    {
+        Containers::Pointer<AbstractAnimal> animal = manager.instantiate("PitBull");
+        CORRADE_VERIFY(animal);
+        CORRADE_COMPARE(animal->name(), "Rodriguez");
+    }
+
+    /* Loading again returns the current state without doing anything */
+    CORRADE_COMPARE_AS(manager.load({"Dog", "PitBull"}),
+        Containers::arrayView({LoadState::Loaded, LoadState::Loaded}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(manager.metadata("Dog")->usedBy(),
+        Containers::StringIterable{"PitBull"},
+        TestSuite::Compare::Container);
+
+    /* Unloading works the same as if the plugins were loaded one by one */
+    CORRADE_COMPARE(manager.unload("PitBull"), LoadState::NotLoaded);
+    CORRADE_COMPARE(manager.unload("Dog"), LoadState::NotLoaded);
+    CORRADE_COMPARE(manager.loadDuration("Dog"), 0);
+    #endif
+}
+
+void ManagerTest::loadMultipleSharedDependency() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("Loading multiple plugins at once is meaningful only for dynamic plugins");
+    #else
+    /* Copies of the Dog plugin, Wolf being a dependency of both Husky and
+       Malamute */
+    const Containers::String directory = Utility::Path::join(PLUGINS_WRITE_DIR, "shared-dependency");
+    CORRADE_VERIFY(Utility::Path::make(directory));
+    for(const char* name: {"Wolf", "Husky", "Malamute"})
+        CORRADE_VERIFY(Utility::Path::copy(DOG_PLUGIN_FILENAME, Utility::Path::join(directory, name + AbstractAnimal::pluginSuffix())));
+    CORRADE_VERIFY(Utility::Path::write(Utility::Path::join(directory, "Wolf.conf"), ""_s));
+    CORRADE_VERIFY(Utility::Path::write(Utility::Path::join(directory, "Husky.conf"), "depends=Wolf\n"_s));
+    CORRADE_VERIFY(Utility::Path::write(Utility::Path::join(directory, "Malamute.conf"), "depends=Wolf\n"_s));
+
+    {
+        PluginManager::Manager<AbstractAnimal> manager{directory};
+
+        /* Both dependents have to wait until Wolf is loaded, which means it
+           gets opened just once */
+        CORRADE_COMPARE_AS(manager.load({"Wolf", "Husky", "Malamute"}),
+            Containers::arrayView({LoadState::Loaded, LoadState::Loaded, LoadState::Loaded}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(manager.metadata("Wolf")->usedBy(),
+            Containers::StringIterable({"Husky", "Malamute"}),
+            TestSuite::Compare::Container);
+
+        CORRADE_COMPARE(manager.unload("Husky"), LoadState::NotLoaded);
+        CORRADE_COMPARE(manager.unload("Malamute"), LoadState::NotLoaded);
+        CORRADE_COMPARE(manager.unload("Wolf"), LoadState::NotLoaded);
+    }
+
+    /* If the plugin was opened twice, it'd stay loaded even after the
+       manager is gone */
+    #ifdef CORRADE_TARGET_UNIX
+    const Containers::String wolfFilename = Utility::Path::join(directory, "Wolf" + AbstractAnimal::pluginSuffix());
+    void* const module = dlopen(wolfFilename.data(), RTLD_NOW|RTLD_NOLOAD);
+    if(module) dlclose(module);
+    CORRADE_VERIFY(!module);
+    #endif
+    #endif
+}
+
+void ManagerTest::loadMultipleFailed() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("Loading multiple plugins at once is meaningful only for dynamic plugins");
+    #else
+    PluginManager::Manager<AbstractAnimal> manager;
+
+    /* A failure of one plugin shouldn't affect the others. Not found plugins
+       are reported first, failures to load in the order the plugins get
+       processed. */
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        CORRADE_COMPARE_AS(manager.load({"Snail", "Nonexistent", "Dog"}),
+            Containers::arrayView({LoadState::UnresolvedDependency, LoadState::NotFound, LoadState::Loaded}),
+            TestSuite::Compare::Container);
+    }
+    CORRADE_COMPARE(manager.loadState("Snail"), LoadState::NotLoaded);
+    CORRADE_COMPARE(manager.loadState("Dog"), LoadState::Loaded);
+    #if defined(CORRADE_TARGET_EMSCRIPTEN) || defined(CORRADE_TARGET_WINDOWS_RT) || defined(CORRADE_TARGET_IOS) || defined(CORRADE_TARGET_ANDROID)
+    CORRADE_COMPARE(out,
+        "PluginManager::Manager::load(): plugin Nonexistent was not found\n"
+        "PluginManager::Manager::load(): unresolved dependency SomethingThatDoesNotExist of plugin Snail\n");
+    #else
+    CORRADE_COMPARE(out,
+        "PluginManager::Manager::load(): plugin Nonexistent is not static and was not found in " PLUGINS_DIR "/animals\n"
+        "PluginManager::Manager::load(): unresolved dependency SomethingThatDoesNotExist of plugin Snail\n");
+    #endif
+    #endif
+}
+
+void ManagerTest::loadMultipleFailedCrossManager() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("Cross-manager dependencies can be tested only with dynamic plugins");
+    #else
+    PluginManager::Manager<AbstractAnimal> manager;
+    PluginManager::Manager<AbstractFood> foodManager;
+    foodManager.registerExternalManager(manager);
+
+    /* Same as unresolvedDependencies(), but with HotDog loaded alongside.
+       Dog should have just HotDog in the usedBy list. */
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        CORRADE_COMPARE_AS(foodManager.load({"HotDogWithSnail", "HotDog"}),
+            Containers::arrayView({LoadState::UnresolvedDependency, LoadState::Loaded}),
+            TestSuite::Compare::Container);
+    }
+    CORRADE_COMPARE(out,
+        "PluginManager::Manager::load(): unresolved dependency SomethingThatDoesNotExist of plugin Snail\n"
+        "PluginManager::Manager::load(): unresolved dependency Snail of plugin HotDogWithSnail\n");
+    CORRADE_COMPARE(foodManager.loadState("HotDogWithSnail"), LoadState::NotLoaded);
+    CORRADE_COMPARE(manager.loadState("Dog"), LoadState::Loaded);
+    CORRADE_COMPARE_AS(manager.metadata("Dog")->usedBy(),
+        Containers::StringIterable{"HotDog"},
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void ManagerTest::loadMultipleFailedOpen() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("Loading multiple plugins at once is meaningful only for dynamic plugins");
+    #else
+    PluginManager::Manager<AbstractWrongPlugin> manager;
+
+    /* The plugins are opened in parallel, but the errors should still be
+       printed in order */
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        CORRADE_COMPARE_AS(manager.load({"NoPluginVersion", "NoPluginInitializer"}),
+            Containers::arrayView({LoadState::LoadFailed, LoadState::LoadFailed}),
+            TestSuite::Compare::Container);
+    }
+    CORRADE_COMPARE(manager.loadState("NoPluginVersion"), LoadState::NotLoaded);
+    CORRADE_COMPARE(manager.loadState("NoPluginInitializer"), LoadState::NotLoaded);
+    CORRADE_COMPARE_AS(out,
+        "PluginManager::Manager::load(): cannot get version of plugin NoPluginVersion: ",
+        TestSuite::Compare::StringHasPrefix);
+    CORRADE_COMPARE_AS(out,
+        "\nPluginManager::Manager::load(): cannot get initializer of plugin NoPluginInitializer: ",
+        TestSuite::Compare::StringContains);
+    #endif
+}
+
+void ManagerTest::loadAll() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("Loading multiple plugins at once is meaningful only for dynamic plugins");
+    #else
+    PluginManager::Manager<AbstractAnimal> manager;
+
+    Containers::Array<LoadState> states;
+    {
+        /* Snail fails to load, not interested in the message */
+        Containers::String out;
+        Error redirectError{&out};
+        states = manager.loadAll();
+    }
+
+    /* The returned states should match what the manager reports */
+    const Containers::Array<Containers::StringView> plugins = manager.pluginList();
+    CORRADE_COMPARE(states.size(), plugins.size());
+    for(std::size_t i = 0; i != plugins.size(); ++i) {
+        CORRADE_ITERATION(plugins[i]);
+        if(states[i] & (LoadState::Loaded|LoadState::Static))
+            CORRADE_COMPARE(manager.loadState(plugins[i]), states[i]);
+        else
+            CORRADE_COMPARE(manager.loadState(plugins[i]), LoadState::NotLoaded);
+    }
+
+    CORRADE_COMPARE(manager.loadState("Canary"), LoadState::Static);
+    CORRADE_COMPARE(manager.loadState("Dog"), LoadState::Loaded);
+    CORRADE_COMPARE(manager.loadState("PitBull"), LoadState::Loaded);
+    CORRADE_COMPARE(manager.loadState("Snail"), LoadState::NotLoaded);
+    #endif
+}
+
 void ManagerTest::reloadPluginDirectory() {
     #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
     CORRADE_SKIP("Plugin directory is irrelevant for static plugins");
@@ -1198,6 +1597,286 @@ void ManagerTest::restoreAliasesAfterPluginDirectoryChange() {
     #endif
 }
 
+#ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+namespace {
+
+/* Creates a directory with a few plugins. The plugin binaries are empty as
+   they're never loaded, only the metadata are used. */
+Containers::String prepareMetadataIndexDirectory() {
+    const Containers::String directory = Utility::Path::join(PLUGINS_WRITE_DIR, "metadata-index");
+    if(Utility::Path::exists(directory)) {
+        const Containers::Optional<Containers::Array<Containers::String>> list = Utility::Path::list(directory, Utility::Path::ListFlag::SkipDotAndDotDot);
+        CORRADE_INTERNAL_ASSERT(list);
+        for(const Containers::String& file: *list)
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::remove(Utility::Path::join(directory, file)));
+    } else CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::make(directory));
+
+    for(const char* name: {"Dog", "Snail"}) {
+        CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::copy(
+            Utility::Path::join({PLUGINS_DIR, "animals", name + ".conf"_s}),
+            Utility::Path::join(directory, name + ".conf"_s)));
+        CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::write(Utility::Path::join(directory, name + AbstractAnimal::pluginSuffix()), Containers::ArrayView<const void>{}));
+    }
+
+    /* Comments aren't preserved in the index, so this one doesn't have any */
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::write(Utility::Path::join(directory, "Fox.conf"),
+        "depends=Dog\n"
+        "provides=Vulpes\n"
+        "provides=Reynard\n"
+        "[data]\n"
+        "description=What does the fox say?\n"
+        "[configuration]\n"
+        "noise=ring-ding\n"
+        "[configuration/volume]\n"
+        "value=11\n"_s));
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::write(Utility::Path::join(directory, "Fox" + AbstractAnimal::pluginSuffix()), Containers::ArrayView<const void>{}));
+
+    return directory;
+}
+
+/* Lists values and groups recursively in the order they're iterated */
+void dumpConfigurationGroup(Containers::String& out, const Utility::ConfigurationGroup& group, const Containers::StringView path) {
+    for(Containers::Pair<Containers::StringView, Containers::StringView> value: group.values())
+        out = out + value.first() + "="_s + value.second() + "\n"_s;
+    for(Containers::Pair<Containers::StringView, Containers::Reference<const Utility::ConfigurationGroup>> subgroup: group.groups()) {
+        const Containers::String subgroupPath = path + "/"_s + subgroup.first();
+        out = out + "["_s + subgroupPath + "]\n"_s;
+        dumpConfigurationGroup(out, *subgroup.second(), subgroupPath);
+    }
+}
+
+Containers::String dumpConfigurationGroup(const Utility::ConfigurationGroup& group) {
+    Containers::String out;
+    dumpConfigurationGroup(out, group, {});
+    return out;
+}
+
+}
+#endif
+
+void ManagerTest::metadataIndex() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("Metadata index is meaningful only for dynamic plugins");
+    #else
+    const Containers::String directory = prepareMetadataIndexDirectory();
+
+    CORRADE_VERIFY(PluginManager::Manager<AbstractAnimal>{directory}.saveMetadataIndex());
+    CORRADE_VERIFY(Utility::Path::exists(Utility::Path::join(directory, ".corrade-plugin-index")));
+
+    /* The metadata should be the same as if the files were parsed directly */
+    PluginManager::Manager<AbstractAnimal> manager{directory};
+    CORRADE_COMPARE_AS(manager.pluginList(), Containers::arrayView({
+        "Canary"_s, "Dog"_s, "Fox"_s, "Snail"_s
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(manager.aliasList(), Containers::arrayView({
+        "AGoodBoy"_s, "Canary"_s, "Dog"_s, "Fox"_s, "JustSomeBird"_s, "JustSomeMammal"_s, "Reynard"_s, "Snail"_s, "Vulpes"_s
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(manager.loadState("Fox"), LoadState::NotLoaded);
+    CORRADE_COMPARE(manager.loadState("Vulpes"), LoadState::NotLoaded);
+    CORRADE_COMPARE(manager.loadDuration("Fox"), 0);
+
+    const PluginMetadata* dog = manager.metadata("Dog");
+    CORRADE_VERIFY(dog);
+    CORRADE_COMPARE(dog->data().value("description"), "A simple dog plugin.");
+
+    const PluginMetadata* fox = manager.metadata("Fox");
+    CORRADE_VERIFY(fox);
+    CORRADE_COMPARE(fox->name(), "Fox");
+    CORRADE_COMPARE_AS(fox->depends(),
+        Containers::StringIterable{"Dog"},
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(fox->provides(),
+        Containers::StringIterable({"Vulpes", "Reynard"}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(fox->data().value("description"), "What does the fox say?");
+    CORRADE_COMPARE(fox->configuration().value("noise"), "ring-ding");
+    CORRADE_VERIFY(fox->configuration().group("volume"));
+    CORRADE_COMPARE(fox->configuration().group("volume")->value<int>("value"), 11);
+
+    /* The plugin configuration is still modifiable */
+    manager.metadata("Fox")->configuration().setValue("noise", "wa-pa-pa-pa-pa-pa-pow");
+    CORRADE_COMPARE(fox->configuration().value("noise"), "wa-pa-pa-pa-pa-pa-pow");
+    #endif
+}
+
+void ManagerTest::metadataIndexRoundTrip() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("Metadata index is meaningful only for dynamic plugins");
+    #else
+    const Containers::String directory = prepareMetadataIndexDirectory();
+
+    /* Repeated keys and repeated groups interleaved with other keys and
+       groups, on multiple levels */
+    const Containers::String filename = Utility::Path::join(directory, "Fox.conf");
+    CORRADE_VERIFY(Utility::Path::write(filename,
+        "provides=Vulpes\n"
+        "depends=Dog\n"
+        "provides=Reynard\n"
+        "[configuration]\n"
+        "noise=ring-ding\n"
+        "volume=11\n"
+        "noise=wa-pa-pa\n"
+        "[configuration/tail]\n"
+        "color=red\n"
+        "[configuration/ear]\n"
+        "side=left\n"
+        "[configuration/tail/tip]\n"
+        "color=white\n"
+        "[configuration/ear]\n"
+        "side=right\n"
+        "[data]\n"
+        "description=What does the fox say?\n"
+        "[configuration]\n"
+        "noise=hatee-hatee-hatee-ho\n"
+        "[configuration/ear]\n"
+        "[data]\n"
+        "description=Ancient mystery\n"_s));
+
+    const Containers::String index = Utility::Path::join(directory, ".corrade-plugin-index");
+    CORRADE_VERIFY(PluginManager::Manager<AbstractAnimal>{directory}.saveMetadataIndex());
+
+    /* The index contents are deterministic. Overwriting the index doesn't
+       change the directory modification time. */
+    Containers::Optional<Containers::String> indexData = Utility::Path::readString(index);
+    CORRADE_VERIFY(indexData);
+    CORRADE_VERIFY(PluginManager::Manager<AbstractAnimal>{directory}.saveMetadataIndex());
+    CORRADE_COMPARE(Utility::Path::readString(index), indexData);
+
+    /* The metadata should be the same as if the file was parsed directly,
+       including the order */
+    PluginManager::Manager<AbstractAnimal> manager{directory};
+    const PluginMetadata* fox = manager.metadata("Fox");
+    CORRADE_VERIFY(fox);
+    CORRADE_COMPARE_AS(fox->depends(),
+        Containers::StringIterable{"Dog"},
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(fox->provides(),
+        Containers::StringIterable({"Vulpes", "Reynard"}),
+        TestSuite::Compare::Container);
+
+    const Utility::Configuration expected{filename, Utility::Configuration::Flag::ReadOnly};
+    CORRADE_VERIFY(expected.isValid());
+    CORRADE_COMPARE(dumpConfigurationGroup(fox->data()),
+        dumpConfigurationGroup(*expected.group("data")));
+    CORRADE_COMPARE(dumpConfigurationGroup(fox->configuration()),
+        dumpConfigurationGroup(*expected.group("configuration")));
+    /* Verify the dump isn't trivially empty. A group that isn't the last one
+       on given level gets reopened as a new group. */
+    CORRADE_COMPARE(dumpConfigurationGroup(fox->configuration()),
+        "noise=ring-ding\n"
+        "volume=11\n"
+        "noise=wa-pa-pa\n"
+        "[/tail]\n"
+        "color=red\n"
+        "[/ear]\n"
+        "side=left\n"
+        "[/tail]\n"
+        "[/tail/tip]\n"
+        "color=white\n"
+        "[/ear]\n"
+        "side=right\n");
+    #endif
+}
+
+void ManagerTest::metadataIndexOutdated() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("Metadata index is meaningful only for dynamic plugins");
+    #else
+    const Containers::String directory = prepareMetadataIndexDirectory();
+
+    const Containers::String index = Utility::Path::join(directory, ".corrade-plugin-index");
+    CORRADE_VERIFY(PluginManager::Manager<AbstractAnimal>{directory}.saveMetadataIndex());
+    const Containers::Optional<std::int64_t> directoryModification = Utility::Path::lastModification(directory);
+    CORRADE_VERIFY(directoryModification);
+
+    /* Change a metadata file, remove a plugin and add another one. The
+       changes should be picked up. The new metadata file has a different
+       size, so it's detected as changed even if the filesystem records the
+       same modification time for it. */
+    CORRADE_VERIFY(Utility::Path::write(Utility::Path::join(directory, "Fox.conf"),
+        "[data]\n"
+        "description=Ring-ding-ding-ding-dingeringeding!\n"_s));
+    CORRADE_VERIFY(Utility::Path::remove(Utility::Path::join(directory, "Snail" + AbstractAnimal::pluginSuffix())));
+    CORRADE_VERIFY(Utility::Path::copy(
+        Utility::Path::join({PLUGINS_DIR, "animals", "PitBull.conf"}),
+        Utility::Path::join(directory, "PitBull.conf")));
+    CORRADE_VERIFY(Utility::Path::write(Utility::Path::join(directory, "PitBull" + AbstractAnimal::pluginSuffix()), Containers::ArrayView<const void>{}));
+
+    /* The directory modification time may however stay the same, as the
+       granularity can be rather coarse. Instead of waiting for it to change,
+       make the time recorded in the index, which is right after the magic
+       and version, older. Overwriting the index doesn't change the directory
+       modification time. */
+    Containers::Optional<Containers::Array<char>> indexData = Utility::Path::read(index);
+    CORRADE_VERIFY(indexData);
+    std::int64_t indexDirectoryModification;
+    CORRADE_VERIFY(indexData->size() >= 8 + sizeof(indexDirectoryModification));
+    std::memcpy(&indexDirectoryModification, indexData->data() + 8, sizeof(indexDirectoryModification));
+    CORRADE_COMPARE(indexDirectoryModification, *directoryModification);
+    --indexDirectoryModification;
+    std::memcpy(indexData->data() + 8, &indexDirectoryModification, sizeof(indexDirectoryModification));
+    CORRADE_VERIFY(Utility::Path::write(index, *indexData));
+
+    PluginManager::Manager<AbstractAnimal> manager{directory};
+    CORRADE_COMPARE_AS(manager.pluginList(), Containers::arrayView({
+        "Canary"_s, "Dog"_s, "Fox"_s, "PitBull"_s
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(manager.metadata("Fox")->data().value("description"), "Ring-ding-ding-ding-dingeringeding!");
+    CORRADE_COMPARE_AS(manager.metadata("Fox")->provides(),
+        Containers::StringIterable{},
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(manager.metadata("PitBull")->data().value("description"), "I'M ANGRY!!");
+
+    /* Metadata of the unchanged plugin are still correct */
+    CORRADE_COMPARE(manager.metadata("Dog")->data().value("description"), "A simple dog plugin.");
+    #endif
+}
+
+void ManagerTest::metadataIndexInvalid() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("Metadata index is meaningful only for dynamic plugins");
+    #else
+    const Containers::String directory = prepareMetadataIndexDirectory();
+    const Containers::String index = Utility::Path::join(directory, ".corrade-plugin-index");
+
+    CORRADE_VERIFY(PluginManager::Manager<AbstractAnimal>{directory}.saveMetadataIndex());
+
+    /* Cut the index in the middle. Overwriting the file doesn't change the
+       directory modification time. */
+    Containers::Optional<Containers::String> data = Utility::Path::readString(index);
+    CORRADE_VERIFY(data);
+    CORRADE_VERIFY(Utility::Path::write(index, data->prefix(data->size()/2)));
+
+    Containers::String out;
+    Containers::Optional<PluginManager::Manager<AbstractAnimal>> manager;
+    {
+        Warning redirectWarning{&out};
+        manager.emplace(directory);
+    }
+    CORRADE_COMPARE(out, Utility::format("PluginManager::Manager: ignoring invalid metadata index {}\n", index));
+
+    /* Everything is still loaded correctly */
+    CORRADE_COMPARE_AS(manager->pluginList(), Containers::arrayView({
+        "Canary"_s, "Dog"_s, "Fox"_s, "Snail"_s
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(manager->metadata("Fox")->data().value("description"), "What does the fox say?");
+    #endif
+}
+
+void ManagerTest::saveMetadataIndexNoPluginDirectory() {
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_SKIP("Metadata index is meaningful only for dynamic plugins");
+    #else
+    PluginManager::Manager<AbstractAnimal> manager;
+    manager.setPluginDirectory({});
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!manager.saveMetadataIndex());
+    CORRADE_COMPARE(out, "PluginManager::Manager::saveMetadataIndex(): plugin directory is not set\n");
+    #endif
+}
+
 void ManagerTest::staticProvides() {
     PluginManager::Manager<AbstractAnimal> manager;
 
@@ -1512,6 +2191,22 @@ void ManagerTest::debugLoadStates() {
     CORRADE_COMPARE(out, "PluginManager::LoadState::NotFound|PluginManager::LoadState::Static PluginManager::LoadStates{}\n");
 }
 
+#ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+void ManagerTest::debugManagerFlag() {
+    Containers::String out;
+
+    Debug{&out} << ManagerFlag::LazyLoad << ManagerFlag(0xf0);
+    CORRADE_COMPARE(out, "PluginManager::ManagerFlag::LazyLoad PluginManager::ManagerFlag(0xf0)\n");
+}
+
+void ManagerTest::debugManagerFlags() {
+    Containers::String out;
+
+    Debug{&out} << (ManagerFlag::LazyLoad|ManagerFlag(0xf0)) << ManagerFlags{};
+    CORRADE_COMPARE(out, "PluginManager::ManagerFlag::LazyLoad|PluginManager::ManagerFlag(0xf0) PluginManager::ManagerFlags{}\n");
+}
+#endif
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::PluginManager::Test::ManagerTest)
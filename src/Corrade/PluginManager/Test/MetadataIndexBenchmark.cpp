@@ -0,0 +1,114 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/Optional.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/PluginManager/Manager.hpp"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Format.h"
+#include "Corrade/Utility/Path.h"
+
+#include "AbstractAnimal.h"
+
+#include "configure.h"
+
+namespace Corrade { namespace PluginManager { namespace Test { namespace {
+
+struct MetadataIndexBenchmark: TestSuite::Tester {
+    explicit MetadataIndexBenchmark();
+
+    void scan();
+    void scanIndexed();
+
+    private:
+        Containers::String _directory, _indexedDirectory;
+};
+
+using namespace Containers::Literals;
+
+constexpr std::size_t PluginCount = 500;
+
+MetadataIndexBenchmark::MetadataIndexBenchmark() {
+    addBenchmarks({&MetadataIndexBenchmark::scan,
+                   &MetadataIndexBenchmark::scanIndexed}, 10);
+
+    /* Two identical directories with a few hundred plugins, one of them with
+       the index. The plugin binaries are empty as they're never loaded. */
+    _directory = Utility::Path::join(PLUGINS_WRITE_DIR, "benchmark");
+    _indexedDirectory = Utility::Path::join(PLUGINS_WRITE_DIR, "benchmark-indexed");
+    for(const Containers::StringView directory: {Containers::StringView{_directory}, Containers::StringView{_indexedDirectory}}) {
+        const Containers::String index = Utility::Path::join(directory, ".corrade-plugin-index");
+        if(Utility::Path::exists(index))
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::remove(index));
+        CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::make(directory));
+        for(std::size_t i = 0; i != PluginCount; ++i) {
+            const Containers::String name = Utility::format("Plugin{:.3}", i);
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::write(Utility::Path::join(directory, name + AbstractAnimal::pluginSuffix()), Containers::ArrayView<const void>{}));
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::write(Utility::Path::join(directory, name + ".conf"_s), Utility::format(
+                "# A plugin with typical metadata\n"
+                "depends=Dog\n"
+                "provides=Alias{0}\n"
+                "provides=AnotherAlias{0}\n"
+                "\n"
+                "[data]\n"
+                "description=Plugin number {0}\n"
+                "author=Someone\n"
+                "\n"
+                "[configuration]\n"
+                "quality=0.9\n"
+                "threads=4\n"
+                "verbose=false\n"
+                "[configuration/hints]\n"
+                "fast=true\n", name)));
+        }
+    }
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Manager<AbstractAnimal>{_indexedDirectory}.saveMetadataIndex());
+}
+
+void MetadataIndexBenchmark::scan() {
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(5) {
+        Manager<AbstractAnimal> manager{_directory};
+        count += manager.pluginList().size();
+    }
+
+    CORRADE_COMPARE(count, 5*PluginCount);
+}
+
+void MetadataIndexBenchmark::scanIndexed() {
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(5) {
+        Manager<AbstractAnimal> manager{_indexedDirectory};
+        count += manager.pluginList().size();
+    }
+
+    CORRADE_COMPARE(count, 5*PluginCount);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::PluginManager::Test::MetadataIndexBenchmark)
@@ -39,6 +39,7 @@ Canary::Canary(AbstractManager& manager, const Containers::StringView& plugin):
 Containers::String Canary::name() { return configuration().value<Containers::String>("name"); }
 int Canary::legCount() { return 2; }
 bool Canary::hasTail() { return true; }
+bool Canary::resetForReuse() { return true; }
 
 }}}
 
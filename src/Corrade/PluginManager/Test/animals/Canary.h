@@ -36,6 +36,8 @@ class Canary: public AbstractAnimal {
         Containers::String name() override;
         int legCount() override;
         bool hasTail() override;
+
+        bool resetForReuse() override;
 };
 
 }}}
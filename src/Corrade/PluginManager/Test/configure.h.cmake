@@ -28,3 +28,4 @@
 #cmakedefine DOG_PLUGIN_FILENAME "${DOG_PLUGIN_FILENAME}"
 #cmakedefine DOGGO_PLUGIN_FILENAME "${DOGGO_PLUGIN_FILENAME}"
 #cmakedefine PITBULL_PLUGIN_FILENAME "${PITBULL_PLUGIN_FILENAME}"
+#cmakedefine PLUGINS_WRITE_DIR "${PLUGINS_WRITE_DIR}"
@@ -28,6 +28,7 @@
 
 #include <cstring>
 
+#include "Corrade/Containers/Array.h"
 /* CORRADE_FALLTHROUGH, needed on Clang when CORRADE_NO_ASSERT is defined */
 #include "Corrade/Utility/Macros.h"
 
@@ -275,4 +276,434 @@ void flipSecondToLastDimensionInPlace(const Containers::StridedArrayView4D<char>
 
 }
 
+namespace {
+
+/* Maps values to unsigned integers with the same ordering, which is what both
+   the radix sort and the comparison-based algorithms operate on. For signed
+   integers it's enough to flip the sign bit, negative floats have all bits
+   flipped in addition, which results in the IEEE 754 totalOrder. */
+template<class T, class K> struct UnsignedSortTraits {
+    typedef K Key;
+    static K toKey(const T value) { return value; }
+    static T fromKey(const K key) { return key; }
+};
+
+template<class T, class K> struct SignedSortTraits {
+    typedef K Key;
+    enum: K { SignBit = K(1) << (sizeof(K)*8 - 1) };
+    static K toKey(const T value) { return K(K(value) ^ SignBit); }
+    static T fromKey(const K key) { return T(K(key ^ SignBit)); }
+};
+
+template<class T, class K> struct FloatSortTraits {
+    typedef K Key;
+    enum: K { SignBit = K(1) << (sizeof(K)*8 - 1) };
+    static K toKey(const T value) {
+        K bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        return bits ^ (K(-K(bits >> (sizeof(K)*8 - 1))) | SignBit);
+    }
+    static T fromKey(const K key) {
+        /* If the top bit is set, the value was positive and only the sign bit
+           got flipped */
+        const K bits = key ^ (K(K(key >> (sizeof(K)*8 - 1)) - 1) | SignBit);
+        T value;
+        std::memcpy(&value, &bits, sizeof(T));
+        return value;
+    }
+};
+
+template<class> struct SortTraits;
+template<> struct SortTraits<std::uint8_t>: UnsignedSortTraits<std::uint8_t, std::uint8_t> {};
+template<> struct SortTraits<std::int8_t>: SignedSortTraits<std::int8_t, std::uint8_t> {};
+template<> struct SortTraits<std::uint16_t>: UnsignedSortTraits<std::uint16_t, std::uint16_t> {};
+template<> struct SortTraits<std::int16_t>: SignedSortTraits<std::int16_t, std::uint16_t> {};
+template<> struct SortTraits<std::uint32_t>: UnsignedSortTraits<std::uint32_t, std::uint32_t> {};
+template<> struct SortTraits<std::int32_t>: SignedSortTraits<std::int32_t, std::uint32_t> {};
+template<> struct SortTraits<std::uint64_t>: UnsignedSortTraits<std::uint64_t, std::uint64_t> {};
+template<> struct SortTraits<std::int64_t>: SignedSortTraits<std::int64_t, std::uint64_t> {};
+template<> struct SortTraits<float>: FloatSortTraits<float, std::uint32_t> {};
+template<> struct SortTraits<double>: FloatSortTraits<double, std::uint64_t> {};
+
+/* Key together with its original position, used for argsort and key-value
+   sort */
+template<class K> struct KeyIndex {
+    K key;
+    std::uint32_t index;
+};
+
+/* Key-index pairs are ordered by the index if the keys are equal. That makes
+   the comparison-based algorithms produce the same stable order as the radix
+   sort, without having to care about stability in them. */
+template<class E> struct SortItem {
+    typedef E Key;
+    static E key(const E item) { return item; }
+    static bool less(const E a, const E b) { return a < b; }
+};
+
+template<class K> struct SortItem<KeyIndex<K>> {
+    typedef K Key;
+    static K key(const KeyIndex<K>& item) { return item.key; }
+    static bool less(const KeyIndex<K>& a, const KeyIndex<K>& b) {
+        return a.key < b.key || (a.key == b.key && a.index < b.index);
+    }
+};
+
+/* Below this size, insertion sort is faster than anything else. Also the size
+   of the stack buffers used to avoid an allocation for small views. */
+constexpr std::size_t InsertionSortThreshold = 32;
+
+/* Below this size multiplied by the key size, a quicksort is faster than the
+   radix sort, for which the histogram setup cost doesn't pay off yet */
+constexpr std::size_t RadixSortThreshold = 32;
+
+template<class E> void insertionSort(E* const data, const std::size_t size) {
+    for(std::size_t i = 1; i < size; ++i) {
+        const E item = data[i];
+        std::size_t j = i;
+        for(; j && SortItem<E>::less(item, data[j - 1]); --j)
+            data[j] = data[j - 1];
+        data[j] = item;
+    }
+}
+
+/* LSD radix sort with 8-bit digits. The histograms for all digits are
+   calculated in a single pass upfront, and digits that are the same for all
+   items are skipped, which makes small value ranges cheaper to sort. The
+   scratch buffer has to have the same size as the data, the result is always
+   in data. */
+template<class E> void radixSort(E* const data, E* const scratch, const std::size_t size) {
+    typedef typename SortItem<E>::Key Key;
+    enum: std::size_t { Passes = sizeof(Key) };
+
+    std::size_t histograms[Passes][256]{};
+    for(std::size_t i = 0; i != size; ++i) {
+        const Key key = SortItem<E>::key(data[i]);
+        for(std::size_t pass = 0; pass != Passes; ++pass)
+            ++histograms[pass][(key >> (pass*8)) & 0xff];
+    }
+
+    E* from = data;
+    E* to = scratch;
+    for(std::size_t pass = 0; pass != Passes; ++pass) {
+        std::size_t* const histogram = histograms[pass];
+        if(histogram[(SortItem<E>::key(from[0]) >> (pass*8)) & 0xff] == size)
+            continue;
+
+        /* Turn the counts into offsets */
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i != 256; ++i) {
+            const std::size_t count = histogram[i];
+            histogram[i] = offset;
+            offset += count;
+        }
+
+        for(std::size_t i = 0; i != size; ++i) {
+            const E item = from[i];
+            to[histogram[(SortItem<E>::key(item) >> (pass*8)) & 0xff]++] = item;
+        }
+
+        Utility::swap(from, to);
+    }
+
+    if(from != data) std::memcpy(data, from, size*sizeof(E));
+}
+
+/* Hoare partitioning with a median-of-three pivot. The three items are sorted
+   first, so there's always an item not less and not greater than the pivot
+   at either end, which means the scans don't need bounds checks and the
+   returned split point is always in [0, size - 1), making both parts
+   non-empty. Expects at least three items. Items in [0, split] are not
+   greater than items in [split + 1, size). */
+template<class E> std::size_t partition(E* const data, const std::size_t size) {
+    E& a = data[0];
+    E& b = data[size/2];
+    E& c = data[size - 1];
+    if(SortItem<E>::less(b, a)) Utility::swap(a, b);
+    if(SortItem<E>::less(c, b)) {
+        Utility::swap(b, c);
+        if(SortItem<E>::less(b, a)) Utility::swap(a, b);
+    }
+    const E pivot = b;
+
+    std::size_t i = 0, j = size - 1;
+    for(;;) {
+        while(SortItem<E>::less(data[i], pivot)) ++i;
+        while(SortItem<E>::less(pivot, data[j])) --j;
+        if(i >= j) return j;
+        Utility::swap(data[i], data[j]);
+        ++i;
+        --j;
+    }
+}
+
+/* Heapsort, used as a fallback for quicksort. Unlike the radix sort it
+   orders by the whole item, so it keeps the key-index pairs ordered by the
+   index even after the partitioning shuffled them. */
+template<class E> void siftDown(E* const data, std::size_t i, const std::size_t size) {
+    const E item = data[i];
+    for(std::size_t child; (child = 2*i + 1) < size; i = child) {
+        if(child + 1 < size && SortItem<E>::less(data[child], data[child + 1]))
+            ++child;
+        if(!SortItem<E>::less(item, data[child])) break;
+        data[i] = data[child];
+    }
+    data[i] = item;
+}
+
+template<class E> void heapSort(E* const data, const std::size_t size) {
+    for(std::size_t i = size/2; i; --i)
+        siftDown(data, i - 1, size);
+    for(std::size_t i = size - 1; i; --i) {
+        Utility::swap(data[0], data[i]);
+        siftDown(data, 0, i);
+    }
+}
+
+/* Introsort -- quicksort recursing only into the smaller part, falling back
+   to the heapsort if it doesn't converge in about 2*log2(size) steps, which
+   happens only for adversarial inputs */
+template<class E> void quickSort(E* data, std::size_t size, std::size_t budget) {
+    while(size > InsertionSortThreshold) {
+        if(!budget--) {
+            heapSort(data, size);
+            return;
+        }
+
+        const std::size_t split = partition(data, size) + 1;
+        if(split < size - split) {
+            quickSort(data, split, budget);
+            data += split;
+            size -= split;
+        } else {
+            quickSort(data + split, size - split, budget);
+            size = split;
+        }
+    }
+
+    insertionSort(data, size);
+}
+
+inline std::size_t partitionBudget(const std::size_t size) {
+    std::size_t budget = 0;
+    for(std::size_t i = size; i; i >>= 1) budget += 2;
+    return budget;
+}
+
+/* Sorts items that are either in the small stack buffer or in the first half
+   of storage, with the second half used as a scratch space */
+template<class E> void sortItems(E* const data, const std::size_t size) {
+    if(size <= InsertionSortThreshold)
+        insertionSort(data, size);
+    else if(size <= RadixSortThreshold*sizeof(typename SortItem<E>::Key))
+        quickSort(data, size, partitionBudget(size));
+    else
+        radixSort(data, data + size, size);
+}
+
+template<class T> void sortInPlaceImplementation(const Containers::StridedArrayView1D<void>& view) {
+    typedef SortTraits<T> Traits;
+    typedef typename Traits::Key Key;
+
+    const std::size_t size = view.size();
+    const Containers::StridedArrayView1D<T> typed = Containers::arrayCast<T>(view);
+
+    Key small[InsertionSortThreshold];
+    Containers::Array<Key> storage;
+    Key* keys = small;
+    if(size > InsertionSortThreshold) {
+        storage = Containers::Array<Key>{NoInit, 2*size};
+        keys = storage.data();
+    }
+
+    for(std::size_t i = 0; i != size; ++i) keys[i] = Traits::toKey(typed[i]);
+    sortItems(keys, size);
+    for(std::size_t i = 0; i != size; ++i) typed[i] = Traits::fromKey(keys[i]);
+}
+
+/* Returns the array where the items are if it's not the small stack buffer */
+template<class T> Containers::Array<KeyIndex<typename SortTraits<T>::Key>> argsortImplementation(const Containers::StridedArrayView1D<const void>& view, KeyIndex<typename SortTraits<T>::Key>*& items, KeyIndex<typename SortTraits<T>::Key>* const small) {
+    typedef SortTraits<T> Traits;
+
+    const std::size_t size = view.size();
+    const Containers::StridedArrayView1D<const T> typed = Containers::arrayCast<const T>(view);
+
+    Containers::Array<KeyIndex<typename Traits::Key>> storage;
+    items = small;
+    if(size > InsertionSortThreshold) {
+        storage = Containers::Array<KeyIndex<typename Traits::Key>>{NoInit, 2*size};
+        items = storage.data();
+    }
+
+    for(std::size_t i = 0; i != size; ++i)
+        items[i] = {Traits::toKey(typed[i]), std::uint32_t(i)};
+    sortItems(items, size);
+    return storage;
+}
+
+template<class T> void argsortIntoImplementation(const Containers::StridedArrayView1D<const void>& view, const Containers::StridedArrayView1D<std::uint32_t>& indices) {
+    KeyIndex<typename SortTraits<T>::Key> small[InsertionSortThreshold];
+    KeyIndex<typename SortTraits<T>::Key>* items;
+    const Containers::Array<KeyIndex<typename SortTraits<T>::Key>> storage = argsortImplementation<T>(view, items, small);
+
+    for(std::size_t i = 0, size = indices.size(); i != size; ++i)
+        indices[i] = items[i].index;
+}
+
+template<class T> void sortInPlaceImplementation(const Containers::StridedArrayView1D<void>& keys, const Containers::StridedArrayView2D<char>& values) {
+    typedef SortTraits<T> Traits;
+
+    KeyIndex<typename Traits::Key> small[InsertionSortThreshold];
+    KeyIndex<typename Traits::Key>* items;
+    const Containers::Array<KeyIndex<typename Traits::Key>> storage = argsortImplementation<T>(keys, items, small);
+
+    const std::size_t size = keys.size();
+    const Containers::StridedArrayView1D<T> typed = Containers::arrayCast<T>(keys);
+    for(std::size_t i = 0; i != size; ++i)
+        typed[i] = Traits::fromKey(items[i].key);
+
+    /* Gather the values in the new order to a temporary location and copy
+       them back */
+    const std::size_t valueSize = values.size()[1];
+    if(!valueSize) return;
+    char* const valueData = static_cast<char*>(values.data());
+    const std::ptrdiff_t valueStride = values.stride()[0];
+    Containers::Array<char> reordered{NoInit, size*valueSize};
+    for(std::size_t i = 0; i != size; ++i)
+        std::memcpy(reordered + i*valueSize, valueData + std::ptrdiff_t(items[i].index)*valueStride, valueSize);
+    for(std::size_t i = 0; i != size; ++i)
+        std::memcpy(valueData + std::ptrdiff_t(i)*valueStride, reordered + i*valueSize, valueSize);
+}
+
+/* Quickselect using the same partitioning as quickSort(). If it doesn't
+   converge fast enough, the remaining range is sorted instead. */
+template<class K> void selectKeys(K* const keys, const std::size_t size, const std::size_t nth) {
+    std::size_t budget = partitionBudget(size);
+    std::size_t begin = 0, end = size;
+    while(end - begin > InsertionSortThreshold) {
+        if(!budget--) {
+            Containers::Array<K> scratch{NoInit, end - begin};
+            radixSort(keys + begin, scratch.data(), end - begin);
+            return;
+        }
+
+        const std::size_t split = begin + partition(keys + begin, end - begin) + 1;
+        if(nth < split) end = split;
+        else begin = split;
+    }
+
+    insertionSort(keys + begin, end - begin);
+}
+
+template<class T> void nthElementInPlaceImplementation(const Containers::StridedArrayView1D<void>& view, const std::size_t nth) {
+    typedef SortTraits<T> Traits;
+    typedef typename Traits::Key Key;
+
+    const std::size_t size = view.size();
+    const Containers::StridedArrayView1D<T> typed = Containers::arrayCast<T>(view);
+
+    Key small[InsertionSortThreshold];
+    Containers::Array<Key> storage;
+    Key* keys = small;
+    if(size > InsertionSortThreshold) {
+        storage = Containers::Array<Key>{NoInit, size};
+        keys = storage.data();
+    }
+
+    for(std::size_t i = 0; i != size; ++i) keys[i] = Traits::toKey(typed[i]);
+    selectKeys(keys, size, nth);
+    for(std::size_t i = 0; i != size; ++i) typed[i] = Traits::fromKey(keys[i]);
+}
+
+/* Branchless binary search -- the loop only narrows the range down to a
+   single item with a conditional move, the final comparison then decides
+   whether the result is that item or the one after */
+template<class T, bool upper> std::size_t boundImplementation(const Containers::StridedArrayView1D<const void>& view, const void* const value) {
+    typedef SortTraits<T> Traits;
+    typedef typename Traits::Key Key;
+
+    const std::size_t size = view.size();
+    if(!size) return 0;
+
+    const Containers::StridedArrayView1D<const T> typed = Containers::arrayCast<const T>(view);
+    const Key key = Traits::toKey(*static_cast<const T*>(value));
+    std::size_t first = 0;
+    for(std::size_t length = size; length > 1; ) {
+        const std::size_t half = length/2;
+        const Key candidate = Traits::toKey(typed[first + half]);
+        first += (upper ? !(key < candidate) : candidate < key) ? half : 0;
+        length -= half;
+    }
+
+    const Key last = Traits::toKey(typed[first]);
+    return first + ((upper ? !(key < last) : last < key) ? 1 : 0);
+}
+
+template<class T> std::size_t lowerBoundImplementation(const Containers::StridedArrayView1D<const void>& view, const void* const value) {
+    return boundImplementation<T, false>(view, value);
+}
+
+template<class T> std::size_t upperBoundImplementation(const Containers::StridedArrayView1D<const void>& view, const void* const value) {
+    return boundImplementation<T, true>(view, value);
+}
+
+}
+
+namespace Implementation {
+
+#define CORRADE_UTILITY_SORT_DISPATCH(function, ...)                        \
+    switch(type) {                                                          \
+        case SortType::UnsignedInt8: return function<std::uint8_t>(__VA_ARGS__); \
+        case SortType::Int8: return function<std::int8_t>(__VA_ARGS__);     \
+        case SortType::UnsignedInt16: return function<std::uint16_t>(__VA_ARGS__); \
+        case SortType::Int16: return function<std::int16_t>(__VA_ARGS__);   \
+        case SortType::UnsignedInt32: return function<std::uint32_t>(__VA_ARGS__); \
+        case SortType::Int32: return function<std::int32_t>(__VA_ARGS__);   \
+        case SortType::UnsignedInt64: return function<std::uint64_t>(__VA_ARGS__); \
+        case SortType::Int64: return function<std::int64_t>(__VA_ARGS__);   \
+        case SortType::Float: return function<float>(__VA_ARGS__);          \
+        case SortType::Double: return function<double>(__VA_ARGS__);        \
+    }                                                                       \
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+
+void sortInPlace(const Containers::StridedArrayView1D<void>& view, const SortType type) {
+    CORRADE_UTILITY_SORT_DISPATCH(sortInPlaceImplementation, view)
+}
+
+void sortInPlace(const Containers::StridedArrayView1D<void>& keys, const SortType type, const Containers::StridedArrayView2D<char>& values) {
+    CORRADE_ASSERT(keys.size() == values.size()[0],
+        "Utility::sortInPlace(): expected" << keys.size() << "values but got" << values.size()[0], );
+    CORRADE_ASSERT(values.isContiguous<1>(),
+        "Utility::sortInPlace(): second value dimension is not contiguous", );
+    CORRADE_ASSERT(keys.size() <= 0xffffffffu,
+        "Utility::sortInPlace(): expected at most 4294967295 items but got" << keys.size(), );
+    CORRADE_UTILITY_SORT_DISPATCH(sortInPlaceImplementation, keys, values)
+}
+
+void argsortInto(const Containers::StridedArrayView1D<const void>& view, const SortType type, const Containers::StridedArrayView1D<std::uint32_t>& indices) {
+    CORRADE_ASSERT(view.size() == indices.size(),
+        "Utility::argsortInto(): expected" << view.size() << "indices but got" << indices.size(), );
+    CORRADE_ASSERT(view.size() <= 0xffffffffu,
+        "Utility::argsortInto(): expected at most 4294967295 items but got" << view.size(), );
+    CORRADE_UTILITY_SORT_DISPATCH(argsortIntoImplementation, view, indices)
+}
+
+void nthElementInPlace(const Containers::StridedArrayView1D<void>& view, const SortType type, const std::size_t nth) {
+    CORRADE_ASSERT(nth < view.size(),
+        "Utility::nthElementInPlace(): index" << nth << "out of range for" << view.size() << "items", );
+    CORRADE_UTILITY_SORT_DISPATCH(nthElementInPlaceImplementation, view, nth)
+}
+
+std::size_t lowerBound(const Containers::StridedArrayView1D<const void>& view, const SortType type, const void* const value) {
+    CORRADE_UTILITY_SORT_DISPATCH(lowerBoundImplementation, view, value)
+}
+
+std::size_t upperBound(const Containers::StridedArrayView1D<const void>& view, const SortType type, const void* const value) {
+    CORRADE_UTILITY_SORT_DISPATCH(upperBoundImplementation, view, value)
+}
+
+#undef CORRADE_UTILITY_SORT_DISPATCH
+
+}
+
 }}
@@ -27,12 +27,13 @@
 */
 
 /** @file
- * @brief Function @ref Corrade::Utility::copy(), @ref Corrade::Utility::flipInPlace()
+ * @brief Function @ref Corrade::Utility::copy(), @ref Corrade::Utility::flipInPlace(), @ref Corrade::Utility::sortInPlace(), @ref Corrade::Utility::argsortInto(), @ref Corrade::Utility::nthElementInPlace(), @ref Corrade::Utility::lowerBound(), @ref Corrade::Utility::upperBound()
  * @m_since{2020,06}
  */
 
 /* std::declval() is said to be in <utility> but libstdc++, libc++ and MSVC STL
    all have it directly in <type_traits> because it just makes sense */
+#include <cstdint>
 #include <type_traits>
 
 #include "Corrade/Containers/StridedArrayView.h"
@@ -210,6 +211,130 @@ second performs it in-place:
 */
 template<unsigned dimension, unsigned dimensions, class T> void flipInPlace(const Containers::StridedArrayView<dimensions, T>& view);
 
+/**
+@brief Sort a view in-place
+@m_since_latest
+
+Sorts the items in an ascending order. Expects that @p T is an 8-, 16-, 32- or
+64-bit integer type or a @cpp float @ce or a @cpp double @ce. The view can
+have an arbitrary stride, it's gathered into a contiguous temporary buffer,
+sorted there and scattered back. Contiguous views are passed as
+@cpp sortInPlace<T>(view) @ce or through @ref Containers::stridedArrayView().
+
+Views of up to 32 items are sorted using an insertion sort, views of up to
+@cpp 32*sizeof(T) @ce items with a quicksort, which falls back to a heapsort
+for adversarial inputs, and larger views use a least-significant-digit radix
+sort with 8-bit digits, skipping digits that are the same for all items. The
+radix sort does at most @cpp sizeof(T) @ce passes over the data independently
+of its contents, which makes it several times faster than @ref std::sort()
+for views with thousands of items and more. Views larger than 32 items need a
+temporary allocation twice the size of the data.
+
+Floating-point values are ordered by the IEEE 754 @m_class{m-doc-external} [totalOrder](https://en.wikipedia.org/wiki/IEEE_754#Total-ordering_predicate)
+predicate --- i.e., @cpp -0.0f @ce is placed before @cpp +0.0f @ce, NaNs
+with the sign bit cleared are placed after a positive infinity and NaNs with
+the sign bit set before a negative infinity. The same ordering is
+used by @ref argsortInto(), @ref nthElementInPlace(), @ref lowerBound() and
+@ref upperBound().
+@see @ref sortInPlace(const Containers::StridedArrayView1D<T>&, const Containers::StridedArrayView1D<U>&)
+*/
+template<class T> void sortInPlace(const Containers::StridedArrayView1D<T>& view);
+
+/**
+@brief Sort a view in-place together with associated values
+@m_since_latest
+
+Sorts @p keys in an ascending order as in @ref sortInPlace(const Containers::StridedArrayView1D<T>&)
+and reorders @p values the same way. Expects that both views have the same
+size and @p U is trivially copyable. The sort is stable, i.e. values
+associated with equal keys keep their original order. Internally it calculates
+the permutation using @ref argsortInto() and then applies it to @p values
+using a temporary copy, so the cost of moving the values doesn't depend on the
+number of radix sort passes.
+*/
+template<class T, class U> void sortInPlace(const Containers::StridedArrayView1D<T>& keys, const Containers::StridedArrayView1D<U>& values);
+
+/**
+@brief Sort a view in-place together with type-erased values
+@m_since_latest
+
+Expects that @p keys and the first dimension of @p values have the same size
+and that the second dimension of @p values is contiguous. The second
+dimension size is the size of a single value.
+*/
+template<class T> void sortInPlace(const Containers::StridedArrayView1D<T>& keys, const Containers::StridedArrayView2D<char>& values);
+
+/**
+@brief Calculate indices that would sort a view
+@m_since_latest
+
+Fills @p indices such that @cpp view[indices[i]] @ce is sorted in an ascending
+order, with the same ordering rules as @ref sortInPlace(const Containers::StridedArrayView1D<T>&).
+The ordering is stable, i.e. equal items are referenced in their original
+order. Expects that @p view and @p indices have the same size, the size isn't
+larger than @cpp 0xffffffffu @ce and @p T is one of the types supported by
+@ref sortInPlace().
+*/
+template<class T> void argsortInto(const Containers::StridedArrayView1D<const T>& view, const Containers::StridedArrayView1D<std::uint32_t>& indices);
+
+/** @overload
+@m_since_latest
+*/
+template<class T> void argsortInto(const Containers::StridedArrayView1D<T>& view, const Containers::StridedArrayView1D<std::uint32_t>& indices) {
+    argsortInto(Containers::StridedArrayView1D<const T>{view}, indices);
+}
+
+/**
+@brief Partially sort a view in-place around given item
+@m_since_latest
+
+Reorders the items so the item at @p nth is the one that would be there if
+the whole view was sorted, all items before are not larger than it and all
+items after are not smaller than it. Has a linear complexity on average,
+falling back to @ref sortInPlace() if the partitioning doesn't converge fast
+enough. Expects that @p nth is less than the view size and @p T is one of the
+types supported by @ref sortInPlace().
+*/
+template<class T> void nthElementInPlace(const Containers::StridedArrayView1D<T>& view, std::size_t nth);
+
+/**
+@brief Find the first item not less than given value in a sorted view
+@m_since_latest
+
+Returns index of the first item that's not less than @p value or the view
+size if there's no such item. Expects that the view is sorted in an ascending
+order, with the same ordering rules as @ref sortInPlace(), and @p T is one of
+the types supported by @ref sortInPlace(). Uses a branchless binary search.
+@see @ref upperBound()
+*/
+template<class T> std::size_t lowerBound(const Containers::StridedArrayView1D<const T>& view, T value);
+
+/** @overload
+@m_since_latest
+*/
+template<class T> std::size_t lowerBound(const Containers::StridedArrayView1D<T>& view, typename std::remove_const<T>::type value) {
+    return lowerBound(Containers::StridedArrayView1D<const T>{view}, value);
+}
+
+/**
+@brief Find the first item greater than given value in a sorted view
+@m_since_latest
+
+Returns index of the first item that's greater than @p value or the view size
+if there's no such item. Expects that the view is sorted in an ascending order,
+with the same ordering rules as @ref sortInPlace(), and @p T is one of the
+types supported by @ref sortInPlace(). Uses a branchless binary search.
+@see @ref lowerBound()
+*/
+template<class T> std::size_t upperBound(const Containers::StridedArrayView1D<const T>& view, T value);
+
+/** @overload
+@m_since_latest
+*/
+template<class T> std::size_t upperBound(const Containers::StridedArrayView1D<T>& view, typename std::remove_const<T>::type value) {
+    return upperBound(Containers::StridedArrayView1D<const T>{view}, value);
+}
+
 namespace Implementation {
 
 template<class> struct ArrayViewType;
@@ -337,6 +462,74 @@ template<unsigned dimension, unsigned dimensions, class T> void flipInPlace(cons
     Implementation::flipSecondToLastDimensionInPlace(expanded.template asContiguous<dimension + 1>());
 }
 
+namespace Implementation {
+
+/* Types are dispatched based on their size and signedness only, so for example
+   both long and long long map to the same 64-bit implementation */
+enum class SortType: std::uint8_t {
+    UnsignedInt8, Int8, UnsignedInt16, Int16, UnsignedInt32, Int32,
+    UnsignedInt64, Int64, Float, Double
+};
+
+template<class T, class = void> struct SortTypeFor;
+template<class T> struct SortTypeFor<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type> {
+    enum: std::uint8_t { Value = std::uint8_t(
+        sizeof(T) == 1 ? SortType::UnsignedInt8 :
+        sizeof(T) == 2 ? SortType::UnsignedInt16 :
+        sizeof(T) == 4 ? SortType::UnsignedInt32 :
+                         SortType::UnsignedInt64) + (std::is_signed<T>::value ? 1 : 0) };
+};
+template<> struct SortTypeFor<float> {
+    enum: std::uint8_t { Value = std::uint8_t(SortType::Float) };
+};
+template<> struct SortTypeFor<double> {
+    enum: std::uint8_t { Value = std::uint8_t(SortType::Double) };
+};
+
+CORRADE_UTILITY_EXPORT void sortInPlace(const Containers::StridedArrayView1D<void>& view, SortType type);
+CORRADE_UTILITY_EXPORT void sortInPlace(const Containers::StridedArrayView1D<void>& keys, SortType type, const Containers::StridedArrayView2D<char>& values);
+CORRADE_UTILITY_EXPORT void argsortInto(const Containers::StridedArrayView1D<const void>& view, SortType type, const Containers::StridedArrayView1D<std::uint32_t>& indices);
+CORRADE_UTILITY_EXPORT void nthElementInPlace(const Containers::StridedArrayView1D<void>& view, SortType type, std::size_t nth);
+CORRADE_UTILITY_EXPORT std::size_t lowerBound(const Containers::StridedArrayView1D<const void>& view, SortType type, const void* value);
+CORRADE_UTILITY_EXPORT std::size_t upperBound(const Containers::StridedArrayView1D<const void>& view, SortType type, const void* value);
+
+}
+
+template<class T> void sortInPlace(const Containers::StridedArrayView1D<T>& view) {
+    Implementation::sortInPlace(view, Implementation::SortType(Implementation::SortTypeFor<T>::Value));
+}
+
+template<class T, class U> void sortInPlace(const Containers::StridedArrayView1D<T>& keys, const Containers::StridedArrayView1D<U>& values) {
+    static_assert(
+        #ifdef CORRADE_NO_STD_IS_TRIVIALLY_TRAITS
+        __has_trivial_copy(U) && __has_trivial_destructor(U)
+        #else
+        std::is_trivially_copyable<U>::value
+        #endif
+        , "types must be trivially copyable");
+    Implementation::sortInPlace(keys, Implementation::SortType(Implementation::SortTypeFor<T>::Value), Containers::arrayCast<2, char>(values));
+}
+
+template<class T> void sortInPlace(const Containers::StridedArrayView1D<T>& keys, const Containers::StridedArrayView2D<char>& values) {
+    Implementation::sortInPlace(keys, Implementation::SortType(Implementation::SortTypeFor<T>::Value), values);
+}
+
+template<class T> void argsortInto(const Containers::StridedArrayView1D<const T>& view, const Containers::StridedArrayView1D<std::uint32_t>& indices) {
+    Implementation::argsortInto(view, Implementation::SortType(Implementation::SortTypeFor<T>::Value), indices);
+}
+
+template<class T> void nthElementInPlace(const Containers::StridedArrayView1D<T>& view, const std::size_t nth) {
+    Implementation::nthElementInPlace(view, Implementation::SortType(Implementation::SortTypeFor<T>::Value), nth);
+}
+
+template<class T> std::size_t lowerBound(const Containers::StridedArrayView1D<const T>& view, const T value) {
+    return Implementation::lowerBound(view, Implementation::SortType(Implementation::SortTypeFor<T>::Value), &value);
+}
+
+template<class T> std::size_t upperBound(const Containers::StridedArrayView1D<const T>& view, const T value) {
+    return Implementation::upperBound(view, Implementation::SortType(Implementation::SortTypeFor<T>::Value), &value);
+}
+
 }}
 
 #endif
@@ -26,10 +26,157 @@
 
 #include "BitAlgorithms.h"
 
+#include <cstdint>
 #include <cstring>
 
+#if defined(CORRADE_TARGET_MSVC) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
 namespace Corrade { namespace Utility {
 
+namespace {
+
+/* Loads at most 64 bits starting at given bit of the mask, with bits past
+   `count` cleared. Reads just the bytes that contain the bits, so it never
+   goes past the end of the mask memory. */
+inline std::uint64_t loadMaskBits(const unsigned char* const data, const std::size_t bit, const std::size_t count) {
+    const unsigned char* const bytes = data + (bit >> 3);
+    const std::size_t shift = bit & 0x07;
+    const std::size_t byteCount = (shift + count + 7) >> 3;
+    /* Compilers turn this into a single load if all eight bytes are read */
+    std::uint64_t word = 0;
+    for(std::size_t i = 0, end = byteCount < 8 ? byteCount : 8; i != end; ++i)
+        word |= std::uint64_t(bytes[i]) << (i*8);
+    word >>= shift;
+    /* The ninth byte, if the range isn't byte-aligned. Shift is never zero
+       here, so the shift below is never by 64 bits. */
+    if(byteCount > 8)
+        word |= std::uint64_t(bytes[8]) << (64 - shift);
+    if(count < 64)
+        word &= (std::uint64_t{1} << count) - 1;
+    return word;
+}
+
+/* Expects the input to be non-zero */
+inline unsigned countTrailingZeros(const std::uint64_t value) {
+    #ifdef CORRADE_TARGET_GCC
+    return __builtin_ctzll(value);
+    #elif defined(CORRADE_TARGET_MSVC) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return index;
+    #else
+    unsigned index = 0;
+    for(std::uint64_t v = value; !(v & 1); v >>= 1) ++index;
+    return index;
+    #endif
+}
+
+/* Copies `size` bytes. Specialized for common type sizes below, where the
+   memcpy() gets turned into a single (unaligned) load and store. */
+template<std::size_t size> struct Copier {
+    static void copy(char* const dst, const char* const src, std::size_t) {
+        std::memcpy(dst, src, size);
+    }
+};
+template<> struct Copier<0> {
+    static void copy(char* const dst, const char* const src, const std::size_t size) {
+        std::memcpy(dst, src, size);
+    }
+};
+
+/* Walks the mask one 64-bit word at a time, jumping directly to the set bits
+   and gathering items at their positions in `src` into consecutive items of
+   `dst`. Fully set words with both views contiguous are copied in a single
+   go. */
+template<std::size_t size> void copyMaskedImplementation(const char* const src, const std::ptrdiff_t srcStride, const Containers::BitArrayView srcMask, char* dst, const std::ptrdiff_t dstStride, const std::size_t typeSize) {
+    const auto* const maskData = static_cast<const unsigned char*>(srcMask.data());
+    const std::size_t maskOffset = srcMask.offset();
+    const std::size_t maskSize = srcMask.size();
+    const bool contiguous = srcStride == std::ptrdiff_t(typeSize) && dstStride == std::ptrdiff_t(typeSize);
+
+    for(std::size_t i = 0; i < maskSize; i += 64) {
+        const std::size_t count = maskSize - i < 64 ? maskSize - i : 64;
+        std::uint64_t bits = loadMaskBits(maskData, maskOffset + i, count);
+        const char* const srcBlock = src + std::ptrdiff_t(i)*srcStride;
+
+        if(bits == ~std::uint64_t{} && contiguous) {
+            std::memcpy(dst, srcBlock, 64*typeSize);
+            dst += 64*dstStride;
+            continue;
+        }
+
+        while(bits) {
+            Copier<size>::copy(dst, srcBlock + std::ptrdiff_t(countTrailingZeros(bits))*srcStride, typeSize);
+            dst += dstStride;
+            /* Clear the lowest set bit */
+            bits &= bits - 1;
+        }
+    }
+}
+
+/* Inverse of the above, scattering consecutive items of `src` to set bit
+   positions in `dst` */
+template<std::size_t size> void expandMaskedImplementation(const char* src, const std::ptrdiff_t srcStride, char* const dst, const std::ptrdiff_t dstStride, const Containers::BitArrayView dstMask, const std::size_t typeSize) {
+    const auto* const maskData = static_cast<const unsigned char*>(dstMask.data());
+    const std::size_t maskOffset = dstMask.offset();
+    const std::size_t maskSize = dstMask.size();
+    const bool contiguous = srcStride == std::ptrdiff_t(typeSize) && dstStride == std::ptrdiff_t(typeSize);
+
+    for(std::size_t i = 0; i < maskSize; i += 64) {
+        const std::size_t count = maskSize - i < 64 ? maskSize - i : 64;
+        std::uint64_t bits = loadMaskBits(maskData, maskOffset + i, count);
+        char* const dstBlock = dst + std::ptrdiff_t(i)*dstStride;
+
+        if(bits == ~std::uint64_t{} && contiguous) {
+            std::memcpy(dstBlock, src, 64*typeSize);
+            src += 64*srcStride;
+            continue;
+        }
+
+        while(bits) {
+            Copier<size>::copy(dstBlock + std::ptrdiff_t(countTrailingZeros(bits))*dstStride, src, typeSize);
+            src += srcStride;
+            bits &= bits - 1;
+        }
+    }
+}
+
+#define _c(size)                                                            \
+    case size: return copyMaskedImplementation<size>(src, srcStride, srcMask, dst, dstStride, typeSize);
+void copyMaskedImplementation(const char* const src, const std::ptrdiff_t srcStride, const Containers::BitArrayView srcMask, char* const dst, const std::ptrdiff_t dstStride, const std::size_t typeSize) {
+    switch(typeSize) {
+        _c(1)
+        _c(2)
+        _c(4)
+        _c(8)
+        _c(12)
+        _c(16)
+    }
+
+    copyMaskedImplementation<0>(src, srcStride, srcMask, dst, dstStride, typeSize);
+}
+#undef _c
+
+#define _c(size)                                                            \
+    case size: return expandMaskedImplementation<size>(src, srcStride, dst, dstStride, dstMask, typeSize);
+void expandMaskedImplementation(const char* const src, const std::ptrdiff_t srcStride, char* const dst, const std::ptrdiff_t dstStride, const Containers::BitArrayView dstMask, const std::size_t typeSize) {
+    switch(typeSize) {
+        _c(1)
+        _c(2)
+        _c(4)
+        _c(8)
+        _c(12)
+        _c(16)
+    }
+
+    expandMaskedImplementation<0>(src, srcStride, dst, dstStride, dstMask, typeSize);
+}
+#undef _c
+
+}
+
 void copyMasked(const Containers::StridedArrayView2D<const char>& src, const Containers::BitArrayView srcMask, const Containers::StridedArrayView2D<char>& dst) {
     const std::size_t srcSize = src.size()[0];
     CORRADE_ASSERT(srcSize == srcMask.size(),
@@ -50,23 +197,30 @@ void copyMasked(const Containers::StridedArrayView2D<const char>& src, const Con
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Utility::copyMasked(): second destination view dimension is not contiguous", );
 
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const char* srcPtr = static_cast<const char*>(src.data());
-    char* dstPtr = static_cast<char*>(dst.data());
-    /** @todo instead of iterating over all src items it could iterate over all
-        dst, and then at the end assert that there's no bits left (or that
-        there's still bit positions), which could avoid the otherwise
-        unnecessary popcount */
-    for(std::size_t i = 0; i != srcSize; ++i) {
-        /** @todo some better way to iterate set bits */
-        if(srcMask[i]) {
-            std::memcpy(dstPtr, srcPtr, srcTypeSize);
-            dstPtr += dstStride;
-        }
+    copyMaskedImplementation(static_cast<const char*>(src.data()), src.stride()[0], srcMask, static_cast<char*>(dst.data()), dst.stride()[0], srcTypeSize);
+}
 
-        srcPtr += srcStride;
-    }
+void expandMasked(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<char>& dst, const Containers::BitArrayView dstMask) {
+    const std::size_t dstSize = dst.size()[0];
+    CORRADE_ASSERT(dstSize == dstMask.size(),
+        "Utility::expandMasked(): expected destination mask size to be" << dstSize << "but got" << dstMask.size(), );
+    #ifndef CORRADE_NO_ASSERT
+    const std::size_t dstMaskCount = dstMask.count();
+    #endif
+    CORRADE_ASSERT(dstMaskCount == src.size()[0],
+        "Utility::expandMasked(): expected" << dstMaskCount << "source items but got" << src.size()[0], );
+    const std::size_t srcTypeSize = src.size()[1];
+    #ifndef CORRADE_NO_ASSERT
+    const std::size_t dstTypeSize = dst.size()[1];
+    #endif
+    CORRADE_ASSERT(srcTypeSize == dstTypeSize,
+        "Utility::expandMasked(): expected second destination dimension size to be" << srcTypeSize << "but got" << dstTypeSize, );
+    CORRADE_ASSERT(src.isContiguous<1>(),
+        "Utility::expandMasked(): second source view dimension is not contiguous", );
+    CORRADE_ASSERT(dst.isContiguous<1>(),
+        "Utility::expandMasked(): second destination view dimension is not contiguous", );
+
+    expandMaskedImplementation(static_cast<const char*>(src.data()), src.stride()[0], static_cast<char*>(dst.data()), dst.stride()[0], dstMask, srcTypeSize);
 }
 
 }}
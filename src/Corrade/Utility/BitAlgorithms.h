@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Corrade::Utility::copyMasked()
+ * @brief Function @ref Corrade::Utility::copyMasked(), @ref Corrade::Utility::expandMasked(), @ref Corrade::Utility::maskFromPredicate()
  * @m_since_latest
  */
 
@@ -37,6 +37,8 @@
 
 #include "Corrade/Containers/BitArrayView.h"
 #include "Corrade/Containers/StridedArrayView.h"
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/Move.h"
 #include "Corrade/Utility/visibility.h"
 
 namespace Corrade { namespace Utility {
@@ -49,6 +51,13 @@ For all bits that are set in @p srcMask takes an element from @p src and
 copies it to @p dst. Expects that @p src and @p srcMask have the same size,
 that count of bits set in @p srcMask is the same as @p dst size and that the
 second dimension of both @p src and @p dst has the same size and is contiguous.
+
+The mask is processed 64 bits at a time, skipping directly to set bits, and
+fully set runs of 64 bits are copied in a single go if both views are
+contiguous, so sparse as well as dense masks are handled efficiently. Copies
+of 1-, 2-, 4-, 8-, 12- and 16-byte types are additionally specialized to not
+go through a generic @ref std::memcpy() for every item.
+@see @ref expandMasked(), @ref maskFromPredicate()
 @experimental
 */
 CORRADE_UTILITY_EXPORT void copyMasked(const Containers::StridedArrayView2D<const char>& src, Containers::BitArrayView srcMask, const Containers::StridedArrayView2D<char>& dst);
@@ -76,6 +85,100 @@ template<class T> void copyMasked(const Containers::StridedArrayView1D<const T>&
                       Containers::arrayCast<2, char>(dst));
 }
 
+/**
+@brief Expand an array view to masked positions of another
+@m_since_latest
+
+Inverse of @ref copyMasked(const Containers::StridedArrayView2D<const char>&, Containers::BitArrayView, const Containers::StridedArrayView2D<char>&) ---
+for all bits that are set in @p dstMask takes the next element from @p src and
+copies it to the corresponding position in @p dst. Elements of @p dst
+corresponding to bits that are not set are left untouched. Expects that
+@p dst and @p dstMask have the same size, that count of bits set in
+@p dstMask is the same as @p src size and that the second dimension of both
+@p src and @p dst has the same size and is contiguous.
+
+@snippet Utility.cpp expandMasked
+@experimental
+*/
+CORRADE_UTILITY_EXPORT void expandMasked(const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<char>& dst, Containers::BitArrayView dstMask);
+
+/**
+@brief Expand an array view to masked positions of another
+@m_since_latest
+
+Casts views into a @cpp char @ce type of one dimension more (where the last
+dimension has a size of @cpp sizeof(T) @ce and delegates into
+@ref expandMasked(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView2D<char>&, Containers::BitArrayView).
+Expects that @p T is a trivially copyable type.
+@experimental
+*/
+template<class T> void expandMasked(const Containers::StridedArrayView1D<const T>& src, const Containers::StridedArrayView1D<T>& dst, Containers::BitArrayView dstMask) {
+    static_assert(
+        #ifdef CORRADE_NO_STD_IS_TRIVIALLY_TRAITS
+        __has_trivial_copy(T) && __has_trivial_destructor(T)
+        #else
+        std::is_trivially_copyable<T>::value
+        #endif
+        , "types must be trivially copyable");
+
+    return expandMasked(Containers::arrayCast<2, const char>(src),
+                        Containers::arrayCast<2, char>(dst), dstMask);
+}
+
+/**
+@brief Fill a mask from a predicate evaluated on an array view
+@m_since_latest
+
+Sets bits in @p dst to the result of calling @p predicate on corresponding
+elements of @p src and returns the count of bits that were set. Expects that
+@p src and @p dst have the same size. Together with @ref copyMasked() it can
+be used for filtering a view:
+
+@snippet Utility.cpp maskFromPredicate
+
+Bits are accumulated into whole bytes and written one byte at a time, only the
+bits at the boundaries that don't cover a full byte of @p dst are written
+one by one.
+@experimental
+*/
+template<class T, class F> std::size_t maskFromPredicate(const Containers::StridedArrayView1D<T>& src, F&& predicate, const Containers::MutableBitArrayView& dst) {
+    const std::size_t size = src.size();
+    CORRADE_ASSERT(size == dst.size(),
+        "Utility::maskFromPredicate(): expected destination mask size to be" << size << "but got" << dst.size(), {});
+
+    std::size_t count = 0;
+    std::size_t i = 0;
+
+    /* Leading bits until the destination is byte-aligned */
+    const std::size_t offset = dst.offset();
+    if(offset) for(const std::size_t end = size < 8 - offset ? size : 8 - offset; i != end; ++i) {
+        const bool value = predicate(src[i]);
+        dst.set(i, value);
+        count += value;
+    }
+
+    /* Whole bytes */
+    unsigned char* const data = static_cast<unsigned char*>(dst.data());
+    for(; i + 8 <= size; i += 8) {
+        unsigned char byte = 0;
+        for(std::size_t j = 0; j != 8; ++j) {
+            const bool value = predicate(src[i + j]);
+            byte |= static_cast<unsigned char>(value) << j;
+            count += value;
+        }
+        data[(offset + i) >> 3] = byte;
+    }
+
+    /* Remaining bits at the end */
+    for(; i != size; ++i) {
+        const bool value = predicate(src[i]);
+        dst.set(i, value);
+        count += value;
+    }
+
+    return count;
+}
+
 namespace Implementation {
 
 /* Adapted from Algorithms.h and restricted to 1D strided array views */
@@ -100,6 +203,23 @@ template<class From, class To, class FromView = decltype(Implementation::strided
     const Containers::StridedArrayView1D<typename ToView::Type> dstV{dst};
     copyMasked(srcV, srcMask, dstV);
 }
+
+template<class From, class To, class FromView = decltype(Implementation::stridedArrayView1DTypeFor(std::declval<From&&>())), class ToView = decltype(Implementation::stridedArrayView1DTypeFor(std::declval<To&&>()))> void expandMasked(From&& src, To&& dst, const Containers::BitArrayView dstMask) {
+    static_assert(std::is_same<typename std::remove_const<typename FromView::Type>::type, typename std::remove_const<typename ToView::Type>::type>::value, "can't copy between views of different types");
+    static_assert(!std::is_const<typename ToView::Type>::value, "can't copy to a const view");
+    /* Same as in copyMasked() above, passing temporary instances directly
+       would lead to infinite recursion */
+    const Containers::StridedArrayView1D<const typename FromView::Type> srcV{src};
+    const Containers::StridedArrayView1D<typename ToView::Type> dstV{dst};
+    expandMasked(srcV, dstV, dstMask);
+}
+
+template<class From, class F, class FromView = decltype(Implementation::stridedArrayView1DTypeFor(std::declval<From&&>()))> std::size_t maskFromPredicate(From&& src, F&& predicate, const Containers::MutableBitArrayView& dst) {
+    /* Same as above, passing temporary instances directly would lead to
+       infinite recursion */
+    const Containers::StridedArrayView1D<typename FromView::Type> srcV{src};
+    return maskFromPredicate(srcV, Utility::forward<F>(predicate), dst);
+}
 #endif
 
 }}
@@ -27,6 +27,7 @@
 #include "Configuration.h"
 
 #include <algorithm> /* std::find() */
+#include <cstring>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -55,9 +56,17 @@ Configuration::Configuration(const std::string& filename, const Flags flags): Co
     }
 
     Containers::Optional<Containers::Array<char>> data = Path::read(filename);
-    if(data && parse(*data)) return;
+    if(data) {
+        /* If parsing in-place, the values will reference the data, so it has
+           to be kept around */
+        if(flags & Flag::ParseInPlace) {
+            _data = std::move(*data);
+            if(parse(_data)) return;
+        } else if(parse(*data)) return;
+    }
 
     /* Error, reset everything back */
+    _data = nullptr;
     _filename = {};
     _flags &= ~InternalFlag::IsValid;
 }
@@ -69,12 +78,15 @@ Configuration::Configuration(std::istream& in, const Flags flags): Configuration
         return;
     }
 
+    /* Parsing in-place is done only when reading from a file */
+    _flags &= ~InternalFlag::ParseInPlace;
+
     /** @todo deprecate and remove completely */
-    const std::string data{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
-    if(parse({data.data(), data.size()})) _flags |= InternalFlag::IsValid;
+    std::string data{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    if(parse(Containers::MutableStringView{data})) _flags |= InternalFlag::IsValid;
 }
 
-Configuration::Configuration(Configuration&& other) noexcept: ConfigurationGroup{std::move(other)}, _filename{std::move(other._filename)}, _flags{other._flags} {
+Configuration::Configuration(Configuration&& other) noexcept: ConfigurationGroup{std::move(other)}, _filename{std::move(other._filename)}, _flags{other._flags}, _data{std::move(other._data)} {
     /* Redirect configuration pointer to this instance */
     setConfigurationPointer(this);
 }
@@ -85,6 +97,7 @@ Configuration& Configuration::operator=(Configuration&& other) noexcept {
     ConfigurationGroup::operator=(std::move(other));
     _filename = std::move(other._filename);
     _flags = other._flags;
+    _data = std::move(other._data);
 
     /* Redirect configuration pointer to this instance */
     setConfigurationPointer(this);
@@ -102,7 +115,7 @@ namespace {
     constexpr const char Bom[] = "\xEF\xBB\xBF";
 }
 
-bool Configuration::parse(Containers::StringView in) {
+bool Configuration::parse(Containers::MutableStringView in) {
     /* Oh, BOM, eww */
     if(in.size() >= 3 && in[0] == Bom[0] && in[1] == Bom[1] && in[2] == Bom[2]) {
         _flags |= InternalFlag::HasBom;
@@ -110,7 +123,7 @@ bool Configuration::parse(Containers::StringView in) {
     }
 
     /* Parse file */
-    std::pair<Containers::StringView, const char*> parsed = parse(in, this, {});
+    std::pair<Containers::MutableStringView, const char*> parsed = parse(in, this, {});
     if(parsed.second) {
         Error() << "Utility::Configuration::Configuration():" << parsed.second;
         clear();
@@ -121,17 +134,37 @@ bool Configuration::parse(Containers::StringView in) {
     return true;
 }
 
-std::pair<Containers::StringView, const char*> Configuration::parse(Containers::StringView in, ConfigurationGroup* group, const Containers::StringView fullPath) {
+Containers::String Configuration::parsedString(const Containers::MutableStringView string) const {
+    /* If parsing in-place and there's a byte after the string, it's either a
+       separator or a whitespace that was already looked at, so it can be
+       replaced with a null terminator and the string referenced. A copy is
+       made otherwise, which is also the case for the very last value in a file
+       without a trailing newline. */
+    if((_flags & InternalFlag::ParseInPlace) && string.end() < _data.end()) {
+        *string.end() = '\0';
+        return Containers::String{string.data(), string.size(), [](char*, std::size_t) {}};
+    }
+
+    return string;
+}
+
+std::pair<Containers::MutableStringView, const char*> Configuration::parse(Containers::MutableStringView in, ConfigurationGroup* group, const Containers::StringView fullPath) {
     CORRADE_INTERNAL_ASSERT(!fullPath || fullPath.hasSuffix('/'));
 
-    /* Parse file */
+    /* Lines of a multi-line value are compacted to a contiguous range starting
+       at the line after the opening quotes. That's the same memory for Unix
+       EOLs, Windows EOLs get shifted to remove the \r characters. */
     bool multiLineValue = false;
+    char* multiLineValueBegin{};
+    char* multiLineValueEnd{};
+
+    /* Parse file */
     while(!in.isEmpty()) {
-        const Containers::StringView currentLine = in;
+        const Containers::MutableStringView currentLine = in;
 
         /* Extract the line and ignore the newline character after it, if any */
-        Containers::StringView buffer = in;
-        const Containers::StringView end = in.findOr('\n', in.end());
+        Containers::MutableStringView buffer = in;
+        const Containers::MutableStringView end = in.findOr('\n', in.end());
         buffer = in.prefix(end.begin());
         in = in.suffix(end.end());
 
@@ -144,21 +177,29 @@ std::pair<Containers::StringView, const char*> Configuration::parse(Containers::
             /* End of multi-line value */
             if(Containers::StringView{buffer}.trimmed() == "\"\"\""_s) {
                 /* Remove trailing newline, if present */
-                if(!group->_values.back().value.empty()) {
-                    CORRADE_INTERNAL_ASSERT(group->_values.back().value.back() == '\n');
-                    group->_values.back().value.resize(group->_values.back().value.size()-1);
+                if(multiLineValueEnd != multiLineValueBegin) {
+                    CORRADE_INTERNAL_ASSERT(multiLineValueEnd[-1] == '\n');
+                    --multiLineValueEnd;
                 }
 
+                group->_values.back().value = parsedString({multiLineValueBegin, std::size_t(multiLineValueEnd - multiLineValueBegin)});
                 multiLineValue = false;
                 continue;
             }
 
+            /* If there's no newline after, there can't be the closing quotes
+               either */
+            if(!end) break;
+
             /* Remove Windows EOL, if present */
             if(buffer.hasSuffix('\r')) buffer = buffer.exceptSuffix(1);
 
-            /* Append it (with newline) to current value */
-            group->_values.back().value += buffer;
-            group->_values.back().value += '\n';
+            /* Append it (with newline) to current value. The target is always
+               before or at the line start, the newline is put at most where
+               the original newline was. */
+            std::memmove(multiLineValueEnd, buffer.data(), buffer.size());
+            multiLineValueEnd += buffer.size();
+            *multiLineValueEnd++ = '\n';
             continue;
         }
 
@@ -202,7 +243,7 @@ std::pair<Containers::StringView, const char*> Configuration::parse(Containers::
                        could throw an exception and the group would otherwise
                        be leaked */
                     group->_groups.push_back(std::move(g));
-                    std::pair<Containers::ArrayView<const char>, const char*> parsed = parse(currentLine, g.group, nextGroup.prefix(groupEnd .end()));
+                    std::pair<Containers::MutableStringView, const char*> parsed = parse(currentLine, g.group, nextGroup.prefix(groupEnd .end()));
                     if(parsed.second) return parsed; /* Error, bubble up */
                     in = parsed.first;
 
@@ -214,7 +255,7 @@ std::pair<Containers::StringView, const char*> Configuration::parse(Containers::
                        could throw an exception and the group would otherwise
                        be leaked */
                     group->_groups.push_back(std::move(g));
-                    std::pair<Containers::ArrayView<const char>, const char*> parsed = parse(in, g.group, nextGroup + "/"_s);
+                    std::pair<Containers::MutableStringView, const char*> parsed = parse(in, g.group, nextGroup + "/"_s);
                     if(parsed.second) return parsed; /* Error, bubble up */
                     in = parsed.first;
                 }
@@ -227,35 +268,39 @@ std::pair<Containers::StringView, const char*> Configuration::parse(Containers::
         } else if(buffer[0] == '#' || buffer[0] == ';') {
             if(_flags & InternalFlag::SkipComments) continue;
 
-            ConfigurationGroup::Value item;
-            item.value = buffer;
-            group->_values.push_back(item);
+            group->_values.emplace_back();
+            group->_values.back().value = parsedString(buffer);
 
         /* Key/value pair */
         } else {
-            const Containers::Array3<Containers::StringView> keyValue = buffer.partition('=');
+            const Containers::Array3<Containers::MutableStringView> keyValue = buffer.partition('=');
             if(!keyValue[1])
                 return {nullptr, "missing equals for a value"};
 
-            ConfigurationGroup::Value item;
-            item.key = keyValue[0].trimmed();
-            item.value = keyValue[2].trimmed();
+            const Containers::MutableStringView key = keyValue[0].trimmed();
+            Containers::MutableStringView value = keyValue[2].trimmed();
 
-            /* Start of multi-line value */
-            if(item.value == "\"\"\"") {
-                item.value = "";
+            /* Start of multi-line value, the value gets filled once the
+               closing quotes are found */
+            if(value == "\"\"\""_s) {
                 multiLineValue = true;
+                multiLineValueBegin = multiLineValueEnd = in.data();
+                group->_values.emplace_back();
+                group->_values.back().key = parsedString(key);
+                continue;
 
             /* Remove quotes, if present */
             /** @todo Check `"` characters better */
-            } else if(!item.value.empty() && item.value[0] == '"') {
-                if(item.value.size() < 2 || item.value[item.value.size()-1] != '"')
+            } else if(value && value[0] == '"') {
+                if(value.size() < 2 || value.back() != '"')
                     return {nullptr, "missing closing quote for a value"};
 
-                item.value = item.value.substr(1, item.value.size()-2);
+                value = value.slice(1, value.size() - 1);
             }
 
-            group->_values.push_back(item);
+            group->_values.emplace_back();
+            group->_values.back().key = parsedString(key);
+            group->_values.back().value = parsedString(value);
         }
     }
 
@@ -311,36 +356,49 @@ namespace {
 void Configuration::save(std::ostream& out, const std::string& eol, ConfigurationGroup* group, const std::string& fullPath) const {
     CORRADE_INTERNAL_ASSERT(group->configuration() == this);
     std::string buffer;
+    const auto write = [&out](const Containers::StringView string) {
+        out.write(string.data(), string.size());
+    };
 
     /* Foreach all items in the group */
     for(const Value& value: group->_values) {
         /* Key/value pair */
-        if(!value.key.empty()) {
+        if(value.key) {
+            write(value.key);
+
             /* Multi-line value */
-            if(value.value.find_first_of('\n') != std::string::npos) {
+            if(value.value.find('\n')) {
+                write("=\"\"\""_s);
+                write(eol);
+
                 /* Replace \n with `eol` */
-                /** @todo fixme: ugly and slow */
-                std::string valueString = value.value;
-                std::size_t pos = 0;
-                while((pos = valueString.find_first_of('\n', pos)) != std::string::npos) {
-                    valueString.replace(pos, 1, eol);
-                    pos += eol.size();
+                Containers::StringView rest = value.value;
+                while(const Containers::StringView found = rest.find('\n')) {
+                    write(rest.prefix(found.begin()));
+                    write(eol);
+                    rest = rest.suffix(found.end());
                 }
-
-                buffer = value.key + "=\"\"\"" + eol + valueString + eol + "\"\"\"" + eol;
+                write(rest);
+                write(eol);
+                write("\"\"\""_s);
 
             /* Value with leading/trailing spaces */
-            } else if(!value.value.empty() && (isWhitespace(value.value.front()) || isWhitespace(value.value.back()))) {
-                buffer = value.key + "=\"" + value.value + '"' + eol;
+            } else if(value.value && (isWhitespace(value.value.front()) || isWhitespace(value.value.back()))) {
+                write("=\""_s);
+                write(value.value);
+                write("\""_s);
 
             /* Value without spaces */
-            } else buffer = value.key + '=' + value.value + eol;
+            } else {
+                write("="_s);
+                write(value.value);
+            }
         }
 
         /* Comment / empty line */
-        else buffer = value.value + eol;
+        else write(value.value);
 
-        out.write(buffer.data(), buffer.size());
+        write(eol);
     }
 
     /* Recursively process all subgroups */
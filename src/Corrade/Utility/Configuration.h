@@ -34,6 +34,7 @@
 #include <string>
 #include <iosfwd>
 
+#include "Corrade/Containers/Array.h"
 #include "Corrade/Containers/EnumSet.h"
 #include "Corrade/Utility/ConfigurationGroup.h"
 #include "Corrade/Utility/visibility.h"
@@ -208,6 +209,24 @@ as well, use @ref valuesComments() instead --- in case of comments and empty
 lines the first pair value is empty, and the second pair value contains the
 full line contents.
 
+@section Utility-Configuration-in-place Parsing in-place
+
+By default, every parsed key and value is copied into a string owned by its
+group. When loading large files, this can be avoided by passing
+@ref Flag::ParseInPlace to the @ref Configuration(const std::string&, Flags)
+constructor. The file is then read into a single buffer owned by the
+@ref Configuration instance, each key and value gets null-terminated directly
+in it and values reference it instead of being copied, so parsing does only a
+handful of allocations regardless of the file size. Values get copied into
+own storage only once they're changed using @ref setValue(), the rest of the
+API behaves the same.
+
+As the memory is owned by the @ref Configuration instance, it's not allowed
+to move a @ref ConfigurationGroup out of such configuration and use it after
+the configuration is destroyed. Copying groups is fine, as it copies all
+referenced data. Additionally, the whole file stays in memory for the whole
+lifetime of the configuration, even if most of its values get replaced.
+
 @todo Renaming, copying groups
 @todo EOL autodetection according to system on unsure/new files (default is
     preserve)
@@ -258,7 +277,16 @@ class CORRADE_UTILITY_EXPORT Configuration: public ConfigurationGroup {
              * and less memory used. Filename is not saved to avoid overwriting
              * the file with @ref save(). See also @ref Flag::SkipComments.
              */
-            ReadOnly        = 1 << 5
+            ReadOnly        = 1 << 5,
+
+            /**
+             * Parse the file in-place, referencing its contents instead of
+             * copying every key and value. Has an effect only when opening a
+             * file, not when parsing a stream. See
+             * @ref Utility-Configuration-in-place for more information.
+             * @m_since_latest
+             */
+            ParseInPlace    = 1 << 6
         };
 
         /**
@@ -357,6 +385,7 @@ class CORRADE_UTILITY_EXPORT Configuration: public ConfigurationGroup {
             Truncate        = std::uint32_t(Flag::Truncate),
             SkipComments    = std::uint32_t(Flag::SkipComments),
             ReadOnly        = std::uint32_t(Flag::ReadOnly),
+            ParseInPlace    = std::uint32_t(Flag::ParseInPlace),
 
             IsValid = 1 << 16,
             HasBom = 1 << 17,
@@ -368,12 +397,17 @@ class CORRADE_UTILITY_EXPORT Configuration: public ConfigurationGroup {
 
         CORRADE_ENUMSET_FRIEND_OPERATORS(InternalFlags)
 
-        CORRADE_UTILITY_LOCAL bool parse(Containers::StringView in);
-        CORRADE_UTILITY_LOCAL std::pair<Containers::StringView, const char*> parse(Containers::StringView in, ConfigurationGroup* group, Containers::StringView fullPath);
+        /* The input is modified during parsing. If ParseInPlace is set, it's
+           expected to be the _data array. */
+        CORRADE_UTILITY_LOCAL bool parse(Containers::MutableStringView in);
+        CORRADE_UTILITY_LOCAL std::pair<Containers::MutableStringView, const char*> parse(Containers::MutableStringView in, ConfigurationGroup* group, Containers::StringView fullPath);
+        CORRADE_UTILITY_LOCAL Containers::String parsedString(Containers::MutableStringView string) const;
         CORRADE_UTILITY_LOCAL void save(std::ostream& out, const std::string& eol, ConfigurationGroup* group, const std::string& fullPath) const;
 
         std::string _filename;
         InternalFlags _flags;
+        /* File contents referenced by values if ParseInPlace is set */
+        Containers::Array<char> _data;
 };
 
 CORRADE_ENUMSET_OPERATORS(Configuration::Flags)
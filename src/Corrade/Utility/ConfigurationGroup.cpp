@@ -26,6 +26,7 @@
 
 #include "ConfigurationGroup.h"
 
+#include "Corrade/Containers/Array.h"
 #include "Corrade/Containers/Pair.h"
 #include "Corrade/Containers/Reference.h"
 #include "Corrade/Containers/StringView.h"
@@ -59,7 +60,7 @@ Containers::Pair<Containers::StringView, Containers::StringView> ConfigurationGr
 auto ConfigurationGroup::ValueIterator::operator++() -> ValueIterator& {
     /* Values with empty keys are comments, skip those if desired. On the other
        hand be sure to not skip past the end. */
-    do ++_value; while(_value != _end && _skipComments && _value->key.empty());
+    do ++_value; while(_value != _end && _skipComments && _value->key.isEmpty());
     return *this;
 }
 
@@ -67,17 +68,109 @@ auto ConfigurationGroup::ValueIterator::operator++(int) -> ValueIterator {
     const ValueIterator out = *this;
     /* Values with empty keys are comments, skip those if desired. On the other
        hand be sure to not skip past the end. */
-    do ++_value; while(_value != _end && _skipComments && _value->key.empty());
+    do ++_value; while(_value != _end && _skipComments && _value->key.isEmpty());
     return out;
 }
 
 ConfigurationGroup::Values::Values(const Value* begin, const Value* end, bool skipComments) noexcept: _begin{begin}, _end{end}, _skipComments{skipComments} {
     /* Values with empty keys are comments, skip those if desired and fake the
        begin to be at the first real key/value pair. */
-    while(_begin != _end && _skipComments && _begin->key.empty())
+    while(_begin != _end && _skipComments && _begin->key.isEmpty())
         ++_begin;
 }
 
+/* Open-addressing hash tables for values and groups. Each slot contains
+   either 0 for an empty slot or 1 + position of the first value / group with
+   given key in _values / _groups. Further values / groups with the same key
+   are found by a linear search from the first one, which is what the
+   unindexed lookup does as well, just from the start. The tables are kept at
+   most half full, so the linear probing is short and always terminates. */
+struct ConfigurationGroup::Index {
+    Containers::Array<std::uint32_t> values;
+    std::size_t valueCount;
+    Containers::Array<std::uint32_t> groups;
+    std::size_t groupCount;
+};
+
+namespace {
+
+/* A 32-bit FNV-1a. Not using MurmurHash2 as this file is compiled into the
+   standalone corrade-rc as well, and keys are usually short anyway. */
+std::size_t indexHash(const Containers::StringView key) {
+    std::uint32_t hash = 0x811c9dc5u;
+    for(const char c: key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x01000193u;
+    }
+    return hash;
+}
+
+/* Returns 1 + position of the first item with given key or 0 if not present.
+   The table size is always a power of two. */
+template<class T, class KeyOf> std::uint32_t indexFind(const Containers::ArrayView<const std::uint32_t> table, const std::vector<T>& items, KeyOf keyOf, const Containers::StringView key) {
+    const std::size_t mask = table.size() - 1;
+    for(std::size_t i = indexHash(key) & mask; ; i = (i + 1) & mask) {
+        const std::uint32_t slot = table[i];
+        if(!slot || Containers::StringView{keyOf(items[slot - 1])} == key)
+            return slot;
+    }
+}
+
+/* Inserts an item at given position if there's no item with the same key yet,
+   growing and rebuilding the table if it would become more than half full */
+template<class T, class KeyOf> void indexInsert(Containers::Array<std::uint32_t>& table, std::size_t& count, const std::vector<T>& items, KeyOf keyOf, std::size_t position);
+
+template<class T, class KeyOf> void indexRebuild(Containers::Array<std::uint32_t>& table, std::size_t& count, const std::vector<T>& items, KeyOf keyOf) {
+    /* Start with 16 slots and grow to have the table at most half full even
+       if all keys are unique */
+    std::size_t size = 16;
+    while(size < items.size()*2) size *= 2;
+    table = Containers::Array<std::uint32_t>{ValueInit, size};
+    count = 0;
+    for(std::size_t i = 0; i != items.size(); ++i)
+        indexInsert(table, count, items, keyOf, i);
+}
+
+template<class T, class KeyOf> void indexInsert(Containers::Array<std::uint32_t>& table, std::size_t& count, const std::vector<T>& items, KeyOf keyOf, const std::size_t position) {
+    const Containers::StringView key = keyOf(items[position]);
+    /* Comments (values with empty keys) aren't indexed */
+    if(key.isEmpty()) return;
+
+    const std::size_t mask = table.size() - 1;
+    for(std::size_t i = indexHash(key) & mask; ; i = (i + 1) & mask) {
+        std::uint32_t& slot = table[i];
+        /* Already present, the first occurrence stays */
+        if(slot && Containers::StringView{keyOf(items[slot - 1])} == key)
+            return;
+        if(slot) continue;
+
+        /* Would get more than half full, rebuild with a larger size. This
+           inserts the new item as well. */
+        if((count + 1)*2 > table.size()) {
+            indexRebuild(table, count, items, keyOf);
+            return;
+        }
+
+        slot = position + 1;
+        ++count;
+        return;
+    }
+}
+
+struct ValueKey {
+    template<class T> Containers::StringView operator()(const T& value) const {
+        return value.key;
+    }
+};
+
+struct GroupName {
+    template<class T> Containers::StringView operator()(const T& group) const {
+        return group.name;
+    }
+};
+
+}
+
 ConfigurationGroup::ConfigurationGroup(): _configuration(nullptr) {}
 
 void ConfigurationGroup::setConfigurationPointer(Configuration* configuration) {
@@ -92,9 +185,12 @@ ConfigurationGroup::ConfigurationGroup(const ConfigurationGroup& other): _values
     /* Deep copy groups */
     for(Group& group: _groups)
         group.group = new ConfigurationGroup(*group.group);
+
+    /* The index contains just positions, so it can be rebuilt the same */
+    if(other._index) setIndexed(true);
 }
 
-ConfigurationGroup::ConfigurationGroup(ConfigurationGroup&& other) noexcept: _values(std::move(other._values)), _groups(std::move(other._groups)), _configuration(nullptr) {
+ConfigurationGroup::ConfigurationGroup(ConfigurationGroup&& other) noexcept: _values(std::move(other._values)), _groups(std::move(other._groups)), _index(std::move(other._index)), _configuration(nullptr) {
     /* Reset configuration pointer for subgroups */
     for(Group& group: _groups)
         group.group->setConfigurationPointer(nullptr);
@@ -115,6 +211,10 @@ ConfigurationGroup& ConfigurationGroup::operator=(const ConfigurationGroup& othe
         group.group->setConfigurationPointer(_configuration);
     }
 
+    /* Rebuild the index, if any */
+    _index = nullptr;
+    if(other._index) setIndexed(true);
+
     return *this;
 }
 
@@ -127,6 +227,12 @@ ConfigurationGroup& ConfigurationGroup::operator=(ConfigurationGroup&& other) no
     _values = std::move(other._values);
     _groups = std::move(other._groups);
 
+    /* Pointer move assignment is a swap, which would leave the other instance
+       with an index of our previous values that it no longer has. Reset it
+       instead, like with the move constructor. */
+    _index = std::move(other._index);
+    other._index = nullptr;
+
     /* Redirect configuration pointer for subgroups */
     for(Group& group: _groups)
         group.group->setConfigurationPointer(_configuration);
@@ -151,58 +257,85 @@ auto ConfigurationGroup::groups() const -> BasicGroups<const ConfigurationGroup>
         BasicGroups<const ConfigurationGroup>{&_groups[0], &_groups[0] + _groups.size()};
 }
 
-auto ConfigurationGroup::findGroup(const std::string& name, const unsigned int index) -> std::vector<Group>::iterator {
-    unsigned int foundIndex = 0;
-    for(auto it = _groups.begin(); it != _groups.end(); ++it)
-        if(it->name == name && foundIndex++ == index) return it;
+void ConfigurationGroup::setIndexed(const bool indexed) {
+    if(!indexed) {
+        _index = nullptr;
+        return;
+    }
+
+    if(!_index) _index.emplace();
+    reindex();
+}
+
+void ConfigurationGroup::reindex() {
+    if(!_index) return;
+    indexRebuild(_index->values, _index->valueCount, _values, ValueKey{});
+    indexRebuild(_index->groups, _index->groupCount, _groups, GroupName{});
+}
+
+void ConfigurationGroup::indexAddedValue() {
+    if(!_index) return;
+    indexInsert(_index->values, _index->valueCount, _values, ValueKey{}, _values.size() - 1);
+}
 
-    return _groups.end();
+void ConfigurationGroup::indexAddedGroup() {
+    if(!_index) return;
+    indexInsert(_index->groups, _index->groupCount, _groups, GroupName{}, _groups.size() - 1);
 }
 
-auto ConfigurationGroup::findGroup(const std::string& name, const unsigned int index) const -> std::vector<Group>::const_iterator {
+std::size_t ConfigurationGroup::findGroup(const Containers::StringView name, const unsigned int index) const {
+    /* If indexed, start the search at the first group with given name, or
+       bail if there's none */
+    std::size_t i = 0;
+    if(_index) {
+        const std::uint32_t found = indexFind(_index->groups, _groups, GroupName{}, name);
+        if(!found) return _groups.size();
+        i = found - 1;
+    }
+
     unsigned int foundIndex = 0;
-    for(auto it = _groups.begin(); it != _groups.end(); ++it)
-        if(it->name == name && foundIndex++ == index) return it;
+    for(; i != _groups.size(); ++i)
+        if(Containers::StringView{_groups[i].name} == name && foundIndex++ == index) return i;
 
-    return _groups.end();
+    return _groups.size();
 }
 
-bool ConfigurationGroup::hasGroup(const std::string& name, const unsigned int index) const {
-    return findGroup(name, index) != _groups.end();
+bool ConfigurationGroup::hasGroup(const Containers::StringView name, const unsigned int index) const {
+    return findGroup(name, index) != _groups.size();
 }
 
-unsigned int ConfigurationGroup::groupCount(const std::string& name) const {
+unsigned int ConfigurationGroup::groupCount(const Containers::StringView name) const {
     unsigned int count = 0;
-    for(const Group& group: _groups)
-        if(group.name == name) ++count;
+    for(std::size_t i = findGroup(name, 0); i < _groups.size(); ++i)
+        if(Containers::StringView{_groups[i].name} == name) ++count;
 
     return count;
 }
 
-ConfigurationGroup* ConfigurationGroup::group(const std::string& name, const unsigned int index) {
-    const auto it = findGroup(name, index);
-    return it != _groups.end() ? it->group : nullptr;
+ConfigurationGroup* ConfigurationGroup::group(const Containers::StringView name, const unsigned int index) {
+    const std::size_t i = findGroup(name, index);
+    return i != _groups.size() ? _groups[i].group : nullptr;
 }
 
-const ConfigurationGroup* ConfigurationGroup::group(const std::string& name, unsigned int index) const {
-    const auto it = findGroup(name, index);
-    return it != _groups.end() ? it->group : nullptr;
+const ConfigurationGroup* ConfigurationGroup::group(const Containers::StringView name, unsigned int index) const {
+    const std::size_t i = findGroup(name, index);
+    return i != _groups.size() ? _groups[i].group : nullptr;
 }
 
-std::vector<ConfigurationGroup*> ConfigurationGroup::groups(const std::string& name) {
+std::vector<ConfigurationGroup*> ConfigurationGroup::groups(const Containers::StringView name) {
     std::vector<ConfigurationGroup*> found;
 
-    for(Group& group: _groups)
-        if(group.name == name) found.push_back(group.group);
+    for(std::size_t i = findGroup(name, 0); i < _groups.size(); ++i)
+        if(Containers::StringView{_groups[i].name} == name) found.push_back(_groups[i].group);
 
     return found;
 }
 
-std::vector<const ConfigurationGroup*> ConfigurationGroup::groups(const std::string& name) const {
+std::vector<const ConfigurationGroup*> ConfigurationGroup::groups(const Containers::StringView name) const {
     std::vector<const ConfigurationGroup*> found;
 
-    for(const Group& group: _groups)
-        if(group.name == name) found.push_back(group.group);
+    for(std::size_t i = findGroup(name, 0); i < _groups.size(); ++i)
+        if(Containers::StringView{_groups[i].name} == name) found.push_back(_groups[i].group);
 
     return found;
 }
@@ -220,6 +353,7 @@ void ConfigurationGroup::addGroup(const std::string& name, ConfigurationGroup* g
 
     if(_configuration) _configuration->_flags |= Configuration::InternalFlag::Changed;
     _groups.push_back({name, group});
+    indexAddedGroup();
 }
 
 ConfigurationGroup* ConfigurationGroup::addGroup(const std::string& name) {
@@ -229,11 +363,12 @@ ConfigurationGroup* ConfigurationGroup::addGroup(const std::string& name) {
 }
 
 bool ConfigurationGroup::removeGroup(const std::string& name, unsigned int index) {
-    const auto it = findGroup(name, index);
-    if(it == _groups.end()) return false;
+    const std::size_t i = findGroup(name, index);
+    if(i == _groups.size()) return false;
 
-    delete it->group;
-    _groups.erase(it);
+    delete _groups[i].group;
+    _groups.erase(_groups.begin() + i);
+    reindex();
     if(_configuration) _configuration->_flags |= Configuration::InternalFlag::Changed;
     return true;
 }
@@ -243,6 +378,7 @@ bool ConfigurationGroup::removeGroup(ConfigurationGroup* const group) {
         if(it->group == group) {
             delete it->group;
             _groups.erase(it);
+            reindex();
             if(_configuration) _configuration->_flags |= Configuration::InternalFlag::Changed;
             return true;
         }
@@ -257,6 +393,7 @@ void ConfigurationGroup::removeAllGroups(const std::string& name) {
         delete (_groups.begin()+i)->group;
         _groups.erase(_groups.begin()+i);
     }
+    reindex();
 
     if(_configuration) _configuration->_flags |= Configuration::InternalFlag::Changed;
 }
@@ -273,25 +410,27 @@ auto ConfigurationGroup::valuesComments() const -> Values {
         Values{&_values[0], &_values[0] + _values.size(), false};
 }
 
-auto ConfigurationGroup::findValue(const std::string& key, const unsigned int index) const -> std::vector<Value>::const_iterator {
-    unsigned int foundIndex = 0;
-    for(auto it = _values.begin(); it != _values.end(); ++it)
-        if(it->key == key && foundIndex++ == index) return it;
-
-    return _values.end();
-}
+std::size_t ConfigurationGroup::findValue(const Containers::StringView key, const unsigned int index) const {
+    /* If indexed, start the search at the first value with given key, or bail
+       if there's none. Comments aren't indexed, so searching for an empty key
+       goes through all values. */
+    std::size_t i = 0;
+    if(_index && !key.isEmpty()) {
+        const std::uint32_t found = indexFind(_index->values, _values, ValueKey{}, key);
+        if(!found) return _values.size();
+        i = found - 1;
+    }
 
-auto ConfigurationGroup::findValue(const std::string& key, const unsigned int index) -> std::vector<Value>::iterator {
     unsigned int foundIndex = 0;
-    for(auto it = _values.begin(); it != _values.end(); ++it)
-        if(it->key == key && foundIndex++ == index) return it;
+    for(; i != _values.size(); ++i)
+        if(_values[i].key == key && foundIndex++ == index) return i;
 
-    return _values.end();
+    return _values.size();
 }
 
 bool ConfigurationGroup::hasValues() const {
     for(const Value& value: _values)
-        if(!value.key.empty()) return true;
+        if(!value.key.isEmpty()) return true;
 
     return false;
 }
@@ -299,33 +438,33 @@ bool ConfigurationGroup::hasValues() const {
 unsigned int ConfigurationGroup::valueCount() const {
     unsigned int count = 0;
     for(const Value& value: _values)
-        if(!value.key.empty()) ++count;
+        if(!value.key.isEmpty()) ++count;
 
     return count;
 }
 
-bool ConfigurationGroup::hasValue(const std::string& key, const unsigned int index) const {
-    return findValue(key, index) != _values.end();
+bool ConfigurationGroup::hasValue(const Containers::StringView key, const unsigned int index) const {
+    return findValue(key, index) != _values.size();
 }
 
-unsigned int ConfigurationGroup::valueCount(const std::string& key) const {
+unsigned int ConfigurationGroup::valueCount(const Containers::StringView key) const {
     unsigned int count = 0;
-    for(const Value& value: _values)
-        if(value.key == key) ++count;
+    for(std::size_t i = findValue(key, 0); i < _values.size(); ++i)
+        if(_values[i].key == key) ++count;
 
     return count;
 }
 
-const std::string* ConfigurationGroup::valueInternal(const std::string& key, const unsigned int index, ConfigurationValueFlags) const {
-    const auto it = findValue(key, index);
-    return it != _values.end() ? &it->value : nullptr;
+const Containers::String* ConfigurationGroup::valueInternal(const Containers::StringView key, const unsigned int index, ConfigurationValueFlags) const {
+    const std::size_t i = findValue(key, index);
+    return i != _values.size() ? &_values[i].value : nullptr;
 }
 
-std::vector<const std::string*> ConfigurationGroup::valuesInternal(const std::string& key, ConfigurationValueFlags) const {
-    std::vector<const std::string*> found;
+std::vector<const Containers::String*> ConfigurationGroup::valuesInternal(const Containers::StringView key, ConfigurationValueFlags) const {
+    std::vector<const Containers::String*> found;
 
-    for(const Value& value: _values)
-        if(value.key == key) found.push_back(&value.value);
+    for(std::size_t i = findValue(key, 0); i < _values.size(); ++i)
+        if(_values[i].key == key) found.push_back(&_values[i].value);
 
     return found;
 }
@@ -335,9 +474,17 @@ bool ConfigurationGroup::setValueInternal(const std::string& key, std::string va
     CORRADE_ASSERT(key.find_first_of("\n=") == std::string::npos,
         "Utility::ConfigurationGroup::setValue(): disallowed character in key", false);
 
+    /* If indexed, start the search at the first value with given key */
+    std::size_t i = 0;
+    if(_index) {
+        const std::uint32_t found = indexFind(_index->values, _values, ValueKey{}, key);
+        i = found ? found - 1 : _values.size();
+    }
+
     unsigned int foundIndex = 0;
-    for(Value& v: _values) {
-        if(v.key == key && foundIndex++ == index) {
+    for(; i != _values.size(); ++i) {
+        Value& v = _values[i];
+        if(v.key == Containers::StringView{key} && foundIndex++ == index) {
             v.value = std::move(value);
             if(_configuration) _configuration->_flags |= Configuration::InternalFlag::Changed;
             return true;
@@ -349,6 +496,7 @@ bool ConfigurationGroup::setValueInternal(const std::string& key, std::string va
 
     /* No value with that name was found, add new */
     _values.push_back({key, std::move(value)});
+    indexAddedValue();
 
     if(_configuration) _configuration->_flags |= Configuration::InternalFlag::Changed;
     return true;
@@ -360,6 +508,7 @@ void ConfigurationGroup::addValueInternal(std::string key, std::string value, Co
         "Utility::ConfigurationGroup::addValue(): disallowed character in key", );
 
     _values.push_back({std::move(key), std::move(value)});
+    indexAddedValue();
 
     if(_configuration) _configuration->_flags |= Configuration::InternalFlag::Changed;
 }
@@ -367,10 +516,11 @@ void ConfigurationGroup::addValueInternal(std::string key, std::string value, Co
 bool ConfigurationGroup::removeValue(const std::string& key, const unsigned int index) {
     CORRADE_ASSERT(!key.empty(), "Utility::ConfigurationGroup::removeValue(): empty key", false);
 
-    const auto it = findValue(key, index);
-    if(it == _values.end()) return false;
+    const std::size_t i = findValue(key, index);
+    if(i == _values.size()) return false;
 
-    _values.erase(it);
+    _values.erase(_values.begin() + i);
+    reindex();
     if(_configuration) _configuration->_flags |= Configuration::InternalFlag::Changed;
     return true;
 }
@@ -380,8 +530,9 @@ void ConfigurationGroup::removeAllValues(const std::string& key) {
 
     /** @todo Do it better & faster */
     for(int i = _values.size()-1; i >= 0; --i) {
-        if(_values[i].key == key) _values.erase(_values.begin()+i);
+        if(_values[i].key == Containers::StringView{key}) _values.erase(_values.begin()+i);
     }
+    reindex();
 
     if(_configuration) _configuration->_flags |= Configuration::InternalFlag::Changed;
 }
@@ -392,6 +543,7 @@ void ConfigurationGroup::clear() {
     for(Group& group: _groups)
         delete group.group;
     _groups.clear();
+    reindex();
 }
 
 }}
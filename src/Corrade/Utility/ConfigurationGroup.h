@@ -34,6 +34,7 @@
 #include <string>
 #include <vector>
 
+#include "Corrade/Containers/Pointer.h"
 #include "Corrade/Containers/StringStl.h"
 #include "Corrade/Utility/ConfigurationValue.h"
 #include "Corrade/Utility/Utility.h"
@@ -46,7 +47,20 @@ namespace Corrade { namespace Utility {
 
 Provides access to values and subgroups. See @ref Configuration class
 documentation for usage example.
-@todo Faster access to elements via multimap, find() and equal_range()
+
+@section Utility-ConfigurationGroup-index Indexed lookup
+
+By default, values and subgroups are looked up by a linear search, which is
+fine for small groups but gets slow with thousands of keys. Calling
+@ref setIndexed() creates a hash table that makes @ref hasValue(),
+@ref value(), @ref hasGroup(), @ref group() and related lookups take constant
+time on average. The index is kept up-to-date when values and groups are
+added, and rebuilt when any are removed. It's only an additional lookup
+structure, the order of values and groups stays the same as without it and
+is preserved on @ref Configuration::save().
+
+Lookup functions take a @relativeref{Corrade,Containers::StringView} and thus
+don't allocate, with or without the index.
 */
 class CORRADE_UTILITY_EXPORT ConfigurationGroup {
     friend Configuration;
@@ -137,6 +151,25 @@ class CORRADE_UTILITY_EXPORT ConfigurationGroup {
         Configuration* configuration() { return _configuration; }
         const Configuration* configuration() const { return _configuration; } /**< @overload */
 
+        /**
+         * @brief Whether the group is indexed
+         * @m_since_latest
+         *
+         * @see @ref setIndexed()
+         */
+        bool isIndexed() const { return !!_index; }
+
+        /**
+         * @brief Enable or disable indexed lookup
+         * @m_since_latest
+         *
+         * Creates or destroys a hash table speeding up lookup of values and
+         * subgroups in this group. Affects only this group, not its
+         * subgroups. Default is disabled. See
+         * @ref Utility-ConfigurationGroup-index for more information.
+         */
+        void setIndexed(bool indexed);
+
         /**
          * @brief Whether the group is empty
          *
@@ -186,14 +219,14 @@ class CORRADE_UTILITY_EXPORT ConfigurationGroup {
          * @see @ref isEmpty(), @ref hasGroups(), @ref groupCount(),
          *      @ref hasValue()
          */
-        bool hasGroup(const std::string& name, unsigned int index = 0) const;
+        bool hasGroup(Containers::StringView name, unsigned int index = 0) const;
 
         /**
          * @brief Count of groups with given name
          *
          * @see @ref hasGroup(), @ref valueCount()
          */
-        unsigned int groupCount(const std::string& name) const;
+        unsigned int groupCount(Containers::StringView name) const;
 
         /**
          * @brief Group
@@ -203,12 +236,12 @@ class CORRADE_UTILITY_EXPORT ConfigurationGroup {
          * Returns pointer to group on success, @cpp nullptr @ce otherwise.
          * @see @ref groups()
          */
-        ConfigurationGroup* group(const std::string& name, unsigned int index = 0);
-        const ConfigurationGroup* group(const std::string& name, unsigned int index = 0) const; /**< @overload */
+        ConfigurationGroup* group(Containers::StringView name, unsigned int index = 0);
+        const ConfigurationGroup* group(Containers::StringView name, unsigned int index = 0) const; /**< @overload */
 
         /** @brief All groups with given name */
-        std::vector<ConfigurationGroup*> groups(const std::string& name);
-        std::vector<const ConfigurationGroup*> groups(const std::string& name) const; /**< @overload */
+        std::vector<ConfigurationGroup*> groups(Containers::StringView name);
+        std::vector<const ConfigurationGroup*> groups(Containers::StringView name) const; /**< @overload */
 
         /**
          * @brief Add a group
@@ -309,14 +342,14 @@ class CORRADE_UTILITY_EXPORT ConfigurationGroup {
          * @see @ref isEmpty(), @ref hasValues(), @ref valueCount(),
          *      @ref hasGroup()
          */
-        bool hasValue(const std::string& key, unsigned int index = 0) const;
+        bool hasValue(Containers::StringView key, unsigned int index = 0) const;
 
         /**
          * @brief Count of values with given key
          *
          * @see @ref hasValue(), @ref groupCount()
          */
-        unsigned int valueCount(const std::string& key) const;
+        unsigned int valueCount(Containers::StringView key) const;
 
         /**
          * @brief Value
@@ -330,12 +363,12 @@ class CORRADE_UTILITY_EXPORT ConfigurationGroup {
          * type.
          * @see @ref hasValue()
          */
-        template<class T = std::string> T value(const std::string& key, unsigned int index = 0, ConfigurationValueFlags flags = ConfigurationValueFlags()) const;
+        template<class T = std::string> T value(Containers::StringView key, unsigned int index = 0, ConfigurationValueFlags flags = ConfigurationValueFlags()) const;
 
         /** @overload
          * Calls the above with @p index set to `0`.
          */
-        template<class T = std::string> T value(const std::string& key, ConfigurationValueFlags flags) const {
+        template<class T = std::string> T value(Containers::StringView key, ConfigurationValueFlags flags) const {
             return value<T>(key, 0, flags);
         }
 
@@ -348,7 +381,7 @@ class CORRADE_UTILITY_EXPORT ConfigurationGroup {
          * @ref ConfigurationValue::fromString() to convert the value to given
          * type.
          */
-        template<class T = std::string> std::vector<T> values(const std::string& key, ConfigurationValueFlags flags = ConfigurationValueFlags()) const;
+        template<class T = std::string> std::vector<T> values(Containers::StringView key, ConfigurationValueFlags flags = ConfigurationValueFlags()) const;
 
         /**
          * @brief Set a string value
@@ -468,7 +501,9 @@ class CORRADE_UTILITY_EXPORT ConfigurationGroup {
 
     private:
         struct CORRADE_UTILITY_LOCAL Value {
-            std::string key, value;
+            /* Either owning or referencing a memory owned by the Configuration
+               if it was parsed with Configuration::Flag::ParseInPlace */
+            Containers::String key, value;
         };
 
         struct CORRADE_UTILITY_LOCAL Group {
@@ -476,25 +511,34 @@ class CORRADE_UTILITY_EXPORT ConfigurationGroup {
             ConfigurationGroup* group;
         };
 
+        struct Index;
+
         /* Used by Configuration constructor */
         CORRADE_UTILITY_LOCAL explicit ConfigurationGroup(Configuration* configuration);
         /* Used by operator=() and addGroup(ConfigurationGroup*), and by
            Configuration */
         CORRADE_UTILITY_LOCAL void setConfigurationPointer(Configuration* configuration);
 
-        CORRADE_UTILITY_LOCAL std::vector<Group>::iterator findGroup(const std::string& name, unsigned int index);
-        CORRADE_UTILITY_LOCAL std::vector<Group>::const_iterator findGroup(const std::string& name, unsigned int index) const;
-        CORRADE_UTILITY_LOCAL std::vector<Value>::iterator findValue(const std::string& key, unsigned int index);
-        CORRADE_UTILITY_LOCAL std::vector<Value>::const_iterator findValue(const std::string& key, unsigned int index) const;
+        /* Return an index into _groups / _values or their size if not
+           found */
+        CORRADE_UTILITY_LOCAL std::size_t findGroup(Containers::StringView name, unsigned int index) const;
+        CORRADE_UTILITY_LOCAL std::size_t findValue(Containers::StringView key, unsigned int index) const;
+        /* Updates the index, if present, after a value or a group was added
+           at the end, or rebuilds it after anything was removed */
+        CORRADE_UTILITY_LOCAL void indexAddedValue();
+        CORRADE_UTILITY_LOCAL void indexAddedGroup();
+        CORRADE_UTILITY_LOCAL void reindex();
 
         /* Returns nullptr in case the key is not found */
-        const std::string* valueInternal(const std::string& key, unsigned int index, ConfigurationValueFlags flags) const;
-        std::vector<const std::string*> valuesInternal(const std::string& key, ConfigurationValueFlags flags) const;
+        const Containers::String* valueInternal(Containers::StringView key, unsigned int index, ConfigurationValueFlags flags) const;
+        std::vector<const Containers::String*> valuesInternal(Containers::StringView key, ConfigurationValueFlags flags) const;
         bool setValueInternal(const std::string& key, std::string value, unsigned int number, ConfigurationValueFlags flags);
         void addValueInternal(std::string key, std::string value, ConfigurationValueFlags flags);
 
         std::vector<Value> _values;
         std::vector<Group> _groups;
+        /* Null if not indexed */
+        Containers::Pointer<Index> _index;
 
         Configuration* _configuration;
 };
@@ -686,22 +730,22 @@ class ConfigurationGroup::Values {
 /* Shorthand template specialization for string values, delete unwanted ones */
 template<> bool ConfigurationGroup::setValue(const std::string&, const std::string&, unsigned int, ConfigurationValueFlags) = delete;
 template<> void ConfigurationGroup::addValue(std::string, const std::string&, ConfigurationValueFlags) = delete;
-template<> inline std::string ConfigurationGroup::value(const std::string& key, unsigned int index, const ConfigurationValueFlags flags) const {
-    const std::string* value = valueInternal(key, index, flags);
-    return value ? *value : std::string{};
+template<> inline std::string ConfigurationGroup::value(const Containers::StringView key, unsigned int index, const ConfigurationValueFlags flags) const {
+    const Containers::String* value = valueInternal(key, index, flags);
+    return value ? std::string{value->data(), value->size()} : std::string{};
 }
-template<> inline std::vector<std::string> ConfigurationGroup::values(const std::string& key, const ConfigurationValueFlags flags) const {
-    std::vector<const std::string*> stringValues = valuesInternal(key, flags);
+template<> inline std::vector<std::string> ConfigurationGroup::values(const Containers::StringView key, const ConfigurationValueFlags flags) const {
+    std::vector<const Containers::String*> stringValues = valuesInternal(key, flags);
     std::vector<std::string> values;
     values.reserve(stringValues.size());
-    for(const std::string* i: stringValues)
-        values.push_back(*i);
+    for(const Containers::String* i: stringValues)
+        values.emplace_back(i->data(), i->size());
     return values;
 }
 #endif
 
-template<class T> inline T ConfigurationGroup::value(const std::string& key, const unsigned int index, const ConfigurationValueFlags flags) const {
-    const std::string* value = valueInternal(key, index, flags);
+template<class T> inline T ConfigurationGroup::value(const Containers::StringView key, const unsigned int index, const ConfigurationValueFlags flags) const {
+    const Containers::String* value = valueInternal(key, index, flags);
     /* If the value is not found, it's important to *not* call fromString()
        with an empty std::string -- if T is a view, it would cause it to
        reference that temporary std::string, which is SSO'd on the stack. That
@@ -712,22 +756,22 @@ template<class T> inline T ConfigurationGroup::value(const std::string& key, con
        anymore. Asserting in the better case, causing some rogue memory access
        in the worse scenario.
 
-       Instead, pass it a StringView -- the fromString() implementation is
-       likely using it already anyway and so it'll properly not reference
-       anything temporary, and if the implementation doesn't use StringView,
-       it'll get implicitly converted to a temporary std::string instance. */
+       Instead, pass it a StringView -- builtin types have fromString()
+       overloads taking it, so no temporary gets created in the common case,
+       and if a custom implementation doesn't use StringView, it'll get
+       implicitly converted to a temporary std::string instance. The
+       conversion is explicit to not make the call ambiguous for types that
+       have both overloads, as Containers::String is convertible to both. */
     /** @todo clean up once Configuration is STL-free */
-    return value ?
-        ConfigurationValue<T>::fromString(*value, flags) :
-        ConfigurationValue<T>::fromString(Containers::StringView{}, flags);
+    return ConfigurationValue<T>::fromString(value ? Containers::StringView{*value} : Containers::StringView{}, flags);
 }
 
-template<class T> std::vector<T> ConfigurationGroup::values(const std::string& key, const ConfigurationValueFlags flags) const {
-    std::vector<const std::string*> stringValues = valuesInternal(key, flags);
+template<class T> std::vector<T> ConfigurationGroup::values(const Containers::StringView key, const ConfigurationValueFlags flags) const {
+    std::vector<const Containers::String*> stringValues = valuesInternal(key, flags);
     std::vector<T> values;
     values.reserve(stringValues.size());
-    for(const std::string* i: stringValues)
-        values.push_back(ConfigurationValue<T>::fromString(*i, flags));
+    for(const Containers::String* i: stringValues)
+        values.push_back(ConfigurationValue<T>::fromString(Containers::StringView{*i}, flags));
 
     return values;
 }
@@ -41,6 +41,9 @@ std::string ConfigurationValue<Containers::StringView>::toString(const Container
     return value;
 }
 
+Containers::String ConfigurationValue<Containers::String>::fromString(const Containers::StringView value, ConfigurationValueFlags) {
+    return value;
+}
 Containers::String ConfigurationValue<Containers::String>::fromString(const std::string& value, ConfigurationValueFlags) {
     return value;
 }
@@ -48,6 +51,19 @@ std::string ConfigurationValue<Containers::String>::toString(const Containers::S
     return value;
 }
 
+namespace {
+
+/* Makes std::istream read directly from the view instead of going through a
+   std::string copy like with std::istringstream */
+struct StringViewBuffer: std::streambuf {
+    explicit StringViewBuffer(const Containers::StringView value) {
+        char* const data = const_cast<char*>(value.data());
+        setg(data, data, data + value.size());
+    }
+};
+
+}
+
 namespace Implementation {
     template<class T> std::string IntegerConfigurationValue<T>::toString(const T& value, ConfigurationValueFlags flags) {
         std::ostringstream stream;
@@ -65,10 +81,11 @@ namespace Implementation {
         return stream.str();
     }
 
-    template<class T> T IntegerConfigurationValue<T>::fromString(const std::string& stringValue, ConfigurationValueFlags flags) {
-        if(stringValue.empty()) return T{};
+    template<class T> T IntegerConfigurationValue<T>::fromString(const Containers::StringView stringValue, ConfigurationValueFlags flags) {
+        if(stringValue.isEmpty()) return T{};
 
-        std::istringstream stream{stringValue};
+        StringViewBuffer buffer{stringValue};
+        std::istream stream{&buffer};
 
         /* Hexadecimal / octal values */
         if(flags & ConfigurationValueFlag::Hex)
@@ -84,6 +101,10 @@ namespace Implementation {
         return value;
     }
 
+    template<class T> T IntegerConfigurationValue<T>::fromString(const std::string& stringValue, ConfigurationValueFlags flags) {
+        return fromString(Containers::StringView{stringValue}, flags);
+    }
+
     template struct IntegerConfigurationValue<short>;
     template struct IntegerConfigurationValue<unsigned short>;
     template struct IntegerConfigurationValue<int>;
@@ -107,10 +128,11 @@ namespace Implementation {
         return stream.str();
     }
 
-    template<class T> T FloatConfigurationValue<T>::fromString(const std::string& stringValue, ConfigurationValueFlags flags) {
-        if(stringValue.empty()) return T{};
+    template<class T> T FloatConfigurationValue<T>::fromString(const Containers::StringView stringValue, ConfigurationValueFlags flags) {
+        if(stringValue.isEmpty()) return T{};
 
-        std::istringstream stream{stringValue};
+        StringViewBuffer buffer{stringValue};
+        std::istream stream{&buffer};
 
         /* Scientific notation */
         if(flags & ConfigurationValueFlag::Scientific)
@@ -124,11 +146,18 @@ namespace Implementation {
         return value;
     }
 
+    template<class T> T FloatConfigurationValue<T>::fromString(const std::string& stringValue, ConfigurationValueFlags flags) {
+        return fromString(Containers::StringView{stringValue}, flags);
+    }
+
     template struct FloatConfigurationValue<float>;
     template struct FloatConfigurationValue<double>;
     template struct FloatConfigurationValue<long double>;
 }
 
+std::string ConfigurationValue<std::string>::fromString(const Containers::StringView value, ConfigurationValueFlags) {
+    return value;
+}
 std::string ConfigurationValue<std::string>::fromString(const std::string& value, ConfigurationValueFlags) {
     return value;
 }
@@ -136,16 +165,23 @@ std::string ConfigurationValue<std::string>::toString(const std::string& value,
     return value;
 }
 
-bool ConfigurationValue<bool>::fromString(const std::string& value, ConfigurationValueFlags) {
-    return value == "1" || value == "yes" || value == "y" || value == "true";
+bool ConfigurationValue<bool>::fromString(const Containers::StringView value, ConfigurationValueFlags) {
+    using namespace Containers::Literals;
+    return value == "1"_s || value == "yes"_s || value == "y"_s || value == "true"_s;
+}
+bool ConfigurationValue<bool>::fromString(const std::string& value, const ConfigurationValueFlags flags) {
+    return fromString(Containers::StringView{value}, flags);
 }
 std::string ConfigurationValue<bool>::toString(const bool value, ConfigurationValueFlags) {
     return value ? "true" : "false";
 }
 
-char32_t ConfigurationValue<char32_t>::fromString(const std::string& value, ConfigurationValueFlags) {
+char32_t ConfigurationValue<char32_t>::fromString(const Containers::StringView value, ConfigurationValueFlags) {
     return char32_t(ConfigurationValue<unsigned long long>::fromString(value, ConfigurationValueFlag::Hex|ConfigurationValueFlag::Uppercase));
 }
+char32_t ConfigurationValue<char32_t>::fromString(const std::string& value, const ConfigurationValueFlags flags) {
+    return fromString(Containers::StringView{value}, flags);
+}
 std::string ConfigurationValue<char32_t>::toString(const char32_t value, ConfigurationValueFlags) {
     return ConfigurationValue<unsigned long long>::toString(value, ConfigurationValueFlag::Hex|ConfigurationValueFlag::Uppercase);
 }
@@ -135,6 +135,7 @@ template<> struct CORRADE_UTILITY_EXPORT ConfigurationValue<Containers::String>
     ConfigurationValue() = delete;
 
     #ifndef DOXYGEN_GENERATING_OUTPUT
+    static Containers::String fromString(Containers::StringView value, ConfigurationValueFlags flags);
     static Containers::String fromString(const std::string& value, ConfigurationValueFlags flags);
     static std::string toString(const Containers::String& value, ConfigurationValueFlags flags);
     #endif
@@ -145,12 +146,14 @@ namespace Implementation {
         IntegerConfigurationValue() = delete;
 
         static std::string toString(const T& value, ConfigurationValueFlags flags);
+        static T fromString(Containers::StringView stringValue, ConfigurationValueFlags flags);
         static T fromString(const std::string& stringValue, ConfigurationValueFlags flags);
     };
     template<class T> struct CORRADE_UTILITY_EXPORT FloatConfigurationValue {
         FloatConfigurationValue() = delete;
 
         static std::string toString(const T& value, ConfigurationValueFlags flags);
+        static T fromString(Containers::StringView stringValue, ConfigurationValueFlags flags);
         static T fromString(const std::string& stringValue, ConfigurationValueFlags flags);
     };
 }
@@ -242,6 +245,7 @@ template<> struct CORRADE_UTILITY_EXPORT ConfigurationValue<std::string> {
     ConfigurationValue() = delete;
 
     #ifndef DOXYGEN_GENERATING_OUTPUT
+    static std::string fromString(Containers::StringView value, ConfigurationValueFlags flags);
     static std::string fromString(const std::string& value, ConfigurationValueFlags flags);
     static std::string toString(const std::string& value, ConfigurationValueFlags flags);
     #endif
@@ -257,6 +261,7 @@ template<> struct CORRADE_UTILITY_EXPORT ConfigurationValue<bool> {
     ConfigurationValue() = delete;
 
     #ifndef DOXYGEN_GENERATING_OUTPUT
+    static bool fromString(Containers::StringView value, ConfigurationValueFlags flags);
     static bool fromString(const std::string& value, ConfigurationValueFlags flags);
     static std::string toString(bool value, ConfigurationValueFlags flags);
     #endif
@@ -271,6 +276,7 @@ template<> struct CORRADE_UTILITY_EXPORT ConfigurationValue<char32_t> {
     ConfigurationValue() = delete;
 
     #ifndef DOXYGEN_GENERATING_OUTPUT
+    static char32_t fromString(Containers::StringView value, ConfigurationValueFlags);
     static char32_t fromString(const std::string& value, ConfigurationValueFlags);
     static std::string toString(char32_t value, ConfigurationValueFlags);
     #endif
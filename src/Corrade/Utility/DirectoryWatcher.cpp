@@ -0,0 +1,416 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DirectoryWatcher.h"
+
+#include <algorithm> /* std::stable_sort() */
+#include <chrono>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/Optional.h"
+#include "Corrade/Containers/Pair.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/Utility/Debug.h"
+#include "Corrade/Utility/Path.h"
+#include "Corrade/Utility/System.h"
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)
+#include "Corrade/Utility/Unicode.h"
+#endif
+
+#include "Corrade/Utility/Implementation/fileWatcher.h"
+
+namespace Corrade { namespace Utility {
+
+namespace {
+
+/* How long to wait at most between two checks in waitForChanges(). With
+   inotify the wait gets interrupted by an event, but since the events may be
+   also drained by FileWatcher instances in other threads, it's not waiting
+   indefinitely. */
+constexpr std::uint32_t WaitInterval = 100;
+
+struct Entry {
+    Containers::String name;
+    std::uint64_t time;
+    std::uint64_t size;
+    bool isDirectory;
+    /* Index into State::directories if isDirectory is set */
+    std::size_t directory;
+};
+
+struct Directory {
+    /* Relative to the watched path, empty for the watched path itself */
+    Containers::String path;
+    /* Sorted by name */
+    Containers::Array<Entry> entries;
+    /* Inotify watch or ~std::size_t{} if there's none */
+    std::size_t watch;
+    bool used;
+};
+
+/* Symbolic links to directories are skipped in order to avoid infinite
+   recursion, links to files are followed. Returns false if the entry doesn't
+   exist (anymore) or should be skipped. */
+bool statEntry(const Containers::StringView path, Entry& entry) {
+    #if defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    const Containers::String pathNullTerminated = Containers::String::nullTerminatedView(path);
+    /* GCC 4.8 complains about missing initializers if {} is used. The struct
+       is initialized by lstat() anyway so it's okay to keep it
+       uninitialized */
+    struct stat result;
+    if(lstat(pathNullTerminated.data(), &result) != 0)
+        return false;
+    if(S_ISLNK(result.st_mode) && (stat(pathNullTerminated.data(), &result) != 0 || S_ISDIR(result.st_mode)))
+        return false;
+    #elif defined(CORRADE_TARGET_WINDOWS)
+    struct _stat result;
+    if(_wstat(Unicode::widen(path), &result) != 0)
+        return false;
+    #else
+    #error
+    #endif
+
+    entry.isDirectory = (result.st_mode & S_IFMT) == S_IFDIR;
+    entry.size = result.st_size;
+    /* See FileWatcher::hasChangedInternal() for details */
+    entry.time =
+        #ifdef CORRADE_TARGET_APPLE
+        std::uint64_t(result.st_mtimespec.tv_sec)*1000000000 + std::uint64_t(result.st_mtimespec.tv_nsec)
+        #elif defined(st_mtime)
+        std::uint64_t(result.st_mtim.tv_sec)*1000000000 + std::uint64_t(result.st_mtim.tv_nsec)
+        #else
+        std::uint64_t(result.st_mtime)*1000000000
+        #endif
+        ;
+    return true;
+}
+
+}
+
+struct DirectoryWatcher::State {
+    Containers::String path;
+    /* The first item is the watched path itself. Removed directories are
+       marked as unused and their slots reused later. */
+    Containers::Array<Directory> directories;
+    /* Changes that weren't reported yet, in the order they were detected and
+       not coalesced */
+    Containers::Array<Containers::Pair<Containers::String, Change>> pending;
+    std::chrono::steady_clock::time_point lastChange;
+    std::uint32_t debounce;
+    bool valid;
+
+    /* Path::join() would add a trailing slash for the watched path itself,
+       which would then appear in error messages */
+    Containers::String absolutePath(std::size_t id) const {
+        return directories[id].path ? Path::join(path, directories[id].path) : Containers::String::nullTerminatedView(path);
+    }
+
+    std::size_t addDirectory(Containers::String&& path, bool report);
+    void removeDirectory(std::size_t id, bool report);
+    bool scanDirectory(std::size_t id, bool report);
+};
+
+std::size_t DirectoryWatcher::State::addDirectory(Containers::String&& path, const bool report) {
+    /* Reuse a free slot, if there's any */
+    std::size_t id = 0;
+    for(; id != directories.size(); ++id)
+        if(!directories[id].used) break;
+    if(id == directories.size())
+        arrayAppend(directories, InPlaceInit);
+
+    Directory& directory = directories[id];
+    directory.path = Utility::move(path);
+    directory.used = true;
+    directory.watch = ~std::size_t{};
+
+    /* Add the watch before listing the directory so no change gets lost in
+       between. The watch is initially dirty, reset that as the directory is
+       listed right after anyway. */
+    #ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+    directory.watch = Implementation::fileWatcherAddWatch(absolutePath(id), true);
+    if(directory.watch != ~std::size_t{})
+        Implementation::fileWatcherWatchDirty(directory.watch, nullptr);
+    #endif
+
+    scanDirectory(id, report);
+    return id;
+}
+
+void DirectoryWatcher::State::removeDirectory(const std::size_t id, const bool report) {
+    /* Cannot keep a reference to the directory across the recursion, but as
+       the entries are moved out, the recursion doesn't need them anymore */
+    const Containers::Array<Entry> entries = Utility::move(directories[id].entries);
+    for(const Entry& entry: entries) {
+        if(entry.isDirectory)
+            removeDirectory(entry.directory, report);
+        else if(report)
+            arrayAppend(pending, InPlaceInit, Path::join(directories[id].path, entry.name), Change::Deleted);
+    }
+
+    Directory& directory = directories[id];
+    #ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+    if(directory.watch != ~std::size_t{})
+        Implementation::fileWatcherRemoveWatch(directory.watch);
+    #endif
+    directory.path = {};
+    directory.used = false;
+}
+
+bool DirectoryWatcher::State::scanDirectory(const std::size_t id, const bool report) {
+    const Containers::String absolutePath = this->absolutePath(id);
+
+    /* If a subdirectory can't be listed, it got most probably deleted, in
+       which case it's treated as empty and removed once its parent directory
+       is scanned. Print the error only for the watched path itself. */
+    Containers::Optional<Containers::Array<Containers::String>> names;
+    if(id == 0)
+        names = Path::list(absolutePath, Path::ListFlag::SkipDotAndDotDot|Path::ListFlag::SortAscending);
+    else {
+        Error silenceError{nullptr};
+        names = Path::list(absolutePath, Path::ListFlag::SkipDotAndDotDot|Path::ListFlag::SortAscending);
+    }
+
+    Containers::Array<Entry> entries;
+    if(names) for(Containers::String& name: *names) {
+        Entry entry;
+        /* The entry could get deleted between the listing and the stat, skip
+           it in that case */
+        if(!statEntry(Path::join(absolutePath, name), entry))
+            continue;
+        entry.name = Utility::move(name);
+        arrayAppend(entries, Utility::move(entry));
+    }
+
+    /* Compare with the previous state. Both lists are sorted, so it's a
+       simple merge. New subdirectories get added only after, as that may
+       reallocate the directories array. */
+    const Containers::Array<Entry> previous = Utility::move(directories[id].entries);
+    std::size_t i = 0, j = 0;
+    while(i != previous.size() || j != entries.size()) {
+        const Entry* const removed =
+            j == entries.size() || (i != previous.size() && previous[i].name < entries[j].name) ? &previous[i] : nullptr;
+        const Entry* const created =
+            i == previous.size() || (j != entries.size() && entries[j].name < previous[i].name) ? &entries[j] : nullptr;
+
+        /* Present in both, and either still a file or still a directory */
+        if(!removed && !created && previous[i].isDirectory == entries[j].isDirectory) {
+            if(entries[j].isDirectory)
+                entries[j].directory = previous[i].directory;
+            else if(report && (entries[j].time != previous[i].time || entries[j].size != previous[i].size))
+                arrayAppend(pending, InPlaceInit, Path::join(directories[id].path, entries[j].name), Change::Modified);
+            ++i;
+            ++j;
+            continue;
+        }
+
+        /* Removed, or changed from a file to a directory or vice versa */
+        if(removed || !created) {
+            if(previous[i].isDirectory)
+                removeDirectory(previous[i].directory, report);
+            else if(report)
+                arrayAppend(pending, InPlaceInit, Path::join(directories[id].path, previous[i].name), Change::Deleted);
+            ++i;
+        }
+
+        /* Created, or changed from a file to a directory or vice versa.
+           Directories are added below. */
+        if(created || !removed) {
+            if(!entries[j].isDirectory && report)
+                arrayAppend(pending, InPlaceInit, Path::join(directories[id].path, entries[j].name), Change::Created);
+            entries[j].directory = ~std::size_t{};
+            ++j;
+        }
+    }
+
+    /* Add new subdirectories, which recursively scans them as well */
+    for(std::size_t k = 0; k != entries.size(); ++k) {
+        if(!entries[k].isDirectory || entries[k].directory != ~std::size_t{})
+            continue;
+        entries[k].directory = addDirectory(Path::join(directories[id].path, entries[k].name), report);
+    }
+
+    directories[id].entries = Utility::move(entries);
+    return !!names;
+}
+
+DirectoryWatcher::DirectoryWatcher(const Containers::StringView path): _state{InPlaceInit} {
+    _state->path = Containers::String::nullTerminatedGlobalView(path);
+    _state->debounce = 0;
+    _state->valid = true;
+
+    /* Scan the whole tree for the first time without reporting anything */
+    _state->addDirectory({}, false);
+    if(_state->directories[0].entries.isEmpty() && !Path::isDirectory(_state->path)) {
+        _state->removeDirectory(0, false);
+        _state->valid = false;
+    }
+}
+
+DirectoryWatcher::DirectoryWatcher(DirectoryWatcher&&) noexcept = default;
+
+DirectoryWatcher::~DirectoryWatcher() {
+    #ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+    /* The state is null if moved out */
+    if(_state) for(const Directory& directory: _state->directories)
+        if(directory.used && directory.watch != ~std::size_t{})
+            Implementation::fileWatcherRemoveWatch(directory.watch);
+    #endif
+}
+
+DirectoryWatcher& DirectoryWatcher::operator=(DirectoryWatcher&&) noexcept = default;
+
+Containers::StringView DirectoryWatcher::path() const {
+    return _state->path;
+}
+
+bool DirectoryWatcher::isValid() const {
+    return _state->valid;
+}
+
+std::uint32_t DirectoryWatcher::debounce() const {
+    return _state->debounce;
+}
+
+DirectoryWatcher& DirectoryWatcher::setDebounce(const std::uint32_t milliseconds) {
+    _state->debounce = milliseconds;
+    return *this;
+}
+
+Containers::Array<Containers::Pair<Containers::String, DirectoryWatcher::Change>> DirectoryWatcher::changes() {
+    State& state = *_state;
+
+    if(state.valid) {
+        #ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+        Implementation::fileWatcherProcessEvents();
+        #endif
+
+        /* Rescan directories that may have changed. New subdirectories may
+           get added in the process, but those are scanned right away so the
+           loop doesn't need to go through them. */
+        const std::size_t pendingCount = state.pending.size();
+        const std::size_t directoryCount = state.directories.size();
+        for(std::size_t i = 0; i != directoryCount; ++i) {
+            if(!state.directories[i].used) continue;
+
+            #ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+            if(state.directories[i].watch != ~std::size_t{} && !Implementation::fileWatcherWatchDirty(state.directories[i].watch, nullptr))
+                continue;
+            #endif
+
+            /* If the watched path itself can't be listed anymore, report all
+               files as deleted and stop watching */
+            if(!state.scanDirectory(i, true) && i == 0) {
+                state.removeDirectory(0, true);
+                state.valid = false;
+                break;
+            }
+        }
+
+        if(state.pending.size() != pendingCount)
+            state.lastChange = std::chrono::steady_clock::now();
+    }
+
+    /* Nothing to report or the debounce duration didn't pass yet. If the
+       watcher became invalid, report everything right away as there won't be
+       any further changes. */
+    if(state.pending.isEmpty() || (state.valid && std::chrono::steady_clock::now() - state.lastChange < std::chrono::milliseconds{state.debounce}))
+        return {};
+
+    /* Sort the changes by path, keeping the order of changes to the same path,
+       and coalesce them. Whether the file existed before the batch is given
+       by the first change, whether it exists after by the last change. */
+    std::stable_sort(state.pending.begin(), state.pending.end(), [](const Containers::Pair<Containers::String, Change>& a, const Containers::Pair<Containers::String, Change>& b) {
+        return a.first() < b.first();
+    });
+    Containers::Array<Containers::Pair<Containers::String, Change>> out;
+    for(std::size_t i = 0; i != state.pending.size(); ) {
+        std::size_t end = i + 1;
+        while(end != state.pending.size() && state.pending[end].first() == state.pending[i].first())
+            ++end;
+
+        const bool existedBefore = state.pending[i].second() != Change::Created;
+        const bool existsAfter = state.pending[end - 1].second() != Change::Deleted;
+        if(existedBefore || existsAfter)
+            arrayAppend(out, InPlaceInit, Utility::move(state.pending[i].first()),
+                !existedBefore ? Change::Created :
+                !existsAfter ? Change::Deleted : Change::Modified);
+
+        i = end;
+    }
+
+    state.pending = {};
+    return out;
+}
+
+Containers::Array<Containers::Pair<Containers::String, DirectoryWatcher::Change>> DirectoryWatcher::waitForChanges(const std::uint32_t timeout) {
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::milliseconds{timeout};
+    for(;;) {
+        Containers::Array<Containers::Pair<Containers::String, Change>> out = changes();
+        if(!out.isEmpty() || !_state->valid) return out;
+
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if(now >= end) return {};
+
+        /* Wait until the timeout, or until the debounce duration passes if
+           there are changes pending, but at most WaitInterval */
+        std::chrono::steady_clock::time_point until = std::min(end, now + std::chrono::milliseconds{WaitInterval});
+        if(!_state->pending.isEmpty())
+            until = std::min(until, _state->lastChange + std::chrono::milliseconds{_state->debounce});
+        /* Round up to not spin with zero waits if there's less than a
+           millisecond left */
+        const std::size_t wait = std::chrono::duration_cast<std::chrono::milliseconds>(until - now + std::chrono::microseconds{999}).count();
+
+        #ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+        if(_state->directories[0].watch != ~std::size_t{})
+            Implementation::fileWatcherWaitForEvents(wait);
+        else
+        #endif
+        {
+            System::sleep(wait);
+        }
+    }
+}
+
+Debug& operator<<(Debug& debug, const DirectoryWatcher::Change value) {
+    debug << "Utility::DirectoryWatcher::Change" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case DirectoryWatcher::Change::value: return debug << "::" #value;
+        _c(Created)
+        _c(Modified)
+        _c(Deleted)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << std::uint8_t(value) << Debug::nospace << ")";
+}
+
+}}
@@ -0,0 +1,203 @@
+#ifndef Corrade_Utility_DirectoryWatcher_h
+#define Corrade_Utility_DirectoryWatcher_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Utility::DirectoryWatcher
+ * @m_since_latest
+ */
+
+#include <cstdint>
+
+#include "Corrade/Containers/Pointer.h"
+#include "Corrade/Utility/Utility.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Utility {
+
+#if defined(DOXYGEN_GENERATING_OUTPUT) || defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)) || defined(CORRADE_TARGET_EMSCRIPTEN)
+/**
+@brief Directory watcher
+@m_since_latest
+
+Watches a directory and all its subdirectories for created, modified and
+deleted files, reporting them in batches. Example usage, reloading assets
+after they stop changing for 100 milliseconds:
+
+@snippet Utility.cpp DirectoryWatcher
+
+@section Utility-DirectoryWatcher-behavior Behavior
+
+On construction, the whole directory tree is scanned and modification time
+and size of every file is remembered. Each call to @ref changes() then
+rescans directories that may have changed, compares their contents with the
+previous state and records differences. Only files are reported, directories
+are traversed but their own creation, modification or deletion isn't
+reported. Creating or deleting a whole directory thus results in all files
+inside being reported as @ref Change::Created or @ref Change::Deleted.
+Symbolic links to directories are skipped, symbolic links to files are
+treated as the files they point to. Paths in the returned batches are relative
+to the watched directory and use forward slashes as separators.
+
+Same as with @ref FileWatcher, file modification is detected from changes in
+its modification time and size, so the same limitations regarding time
+granularity apply. See @ref Utility-FileWatcher-behavior for details.
+
+On Linux, the watcher makes use of the same shared inotify instance as
+@ref FileWatcher and rescans only directories for which an event arrived. If
+nothing changed, @ref changes() thus costs a single @cb{.sh} read() @ce
+syscall. On other systems, or if a directory can't be watched with inotify,
+the directories are rescanned on every call.
+
+@section Utility-DirectoryWatcher-debounce Debouncing
+
+Editors and asset pipelines often save files in several steps, or save many
+files at once. With @ref setDebounce() the changes are accumulated until
+there's no new change for given duration, and only then reported all at once.
+Changes to the same file are coalesced --- for example a file that got
+created and then modified is reported just as @ref Change::Created, and a
+file that got created and deleted again within the same batch isn't reported
+at all.
+
+@section Utility-DirectoryWatcher-threads Usage from a background thread
+
+The @ref changes() function never blocks. Alternatively, a background thread
+can call @ref waitForChanges(), which blocks until a batch of changes is
+available or given timeout expires. The directories are checked at least
+every 100 milliseconds while waiting, on Linux additionally right when an
+inotify event arrives. Concurrent access to the same instance
+from multiple threads isn't allowed, however independent instances as well as
+@ref FileWatcher instances can be used from different threads at the same
+time if @ref CORRADE_BUILD_MULTITHREADED is enabled.
+
+@partialsupport Available only on @ref CORRADE_TARGET_UNIX "Unix" and non-RT
+    @ref CORRADE_TARGET_WINDOWS "Windows" platforms and on
+    @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten". On Emscripten it works on the
+    virtual filesystem.
+*/
+class CORRADE_UTILITY_EXPORT DirectoryWatcher {
+    public:
+        /**
+         * @brief File change
+         *
+         * @see @ref changes(), @ref waitForChanges()
+         */
+        enum class Change: std::uint8_t {
+            /* Zero reserved for an invalid value */
+
+            Created = 1,    /**< File was created */
+            Modified,       /**< File was modified */
+            Deleted         /**< File was deleted */
+        };
+
+        /**
+         * @brief Constructor
+         *
+         * Expects that the @p path is in UTF-8. Scans the whole directory
+         * tree, see @ref Utility-DirectoryWatcher-behavior for more
+         * information. If @p path can't be listed, prints a message to
+         * @ref Error and @ref isValid() returns @cpp false @ce.
+         */
+        explicit DirectoryWatcher(Containers::StringView path);
+
+        /** @brief Copying is not allowed */
+        DirectoryWatcher(const DirectoryWatcher&) = delete;
+
+        /** @brief Move constructor */
+        DirectoryWatcher(DirectoryWatcher&&) noexcept;
+
+        /** @brief Copying is not allowed */
+        DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+
+        /** @brief Move assignment */
+        DirectoryWatcher& operator=(DirectoryWatcher&&) noexcept;
+
+        ~DirectoryWatcher();
+
+        /** @brief Watched path */
+        Containers::StringView path() const;
+
+        /**
+         * @brief Whether the watcher is valid
+         *
+         * Returns @cpp false @ce if the watched directory couldn't be listed
+         * on construction or if it was deleted. In the latter case, all files
+         * that were inside are reported as @ref Change::Deleted first. Once
+         * invalid, the watcher doesn't recover even if the directory is
+         * created again.
+         */
+        bool isValid() const;
+
+        /** @brief Debounce duration in milliseconds */
+        std::uint32_t debounce() const;
+
+        /**
+         * @brief Set debounce duration
+         * @return Reference to self (for method chaining)
+         *
+         * Changes are reported only once no new change was detected for
+         * @p milliseconds. Default is @cpp 0 @ce, meaning changes are
+         * reported as soon as they're detected. See
+         * @ref Utility-DirectoryWatcher-debounce for more information.
+         */
+        DirectoryWatcher& setDebounce(std::uint32_t milliseconds);
+
+        /**
+         * @brief Changed files
+         *
+         * Doesn't block. Returns a batch of changed files sorted by path, or
+         * an empty array if nothing changed or if the changes are held back
+         * because of @ref setDebounce(). If nothing changed, no allocation is
+         * done.
+         */
+        Containers::Array<Containers::Pair<Containers::String, Change>> changes();
+
+        /**
+         * @brief Wait for changed files
+         *
+         * Blocks until a non-empty batch of changed files is available, or
+         * until @p timeout milliseconds expire, in which case an empty array
+         * is returned. Returns immediately with an empty array if the watcher
+         * isn't valid. See @ref changes() for more information.
+         */
+        Containers::Array<Containers::Pair<Containers::String, Change>> waitForChanges(std::uint32_t timeout);
+
+    private:
+        struct State;
+
+        Containers::Pointer<State> _state;
+};
+
+/** @debugoperatorclassenum{DirectoryWatcher,DirectoryWatcher::Change} */
+CORRADE_UTILITY_EXPORT Debug& operator<<(Debug& debug, DirectoryWatcher::Change value);
+#else
+#error this header is available only on Unix, non-RT Windows and Emscripten
+#endif
+
+}}
+
+#endif
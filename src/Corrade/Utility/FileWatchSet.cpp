@@ -0,0 +1,77 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FileWatchSet.h"
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/StringView.h"
+#include "Corrade/Utility/Assert.h"
+
+#include "Corrade/Utility/Implementation/fileWatcher.h"
+
+namespace Corrade { namespace Utility {
+
+FileWatchSet::FileWatchSet() = default;
+
+FileWatchSet::FileWatchSet(FileWatchSet&&) noexcept = default;
+
+FileWatchSet::~FileWatchSet() = default;
+
+FileWatchSet& FileWatchSet::operator=(FileWatchSet&&) noexcept = default;
+
+std::size_t FileWatchSet::add(const Containers::StringView filename, const FileWatcher::Flags flags) {
+    arrayAppend(_watchers, InPlaceInit, filename, flags);
+    return _watchers.size() - 1;
+}
+
+FileWatcher::Flags FileWatchSet::flags(const std::size_t id) const {
+    CORRADE_ASSERT(id < _watchers.size(),
+        "Utility::FileWatchSet::flags(): id" << id << "out of range for" << _watchers.size() << "files", {});
+    return _watchers[id].flags();
+}
+
+bool FileWatchSet::isValid(const std::size_t id) const {
+    CORRADE_ASSERT(id < _watchers.size(),
+        "Utility::FileWatchSet::isValid(): id" << id << "out of range for" << _watchers.size() << "files", {});
+    return _watchers[id].isValid();
+}
+
+Containers::Array<std::size_t> FileWatchSet::changedFiles() {
+    /* Drain the shared inotify queue just once, the watchers then only check
+       their dirty state without doing any syscalls unless there was an
+       event */
+    #ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+    Implementation::fileWatcherProcessEvents();
+    #endif
+
+    Containers::Array<std::size_t> out;
+    for(std::size_t i = 0; i != _watchers.size(); ++i)
+        if(_watchers[i].hasChangedInternal()) arrayAppend(out, i);
+
+    return out;
+}
+
+}}
@@ -0,0 +1,135 @@
+#ifndef Corrade_Utility_FileWatchSet_h
+#define Corrade_Utility_FileWatchSet_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Utility::FileWatchSet
+ * @m_since_latest
+ */
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Utility/FileWatcher.h"
+
+namespace Corrade { namespace Utility {
+
+#if defined(DOXYGEN_GENERATING_OUTPUT) || defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)) || defined(CORRADE_TARGET_EMSCRIPTEN)
+/**
+@brief File watch set
+@m_since_latest
+
+Watches a set of files for changes, returning all files that changed since the
+last check from a single non-blocking call:
+
+@snippet Utility.cpp FileWatchSet
+
+Each file is watched with a @ref FileWatcher, so the
+@ref Utility-FileWatcher-behavior "behavior" is the same. On Linux the shared
+inotify instance described in @ref Utility-FileWatcher-inotify is drained just
+once in @ref changedFiles(), after which only files that had an event since the
+last call have their modification time queried. If nothing changed, the call
+thus costs a single @cb{.sh} read() @ce syscall regardless of how many files
+are watched. On other systems the modification time of all files is queried
+each time.
+
+@partialsupport Available only on @ref CORRADE_TARGET_UNIX "Unix" and non-RT
+    @ref CORRADE_TARGET_WINDOWS "Windows" platforms and on
+    @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten". On Emscripten it works on the
+    virtual filesystem.
+*/
+class CORRADE_UTILITY_EXPORT FileWatchSet {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Creates an empty set, add files to it with @ref add().
+         */
+        explicit FileWatchSet();
+
+        /** @brief Copying is not allowed */
+        FileWatchSet(const FileWatchSet&) = delete;
+
+        /** @brief Move constructor */
+        FileWatchSet(FileWatchSet&&) noexcept;
+
+        /** @brief Copying is not allowed */
+        FileWatchSet& operator=(const FileWatchSet&) = delete;
+
+        /** @brief Move assignment */
+        FileWatchSet& operator=(FileWatchSet&&) noexcept;
+
+        ~FileWatchSet();
+
+        /** @brief Count of watched files */
+        std::size_t fileCount() const { return _watchers.size(); }
+
+        /**
+         * @brief Add a file to watch
+         *
+         * Creates a @ref FileWatcher for @p filename with given @p flags, see
+         * @ref FileWatcher::FileWatcher(Containers::StringView, FileWatcher::Flags)
+         * for more information. Returns an ID of the file, which is equal to
+         * @ref fileCount() before calling this function, and which is used to
+         * identify the file in @ref changedFiles().
+         */
+        std::size_t add(Containers::StringView filename, FileWatcher::Flags flags = {});
+
+        /**
+         * @brief Watch behavior flags of given file
+         *
+         * Expects that @p id is less than @ref fileCount().
+         * @see @ref FileWatcher::flags()
+         */
+        FileWatcher::Flags flags(std::size_t id) const;
+
+        /**
+         * @brief Whether the watch of given file is valid
+         *
+         * Expects that @p id is less than @ref fileCount().
+         * @see @ref FileWatcher::isValid()
+         */
+        bool isValid(std::size_t id) const;
+
+        /**
+         * @brief Files that changed
+         *
+         * Returns IDs of files that changed since the previous call, in
+         * ascending order. If nothing changed, the returned array is empty
+         * and no allocation is done.
+         * @see @ref FileWatcher::hasChanged()
+         */
+        Containers::Array<std::size_t> changedFiles();
+
+    private:
+        Containers::Array<FileWatcher> _watchers;
+};
+#else
+#error this header is available only on Unix, non-RT Windows and Emscripten
+#endif
+
+}}
+
+#endif
@@ -34,6 +34,7 @@
 #include "Corrade/Containers/EnumSet.hpp"
 #include "Corrade/Containers/StringView.h"
 #include "Corrade/Utility/Debug.h"
+#include "Corrade/Utility/Move.h"
 
 #if defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)
 #include "Corrade/Containers/String.h"
@@ -41,9 +42,224 @@
 #endif
 
 #include "Corrade/Utility/Implementation/ErrorString.h"
+#include "Corrade/Utility/Implementation/fileWatcher.h"
+
+#ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#ifdef CORRADE_BUILD_MULTITHREADED
+#include <mutex>
+#endif
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/Pair.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/Utility/Path.h"
+#endif
 
 namespace Corrade { namespace Utility {
 
+#ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+namespace {
+
+#ifdef CORRADE_BUILD_MULTITHREADED
+/* Guards the shared inotify state below, including the inotify_add_watch()
+   calls and draining of the event queue */
+std::mutex inotifyMutex;
+#endif
+
+/* Creation, deletion and replacement of the file is detected through the
+   parent directory watch, in-place modifications also through the watch on
+   the file itself, which additionally follows symlinks. Access events are
+   deliberately not included. */
+constexpr std::uint32_t InotifyDirectoryMask = IN_MODIFY|IN_ATTRIB|IN_CLOSE_WRITE|IN_MOVED_FROM|IN_MOVED_TO|IN_CREATE|IN_DELETE|IN_ONLYDIR;
+constexpr std::uint32_t InotifyFileMask = IN_MODIFY|IN_ATTRIB|IN_CLOSE_WRITE|IN_DELETE_SELF|IN_MOVE_SELF;
+
+struct InotifyWatch {
+    /* Filename part of the path, to match directory events against. Unused
+       for directory watches, which match all events in the directory. */
+    Containers::String name;
+    /* Watch descriptors, -1 if not watched. If the directory isn't watched
+       anymore, the watch is treated as always dirty. */
+    int directory;
+    int file;
+    bool used;
+    bool dirty;
+    bool wholeDirectory;
+};
+
+struct Inotify {
+    int fd;
+    std::size_t usedCount;
+    Containers::Array<InotifyWatch> watches;
+};
+
+/* Allocated on first use and deleted again when the last watch is removed,
+   so there's no global destructor that could run before destructors of
+   global FileWatcher instances */
+Inotify* inotify = nullptr;
+
+}
+
+namespace Implementation {
+
+std::size_t fileWatcherAddWatch(const Containers::StringView path, const bool directory) {
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    std::lock_guard<std::mutex> lock{inotifyMutex};
+    #endif
+
+    if(!inotify) {
+        const int fd = inotify_init1(IN_NONBLOCK|IN_CLOEXEC);
+        if(fd == -1) return ~std::size_t{};
+        inotify = new Inotify{fd, 0, {}};
+    }
+
+    /* For a file watch the parent directory is watched. If the directory
+       can't be watched, fall back to polling. */
+    const Containers::Pair<Containers::StringView, Containers::StringView> split = Path::split(path);
+    const int directoryDescriptor = directory ?
+        inotify_add_watch(inotify->fd, Containers::String::nullTerminatedView(path).data(), InotifyDirectoryMask) :
+        inotify_add_watch(inotify->fd, split.first() ? Containers::String::nullTerminatedView(split.first()).data() : ".", InotifyDirectoryMask);
+    if(directoryDescriptor == -1) {
+        if(!inotify->usedCount) {
+            close(inotify->fd);
+            delete inotify;
+            inotify = nullptr;
+        }
+        return ~std::size_t{};
+    }
+
+    /* The file may not exist yet, in which case its watch gets added once a
+       directory event for it arrives */
+    const int fileDescriptor = directory ? -1 :
+        inotify_add_watch(inotify->fd, path.data(), InotifyFileMask);
+
+    /* Reuse a free slot, if there's any */
+    std::size_t id = 0;
+    for(; id != inotify->watches.size(); ++id)
+        if(!inotify->watches[id].used) break;
+    if(id == inotify->watches.size())
+        arrayAppend(inotify->watches, InPlaceInit);
+
+    /* Dirty initially so the first check queries the filesystem */
+    inotify->watches[id] = InotifyWatch{directory ? Containers::String{} : Containers::String{split.second()}, directoryDescriptor, fileDescriptor, true, true, directory};
+    ++inotify->usedCount;
+    return id;
+}
+
+void fileWatcherRemoveWatch(const std::size_t id) {
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    std::lock_guard<std::mutex> lock{inotifyMutex};
+    #endif
+
+    InotifyWatch& watch = inotify->watches[id];
+    watch.used = false;
+    watch.name = {};
+
+    /* Remove the kernel watches only if they're not shared with other
+       watches. The kernel returns the same descriptor for the same inode. */
+    for(const int descriptor: {watch.directory, watch.file}) {
+        if(descriptor == -1) continue;
+        bool shared = false;
+        for(const InotifyWatch& other: inotify->watches) {
+            if(other.used && (other.directory == descriptor || other.file == descriptor)) {
+                shared = true;
+                break;
+            }
+        }
+        if(!shared) inotify_rm_watch(inotify->fd, descriptor);
+    }
+
+    if(!--inotify->usedCount) {
+        close(inotify->fd);
+        delete inotify;
+        inotify = nullptr;
+    }
+}
+
+bool fileWatcherWatchDirty(const std::size_t id, const char* const filename) {
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    std::lock_guard<std::mutex> lock{inotifyMutex};
+    #endif
+
+    InotifyWatch& watch = inotify->watches[id];
+    if(watch.directory == -1) return true;
+    if(!watch.dirty) return false;
+
+    /* If the file was deleted or replaced, watch the new one */
+    if(watch.file == -1 && !watch.wholeDirectory)
+        watch.file = inotify_add_watch(inotify->fd, filename, InotifyFileMask);
+    watch.dirty = false;
+    return true;
+}
+
+void fileWatcherProcessEvents() {
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    std::lock_guard<std::mutex> lock{inotifyMutex};
+    #endif
+    if(!inotify) return;
+
+    alignas(struct inotify_event) char buffer[4096];
+    for(;;) {
+        /* The fd is non-blocking, so this returns -1 with EAGAIN once there's
+           nothing more to read. Since events are never split across reads,
+           just stop on any error. */
+        const ssize_t size = read(inotify->fd, buffer, sizeof(buffer));
+        if(size <= 0) break;
+
+        for(const char* i = buffer; i < buffer + size; ) {
+            const struct inotify_event& event = *reinterpret_cast<const struct inotify_event*>(i);
+            i += sizeof(struct inotify_event) + event.len;
+
+            /* Events were lost, check everything */
+            if(event.mask & IN_Q_OVERFLOW) {
+                for(InotifyWatch& watch: inotify->watches)
+                    watch.dirty = true;
+                continue;
+            }
+
+            /* The name is null-terminated, possibly with additional padding */
+            const Containers::StringView name = event.len ? Containers::StringView{event.name} : Containers::StringView{};
+            for(InotifyWatch& watch: inotify->watches) {
+                if(!watch.used) continue;
+
+                if(watch.directory == event.wd) {
+                    if(event.mask & IN_IGNORED) {
+                        watch.directory = -1;
+                        watch.dirty = true;
+                    } else if(watch.wholeDirectory || name == watch.name)
+                        watch.dirty = true;
+                }
+
+                if(watch.file == event.wd) {
+                    if(event.mask & IN_IGNORED) watch.file = -1;
+                    watch.dirty = true;
+                }
+            }
+        }
+    }
+}
+
+void fileWatcherWaitForEvents(const std::size_t milliseconds) {
+    /* The instance is kept alive by the caller's watches, so it's fine to
+       use the fd outside of the lock. poll() doesn't consume any events. */
+    int fd;
+    {
+        #ifdef CORRADE_BUILD_MULTITHREADED
+        std::lock_guard<std::mutex> lock{inotifyMutex};
+        #endif
+        if(!inotify) return;
+        fd = inotify->fd;
+    }
+
+    pollfd pfd{fd, POLLIN, 0};
+    poll(&pfd, 1, int(milliseconds));
+}
+
+}
+#endif
+
 enum class FileWatcher::InternalFlag: std::uint8_t {
     /* Keep in sync with Flag */
     IgnoreErrors = std::uint8_t(FileWatcher::Flag::IgnoreErrors),
@@ -61,15 +277,29 @@ FileWatcher::FileWatcher(const Containers::StringView filename, Flags flags):
     #error
     #endif
     _flags{InternalFlag(std::uint8_t(flags))|InternalFlag::Valid},
-    _time{~std::uint64_t{}}
+    _time{~std::uint64_t{}},
+    _inotifyWatch{~std::size_t{}}
 {
+    /* Add the watch before querying the modification time so no change gets
+       lost in between */
+    #ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+    _inotifyWatch = Implementation::fileWatcherAddWatch(_filename, false);
+    #endif
+
     /* Initialize the time value for the first time */
     hasChanged();
 }
 
-FileWatcher::FileWatcher(FileWatcher&&) noexcept = default;
+FileWatcher::FileWatcher(FileWatcher&& other) noexcept: _filename{Utility::move(other._filename)}, _flags{other._flags}, _time{other._time}, _inotifyWatch{other._inotifyWatch} {
+    other._inotifyWatch = ~std::size_t{};
+}
 
-FileWatcher::~FileWatcher() = default;
+FileWatcher::~FileWatcher() {
+    #ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+    if(_inotifyWatch != ~std::size_t{})
+        Implementation::fileWatcherRemoveWatch(_inotifyWatch);
+    #endif
+}
 
 FileWatcher::Flags FileWatcher::flags() const {
     return Flag(std::uint8_t(_flags & ~InternalFlag::Valid));
@@ -79,11 +309,35 @@ bool FileWatcher::isValid() const {
     return _flags >= InternalFlag::Valid;
 }
 
-FileWatcher& FileWatcher::operator=(FileWatcher&&) noexcept = default;
+FileWatcher& FileWatcher::operator=(FileWatcher&& other) noexcept {
+    using Utility::swap;
+    swap(other._filename, _filename);
+    swap(other._flags, _flags);
+    swap(other._time, _time);
+    swap(other._inotifyWatch, _inotifyWatch);
+    return *this;
+}
 
 bool FileWatcher::hasChanged() {
     if(!(_flags & InternalFlag::Valid)) return false;
 
+    #ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+    Implementation::fileWatcherProcessEvents();
+    #endif
+
+    return hasChangedInternal();
+}
+
+bool FileWatcher::hasChangedInternal() {
+    if(!(_flags & InternalFlag::Valid)) return false;
+
+    /* Query the modification time only if there was any event for the file
+       since the last time */
+    #ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+    if(_inotifyWatch != ~std::size_t{} && !Implementation::fileWatcherWatchDirty(_inotifyWatch, _filename.data()))
+        return false;
+    #endif
+
     /** @todo all this code is now in Path::lastModification() as well, except
         that here it caches the UTF-16-converted filename for Windows, and it
         also subsequently queries the file size on iOS, so porting it to make
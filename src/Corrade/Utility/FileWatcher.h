@@ -59,8 +59,8 @@ usage:
 
 @section Utility-FileWatcher-behavior Behavior
 
-The generic implementation (currently used on all supported systems) checks for
-file modification time and reports a change if the modification time changes.
+The generic implementation checks for file modification time and reports a
+change if the modification time changes.
 Deleting a file and immediately recreating it with the same name will behave
 the same as simply updating that file, unless the file status is checked during
 the short time when it was deleted --- in that case @ref isValid() will return
@@ -82,6 +82,23 @@ modification time:
 
 <b></b>
 
+@section Utility-FileWatcher-inotify Event-driven implementation on Linux
+
+On Linux, all @ref FileWatcher instances additionally share a single
+non-blocking [inotify](https://man7.org/linux/man-pages/man7/inotify.7.html)
+instance, watching the parent directory of each file and the file itself.
+The modification time is then queried only if inotify reported an event for
+the file since the last call to @ref hasChanged(), which means the check
+costs just a single @cb{.sh} read() @ce syscall if nothing changed. The
+behavior described above stays the same, the file modification time is still
+what ultimately decides whether a change is reported. If the inotify instance
+can't be created or the parent directory can't be watched, for example
+because it doesn't exist or a limit of watches was reached, the watcher
+silently falls back to the generic implementation.
+
+In order to check many files at once with a single syscall, use
+@ref FileWatchSet.
+
 @partialsupport Available only on @ref CORRADE_TARGET_UNIX "Unix" and non-RT
     @ref CORRADE_TARGET_WINDOWS "Windows" platforms and on
     @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten". On Emscripten it works on the
@@ -171,11 +188,20 @@ class CORRADE_UTILITY_EXPORT FileWatcher {
          * @brief Whether the file has changed
          *
          * Returns @cpp true @ce if the file modification time was updated
-         * since the previous call, @cpp false @ce otherwise.
+         * since the previous call, @cpp false @ce otherwise. See
+         * @ref Utility-FileWatcher-inotify for details about the
+         * implementation on Linux.
          */
         bool hasChanged();
 
     private:
+        friend FileWatchSet;
+
+        /* Like hasChanged(), but doesn't process pending inotify events.
+           Used by FileWatchSet, which processes them just once for all its
+           watchers. */
+        bool hasChangedInternal();
+
         enum class InternalFlag: std::uint8_t;
         typedef Containers::EnumSet<InternalFlag> InternalFlags;
         CORRADE_ENUMSET_FRIEND_OPERATORS(InternalFlags)
@@ -189,6 +215,9 @@ class CORRADE_UTILITY_EXPORT FileWatcher {
         #endif
         InternalFlags _flags;
         std::uint64_t _time;
+        /* Index of the shared inotify watch on Linux or ~std::size_t{} if
+           there's none, unused elsewhere */
+        std::size_t _inotifyWatch;
 };
 
 CORRADE_ENUMSET_OPERATORS(FileWatcher::Flags)
@@ -27,6 +27,7 @@
 */
 
 #include <algorithm> /* std::lower_bound() */
+#include <cstring> /* std::memcpy() */
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/Containers/ArrayView.h>
 
@@ -98,6 +99,98 @@ inline std::size_t resourceLookup(const unsigned int count, const unsigned int*
     return i;
 }
 
+/* Hash used for filename lookup in a minimal perfect hash table. A FNV-1a
+   with the seed mixed into the initial state, followed by a MurmurHash3
+   finalizer to have the bits well distributed for the subsequent modulo. The
+   same function is used by corrade-rc when generating the table, so any
+   change to it has to be accompanied by a CORRADE_RESOURCE_VERSION bump. */
+inline unsigned int resourceHash(const Containers::StringView filename, const unsigned int seed) {
+    unsigned int hash = 0x811c9dc5u ^ (seed*0x9e3779b9u);
+    for(const char c: filename) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x01000193u;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/* Look up a particular filename using a minimal perfect hash table. Every
+   filename falls into a bucket based on an unseeded hash, hashing it again
+   with the bucket seed gives a slot containing the file index. As the table
+   gives back an index for any input, the filename still has to be compared
+   at the end. Returns either the index or count if not found. If the table is
+   null, falls back to the binary search above. */
+inline std::size_t resourceLookup(const unsigned int count, const unsigned int* const positionData, const unsigned int* const hash, const unsigned char* const filenames, const Containers::StringView filename) {
+    if(!hash) return resourceLookup(count, positionData, filenames, filename);
+    if(!count) return count;
+
+    const unsigned int seed = hash[2*(resourceHash(filename, 0) % count)];
+    const unsigned int i = hash[2*(resourceHash(filename, seed) % count) + 1];
+    if(filename != resourceFilenameAt(positionData, filenames, i)) return count;
+    return i;
+}
+
+/* Decompresses a LZ4 block produced by resourceCompress() in
+   ResourceCompile.h. The block is a sequence of a token byte with literal
+   count in the upper and match length minus 4 in the lower four bits, both
+   extended with additional bytes if 15, followed by the literals, a 16-bit
+   little-endian match offset and the additional match length bytes. The last
+   sequence has only literals. Returns false if the input is malformed or
+   doesn't decompress to exactly the output size. */
+inline bool resourceDecompress(const Containers::ArrayView<const char> in, const Containers::ArrayView<char> out) {
+    const unsigned char* ip = reinterpret_cast<const unsigned char*>(in.data());
+    const unsigned char* const inEnd = ip + in.size();
+    char* op = out.data();
+    char* const outEnd = op + out.size();
+
+    while(ip != inEnd) {
+        const unsigned int token = *ip++;
+
+        std::size_t literalCount = token >> 4;
+        if(literalCount == 15) for(;;) {
+            if(ip == inEnd) return false;
+            const unsigned char byte = *ip++;
+            literalCount += byte;
+            if(byte != 255) break;
+        }
+        if(literalCount > std::size_t(inEnd - ip) || literalCount > std::size_t(outEnd - op))
+            return false;
+        /* Empty files aren't compressed so the pointers are never null here,
+           but better be sure */
+        if(literalCount) std::memcpy(op, ip, literalCount);
+        ip += literalCount;
+        op += literalCount;
+
+        /* The last sequence has no match */
+        if(ip == inEnd) break;
+
+        if(inEnd - ip < 2) return false;
+        const std::size_t offset = ip[0] | ip[1] << 8;
+        ip += 2;
+        if(!offset || offset > std::size_t(op - out.data())) return false;
+
+        std::size_t matchLength = (token & 0x0f) + 4;
+        if((token & 0x0f) == 15) for(;;) {
+            if(ip == inEnd) return false;
+            const unsigned char byte = *ip++;
+            matchLength += byte;
+            if(byte != 255) break;
+        }
+        if(matchLength > std::size_t(outEnd - op)) return false;
+
+        /* The match can overlap the output, so copying byte by byte */
+        const char* match = op - offset;
+        for(char* const end = op + matchLength; op != end; ++op, ++match)
+            *op = *match;
+    }
+
+    return op == outEnd;
+}
+
 }}}
 
 #endif
@@ -29,7 +29,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
-#include <algorithm> /* std::is_sorted(), ahem */ /** @todo drop */
+#include <algorithm> /* std::is_sorted(), std::stable_sort(), ahem */ /** @todo drop */
 #include <iomanip>
 #include <map>
 #include <sstream>
@@ -44,6 +44,12 @@
 #include "Corrade/Utility/Math.h"
 #include "Corrade/Utility/Path.h"
 #include "Corrade/Utility/Resource.h" /* CORRADE_RESOURCE_VERSION */
+#include "Corrade/Utility/Implementation/Resource.h"
+
+#ifdef CORRADE_BUILD_MULTITHREADED
+#include <atomic>
+#include <thread>
+#endif
 
 /* Functionality here is used only by corrade-rc and ResourceCompileTest, thus
    it makes no sense for it to live inside CorradeUtility. It's put into an
@@ -94,6 +100,7 @@ struct FileData {
     Containers::StringView filename;
     bool nullTerminated;
     unsigned int align;
+    bool compress;
     Containers::Array<char> data;
 };
 
@@ -101,6 +108,224 @@ inline bool lessFilename(const FileData& a, const FileData& b) {
     return a.filename < b.filename;
 }
 
+/* Calls given function for all indices in given range. If Corrade is built
+   with multithreading enabled, it's done on as many threads as there's cores,
+   with the calling thread taking a part of the work as well. */
+template<class F> void resourceParallelFor(const std::size_t count, const F& f) {
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    const std::size_t threadCount = min(std::size_t(std::thread::hardware_concurrency()), count);
+    if(threadCount > 1) {
+        std::atomic<std::size_t> next{0};
+        auto worker = [&next, count, &f]() {
+            for(std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < count; )
+                f(i);
+        };
+
+        Containers::Array<std::thread> threads{threadCount - 1};
+        for(std::thread& thread: threads)
+            thread = std::thread{worker};
+        worker();
+        for(std::thread& thread: threads)
+            thread.join();
+        return;
+    }
+    #endif
+
+    for(std::size_t i = 0; i != count; ++i)
+        f(i);
+}
+
+/* 64-bit FNV-1a of file contents, used together with the size as a key into
+   the cache of compressed data */
+inline std::uint64_t resourceContentHash(const Containers::ArrayView<const char> data) {
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    for(const char c: data)
+        hash = (hash ^ std::uint8_t(c))*0x100000001b3ull;
+    return hash;
+}
+
+/* Reads a cache entry, returning an empty Optional if it doesn't exist */
+Containers::Optional<Containers::Array<char>> resourceCacheRead(const Containers::StringView directory, const Containers::StringView entry) {
+    const Containers::String filename = Path::join(directory, entry);
+    if(!Path::exists(filename))
+        return {};
+    return Path::read(filename);
+}
+
+/* Writes a cache entry. Done through a temporary file that's then moved over,
+   so an interrupted write or another process reading the cache at the same
+   time never sees a partially written entry. The suffix is meant to make the
+   temporary file unique if multiple threads write the same entry. Failures
+   aren't fatal, the entry just gets created again next time. */
+void resourceCacheWrite(const Containers::StringView directory, const Containers::StringView entry, const Containers::ArrayView<const char> data, const std::size_t suffix) {
+    const Containers::String filename = Path::join(directory, entry);
+    const Containers::String temporary = format("{}.{}.tmp", filename, suffix);
+    if(Path::write(temporary, data) && !Path::move(temporary, filename))
+        Path::remove(temporary);
+}
+
+/* Whether given filename is a cache entry written by resourceCacheWrite(),
+   i.e. `<16 hex digits>-<hex digits>.lz4`, optionally followed by
+   `.<digits>.tmp` if it's a temporary file left over from an interrupted
+   write. Used to never touch anything else that might be in the directory. */
+bool resourceIsCacheEntry(Containers::StringView filename) {
+    using namespace Containers::Literals;
+
+    const auto isHexDigit = [](const char c) {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f');
+    };
+
+    /* Strip the temporary file suffix first, if there's any */
+    if(filename.hasSuffix(".tmp"_s)) {
+        filename = filename.exceptSuffix(".tmp"_s);
+        std::size_t digits = 0;
+        while(digits < filename.size() && filename[filename.size() - digits - 1] >= '0' && filename[filename.size() - digits - 1] <= '9')
+            ++digits;
+        if(!digits || !filename.exceptSuffix(digits).hasSuffix('.'))
+            return false;
+        filename = filename.exceptSuffix(digits + 1);
+    }
+
+    if(!filename.hasSuffix(".lz4"_s))
+        return false;
+    filename = filename.exceptSuffix(".lz4"_s);
+
+    /* 16 hex digits of the hash, a dash and at least one hex digit of the
+       size */
+    if(filename.size() < 18 || filename[16] != '-')
+        return false;
+    for(std::size_t i = 0; i != filename.size(); ++i)
+        if(i != 16 && !isHexDigit(filename[i]))
+            return false;
+    return true;
+}
+
+/* Files smaller than this are never compressed, as the savings would be
+   negligible compared to the cost of decompressing and allocating a copy on
+   first access */
+constexpr std::size_t ResourceCompressMinSize = 256;
+
+/* Compresses the data into a LZ4 block, decompressed by resourceDecompress()
+   in Implementation/Resource.h. A greedy single-pass compressor with a 4096
+   entry hash table of four-byte sequences, following the LZ4 block format
+   restrictions that the last five bytes are always literals and the last
+   match starts at least twelve bytes before the end. */
+Containers::Array<char> resourceCompress(const Containers::ArrayView<const char> in) {
+    const unsigned char* const data = reinterpret_cast<const unsigned char*>(in.data());
+    const std::size_t size = in.size();
+    Containers::Array<char> out;
+
+    const auto appendLength = [&out](std::size_t length) {
+        for(; length >= 255; length -= 255)
+            arrayAppend(out, char(255));
+        arrayAppend(out, char(length));
+    };
+    const auto appendSequence = [&](const std::size_t literalBegin, const std::size_t literalCount, const std::size_t offset, const std::size_t matchLength) {
+        const std::size_t extraMatchLength = matchLength ? matchLength - 4 : 0;
+        arrayAppend(out, char((min(literalCount, std::size_t{15}) << 4)|min(extraMatchLength, std::size_t{15})));
+        if(literalCount >= 15) appendLength(literalCount - 15);
+        arrayAppend(out, in.slice(literalBegin, literalBegin + literalCount));
+        /* The last sequence has just the literals */
+        if(!matchLength) return;
+        arrayAppend(out, {char(offset & 0xff), char(offset >> 8)});
+        if(extraMatchLength >= 15) appendLength(extraMatchLength - 15);
+    };
+    const auto read32 = [data](const std::size_t i) {
+        return std::uint32_t(data[i])|std::uint32_t(data[i + 1]) << 8|std::uint32_t(data[i + 2]) << 16|std::uint32_t(data[i + 3]) << 24;
+    };
+
+    /* Positions + 1 of the last occurence of a four-byte sequence with given
+       hash, zero meaning there's none */
+    Containers::Array<std::size_t> table{ValueInit, 4096};
+    std::size_t literalBegin = 0;
+    if(size > 12) for(std::size_t i = 0; i < size - 12; ) {
+        const std::uint32_t sequence = read32(i);
+        std::size_t& entry = table[(sequence*2654435761u) >> 20];
+        const std::size_t match = entry;
+        entry = i + 1;
+        if(!match || i + 1 - match > 65535 || read32(match - 1) != sequence) {
+            ++i;
+            continue;
+        }
+
+        std::size_t matchLength = 4;
+        while(i + matchLength < size - 5 && data[match - 1 + matchLength] == data[i + matchLength])
+            ++matchLength;
+
+        appendSequence(literalBegin, i - literalBegin, i + 1 - match, matchLength);
+        i += matchLength;
+        literalBegin = i;
+    }
+
+    appendSequence(literalBegin, size - literalBegin, 0, 0);
+
+    return out;
+}
+
+/* Builds a minimal perfect hash table for filename lookup, consumed by
+   resourceLookup() in Implementation/Resource.h. The filenames are first
+   distributed into as many buckets as there are files using an unseeded
+   hash. Then, going from the largest bucket, a seed is searched for which
+   hashes all filenames in the bucket to distinct free slots. Pair `i` of the
+   output is a seed for bucket `i` and index of the file in slot `i`.
+
+   With one bucket per file the search converges quickly, the attempt limit is
+   only there to not loop forever for example if there are duplicate
+   filenames. In that case an empty array is returned and the lookup falls
+   back to a binary search. */
+Containers::Array<unsigned int> resourceHashTable(const Containers::ArrayView<const FileData> files) {
+    const unsigned int count = files.size();
+    if(!count) return {};
+
+    /* Bucket assignment, sorted by the bucket and then by bucket size so the
+       largest buckets get placed first while there's the most free slots */
+    Containers::Array<Containers::Pair<unsigned int, unsigned int>> fileBuckets{NoInit, count};
+    Containers::Array<unsigned int> bucketSizes{ValueInit, count};
+    for(unsigned int i = 0; i != count; ++i) {
+        const unsigned int bucket = resourceHash(files[i].filename, 0) % count;
+        fileBuckets[i] = {bucket, i};
+        ++bucketSizes[bucket];
+    }
+    std::stable_sort(fileBuckets.begin(), fileBuckets.end(), [&bucketSizes](const Containers::Pair<unsigned int, unsigned int>& a, const Containers::Pair<unsigned int, unsigned int>& b) {
+        return bucketSizes[a.first()] > bucketSizes[b.first()] ||
+            (bucketSizes[a.first()] == bucketSizes[b.first()] && a.first() < b.first());
+    });
+
+    Containers::Array<unsigned int> out{ValueInit, count*2};
+    Containers::Array<bool> occupied{ValueInit, count};
+    Containers::Array<unsigned int> slots{NoInit, count};
+    for(std::size_t begin = 0; begin != count; ) {
+        const unsigned int bucket = fileBuckets[begin].first();
+        const std::size_t end = begin + bucketSizes[bucket];
+
+        bool found = false;
+        for(unsigned int seed = 1; seed != 0x100000; ++seed) {
+            std::size_t i = begin;
+            for(; i != end; ++i) {
+                const unsigned int slot = resourceHash(files[fileBuckets[i].second()].filename, seed) % count;
+                /* The slot has to be free and not used by any other file from
+                   this bucket */
+                if(occupied[slot] || std::find(slots + begin, slots + i, slot) != slots + i) break;
+                slots[i] = slot;
+            }
+            if(i != end) continue;
+
+            out[2*bucket] = seed;
+            for(std::size_t j = begin; j != end; ++j) {
+                occupied[slots[j]] = true;
+                out[2*slots[j] + 1] = fileBuckets[j].second();
+            }
+            found = true;
+            break;
+        }
+
+        if(!found) return {};
+        begin = end;
+    }
+
+    return out;
+}
+
 /* Yeah, I know, macro hell, but I really want to turn this into a single
    compile-time literal in all three cases below instead of doing a ton of
    useless runtime concatenation and formatting. Tried copying it thrice before
@@ -135,10 +360,31 @@ inline bool lessFilename(const FileData& a, const FileData& b) {
 
 /* Compile data resource file. Resource name is the one to use in
    CORRADE_RESOURCE_INITIALIZE(), group name is the one to load the resources
-   from. Output is a C++ file with hexadecimal data representation. */
-Containers::String resourceCompile(const Containers::StringView name, const Containers::StringView group, const Containers::ArrayView<const FileData> files) {
+   from. Output is a C++ file with hexadecimal data representation.
+
+   If blob is not null, the data are put there instead and the C++ file
+   references them via an assembler .incbin directive, expecting the blob to
+   be saved to blobFilename. That avoids the compiler having to parse huge
+   array literals, which for large resources takes a lot of time and memory.
+
+   If cacheDirectory is not empty, results of compression are stored there,
+   keyed by a hash of the file contents, and reused on the next invocation for
+   files that didn't change. Entries that weren't used by this invocation are
+   removed from the directory. */
+Containers::String resourceCompile(const Containers::StringView name, const Containers::StringView group, const Containers::ArrayView<const FileData> files, const Containers::StringView blobFilename = {}, Containers::Array<char>* const blob = nullptr, const Containers::StringView cacheDirectory = {}) {
     using namespace Containers::Literals;
 
+    CORRADE_INTERNAL_ASSERT(!blob == blobFilename.isEmpty());
+
+    /* The blob filename gets put into a string literal that's then parsed
+       again by the assembler, so it'd need escaping twice. Not worth the
+       trouble, such paths can only really happen on Windows, where blobs
+       aren't supported anyway. */
+    if(blobFilename.containsAny("\\\"\n"_s)) {
+        Error{} << "    Error: blob filename" << blobFilename << "contains characters that can't be used in an assembler string";
+        return {};
+    }
+
     /* We're sorting by filename in order to have efficient lookup, which may
        not be as memory-efficient when alignment is involved. A more
        memory-efficient way to pack the data would be by sorting by alignment,
@@ -172,6 +418,9 @@ int corradeResourceInitializer_{0}() {{
     resource.positions = nullptr;
     resource.filenames = nullptr;
     resource.data = nullptr;
+    resource.hash = nullptr;
+    resource.compression = nullptr;
+    resource.decompressed = nullptr;
     Corrade::Utility::Resource::registerData(resource);
     return 1;
 }} CORRADE_AUTOMATIC_INITIALIZER(corradeResourceInitializer_{0})
@@ -184,8 +433,97 @@ int corradeResourceFinalizer_{0}() {{
 )", name, group);
     }
 
+    /* Only compressed data are cached, so don't create the cache directory
+       if there's nothing to compress */
+    bool cache = false;
+    if(cacheDirectory) for(const FileData& file: files) {
+        if(file.compress && file.data.size() >= ResourceCompressMinSize) {
+            cache = true;
+            break;
+        }
+    }
+    if(cache && !Path::make(cacheDirectory)) {
+        Error{} << "    Error: cannot create cache directory" << cacheDirectory;
+        return {};
+    }
+
+    /* Compress files that are requested to be compressed, are large enough
+       and where the compression actually saves space. Those are then stored
+       without any alignment or null termination, which is applied only when
+       decompressing. Done in parallel as it's the most expensive operation
+       together with the hexacode conversion below. */
+    struct StoredFile {
+        Containers::ArrayView<const char> data;
+        bool nullTerminated;
+        unsigned int align;
+        unsigned int padding;
+        Containers::Array<char> compressed;
+        std::string hexcode;
+        /* Name of the cache entry used by this file, if caching is enabled
+           and the file is meant to be compressed */
+        Containers::String compressedCacheEntry;
+        /* Errors printed while compressing the file, printed from the
+           calling thread afterwards to have them in a deterministic order */
+        Containers::String errors;
+    };
+    Containers::Array<StoredFile> storedFiles{files.size()};
+    resourceParallelFor(files.size(), [&](const std::size_t i) {
+        const FileData& file = files[i];
+        StoredFile& stored = storedFiles[i];
+        Error redirectError{&stored.errors};
+        stored.data = file.data;
+        stored.nullTerminated = file.nullTerminated;
+        stored.align = file.align;
+
+        if(!file.compress || file.data.size() < ResourceCompressMinSize)
+            return;
+
+        /* The compression result is cached even if it doesn't save any space,
+           to not attempt to compress incompressible files every time. The
+           cached data are verified to decompress back to the original
+           contents, which is significantly cheaper than compressing again and
+           guards against hash collisions and corrupted cache entries. */
+        Containers::Array<char> compressed;
+        if(cache) {
+            stored.compressedCacheEntry = format("{:.16x}-{:x}.lz4", resourceContentHash(file.data), file.data.size());
+            if(Containers::Optional<Containers::Array<char>> cached = resourceCacheRead(cacheDirectory, stored.compressedCacheEntry)) {
+                Containers::Array<char> decompressed{NoInit, file.data.size()};
+                if(resourceDecompress(*cached, decompressed) && std::memcmp(decompressed.data(), file.data.data(), file.data.size()) == 0)
+                    compressed = *Utility::move(cached);
+            }
+        }
+        if(!compressed) {
+            compressed = resourceCompress(file.data);
+            if(cache)
+                resourceCacheWrite(cacheDirectory, stored.compressedCacheEntry, compressed, i);
+        }
+
+        if(compressed.size() < file.data.size()) {
+            stored.compressed = Utility::move(compressed);
+            stored.data = stored.compressed;
+            stored.nullTerminated = false;
+            stored.align = 1;
+        }
+    });
+
+    std::string compression;
+    bool anyCompressed = false;
+    for(std::size_t i = 0; i != files.size(); ++i) {
+        const FileData& file = files[i];
+        const StoredFile& stored = storedFiles[i];
+        if(stored.compressed) {
+            anyCompressed = true;
+            formatInto(compression, compression.size(), "    0x{:.8x},0x{:.8x},\n", file.data.size(), file.align|(file.nullTerminated ? 1 << 8 : 0));
+        } else formatInto(compression, compression.size(), "    0x{:.8x},0x{:.8x},\n", 0, 0);
+    }
+    /* Remove last comma and newline, or everything if no file is compressed */
+    if(anyCompressed)
+        compression.resize(compression.size() - 2);
+    else
+        compression.clear();
+
     unsigned int maxAlign = 1;
-    for(const FileData& file: files) {
+    for(const StoredFile& file: storedFiles) {
         CORRADE_INTERNAL_ASSERT(file.align && file.align <= 128 && !(file.align & (file.align - 1)));
         maxAlign = max(maxAlign, file.align);
     }
@@ -193,9 +531,10 @@ int corradeResourceFinalizer_{0}() {{
     std::string positions, filenames, data;
     unsigned int filenamesLen = 0, dataLen = 0, minDataLen = 0;
 
-    /* Convert data to hexacodes */
+    /* Calculate file positions and padding */
     for(std::size_t i = 0; i != files.size(); ++i) {
         const FileData& file = files[i];
+        StoredFile& stored = storedFiles[i];
 
         filenamesLen += file.filename.size();
         /* The filenames shouldn't span more than 16 MB, because then it would
@@ -205,14 +544,14 @@ int corradeResourceFinalizer_{0}() {{
         /* Minimal data length to satisfy alignment -- for a non-empty file
            aligned to N bytes there has to be at least N bytes of data, even if
            the file is shorter than that */
-        if(file.data.size())
-            minDataLen = max(minDataLen, dataLen + file.align);
+        if(stored.data.size())
+            minDataLen = max(minDataLen, dataLen + stored.align);
 
-        dataLen += file.data.size();
+        dataLen += stored.data.size();
 
         /* Next file offset before alignment. Add a 1-byte padding if this file
            is meant to be null-terminated. */
-        const unsigned int nextOffset = dataLen + (file.nullTerminated ? 1 : 0);
+        const unsigned int nextOffset = dataLen + (stored.nullTerminated ? 1 : 0);
 
         /* Next file offset. If this is the last file, take into account the
            minimal data length given by alignment of any previous files.
@@ -221,7 +560,7 @@ int corradeResourceFinalizer_{0}() {{
         if(i == files.size() - 1) {
             nextOffsetAligned = max(nextOffset, minDataLen);
         } else {
-            const FileData& nextFile = files[i + 1];
+            const StoredFile& nextFile = storedFiles[i + 1];
             nextOffsetAligned = nextFile.align*((nextOffset + nextFile.align - 1)/nextFile.align);
         }
 
@@ -229,29 +568,137 @@ int corradeResourceFinalizer_{0}() {{
         dataLen = nextOffsetAligned;
 
         CORRADE_INTERNAL_ASSERT(padding < 256);
+        stored.padding = padding;
         formatInto(positions, positions.size(), "    0x{:.8x},0x{:.8x},\n", filenamesLen | (padding << 24), dataLen);
 
         formatInto(filenames, filenames.size(), "\n    /* {} */\n", file.filename);
         filenames += hexcode(Containers::StringView{file.filename});
+    }
+
+    /* Convert data to hexacodes in parallel, unless they go to a blob. The
+       conversion is cheap enough to not be worth caching, compared to reading
+       and verifying a cache entry. */
+    if(!blob) resourceParallelFor(files.size(), [&](const std::size_t i) {
+        StoredFile& stored = storedFiles[i];
+        stored.hexcode = hexcode(stored.data, stored.padding);
+    });
+
+    for(std::size_t i = 0; i != files.size(); ++i) {
+        const FileData& file = files[i];
+        StoredFile& stored = storedFiles[i];
+        /* Not using NoNewlineAtTheEnd as that wouldn't flush the output */
+        if(stored.errors)
+            Error{} << stored.errors.trimmedSuffix("\n");
+
+        formatInto(data, data.size(), "\n    /* {}{} */\n", file.filename, stored.compressed ? " (compressed)"_s : ""_s);
+
+        /* For a blob, copy the data and padding directly instead of
+           converting to hexacodes */
+        if(blob) {
+            arrayAppend(*blob, stored.data);
+            arrayAppend(*blob, ValueInit, stored.padding);
+        } else {
+            data += stored.hexcode;
+            /* Free the memory early, it can be quite a lot */
+            stored.hexcode = std::string{};
+        }
+    }
 
-        formatInto(data, data.size(), "\n    /* {} */\n", file.filename);
-        data += hexcode(file.data, padding);
+    /* Remove cache entries that weren't used by this invocation, so the cache
+       doesn't grow indefinitely as files change. Files that don't look like
+       cache entries are left untouched, as the directory may be shared with
+       something else. Done also if nothing got compressed this time, to not
+       leave stale entries behind if a file is no longer compressed. */
+    if(cacheDirectory && Path::exists(cacheDirectory)) {
+        Containers::Array<Containers::StringView> used;
+        for(const StoredFile& stored: storedFiles)
+            if(stored.compressedCacheEntry)
+                arrayAppend(used, stored.compressedCacheEntry);
+        std::sort(used.begin(), used.end());
+        if(Containers::Optional<Containers::Array<Containers::String>> entries = Path::list(cacheDirectory, Path::ListFlag::SkipDirectories|Path::ListFlag::SkipSpecial)) {
+            for(const Containers::String& entry: *entries)
+                if(resourceIsCacheEntry(entry) && !std::binary_search(used.begin(), used.end(), entry))
+                    Path::remove(Path::join(cacheDirectory, entry));
+        }
     }
 
+    /* Minimal perfect hash table for the lookup, if it can be built */
+    std::string hash;
+    const Containers::Array<unsigned int> hashTable = resourceHashTable(files);
+    for(std::size_t i = 0; i != hashTable.size(); i += 2)
+        formatInto(hash, hash.size(), "    0x{:.8x},0x{:.8x},\n", hashTable[i], hashTable[i + 1]);
+    if(!hash.empty())
+        hash.resize(hash.size() - 2);
+
     /* Remove last comma and newline from the positions and filenames array */
     positions.resize(positions.size() - 2);
     filenames.resize(filenames.size() - 2);
 
-    /* Remove last newline from the data array, remove also the preceding comma
-       if present (from either data or alignment) */
-    data.resize(data.size() - 1);
-    if(Containers::StringView{data}.hasSuffix(','))
+    /* Data array definition. If we don't have any data, we don't create the
+       resourceData array, as zero-length arrays are not allowed. */
+    Containers::String dataDeclaration, dataDefinition, dataPointer;
+    if(dataLen && blob) {
+        /* Can't be inside the anonymous namespace, as the symbol name has to
+           be known to the assembler. Hidden visibility to avoid it being
+           exported from shared libraries and to not need to go through GOT
+           when accessing it. The symbol name has the same uniqueness
+           guarantees as the initializer and finalizer functions below. */
+        dataDeclaration = format(R"(/* The data are in an external binary file, included by the assembler in order
+   to avoid the compiler overhead of parsing a huge array literal. Hash of the
+   blob contents is 0x{4:.16x}, ensuring this file changes every time
+   the blob does, which triggers a recompilation. */
+#if !defined(CORRADE_TARGET_UNIX) || !defined(CORRADE_TARGET_GCC)
+#error resource data in an external blob are supported only with GCC or Clang on Unix platforms
+#endif
+extern "C" __attribute__((visibility("hidden"))) const unsigned char corradeResourceBlob_{0}[];
+#ifdef CORRADE_TARGET_APPLE
+__asm__(
+    ".section __TEXT,__const\n"
+    ".globl _corradeResourceBlob_{0}\n"
+    ".private_extern _corradeResourceBlob_{0}\n"
+    ".balign {1}\n"
+    "_corradeResourceBlob_{0}:\n"
+    ".incbin \"{2}\"\n"
+    ".text\n");
+#else
+__asm__(
+    ".pushsection .rodata\n"
+    ".globl corradeResourceBlob_{0}\n"
+    ".hidden corradeResourceBlob_{0}\n"
+    ".type corradeResourceBlob_{0}, STT_OBJECT\n"
+    ".balign {1}\n"
+    "corradeResourceBlob_{0}:\n"
+    ".incbin \"{2}\"\n"
+    ".size corradeResourceBlob_{0}, {3}\n"
+    ".popsection\n");
+#endif
+
+)", name, maxAlign, blobFilename, dataLen, resourceContentHash(*blob));
+        dataPointer = format("corradeResourceBlob_{}", name);
+    } else {
+        /* Remove last newline from the data array, remove also the preceding
+           comma if present (from either data or alignment) */
         data.resize(data.size() - 1);
+        if(Containers::StringView{data}.hasSuffix(','))
+            data.resize(data.size() - 1);
+
+        dataDefinition = format(R"(
+{0}{1}const unsigned char resourceData[] = {{{2}
+{0}}};
+)",
+            dataLen ? ""_s : "// "_s,
+            maxAlign == 1 ? Containers::String{} :
+                format("alignas({}) ", maxAlign),
+            /* Cast to prevent ambiguity with std::format() when compiling as
+               C++20 */
+            /** @todo remove once this code is STL-free */
+            Containers::StringView{data});
+        dataPointer = dataLen ? "resourceData"_s : "nullptr"_s;
+    }
 
     /* Return C++ file. The functions have forward declarations to avoid warning
        about functions which don't have corresponding declarations (enabled by
-       -Wmissing-declarations in GCC). If we don't have any data, we don't
-       create the resourceData array, as zero-length arrays are not allowed. */
+       -Wmissing-declarations in GCC). */
     return format(R"(/* Compiled resource file. DO NOT EDIT! */
 
 #include "Corrade/Corrade.h"
@@ -260,7 +707,7 @@ int corradeResourceFinalizer_{0}() {{
 
 )" _CORRADE_RESOURCE_VERSION_CHECK R"(
 
-namespace {{
+{2}namespace {{
 
 /* Pair `i` is offset of filename `i + 1` in the low 24 bits, padding after
    data `i` in the upper 8 bits, and a 32bit offset of data `i + 1`. Offset of
@@ -269,50 +716,72 @@ const unsigned int resourcePositions[] = {{
 {0}
 }};
 
-const unsigned char resourceFilenames[] = {{{1}
+{8}const unsigned char resourceFilenames[] = {{{1}
 }};
-
-{2}{3}const unsigned char resourceData[] = {{{4}
-{2}}};
-
+{10}{3}
 Corrade::Utility::Implementation::ResourceGroup resource;
 
 }}
 
-int corradeResourceInitializer_{5}();
-int corradeResourceInitializer_{5}() {{
-    resource.name = "{6}";
-    resource.count = {7};
+int corradeResourceInitializer_{4}();
+int corradeResourceInitializer_{4}() {{
+    resource.name = "{5}";
+    resource.count = {6};
     resource.positions = resourcePositions;
     resource.filenames = resourceFilenames;
-    resource.data = {8};
+    resource.data = {7};
+    resource.hash = {9};
+    resource.compression = {11};
+    resource.decompressed = {12};
     Corrade::Utility::Resource::registerData(resource);
     return 1;
-}} CORRADE_AUTOMATIC_INITIALIZER(corradeResourceInitializer_{5})
+}} CORRADE_AUTOMATIC_INITIALIZER(corradeResourceInitializer_{4})
 
-int corradeResourceFinalizer_{5}();
-int corradeResourceFinalizer_{5}() {{
+int corradeResourceFinalizer_{4}();
+int corradeResourceFinalizer_{4}() {{
     Corrade::Utility::Resource::unregisterData(resource);
     return 1;
-}} CORRADE_AUTOMATIC_FINALIZER(corradeResourceFinalizer_{5})
+}} CORRADE_AUTOMATIC_FINALIZER(corradeResourceFinalizer_{4})
 )",
         /* Casts to prevent ambiguity with std::format() when compiling as
            C++20 */
         /** @todo remove once this code is STL-free */
         Containers::StringView{positions},      // 0
         Containers::StringView{filenames},      // 1
-        dataLen ? ""_s : "// "_s,               // 2
-        maxAlign == 1 ? Containers::String{} :  // 3
-            format("alignas({}) ", maxAlign),
-        Containers::StringView{data},           // 4
-        name,                                   // 5
-        group,                                  // 6
-        files.size(),                           // 7
-        dataLen ? "resourceData" : "nullptr"    // 8
+        dataDeclaration,                        // 2
+        dataDefinition,                         // 3
+        name,                                   // 4
+        group,                                  // 5
+        files.size(),                           // 6
+        dataPointer,                            // 7
+        hash.empty() ? Containers::String{} : format(R"(/* Pair `i` is a seed for bucket `i` and index of a file hashed to slot `i`
+   in a minimal perfect hash table of the filenames. */
+const unsigned int resourceHash[] = {{
+{}
+}};
+
+)", Containers::StringView{hash}),      // 8
+        hash.empty() ? "nullptr" : "resourceHash", // 9
+        anyCompressed ? format(R"(
+/* Pair `i` is size of file `i` after decompression and its alignment in the
+   lower 8 bits together with null termination in bit 8. Both are zero if the
+   file isn't compressed. */
+const unsigned int resourceCompression[] = {{
+{0}
+}};
+
+/* Compressed files get decompressed here on first access */
+const char* resourceDecompressed[{1}]{{}};
+)", Containers::StringView{compression}, files.size()) : Containers::String{}, // 10
+        anyCompressed ? "resourceCompression" : "nullptr", // 11
+        anyCompressed ? "resourceDecompressed" : "nullptr" // 12
     );
 }
 
-Containers::String resourceCompileFrom(const Containers::StringView name, const Containers::StringView configurationFile) {
+/* If blob is not null, the data are put there instead, if cacheDirectory is
+   not empty, it's used to cache results for unchanged files, see
+   resourceCompile() for details */
+Containers::String resourceCompileFrom(const Containers::StringView name, const Containers::StringView configurationFile, const Containers::StringView blobFilename = {}, Containers::Array<char>* const blob = nullptr, const Containers::StringView cacheDirectory = {}) {
     /* Resource file existence */
     /** @todo drop this and leave on the Configuration once it's reworked --
         i.e., an explicit flag to create it if it doesn't exist or some such,
@@ -338,6 +807,7 @@ Containers::String resourceCompileFrom(const Containers::StringView name, const
        padding would need to be 256 again to have the next file 256-bit
        aligned, which needs 9 bits. */
     const bool globalNullTerminated = conf.value<bool>("nullTerminated");
+    const bool globalCompress = conf.value<bool>("compress");
     /** @todo findValue(), once it exists */
     const unsigned int globalAlign = conf.hasValue("align") ?
         conf.value<unsigned int>("align") : 1;
@@ -346,10 +816,12 @@ Containers::String resourceCompileFrom(const Containers::StringView name, const
         return {};
     }
 
-    /* Load all files */
+    /* Gather options for all files */
     std::vector<const ConfigurationGroup*> files = conf.groups("file");
     Containers::Array<FileData> fileData;
+    Containers::Array<Containers::String> fileFilenames;
     arrayReserve(fileData, files.size());
+    arrayReserve(fileFilenames, files.size());
     for(const ConfigurationGroup* const file: files) {
         const Containers::StringView filename = file->value<Containers::StringView>("filename");
         const Containers::StringView alias = file->hasValue("alias") ? file->value<Containers::StringView>("alias") : filename;
@@ -363,6 +835,8 @@ Containers::String resourceCompileFrom(const Containers::StringView name, const
         /** @todo findValue(), once it exists */
         const bool nullTerminated = file->hasValue("nullTerminated") ?
             file->value<bool>("nullTerminated") : globalNullTerminated;
+        const bool compress = file->hasValue("compress") ?
+            file->value<bool>("compress") : globalCompress;
         const unsigned int align = file->hasValue("align") ?
             file->value<unsigned int>("align") : globalAlign;
         if(!align || align > 128 || align & (align- 1)) {
@@ -370,18 +844,31 @@ Containers::String resourceCompileFrom(const Containers::StringView name, const
             return {};
         }
 
-        Containers::Optional<Containers::Array<char>> contents = Path::read(Path::join(path, filename));
-        if(!contents) {
-            Error() << "    Error: cannot open file" << filename << "of file" << fileData.size()+1 << "in group" << group;
+        arrayAppend(fileData, InPlaceInit, alias, nullTerminated, align, compress, nullptr);
+        arrayAppend(fileFilenames, Path::join(path, filename));
+    }
+
+    /* Load all files in parallel. Errors are printed from the calling thread
+       afterwards to have them in a deterministic order. */
+    Containers::Array<Containers::String> fileErrors{files.size()};
+    resourceParallelFor(files.size(), [&](const std::size_t i) {
+        Error redirectError{&fileErrors[i]};
+        if(Containers::Optional<Containers::Array<char>> contents = Path::read(fileFilenames[i]))
+            fileData[i].data = *Utility::move(contents);
+        else
+            Error{} << "    Error: cannot open file" << files[i]->value<Containers::StringView>("filename") << "of file" << i + 1 << "in group" << group;
+    });
+    for(const Containers::String& errors: fileErrors) {
+        if(errors) {
+            Error{} << errors.trimmedSuffix("\n");
             return {};
         }
-        arrayAppend(fileData, InPlaceInit, alias, nullTerminated, align, *std::move(contents));
     }
 
     /* The list has to be sorted before passing it to compile() */
     std::sort(fileData.begin(), fileData.end(), lessFilename);
 
-    return resourceCompile(name, group, fileData);
+    return resourceCompile(name, group, fileData, blobFilename, blob, cacheDirectory);
 }
 
 Containers::String resourceCompileSingle(const Containers::StringView name, const Containers::StringView filename) {
@@ -0,0 +1,70 @@
+#ifndef Corrade_Utility_Implementation_fileWatcher_h
+#define Corrade_Utility_Implementation_fileWatcher_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Corrade/Containers/Containers.h"
+
+/* inotify_init1() is available on Android only since API 21 */
+#if defined(__linux__) && !(defined(CORRADE_TARGET_ANDROID) && __ANDROID_API__ < 21)
+#define CORRADE_UTILITY_FILEWATCHER_INOTIFY
+#endif
+
+namespace Corrade { namespace Utility { namespace Implementation {
+
+#ifdef CORRADE_UTILITY_FILEWATCHER_INOTIFY
+/* Adds a watch to the inotify instance shared by all FileWatcher and
+   DirectoryWatcher instances, creating it if it doesn't exist yet. A file
+   watch, used by FileWatcher, is marked dirty on events affecting given file,
+   in which case the path is expected to be null-terminated. A directory
+   watch, used by DirectoryWatcher, is marked dirty on events affecting any
+   entry in given directory. The watch is initially dirty. Returns
+   ~std::size_t{} if inotify can't be used for given path. */
+std::size_t fileWatcherAddWatch(Containers::StringView path, bool directory);
+
+void fileWatcherRemoveWatch(std::size_t id);
+
+/* Returns true if the watch is dirty, resetting the dirty state, or if
+   inotify no longer watches the containing directory. For a file watch the
+   filename is used to watch a file that got replaced. */
+bool fileWatcherWatchDirty(std::size_t id, const char* filename);
+
+/* Reads all pending events from the shared inotify instance and marks the
+   affected watches as dirty. Used by FileWatcher::hasChanged() and by
+   FileWatchSet::changedFiles() and DirectoryWatcher::changes(), which then
+   check all their watches without any additional syscalls. */
+void fileWatcherProcessEvents();
+
+/* Blocks until there are events to read or the timeout expires. Expects that
+   the caller has at least one watch. */
+void fileWatcherWaitForEvents(std::size_t milliseconds);
+#endif
+
+}}}
+
+#endif
@@ -29,8 +29,11 @@
 #include <string>
 #include <set>
 #include <tuple>
+#include <utility>
 #include <vector>
 
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringStl.h"
 #include "Corrade/Utility/FileWatcher.h"
 #include "Corrade/Utility/Tweakable.h"
 
@@ -49,8 +52,42 @@ struct TweakableVariable {
     void* scopeUserData{};
 };
 
-CORRADE_UTILITY_EXPORT std::string findTweakableAlias(const std::string& file);
-CORRADE_UTILITY_EXPORT TweakableState parseTweakables(const std::string& name, const std::string& filename, const std::string& data, std::vector<TweakableVariable>& variables, std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>>& scopes);
+/* Result of the last scan of a file, used to scan only the changed part the
+   next time */
+struct TweakableParseCache {
+    /* Alias and contents of the file the annotations were found in */
+    std::string name;
+    Containers::String data;
+    /* Offset and line of each annotation, indexed by the variable ID */
+    std::vector<std::pair<std::size_t, int>> annotations;
+    /* False if there's no usable result, for example if the scan failed or
+       if some annotations didn't have a parser yet */
+    bool valid{};
+};
+
+/* Annotation offsets and lines gathered during a scan, and the previous ones
+   the scan can stop at once it gets to the part of the data that didn't
+   change */
+struct TweakableParseRecord {
+    std::vector<std::pair<std::size_t, int>> annotations;
+    bool allKnown = true;
+
+    const std::vector<std::pair<std::size_t, int>>* previous{};
+    /* Where the unchanged suffix begins in the new and previous data */
+    std::size_t suffixBegin, previousSuffixBegin;
+};
+
+CORRADE_UTILITY_EXPORT std::string findTweakableAlias(Containers::StringView file);
+/* Scans the whole file */
+CORRADE_UTILITY_EXPORT TweakableState parseTweakables(Containers::StringView name, Containers::StringView filename, Containers::StringView data, std::vector<TweakableVariable>& variables, std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>>& scopes);
+/* Parses the data from given position, which is expected to be outside of
+   any comment or literal, and at given line and variable index. If record is
+   non-null, it gets filled with found annotations. Used only internally by
+   the parseTweakables() overloads. */
+TweakableState parseTweakablesFrom(Containers::StringView name, Containers::StringView filename, Containers::StringView data, std::size_t pos, int line, std::size_t variable, TweakableParseRecord* record, std::vector<TweakableVariable>& variables, std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>>& scopes);
+/* Scans only the part that changed since the previous scan, if possible, and
+   updates the cache */
+CORRADE_UTILITY_EXPORT TweakableState parseTweakables(Containers::StringView name, Containers::StringView filename, Containers::String&& data, TweakableParseCache& cache, std::vector<TweakableVariable>& variables, std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>>& scopes);
 
 }}}
 
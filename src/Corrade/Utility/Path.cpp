@@ -45,6 +45,11 @@
 
 #include <cstdio> /* std::fopen(), FILE, std::remove(), std::rename() */
 #include <algorithm> /* std::sort() */
+#if defined(CORRADE_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
 
 /* Checking for API level on Android */
 #ifdef CORRADE_TARGET_ANDROID
@@ -104,6 +109,7 @@
 #include "Corrade/Containers/String.h"
 #include "Corrade/Containers/StringIterable.h"
 #include "Corrade/Utility/Debug.h"
+#include "Corrade/Utility/PathListEntry.h"
 
 #if defined(__unix__) || defined(CORRADE_TARGET_EMSCRIPTEN) || defined(CORRADE_TARGET_WINDOWS)
 #include "Corrade/Utility/String.h" /* lowercase(), replaceAll() on Windows */
@@ -958,6 +964,310 @@ Containers::Optional<Containers::Array<Containers::String>> list(const Container
     #endif
 }
 
+Debug& operator<<(Debug& debug, const ListEntryType value) {
+    debug << "Utility::Path::ListEntryType" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case ListEntryType::value: return debug << "::" #value;
+        _c(File)
+        _c(Directory)
+        _c(Special)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << static_cast<unsigned char>(value) << Debug::nospace << ")";
+}
+
+namespace {
+
+#if defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+#if defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN)
+/* Same as in lastModification() below, see the comment there for details */
+std::int64_t modificationTime(const struct stat& result) {
+    return
+        #ifdef CORRADE_TARGET_APPLE
+        std::uint64_t(result.st_mtimespec.tv_sec)*1000000000 + std::uint64_t(result.st_mtimespec.tv_nsec)
+        #elif defined(st_mtime)
+        std::uint64_t(result.st_mtim.tv_sec)*1000000000 + std::uint64_t(result.st_mtim.tv_nsec)
+        #else
+        std::uint64_t(result.st_mtime)*1000000000
+        #endif
+        ;
+}
+#endif
+
+/* Appends entries of the directory at `path` to `out`, with `prefix` joined
+   to their names. If `subdirectories` is non-null, `.` and `..` are skipped
+   and subdirectories to descend into are appended there, again with `prefix`
+   joined. Prints a message and returns false if the directory can't be
+   opened, except for when it doesn't exist and `skipMissing` is set, which
+   is used for subdirectories that got removed since they were listed. */
+bool listEntriesInto(const char* const messagePrefix, const Containers::StringView path, const Containers::StringView prefix, const ListFlags flags, Containers::Array<ListEntry>& out, Containers::Array<Containers::String>* const subdirectories, const bool skipMissing) {
+    /* POSIX-compliant Unix, Emscripten */
+    #if defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    DIR* const directory = opendir(Containers::String::nullTerminatedView(path).data());
+    if(!directory) {
+        /* The directory got removed or replaced with a file */
+        if(skipMissing && (errno == ENOENT || errno == ENOTDIR))
+            return true;
+
+        Error err;
+        err << messagePrefix << "can't list" << path << Debug::nospace << ":";
+        Utility::Implementation::printErrnoErrorString(err, errno);
+        return false;
+    }
+    Containers::ScopeGuard closeDirectory{directory, closedir};
+    const int fd = dirfd(directory);
+
+    dirent* entry;
+    while((entry = readdir(directory)) != nullptr) {
+        const Containers::StringView name = entry->d_name;
+        if((subdirectories || flags >= ListFlag::SkipDotAndDotDot) && (name == "."_s || name == ".."_s))
+            continue;
+
+        /* If the type is known already, skip the entry without querying its
+           metadata. Directories have to be listed when recursing even if
+           they're skipped, symlinks and entries of an unknown type have to be
+           queried to know what they are. Emscripten doesn't set DT_REG for
+           files, so it's just directories there. */
+        if(!subdirectories && flags >= ListFlag::SkipDirectories && entry->d_type == DT_DIR)
+            continue;
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        if(flags >= ListFlag::SkipFiles && entry->d_type == DT_REG)
+            continue;
+        #endif
+
+        /* Query the metadata relative to the directory handle, which avoids
+           resolving the whole path again for every entry. fstatat() follows
+           symlinks by default, if that fails it's most likely a broken link,
+           so query the link itself. If even that fails, the entry got removed
+           since it was listed, so skip it. */
+        struct stat st;
+        if(fstatat(fd, entry->d_name, &st, 0) != 0 &&
+           fstatat(fd, entry->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+            continue;
+
+        ListEntryType type;
+        if(S_ISDIR(st.st_mode))
+            type = ListEntryType::Directory;
+        else if(S_ISREG(st.st_mode))
+            type = ListEntryType::File;
+        else
+            type = ListEntryType::Special;
+
+        /* Descend into directories, but not into symlinks to directories to
+           avoid cycles. If the filesystem doesn't report entry types, we have
+           to check whether it's a link explicitly. */
+        if(subdirectories && type == ListEntryType::Directory && entry->d_type != DT_LNK) {
+            struct stat linkSt;
+            if(entry->d_type != DT_UNKNOWN || (fstatat(fd, entry->d_name, &linkSt, AT_SYMLINK_NOFOLLOW) == 0 && !S_ISLNK(linkSt.st_mode)))
+                arrayAppend(*subdirectories, join(prefix, name));
+        }
+
+        if((flags >= ListFlag::SkipDirectories && type == ListEntryType::Directory) ||
+           (flags >= ListFlag::SkipFiles && type == ListEntryType::File) ||
+           (flags >= ListFlag::SkipSpecial && type == ListEntryType::Special))
+            continue;
+
+        arrayAppend(out, ListEntry{join(prefix, name),
+            type == ListEntryType::File ? std::size_t(st.st_size) : 0,
+            modificationTime(st), type});
+    }
+
+    /* Windows (not Store/Phone) */
+    #elif defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)
+    WIN32_FIND_DATAW data;
+    HANDLE hFile = FindFirstFileW(Unicode::widen(join(path, "*"_s)), &data);
+    if(hFile == INVALID_HANDLE_VALUE) {
+        const DWORD error = GetLastError();
+        /* The directory got removed or replaced with a file */
+        if(skipMissing && (error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND || error == ERROR_DIRECTORY))
+            return true;
+
+        Error err;
+        err << messagePrefix << "can't list" << path << Debug::nospace << ":";
+        Utility::Implementation::printWindowsErrorString(err, error);
+        return false;
+    }
+    Containers::ScopeGuard closeHandle{hFile,
+        #ifdef CORRADE_MSVC2015_COMPATIBILITY
+        /* MSVC 2015 is unable to cast the parameter for FindClose */
+        [](HANDLE hFile){ FindClose(hFile); }
+        #else
+        FindClose
+        #endif
+    };
+
+    /* The metadata are a part of the listing, so there's nothing else to
+       query. Unlike list(), the first found entry isn't skipped, so `.` is
+       listed the same way as on other systems. */
+    do {
+        Containers::String name = Unicode::narrow(data.cFileName);
+        if((subdirectories || flags >= ListFlag::SkipDotAndDotDot) && (name == "."_s || name == ".."_s))
+            continue;
+
+        const ListEntryType type = data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ? ListEntryType::Directory : ListEntryType::File;
+
+        /* Don't descend into symlinks or junctions to avoid cycles */
+        if(subdirectories && type == ListEntryType::Directory && !(data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT))
+            arrayAppend(*subdirectories, join(prefix, name));
+
+        if((flags >= ListFlag::SkipDirectories && type == ListEntryType::Directory) ||
+           (flags >= ListFlag::SkipFiles && type == ListEntryType::File))
+            continue;
+
+        /* FILETIME is in 100-nanosecond units since January 1, 1601, convert
+           to nanoseconds since the Unix epoch */
+        const std::int64_t time = (std::int64_t((std::uint64_t(data.ftLastWriteTime.dwHighDateTime) << 32)|data.ftLastWriteTime.dwLowDateTime) - 116444736000000000ll)*100;
+        arrayAppend(out, ListEntry{join(prefix, name),
+            type == ListEntryType::File ? std::size_t((std::uint64_t(data.nFileSizeHigh) << 32)|data.nFileSizeLow) : 0,
+            time, type});
+    } while(FindNextFileW(hFile, &data) != 0);
+    #else
+    #error
+    #endif
+
+    return true;
+}
+
+void sortEntries(Containers::Array<ListEntry>& entries, const ListFlags flags) {
+    if(flags & (ListFlag::SortAscending|ListFlag::SortDescending))
+        std::sort(entries.begin(), entries.end(), [](const ListEntry& a, const ListEntry& b) {
+            return a.name < b.name;
+        });
+    /* Same as in list(), just reverse the result */
+    if(flags >= ListFlag::SortDescending && !(flags >= ListFlag::SortAscending))
+        std::reverse(entries.begin(), entries.end());
+}
+#endif
+
+}
+
+Containers::Optional<Containers::Array<ListEntry>> listEntries(const Containers::StringView path, const ListFlags flags) {
+    #if defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Array<ListEntry> entries;
+    if(!listEntriesInto("Utility::Path::listEntries():", path, {}, flags, entries, nullptr, false))
+        return {};
+
+    sortEntries(entries, flags);
+
+    /* GCC 4.8 needs extra help here */
+    return Containers::optional(Utility::move(entries));
+
+    /* Other not implemented */
+    #else
+    Error{} << "Utility::Path::listEntries(): not implemented on this platform";
+    static_cast<void>(path);
+    static_cast<void>(flags);
+    return {};
+    #endif
+}
+
+Containers::Optional<Containers::Array<ListEntry>> listEntriesRecursive(const Containers::StringView path, const ListFlags flags, std::size_t threadCount) {
+    #if defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    constexpr const char* messagePrefix = "Utility::Path::listEntriesRecursive():";
+
+    /* List the top-level directory directly, which gives us the initial set
+       of subdirectories to distribute among the threads */
+    Containers::Array<ListEntry> entries;
+    Containers::Array<Containers::String> directories;
+    if(!listEntriesInto(messagePrefix, path, {}, flags, entries, &directories, false))
+        return {};
+
+    #if defined(CORRADE_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+    if(!threadCount)
+        threadCount = std::thread::hardware_concurrency();
+    if(threadCount > 1 && !directories.isEmpty()) {
+        std::mutex mutex;
+        std::condition_variable condition;
+        /* Count of threads currently listing a directory. If it's zero and
+           there are no directories left, everything is done. */
+        std::size_t busy = 0;
+        bool failed = false;
+
+        /* Errors are printed into a string on each thread and then printed
+           from the calling thread afterwards to make them go to wherever the
+           caller redirected them */
+        auto worker = [&](Containers::Array<ListEntry>& out, Containers::String& errors) {
+            Error redirectError{&errors};
+            Containers::Array<Containers::String> found;
+            std::unique_lock<std::mutex> lock{mutex};
+            for(;;) {
+                condition.wait(lock, [&]() {
+                    return failed || !directories.isEmpty() || !busy;
+                });
+                if(failed || directories.isEmpty()) break;
+
+                const Containers::String directory = Utility::move(directories.back());
+                arrayRemoveSuffix(directories);
+                ++busy;
+                lock.unlock();
+
+                const bool listed = listEntriesInto(messagePrefix, join(path, directory), directory, flags, out, &found, true);
+
+                lock.lock();
+                --busy;
+                if(!listed)
+                    failed = true;
+                for(Containers::String& i: found)
+                    arrayAppend(directories, Utility::move(i));
+                arrayClear(found);
+                condition.notify_all();
+            }
+        };
+
+        /* The calling thread takes a part of the work as well, putting the
+           entries directly to the output */
+        Containers::Array<Containers::Array<ListEntry>> threadEntries{threadCount - 1};
+        Containers::Array<Containers::String> threadErrors{threadCount};
+        Containers::Array<std::thread> threads{threadCount - 1};
+        for(std::size_t i = 0; i != threads.size(); ++i)
+            threads[i] = std::thread{[&worker, &threadEntries, &threadErrors, i]() {
+                worker(threadEntries[i], threadErrors[i]);
+            }};
+        worker(entries, threadErrors.back());
+        for(std::thread& thread: threads)
+            thread.join();
+
+        for(const Containers::String& errors: threadErrors)
+            if(errors)
+                Error{Debug::Flag::NoNewlineAtTheEnd} << errors;
+        if(failed)
+            return {};
+
+        for(Containers::Array<ListEntry>& i: threadEntries)
+            for(ListEntry& entry: i)
+                arrayAppend(entries, Utility::move(entry));
+    } else
+    #else
+    static_cast<void>(threadCount);
+    #endif
+    {
+        while(!directories.isEmpty()) {
+            const Containers::String directory = Utility::move(directories.back());
+            arrayRemoveSuffix(directories);
+            if(!listEntriesInto(messagePrefix, join(path, directory), directory, flags, entries, &directories, true))
+                return {};
+        }
+    }
+
+    sortEntries(entries, flags);
+
+    /* GCC 4.8 needs extra help here */
+    return Containers::optional(Utility::move(entries));
+
+    /* Other not implemented */
+    #else
+    Error{} << "Utility::Path::listEntriesRecursive(): not implemented on this platform";
+    static_cast<void>(path);
+    static_cast<void>(flags);
+    static_cast<void>(threadCount);
+    return {};
+    #endif
+}
+
 namespace {
 
 /* Used by size() and read(). Returns NullOpt if the file is not seekable
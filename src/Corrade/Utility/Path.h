@@ -561,7 +561,7 @@ passed to system APIs.
     @ref ListFlag::SkipFiles and @ref ListFlag::SkipDirectories affects the
     link target, not the link itself. This behavior is not implemented on
     Windows at the moment.
-@see @ref isDirectory(), @ref exists()
+@see @ref isDirectory(), @ref exists(), @ref listEntries()
 */
 CORRADE_UTILITY_EXPORT Containers::Optional<Containers::Array<Containers::String>> list(Containers::StringView path, ListFlags flags = {});
 
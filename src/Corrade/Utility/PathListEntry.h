@@ -0,0 +1,161 @@
+#ifndef Corrade_Utility_PathListEntry_h
+#define Corrade_Utility_PathListEntry_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Corrade::Utility::Path::ListEntry, enum @ref Corrade::Utility::Path::ListEntryType, function @ref Corrade::Utility::Path::listEntries(), @ref Corrade::Utility::Path::listEntriesRecursive()
+ * @m_since_latest
+ */
+
+#include <cstdint> /* std::int64_t */
+
+#include "Corrade/Containers/String.h"
+#include "Corrade/Utility/Path.h"
+#include "Corrade/Utility/Utility.h"
+
+namespace Corrade { namespace Utility { namespace Path {
+
+/**
+@brief Directory entry type
+@m_since_latest
+
+@see @ref ListEntry, @ref listEntries(), @ref listEntriesRecursive()
+*/
+enum class ListEntryType: unsigned char {
+    /** Regular file */
+    File,
+
+    /** Directory */
+    Directory,
+
+    /**
+     * Anything that is not a file or a directory, such as a device, a socket
+     * or a broken symlink. Not produced on @ref CORRADE_TARGET_WINDOWS "Windows",
+     * as there's no concept of a special file.
+     */
+    Special
+};
+
+/**
+@debugoperatorenum{ListEntryType}
+@m_since_latest
+*/
+CORRADE_UTILITY_EXPORT Debug& operator<<(Debug& debug, ListEntryType value);
+
+/**
+@brief Directory entry
+@m_since_latest
+
+@see @ref listEntries(), @ref listEntriesRecursive()
+*/
+struct ListEntry {
+    /**
+     * Entry name. In case of @ref listEntriesRecursive() it's a path relative
+     * to the listed directory, with forward slashes as separators.
+     */
+    Containers::String name;
+
+    /**
+     * File size in bytes. Set to @cpp 0 @ce for directories and special
+     * files.
+     */
+    std::size_t size;
+
+    /**
+     * Last modification timestamp. Same as what @ref lastModification()
+     * returns for the entry.
+     */
+    std::int64_t lastModification;
+
+    /** Entry type */
+    ListEntryType type;
+};
+
+/**
+@brief List directory contents including file metadata
+@m_since_latest
+
+Like @ref list(), but in addition to the name it returns also the type, size
+and last modification time of each entry, gathered during a single pass over
+the directory. Compared to calling @ref isDirectory(), @ref size() and
+@ref lastModification() for each item returned by @ref list(), which each open
+the file by its full path, this queries the metadata relative to the already
+opened directory handle and only once for each entry. On Windows the metadata
+are already a part of the directory listing and no additional system calls are
+made at all.
+
+If @p path is not a directory or it can't be opened, prints a message to
+@ref Error and returns @ref Containers::NullOpt. Entries that disappear while
+the directory is being listed are omitted. The @p flags are interpreted the
+same way as in @ref list(), sorting is done by the entry name.
+
+Expects that the @p path is in UTF-8. If it's already
+@ref Containers::StringViewFlag::NullTerminated, it's passed to system APIs
+directly, otherwise a null-terminated copy is allocated first. On Windows the
+path is instead first converted to UTF-16 using @ref Unicode::widen() and then
+passed to system APIs.
+@partialsupport On @ref CORRADE_TARGET_UNIX "Unix" platforms and
+    @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", symlinks are followed and
+    the metadata as well as the effect of @ref ListFlag::SkipFiles,
+    @ref ListFlag::SkipDirectories and @ref ListFlag::SkipSpecial is of the
+    link target, not the link itself. Symlinks that can't be followed are
+    treated as @ref ListEntryType::Special. This behavior is not implemented
+    on Windows at the moment.
+@see @ref listEntriesRecursive()
+*/
+CORRADE_UTILITY_EXPORT Containers::Optional<Containers::Array<ListEntry>> listEntries(Containers::StringView path, ListFlags flags = {});
+
+/**
+@brief Recursively list directory contents including file metadata
+@m_since_latest
+
+Like @ref listEntries(), but descends into all subdirectories, with
+@ref ListEntry::name containing the path relative to @p path. The `.` and `..`
+entries are never included. @ref ListFlag::SkipDirectories only omits the
+directories from the output, their contents are still listed. Symlinks to
+directories are listed but not descended into, to avoid infinite recursion.
+
+The directories are listed on @p threadCount threads, with the calling thread
+taking a part of the work as well. Setting it to @cpp 0 @ce uses as many
+threads as there's CPU cores. If Corrade isn't built with
+@ref CORRADE_BUILD_MULTITHREADED or on @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten",
+the directories are always listed on the calling thread only. If neither
+@ref ListFlag::SortAscending nor @ref ListFlag::SortDescending is specified,
+the order of entries is unspecified, and if multiple threads are used, it can
+be different every time.
+
+If @p path or any of its subdirectories can't be opened, prints a message to
+@ref Error and returns @ref Containers::NullOpt. Subdirectories that get
+removed while the tree is being listed are silently skipped, same as entries
+that disappear in @ref listEntries(). See @ref listEntries() for
+more information about path encoding and platform-specific behavior.
+*/
+CORRADE_UTILITY_EXPORT Containers::Optional<Containers::Array<ListEntry>> listEntriesRecursive(Containers::StringView path, ListFlags flags = {}, std::size_t threadCount = 1);
+
+}}}
+
+#endif
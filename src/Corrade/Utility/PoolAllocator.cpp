@@ -0,0 +1,263 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PoolAllocator.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <atomic>
+#include <new>
+#ifdef CORRADE_TARGET_WINDOWS
+#include <malloc.h>
+#endif
+
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/Macros.h" /* CORRADE_THREAD_LOCAL */
+
+namespace Corrade { namespace Utility {
+
+namespace {
+
+/* Chunks are aligned to their size so the chunk header can be found from any
+   pointer inside by just masking the low bits away */
+constexpr std::size_t ChunkSize = 64*1024;
+constexpr std::size_t SizeClassCount = PoolAllocatorMaxSize/PoolAllocatorAlignment;
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+struct ThreadCache;
+
+struct Chunk {
+    /* Never changes after the chunk is created. Thread caches are never
+       deleted, only handed over to another thread when the owning thread
+       exits, so the pointer stays valid forever. */
+    ThreadCache* owner;
+    std::size_t sizeClass;
+};
+
+/* Keep the first block aligned */
+constexpr std::size_t ChunkHeaderSize = (sizeof(Chunk) + PoolAllocatorAlignment - 1)/PoolAllocatorAlignment*PoolAllocatorAlignment;
+
+struct ThreadCache {
+    /* Blocks freed by the owning thread */
+    FreeBlock* free[SizeClassCount];
+    /* Unused remainder of the last chunk of each size class */
+    char* bump[SizeClassCount];
+    char* bumpEnd[SizeClassCount];
+    /* Blocks freed by other threads, of any size class. Multiple producers
+       push, only the owning thread takes the whole list at once, so there's
+       no ABA problem. */
+    std::atomic<FreeBlock*> remoteFree;
+    /* Next in the list of caches whose thread exited */
+    ThreadCache* nextOrphan;
+};
+
+inline std::size_t sizeClassFor(const std::size_t size) {
+    return size ? (size - 1)/PoolAllocatorAlignment : 0;
+}
+
+inline Chunk* chunkFor(void* const data) {
+    return reinterpret_cast<Chunk*>(reinterpret_cast<std::uintptr_t>(data) & ~std::uintptr_t(ChunkSize - 1));
+}
+
+Chunk* allocateChunk() {
+    void* data;
+    #ifdef CORRADE_TARGET_UNIX
+    CORRADE_INTERNAL_ASSERT_OUTPUT(posix_memalign(&data, ChunkSize, ChunkSize) == 0);
+    #elif defined(CORRADE_TARGET_WINDOWS)
+    data = _aligned_malloc(ChunkSize, ChunkSize);
+    CORRADE_INTERNAL_ASSERT(data);
+    #else
+    /* Chunks are never freed, so there's no need to remember the original
+       pointer and the padding can be simply discarded */
+    char* const unaligned = static_cast<char*>(std::malloc(2*ChunkSize - 1));
+    CORRADE_INTERNAL_ASSERT(unaligned);
+    data = reinterpret_cast<void*>((reinterpret_cast<std::uintptr_t>(unaligned) + ChunkSize - 1) & ~std::uintptr_t(ChunkSize - 1));
+    #endif
+    return static_cast<Chunk*>(data);
+}
+
+ThreadCache* createThreadCache() {
+    /* The cache itself is never freed, so plain new is fine. Value-initialized
+       to have all lists and bump pointers null. */
+    return new ThreadCache{};
+}
+
+#ifdef CORRADE_BUILD_MULTITHREADED
+/* Caches of threads that exited. Accessed only on thread start and exit, so a
+   spinlock is enough. */
+std::atomic_flag orphansLock = ATOMIC_FLAG_INIT;
+ThreadCache* orphans = nullptr;
+
+ThreadCache* acquireThreadCache() {
+    while(orphansLock.test_and_set(std::memory_order_acquire));
+    ThreadCache* const cache = orphans;
+    if(cache) orphans = cache->nextOrphan;
+    orphansLock.clear(std::memory_order_release);
+    return cache ? cache : createThreadCache();
+}
+
+void releaseThreadCache(ThreadCache* const cache) {
+    while(orphansLock.test_and_set(std::memory_order_acquire));
+    cache->nextOrphan = orphans;
+    orphans = cache;
+    orphansLock.clear(std::memory_order_release);
+}
+
+/* The library is usually loaded at startup, so the initial-exec model can be
+   used for the two variables below, avoiding a __tls_get_addr() call on every
+   access. Makes the allocation fast path about twice as fast on Linux. */
+#if defined(CORRADE_TARGET_GCC) && defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_APPLE) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#define CORRADE_POOL_ALLOCATOR_TLS_MODEL __attribute__((tls_model("initial-exec")))
+#else
+#define CORRADE_POOL_ALLOCATOR_TLS_MODEL
+#endif
+
+/* Kept as a plain pointer separate from the guard below to avoid the TLS
+   initialization wrapper on every access */
+CORRADE_THREAD_LOCAL CORRADE_POOL_ALLOCATOR_TLS_MODEL ThreadCache* currentThreadCache = nullptr;
+CORRADE_THREAD_LOCAL CORRADE_POOL_ALLOCATOR_TLS_MODEL bool currentThreadExited = false;
+
+struct ThreadCacheGuard {
+    ~ThreadCacheGuard() {
+        releaseThreadCache(currentThreadCache);
+        currentThreadCache = nullptr;
+        currentThreadExited = true;
+    }
+};
+
+ThreadCache& threadCache() {
+    if CORRADE_LIKELY(currentThreadCache) return *currentThreadCache;
+
+    currentThreadCache = acquireThreadCache();
+    /* If the thread is already exiting (i.e., the allocation happens from a
+       destructor of a thread-local object that got destructed after the
+       guard), registering the guard again isn't possible. The cache then
+       stays with the exited thread and isn't reused by any other, which is
+       a rare enough corner case to not care about. */
+    if(!currentThreadExited) {
+        static thread_local ThreadCacheGuard guard;
+        static_cast<void>(guard);
+    }
+    return *currentThreadCache;
+}
+
+inline ThreadCache* threadCacheIfAny() {
+    return currentThreadCache;
+}
+#else
+ThreadCache* globalCache = nullptr;
+
+ThreadCache& threadCache() {
+    if CORRADE_UNLIKELY(!globalCache) globalCache = createThreadCache();
+    return *globalCache;
+}
+
+inline ThreadCache* threadCacheIfAny() {
+    return globalCache;
+}
+#endif
+
+/* Moves all blocks freed by other threads to the local free lists */
+void drainRemoteFree(ThreadCache& cache) {
+    FreeBlock* block = cache.remoteFree.exchange(nullptr, std::memory_order_acquire);
+    while(block) {
+        FreeBlock* const next = block->next;
+        const std::size_t sizeClass = chunkFor(block)->sizeClass;
+        block->next = cache.free[sizeClass];
+        cache.free[sizeClass] = block;
+        block = next;
+    }
+}
+
+}
+
+void* poolAllocate(const std::size_t size) {
+    if(size > PoolAllocatorMaxSize) return ::operator new(size);
+
+    ThreadCache& cache = threadCache();
+    const std::size_t sizeClass = sizeClassFor(size);
+
+    /* Fast path, a block in the local free list */
+    if(FreeBlock* const block = cache.free[sizeClass]) {
+        cache.free[sizeClass] = block->next;
+        return block;
+    }
+
+    /* Take back whatever other threads freed, try again */
+    if(cache.remoteFree.load(std::memory_order_relaxed)) {
+        drainRemoteFree(cache);
+        if(FreeBlock* const block = cache.free[sizeClass]) {
+            cache.free[sizeClass] = block->next;
+            return block;
+        }
+    }
+
+    /* Carve out of the current chunk, allocate a new one if there's no space
+       left */
+    const std::size_t blockSize = (sizeClass + 1)*PoolAllocatorAlignment;
+    if(std::size_t(cache.bumpEnd[sizeClass] - cache.bump[sizeClass]) < blockSize) {
+        Chunk* const chunk = allocateChunk();
+        chunk->owner = &cache;
+        chunk->sizeClass = sizeClass;
+        cache.bump[sizeClass] = reinterpret_cast<char*>(chunk) + ChunkHeaderSize;
+        cache.bumpEnd[sizeClass] = reinterpret_cast<char*>(chunk) + ChunkSize;
+    }
+
+    void* const out = cache.bump[sizeClass];
+    cache.bump[sizeClass] += blockSize;
+    return out;
+}
+
+void poolDeallocate(void* const data, const std::size_t size) {
+    if(!data) return;
+    if(size > PoolAllocatorMaxSize) {
+        ::operator delete(data);
+        return;
+    }
+
+    Chunk* const chunk = chunkFor(data);
+    CORRADE_INTERNAL_DEBUG_ASSERT(chunk->sizeClass == sizeClassFor(size));
+    FreeBlock* const block = static_cast<FreeBlock*>(data);
+
+    /* Freeing from the owning thread, put it into the local free list */
+    ThreadCache* const owner = chunk->owner;
+    if(owner == threadCacheIfAny()) {
+        block->next = owner->free[chunk->sizeClass];
+        owner->free[chunk->sizeClass] = block;
+        return;
+    }
+
+    /* Otherwise hand it over to the owner */
+    FreeBlock* head = owner->remoteFree.load(std::memory_order_relaxed);
+    do {
+        block->next = head;
+    } while(!owner->remoteFree.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+}
+
+}}
@@ -0,0 +1,228 @@
+#ifndef Corrade_Utility_PoolAllocator_h
+#define Corrade_Utility_PoolAllocator_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Utility::PoolAllocated, @ref Corrade::Utility::Pooled, function @ref Corrade::Utility::poolAllocate(), @ref Corrade::Utility::poolDeallocate(), @ref Corrade::Utility::poolPointer(), @ref Corrade::Utility::pooled()
+ * @m_since_latest
+ */
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Corrade/Containers/Pointer.h"
+#include "Corrade/Utility/Move.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Utility {
+
+/**
+@brief Largest allocation size served by the pool allocator
+@m_since_latest
+
+Allocations larger than this value are passed through to the global
+@cpp operator new @ce and @cpp operator delete @ce.
+@see @ref poolAllocate()
+*/
+constexpr std::size_t PoolAllocatorMaxSize = 256;
+
+/**
+@brief Alignment of allocations served by the pool allocator
+@m_since_latest
+
+@see @ref poolAllocate()
+*/
+constexpr std::size_t PoolAllocatorAlignment = 16;
+
+/**
+@brief Allocate a small object from a thread-local pool
+@m_since_latest
+
+Meant for short-lived small objects that are created and destroyed at a high
+rate, such as signal connections or heap-allocated @ref Containers::Function
+state. The allocation is rounded up to a multiple of
+@ref PoolAllocatorAlignment and served from a per-thread free list of given
+size class, which means that in the common case no locking and no system
+allocator calls are involved. If the free list is empty, memory is taken from
+a 64 kB chunk owned by the calling thread, a new chunk is allocated from the
+system only once the current one is exhausted. Sizes larger than
+@ref PoolAllocatorMaxSize are passed through to the global
+@cpp operator new @ce.
+
+The returned memory is aligned to @ref PoolAllocatorAlignment bytes and has to
+be freed with @ref poolDeallocate() with the same @p size. It can be freed
+from any thread --- if freed from a thread different from the one that
+allocated it, it's returned to the owning thread via a lock-free queue and
+reused by it on a subsequent allocation. When a thread exits, its pool is
+handed over to the next thread that starts allocating, so memory that's still
+referenced or freed later isn't lost.
+
+Memory taken by the pool is never returned back to the system, only reused for
+subsequent allocations. If @ref CORRADE_BUILD_MULTITHREADED is not enabled, a
+single pool is shared by all threads and the allocator isn't thread-safe.
+@see @ref PoolAllocated, @ref poolPointer(), @ref pooled()
+*/
+CORRADE_UTILITY_EXPORT void* poolAllocate(std::size_t size);
+
+/**
+@brief Free a small object allocated from a thread-local pool
+@m_since_latest
+
+Expects that @p data was allocated with @ref poolAllocate() with the same
+@p size. Passing a @cpp nullptr @ce is a no-op. See @ref poolAllocate() for
+more information.
+*/
+CORRADE_UTILITY_EXPORT void poolDeallocate(void* data, std::size_t size);
+
+/**
+@brief Base for pool-allocated classes
+@m_since_latest
+
+Provides class-specific @cpp operator new @ce and @cpp operator delete @ce
+that delegate to @ref poolAllocate() and @ref poolDeallocate(). Deriving a
+class from it makes all its heap allocations go through the pool, including
+allocations done by @ref Containers::Pointer, @ref Containers::pointer() or
+heap-stored @ref Containers::Function state:
+
+@snippet Utility.cpp PoolAllocated
+
+If a class hierarchy is deleted through a base pointer, the base has to have a
+virtual destructor, as otherwise the size passed to the deallocation function
+wouldn't match. Types with alignment larger than @ref PoolAllocatorAlignment
+aren't supported. For wrapping existing types that can't be modified use
+@ref Pooled instead.
+*/
+class PoolAllocated {
+    public:
+        /** @brief Allocate from the pool */
+        static void* operator new(std::size_t size) {
+            return poolAllocate(size);
+        }
+
+        /** @brief Free to the pool */
+        static void operator delete(void* data, std::size_t size) {
+            poolDeallocate(data, size);
+        }
+
+    protected:
+        ~PoolAllocated() = default;
+};
+
+/**
+@brief Pool-allocated wrapper of an existing type
+@m_since_latest
+
+Derives from @p T and @ref PoolAllocated, making heap allocations of the
+wrapped type go through @ref poolAllocate(). Useful for types that can't be
+modified to derive from @ref PoolAllocated directly, such as lambdas. Created
+either directly or through @ref poolPointer() and @ref pooled().
+
+The type always has a non-trivial destructor, which means a
+@cpp Containers::Pointer<Pooled<T>> @ce can be converted to a
+@cpp Containers::Pointer<T> @ce only if @p T has a virtual destructor. This
+prevents the pool-allocated memory from being accidentally freed through the
+global @cpp operator delete @ce. For the same reason, a lambda wrapped in
+@ref Pooled is always stored out-of-line in a @ref Containers::Function,
+never inline.
+*/
+template<class T> class Pooled: public T, public PoolAllocated {
+    static_assert(alignof(T) <= PoolAllocatorAlignment, "overaligned types can't be pool-allocated");
+    static_assert(!std::is_base_of<PoolAllocated, T>::value, "the type is already pool-allocated, use it directly");
+
+    public:
+        /**
+         * @brief Construct the wrapped type in-place
+         *
+         * Passes @p args to the constructor of @p T.
+         */
+        template<class First, class ...Next> explicit Pooled(Corrade::InPlaceInitT, First&& first, Next&&... next): T{Utility::forward<First>(first), Utility::forward<Next>(next)...} {}
+
+        /**
+         * @brief Default-construct the wrapped type in-place
+         *
+         * Same as in @ref Containers::Pointer, the @cpp () @ce instead of
+         * @cpp {} @ce works around a featurebug in C++ where @cpp T{} @ce
+         * doesn't work for an explicit defaulted constructor.
+         */
+        explicit Pooled(Corrade::InPlaceInitT): T() {}
+
+        /** @brief Copy-construct the wrapped type */
+        /*implicit*/ Pooled(const T& other): T(other) {}
+
+        /** @brief Move-construct the wrapped type */
+        /*implicit*/ Pooled(T&& other): T(Utility::move(other)) {}
+
+        /** @brief Copy constructor */
+        Pooled(const Pooled<T>&) = default;
+
+        /** @brief Move constructor */
+        Pooled(Pooled<T>&&) = default;
+
+        /* Deliberately non-trivial, see the class docs for why */
+        ~Pooled() {}
+
+        /** @brief Copy assignment */
+        Pooled<T>& operator=(const Pooled<T>&) = default;
+
+        /** @brief Move assignment */
+        Pooled<T>& operator=(Pooled<T>&&) = default;
+
+};
+
+/**
+@brief Make a pool-allocated unique pointer
+@m_since_latest
+
+Pool-allocated equivalent to @ref Containers::pointer(Args&&... args). If
+@p T has a virtual destructor, the returned value can be converted to a
+@cpp Containers::Pointer<T> @ce or a pointer to any of its bases:
+
+@snippet Utility.cpp poolPointer
+
+For types that derive from @ref PoolAllocated directly, the regular
+@ref Containers::pointer() is sufficient.
+*/
+template<class T, class ...Args> inline Containers::Pointer<Pooled<T>> poolPointer(Args&&... args) {
+    return Containers::Pointer<Pooled<T>>{new Pooled<T>{Corrade::InPlaceInit, Utility::forward<Args>(args)...}};
+}
+
+/**
+@brief Wrap a lambda or a functor for pool allocation
+@m_since_latest
+
+Useful for making a stateful lambda that's too large to be stored inline in a
+@ref Containers::Function allocated from the pool instead of the global heap:
+
+@snippet Utility.cpp pooled
+*/
+template<class F> inline Pooled<typename std::decay<F>::type> pooled(F&& f) {
+    return Pooled<typename std::decay<F>::type>{Utility::forward<F>(f)};
+}
+
+}}
+
+#endif
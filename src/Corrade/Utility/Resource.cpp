@@ -26,7 +26,14 @@
 
 #include "Resource.h"
 
+#include <cstdint>
 #include <map> /* overrideGroups :( */
+#ifdef CORRADE_BUILD_MULTITHREADED
+#include <mutex>
+#ifdef CORRADE_BUILD_STARTUP_PROFILING
+#include <atomic>
+#endif
+#endif
 
 #include "Corrade/Containers/Optional.h"
 #include "Corrade/Containers/Pair.h"
@@ -37,6 +44,9 @@
 #include "Corrade/Utility/Configuration.h"
 #include "Corrade/Utility/ConfigurationGroup.h"
 #include "Corrade/Utility/Path.h"
+#ifdef CORRADE_BUILD_STARTUP_PROFILING
+#include "Corrade/Utility/StartupProfile.h"
+#endif
 #include "Corrade/Utility/Implementation/Resource.h"
 
 #if defined(CORRADE_TARGET_WINDOWS) && defined(CORRADE_BUILD_STATIC_UNIQUE_GLOBALS) && !defined(CORRADE_TARGET_WINDOWS_RT)
@@ -124,42 +134,172 @@ struct Resource::OverrideData {
     explicit OverrideData(const Containers::StringView filename): conf(filename) {}
 };
 
+namespace {
+
+#ifdef CORRADE_BUILD_MULTITHREADED
+/* Guards Implementation::ResourceGroup::decompressed. Held only for reading or
+   writing the pointers, the decompression itself happens outside. */
+std::mutex decompressedMutex;
+#endif
+
+/* The buffer is over-allocated to fit the alignment, so the aligned pointer
+   is calculated from the allocated one each time instead of being stored */
+inline const char* alignDecompressed(const char* const data, const unsigned int align) {
+    return reinterpret_cast<const char*>((reinterpret_cast<std::uintptr_t>(data) + align - 1) & ~std::uintptr_t(align - 1));
+}
+
+Containers::StringView decompressedDataAt(const Implementation::ResourceGroup& group, const unsigned int i) {
+    const std::size_t size = group.compression[2*i];
+    const unsigned int align = group.compression[2*i + 1] & 0xff;
+    const bool nullTerminated = group.compression[2*i + 1] & (1 << 8);
+
+    const char* data;
+    {
+        #ifdef CORRADE_BUILD_MULTITHREADED
+        std::lock_guard<std::mutex> lock{decompressedMutex};
+        #endif
+        data = group.decompressed[i];
+    }
+
+    /* Not decompressed yet. If some other thread decompresses the same file
+       in the meantime, the first one to finish wins and the others discard
+       their copy. */
+    if(!data) {
+        char* const decompressed = new char[size + align - 1 + (nullTerminated ? 1 : 0)];
+        char* const aligned = const_cast<char*>(alignDecompressed(decompressed, align));
+        CORRADE_INTERNAL_ASSERT_OUTPUT(Implementation::resourceDecompress(Implementation::resourceDataAt(group.positions, group.data, i), {aligned, size}));
+        if(nullTerminated) aligned[size] = '\0';
+
+        #ifdef CORRADE_BUILD_MULTITHREADED
+        std::lock_guard<std::mutex> lock{decompressedMutex};
+        #endif
+        if(!group.decompressed[i]) {
+            group.decompressed[i] = decompressed;
+            data = decompressed;
+        } else {
+            delete[] decompressed;
+            data = group.decompressed[i];
+        }
+    }
+
+    /* Not global, as the data get freed when the group is unregistered */
+    return {alignDecompressed(data, align), size, nullTerminated ? Containers::StringViewFlag::NullTerminated : Containers::StringViewFlags{}};
+}
+
+}
+
 void Resource::registerData(Implementation::ResourceGroup& resource) {
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    const std::uint64_t start = Implementation::startupProfileTimestamp();
+    #endif
     Containers::Implementation::forwardListInsert(resourceGlobals.groups, resource);
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    Implementation::recordStartupProfileEvent(StartupProfileEventType::ResourceGroupRegister, resource.name, start);
+    #endif
 }
 
 void Resource::unregisterData(Implementation::ResourceGroup& resource) {
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    const std::uint64_t start = Implementation::startupProfileTimestamp();
+    #endif
     Containers::Implementation::forwardListRemove(resourceGlobals.groups, resource);
+    /* Free data decompressed so far. The group can be registered again, so
+       reset the pointers as well. */
+    if(resource.decompressed) {
+        #ifdef CORRADE_BUILD_MULTITHREADED
+        std::lock_guard<std::mutex> lock{decompressedMutex};
+        #endif
+        for(std::size_t i = 0; i != resource.count; ++i) {
+            delete[] resource.decompressed[i];
+            resource.decompressed[i] = nullptr;
+        }
+    }
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    Implementation::recordStartupProfileEvent(StartupProfileEventType::ResourceGroupUnregister, resource.name, start);
+    #endif
 }
 
 namespace {
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    std::atomic<bool> firstLookupDone{};
+    #else
+    bool firstLookupDone{};
+    #endif
+
+    /* Returns a timestamp if no group lookup was done yet, zero otherwise. The
+       caller then passes it to recordFirstLookup() once the whole operation
+       is done. */
+    std::uint64_t firstLookupStart() {
+        return firstLookupDone ? 0 : Implementation::startupProfileTimestamp();
+    }
+
+    void recordFirstLookup(const std::uint64_t start, const Implementation::ResourceGroup* const group) {
+        if(!start) return;
+        #ifdef CORRADE_BUILD_MULTITHREADED
+        if(firstLookupDone.exchange(true)) return;
+        #else
+        if(firstLookupDone) return;
+        firstLookupDone = true;
+        #endif
+        /* The lookup name isn't guaranteed to be global, so the group name is
+           recorded instead */
+        Implementation::recordStartupProfileEvent(StartupProfileEventType::ResourceFirstLookup, group ? group->name : nullptr, start);
+    }
+    #endif
+
     Implementation::ResourceGroup* findGroup(const Containers::StringView name) {
-        for(Implementation::ResourceGroup* group = resourceGlobals.groups; group; group = Containers::Implementation::forwardListNext(*group)) {
-            if(group->name == name) return group;
+        Implementation::ResourceGroup* group = resourceGlobals.groups;
+        for(; group; group = Containers::Implementation::forwardListNext(*group)) {
+            if(group->name == name) break;
         }
 
-        return nullptr;
+        return group;
     }
 }
 
 void Resource::overrideGroup(const Containers::StringView group, const Containers::StringView configurationFile) {
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    const std::uint64_t start = firstLookupStart();
+    #endif
+
     if(!resourceGlobals.overrideGroups) {
         static std::map<Containers::StringView, Containers::String> overrideGroups;
         resourceGlobals.overrideGroups = &overrideGroups;
     }
 
-    CORRADE_ASSERT(findGroup(group),
+    #if defined(CORRADE_BUILD_STARTUP_PROFILING) || !defined(CORRADE_NO_ASSERT)
+    const Implementation::ResourceGroup* const found = findGroup(group);
+    #endif
+    CORRADE_ASSERT(found,
         "Utility::Resource::overrideGroup(): group '" << Debug::nospace << group << Debug::nospace << "' was not found", );
     /* This group can be already overridden from before, so insert if not there
        yet and then update the filename */
     resourceGlobals.overrideGroups->emplace(group, Containers::String{}).first->second = Containers::String::nullTerminatedGlobalView(configurationFile);
+
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    recordFirstLookup(start, found);
+    #endif
 }
 
 bool Resource::hasGroup(const Containers::StringView group) {
-    return findGroup(group);
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    const std::uint64_t start = firstLookupStart();
+    #endif
+    const Implementation::ResourceGroup* const found = findGroup(group);
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    recordFirstLookup(start, found);
+    #endif
+    return found;
 }
 
-Resource::Resource(const Containers::StringView group): _group{findGroup(group)}, _overrideGroup(nullptr) {
+Resource::Resource(const Containers::StringView group): _group{}, _overrideGroup{} {
+    /* The group lookup is done here and not in the initializer list so the
+       first lookup profiling spans also the override configuration parsing */
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    const std::uint64_t start = firstLookupStart();
+    #endif
+    _group = findGroup(group);
     CORRADE_ASSERT(_group, "Utility::Resource: group '" << Debug::nospace << group << Debug::nospace << "' was not found", );
 
     if(resourceGlobals.overrideGroups) {
@@ -176,6 +316,10 @@ Resource::Resource(const Containers::StringView group): _group{findGroup(group)}
                 << group << Debug::nospace << "'";
         }
     }
+
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    recordFirstLookup(start, _group);
+    #endif
 }
 
 Resource::~Resource() {
@@ -192,7 +336,7 @@ Containers::StringIterable Resource::list() const {
 
 bool Resource::hasFile(const Containers::StringView filename) const {
     CORRADE_INTERNAL_ASSERT(_group);
-    return Implementation::resourceLookup(_group->count, _group->positions, _group->filenames, filename) != _group->count;
+    return Implementation::resourceLookup(_group->count, _group->positions, _group->hash, _group->filenames, filename) != _group->count;
 }
 
 Containers::ArrayView<const char> Resource::getRaw(const Containers::StringView filename) const {
@@ -208,7 +352,7 @@ Containers::StringView Resource::getString(const Containers::StringView filename
     /* Look for the file in compiled-in resources. This is done before looking
        into an overriden group configuration file to prevent retrieving files
        that aren't compiled in. */
-    const unsigned int i = Implementation::resourceLookup(_group->count, _group->positions, _group->filenames, filename);
+    const unsigned int i = Implementation::resourceLookup(_group->count, _group->positions, _group->hash, _group->filenames, filename);
     CORRADE_ASSERT(i != _group->count,
         "Utility::Resource::get(): file '" << Debug::nospace << filename << Debug::nospace << "' was not found in group '" << Debug::nospace << _group->name << Debug::nospace << "'", {});
 
@@ -245,6 +389,10 @@ Containers::StringView Resource::getString(const Containers::StringView filename
             << filename << Debug::nospace << "' was not found in overridden group, fallback to compiled-in resources";
     }
 
+    /* Compressed files get decompressed on first access */
+    if(_group->compression && _group->compression[2*i])
+        return decompressedDataAt(*_group, i);
+
     return Implementation::resourceDataAt(_group->positions, _group->data, i);
 }
 
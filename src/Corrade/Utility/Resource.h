@@ -118,6 +118,12 @@ care of dependency management --- if either the configuration file or any files
 referenced by it are changed, it triggers a recompilation of the resources,
 same as with usual C++ sources.
 
+For large resource groups, the hexadecimal representation can take a long time
+and a lot of memory to compile. With GCC and Clang on Unix platforms, the
+`BLOB` option of the macro puts the data into a separate binary file included
+directly by the assembler instead, see @ref corrade-rc-blob for details. The
+runtime @ref Resource API is the same in both cases.
+
 The variable name also acts as a name used for symbols in the generated file
 --- it has to be a valid C identifier and has to be unique among all resources
 compiled into the same executable. But apart from that, you'd need the name
@@ -190,6 +196,39 @@ nullTerminated=false
 align=4
 @endcode
 
+@subsection Utility-Resource-compilation-compress Resource compression
+
+Large compressible files such as text, shader sources or uncompressed data can
+be stored compressed using @cb{.ini} compress=true @ce. The compression uses
+the LZ4 block format, with the compressor and decompressor built into
+@ref corrade-rc "corrade-rc" and the library itself, so no external dependency
+is needed. Files smaller than 256 bytes and files for which the compression
+doesn't save any space are stored as-is. Same as the other options, it can be
+specified either globally or for particular @cb{.ini} [file] @ce section:
+
+@code{.ini}
+group=data
+
+# All files are compressed by default
+compress=true
+
+[file]
+filename=level.json
+
+# Already compressed, so the compression wouldn't help
+[file]
+filename=texture.png
+compress=false
+@endcode
+
+A compressed file is decompressed on its first access through @ref getRaw() or
+@ref getString() into a heap-allocated buffer that's then cached until the
+resource group is unregistered, so subsequent accesses are as cheap as for
+uncompressed files. Because the buffer is freed on unregistration, views on
+compressed files don't have @ref Containers::StringViewFlag::Global set. The
+@cb{.ini} nullTerminated @ce and @cb{.ini} align @ce options are applied to the
+decompressed data.
+
 @section Utility-Resource-usage Accessing the resources
 
 If you compiled the resources directly into an executable or into a shared
@@ -255,12 +294,18 @@ access or other operations that could potentially fail. With the exception of
 @ref overrideGroup(), no memory allocation or heap access is involved when
 constructing a @ref Resource instance or calling any of its APIs. If
 @ref overrideGroup() is used, @ref getRaw() and @ref getString() accesses the
-filesystem and allocates.
+filesystem and allocates. A @ref Utility-Resource-compilation-compress "compressed file"
+is decompressed into a newly allocated buffer on its first access, subsequent
+accesses reuse the buffer. The buffer is freed when the resource group is
+unregistered.
 
 The group lookup during construction and @ref hasGroup() is done with a
 @f$ \mathcal{O}(n) @f$ complexity as the resource groups register themselves
 into a linked list. Actual file lookup after is done in-place on the
-compiled-in data in a @f$ \mathcal{O}(\log{}n) @f$ time.
+compiled-in data in a @f$ \mathcal{O}(1) @f$ time using a minimal perfect hash
+table generated by @ref corrade-rc "corrade-rc" together with the data. For
+the rare case where the hash table construction fails, the lookup falls back to
+a binary search in @f$ \mathcal{O}(\log{}n) @f$ time.
 
 @section Utility-Resource-multithreading Thread safety
 
@@ -272,7 +317,10 @@ single thread or externally guarded to avoid data races. Same goes for the
 @ref overrideGroup() function.
 
 On the other hand, all other functionality only reads from the global storage
-and thus is thread-safe.
+and thus is thread-safe. First access to a
+@ref Utility-Resource-compilation-compress "compressed file" publishes the
+decompressed data under a lock, so it's thread-safe as well if
+@ref CORRADE_BUILD_MULTITHREADED is enabled.
 
 @todo Ad-hoc resources
  */
@@ -346,10 +394,15 @@ class CORRADE_UTILITY_EXPORT Resource {
          * @ref Path::read(), and unless the file is coming from an
          * @ref Utility-Resource-override "overriden group", no OS-specific
          * treatment of non-null-terminated strings nor any encoding conversion
-         * is done --- this function never allocates.
+         * is done --- this function never allocates except for the
+         * first access of a @ref Utility-Resource-compilation-compress "compressed file".
          *
-         * Unless the file is coming from an overriden group, the returned view
-         * can be assumed to have unlimited lifetime, otherwise it's alive
+         * Unless the file is coming from an overriden group or is
+         * @ref Utility-Resource-compilation-compress "compressed", the
+         * returned view can be assumed to have unlimited lifetime. Data of a
+         * compressed file are alive until the resource group is unregistered,
+         * which for groups compiled into the executable is the end of the
+         * program. If the file is coming from an overriden group, it's alive
          * only until the next @ref overrideGroup() call on the same group. The
          * data pointer is aligned according to the @cb{.ini} align @ce option
          * if it was set for given file. If the file is coming from an
@@ -372,10 +425,15 @@ class CORRADE_UTILITY_EXPORT Resource {
          * @ref Path::read(), and unless the file is coming from an
          * @ref Utility-Resource-override "overriden group", no OS-specific
          * treatment of non-null-terminated filenames nor any encoding
-         * conversion is done --- this function never allocates.
+         * conversion is done --- this function never allocates except for the
+         * first access of a @ref Utility-Resource-compilation-compress "compressed file".
          *
          * The returned string has @ref Containers::StringViewFlag::Global set
-         * unless it's coming from an overriden group, otherwise it's alive
+         * unless it's coming from an overriden group or is
+         * @ref Utility-Resource-compilation-compress "compressed". Data of a
+         * compressed file are alive until the resource group is unregistered,
+         * which for groups compiled into the executable is the end of the
+         * program. If the file is coming from an overriden group, it's alive
          * only until the next @ref overrideGroup() call on the same group. The
          * data pointer is aligned according to the @cb{.ini} align @ce option
          * if it was set for given file. If the file is coming from an
@@ -487,7 +545,7 @@ of application execution. It's also safe to call this macro more than once.
 Gets embedded in files generated by @ref corrade-rc "corrade-rc" in order to
 ensure they match the internal layout expected by the library.
 */
-#define CORRADE_RESOURCE_VERSION 2
+#define CORRADE_RESOURCE_VERSION 4
 
 namespace Implementation {
 
@@ -497,6 +555,17 @@ struct ResourceGroup {
     const unsigned int* positions;
     const unsigned char* filenames;
     const unsigned char* data;
+    /* Minimal perfect hash table for filename lookup, pair `i` is a seed for
+       bucket `i` and index of a file hashed to slot `i`. Can be null, in
+       which case a binary search is used. */
+    const unsigned int* hash;
+    /* Pair `i` is size of file `i` after decompression and its alignment
+       together with null termination flag, both zero if the file isn't
+       compressed. Null if no file is compressed. */
+    const unsigned int* compression;
+    /* Storage for data of compressed files, decompressed on first access.
+       Null if no file is compressed. */
+    const char** decompressed;
     /* This field shouldn't be written to by anything else than
        corradeResourceInitializer_*() / corradeResourceFinalizer_*(). It's
        zero-initialized by default and those use it to avoid inserting a single
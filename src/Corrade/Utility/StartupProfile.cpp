@@ -0,0 +1,205 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "StartupProfile.h"
+
+#ifdef CORRADE_BUILD_STARTUP_PROFILING
+#include <chrono>
+#ifdef CORRADE_BUILD_MULTITHREADED
+#include <atomic>
+#endif
+#endif
+
+#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringView.h"
+#include "Corrade/Utility/Debug.h"
+#include "Corrade/Utility/DebugAssert.h"
+#include "Corrade/Utility/JsonWriter.h"
+
+namespace Corrade { namespace Utility {
+
+namespace {
+
+constexpr const char* StartupProfileEventTypeNames[]{
+    "StaticPluginImport",
+    "StaticPluginEject",
+    "ResourceGroupRegister",
+    "ResourceGroupUnregister",
+    "ResourceFirstLookup"
+};
+
+constexpr std::size_t StartupProfileEventTypeCount = Containers::arraySize(StartupProfileEventTypeNames);
+
+#ifdef CORRADE_BUILD_STARTUP_PROFILING
+#ifdef CORRADE_BUILD_MULTITHREADED
+typedef std::atomic<std::size_t> Counter;
+#else
+typedef std::size_t Counter;
+#endif
+
+/* All of these are zero-initialized before any global constructors are
+   executed, which means static plugins and resources registered from there
+   get recorded as well */
+struct StartupProfileGlobals {
+    StartupProfileEvent events[StartupProfileMaxEventCount];
+    /* Index of the next event to write, can go past the event count, in which
+       case the event is dropped */
+    Counter next;
+    Counter counts[StartupProfileEventTypeCount];
+} startupProfileGlobals;
+#endif
+
+}
+
+Debug& operator<<(Debug& debug, const StartupProfileEventType value) {
+    debug << "Utility::StartupProfileEventType" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case StartupProfileEventType::value: return debug << "::" #value;
+        _c(StaticPluginImport)
+        _c(StaticPluginEject)
+        _c(ResourceGroupRegister)
+        _c(ResourceGroupUnregister)
+        _c(ResourceFirstLookup)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << std::uint8_t(value) << Debug::nospace << ")";
+}
+
+Containers::ArrayView<const StartupProfileEvent> startupProfileEvents() {
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    const std::size_t next = startupProfileGlobals.next;
+    return Containers::arrayView(startupProfileGlobals.events).prefix(next < StartupProfileMaxEventCount ? next : StartupProfileMaxEventCount);
+    #else
+    return {};
+    #endif
+}
+
+std::size_t startupProfileEventCount(const StartupProfileEventType type) {
+    CORRADE_DEBUG_ASSERT(std::uint8_t(type) && std::uint8_t(type) <= StartupProfileEventTypeCount,
+        "Utility::startupProfileEventCount(): invalid type" << type, {});
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    return startupProfileGlobals.counts[std::uint8_t(type) - 1];
+    #else
+    #ifdef CORRADE_NO_DEBUG_ASSERT
+    static_cast<void>(type);
+    #endif
+    return 0;
+    #endif
+}
+
+std::size_t startupProfileDroppedEventCount() {
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    const std::size_t next = startupProfileGlobals.next;
+    return next > StartupProfileMaxEventCount ? next - StartupProfileMaxEventCount : 0;
+    #else
+    return 0;
+    #endif
+}
+
+Containers::String startupProfileReport() {
+    JsonWriter json{JsonWriter::Option::Wrap|JsonWriter::Option::TypographicalSpace, 2};
+    json.beginObject()
+        .writeKey("events").beginArray();
+
+    /* The event may not be fully written yet if it's being recorded from
+       another thread, in which case the type is still zero */
+    const auto isComplete = [](const StartupProfileEvent& event) {
+        return std::uint8_t(event.type) && std::uint8_t(event.type) <= StartupProfileEventTypeCount;
+    };
+
+    /* Events are recorded when they end, so an event enclosing other events
+       is recorded after them, with an earlier start. Make the timestamps
+       relative to the earliest start instead of to the first event. */
+    const Containers::ArrayView<const StartupProfileEvent> events = startupProfileEvents();
+    std::uint64_t earliest = ~std::uint64_t{};
+    for(const StartupProfileEvent& event: events)
+        if(isComplete(event) && event.timestamp < earliest)
+            earliest = event.timestamp;
+
+    for(const StartupProfileEvent& event: events) {
+        json.beginObject()
+            .writeKey("type");
+        if(isComplete(event))
+            json.write(StartupProfileEventTypeNames[std::uint8_t(event.type) - 1]);
+        else
+            json.write(nullptr);
+        json.writeKey("name");
+        if(event.name)
+            json.write(event.name);
+        else
+            json.write(nullptr);
+        json.writeKey("timestamp");
+        if(isComplete(event))
+            json.write(event.timestamp - earliest)
+                .writeKey("duration").write(event.duration);
+        else
+            json.write(nullptr)
+                .writeKey("duration").write(nullptr);
+        json.endObject();
+    }
+
+    json.endArray()
+        .writeKey("counts").beginObject();
+    for(std::size_t i = 0; i != StartupProfileEventTypeCount; ++i)
+        json.writeKey(StartupProfileEventTypeNames[i])
+            .write(std::uint64_t(startupProfileEventCount(StartupProfileEventType(i + 1))));
+    json.endObject()
+        .writeKey("droppedEvents").write(std::uint64_t(startupProfileDroppedEventCount()))
+        .endObject();
+
+    return json.toString();
+}
+
+#ifdef CORRADE_BUILD_STARTUP_PROFILING
+namespace Implementation {
+
+std::uint64_t startupProfileTimestamp() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void recordStartupProfileEvent(const StartupProfileEventType type, const char* const name, const std::uint64_t start) {
+    const std::uint64_t end = startupProfileTimestamp();
+    ++startupProfileGlobals.counts[std::uint8_t(type) - 1];
+
+    const std::size_t index = startupProfileGlobals.next++;
+    if(index >= StartupProfileMaxEventCount) return;
+
+    StartupProfileEvent& event = startupProfileGlobals.events[index];
+    event.name = name;
+    event.timestamp = start;
+    event.duration = end - start;
+    event.type = type;
+}
+
+}
+#endif
+
+}}
@@ -0,0 +1,230 @@
+#ifndef Corrade_Utility_StartupProfile_h
+#define Corrade_Utility_StartupProfile_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Corrade::Utility::StartupProfileEvent, enum @ref Corrade::Utility::StartupProfileEventType, function @ref Corrade::Utility::startupProfileEvents(), @ref Corrade::Utility::startupProfileEventCount(), @ref Corrade::Utility::startupProfileDroppedEventCount(), @ref Corrade::Utility::startupProfileReport()
+ * @m_since_latest
+ */
+
+#include <cstdint>
+
+#include "Corrade/Containers/Containers.h"
+#include "Corrade/Utility/Utility.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Utility {
+
+/**
+@brief Startup profile event type
+@m_since_latest
+
+@see @ref StartupProfileEvent, @ref startupProfileEventCount()
+*/
+enum class StartupProfileEventType: unsigned char {
+    /* Zero reserved for an invalid value */
+
+    /**
+     * A static plugin was imported into a plugin manager. Recorded for each
+     * @ref PluginManager::Manager instance the plugin belongs to, the
+     * duration spans parsing the plugin metadata and calling its
+     * initializer. The @relativeref{StartupProfileEvent,name} is the plugin
+     * name.
+     */
+    StaticPluginImport = 1,
+
+    /**
+     * A static plugin was ejected from a plugin manager on its destruction.
+     * The duration spans calling the plugin finalizer. The
+     * @relativeref{StartupProfileEvent,name} is the plugin name.
+     */
+    StaticPluginEject,
+
+    /**
+     * A resource group was registered, either from a global constructor or
+     * via @ref CORRADE_RESOURCE_INITIALIZE(). The
+     * @relativeref{StartupProfileEvent,name} is the group name.
+     */
+    ResourceGroupRegister,
+
+    /**
+     * A resource group was unregistered, either from a global destructor or
+     * via @ref CORRADE_RESOURCE_FINALIZE(). The duration includes freeing
+     * data decompressed from the group. The
+     * @relativeref{StartupProfileEvent,name} is the group name.
+     */
+    ResourceGroupUnregister,
+
+    /**
+     * First lookup of a resource group, done either by constructing a
+     * @ref Resource instance or by calling @ref Resource::hasGroup() or
+     * @ref Resource::overrideGroup(). Recorded only once, the duration spans
+     * the whole operation including parsing an override configuration file
+     * in the @ref Resource constructor. The
+     * @relativeref{StartupProfileEvent,name} is the group name or
+     * @cpp nullptr @ce if the group wasn't found.
+     */
+    ResourceFirstLookup
+};
+
+/**
+@debugoperatorenum{StartupProfileEventType}
+@m_since_latest
+*/
+CORRADE_UTILITY_EXPORT Debug& operator<<(Debug& debug, StartupProfileEventType value);
+
+/**
+@brief Startup profile event
+@m_since_latest
+
+@see @ref startupProfileEvents()
+*/
+struct StartupProfileEvent {
+    /** @brief Event type */
+    StartupProfileEventType type;
+
+    /**
+     * @brief Plugin or resource group name
+     *
+     * Null-terminated and global, may be @cpp nullptr @ce.
+     */
+    const char* name;
+
+    /**
+     * @brief Timestamp in nanoseconds
+     *
+     * Taken from a monotonic clock at the start of the event. The absolute
+     * value has no meaning on its own, only differences between events are
+     * useful.
+     */
+    std::uint64_t timestamp;
+
+    /** @brief Duration of the event in nanoseconds */
+    std::uint64_t duration;
+};
+
+/**
+@brief Max count of recorded startup profile events
+@m_since_latest
+
+The events are recorded into a fixed-size global buffer that doesn't allocate.
+Events that don't fit are counted in @ref startupProfileDroppedEventCount()
+but otherwise discarded.
+*/
+constexpr std::size_t StartupProfileMaxEventCount = 1024;
+
+/**
+@brief Recorded startup profile events
+@m_since_latest
+
+If Corrade is built with @ref CORRADE_BUILD_STARTUP_PROFILING enabled, returns
+events recorded so far, in the order they happened. The events include also
+everything that happened before @cpp main() @ce was entered, as the
+instrumentation relies only on zero-initialized global state. If the option
+isn't enabled, returns an empty view.
+
+The recording is done in a thread-safe way if
+@ref CORRADE_BUILD_MULTITHREADED is enabled, however the returned view may
+contain partially written events if some are being recorded from other threads
+at the same time. In case of a static build linked into multiple shared
+libraries, each copy of the library records its events separately.
+@see @ref startupProfileEventCount(), @ref startupProfileReport()
+*/
+CORRADE_UTILITY_EXPORT Containers::ArrayView<const StartupProfileEvent> startupProfileEvents();
+
+/**
+@brief Count of recorded startup profile events of given type
+@m_since_latest
+
+Unlike @ref startupProfileEvents(), includes also events that didn't fit into
+the event buffer. Expects that @p type is a valid event type. If Corrade isn't
+built with @ref CORRADE_BUILD_STARTUP_PROFILING enabled, returns @cpp 0 @ce.
+*/
+CORRADE_UTILITY_EXPORT std::size_t startupProfileEventCount(StartupProfileEventType type);
+
+/**
+@brief Count of dropped startup profile events
+@m_since_latest
+
+Count of events that didn't fit into the buffer of
+@ref StartupProfileMaxEventCount events. If Corrade isn't built with
+@ref CORRADE_BUILD_STARTUP_PROFILING enabled, returns @cpp 0 @ce.
+*/
+CORRADE_UTILITY_EXPORT std::size_t startupProfileDroppedEventCount();
+
+/**
+@brief Startup profile report
+@m_since_latest
+
+Returns recorded events and counts as a JSON, suitable for tracking startup
+time regressions in continuous integration. Events are listed in the order in
+which they finished and timestamps are relative to the earliest event start.
+Events that are still being recorded from another thread have the type,
+timestamp and duration set to @cb{.json} null @ce. For example:
+
+@code{.json}
+{
+  "events": [
+    {
+      "type": "ResourceGroupRegister",
+      "name": "game-data",
+      "timestamp": 0,
+      "duration": 40
+    },
+    {
+      "type": "StaticPluginImport",
+      "name": "PngImporter",
+      "timestamp": 1250,
+      "duration": 35
+    }
+  ],
+  "counts": {
+    "StaticPluginImport": 1,
+    "StaticPluginEject": 0,
+    "ResourceGroupRegister": 1,
+    "ResourceGroupUnregister": 0,
+    "ResourceFirstLookup": 0
+  },
+  "droppedEvents": 0
+}
+@endcode
+
+If Corrade isn't built with @ref CORRADE_BUILD_STARTUP_PROFILING enabled, the
+@cb{.json} "events" @ce array is empty and all counts are zero.
+*/
+CORRADE_UTILITY_EXPORT Containers::String startupProfileReport();
+
+namespace Implementation {
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    CORRADE_UTILITY_EXPORT std::uint64_t startupProfileTimestamp();
+    CORRADE_UTILITY_EXPORT void recordStartupProfileEvent(StartupProfileEventType type, const char* name, std::uint64_t start);
+    #endif
+}
+
+}}
+
+#endif
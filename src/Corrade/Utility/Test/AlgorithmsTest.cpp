@@ -24,13 +24,19 @@
     DEALINGS IN THE SOFTWARE.
 */
 
-#include <algorithm> /* std::copy() */
+#include <algorithm> /* std::copy(), std::sort(), std::stable_sort() */
+#include <cmath> /* std::signbit() */
+#include <cstdint>
+#include <utility> /* std::pair */
+#include <vector> /* for benchmark against STL */
 
 #include "Corrade/Containers/Array.h"
 #include "Corrade/Containers/ArrayViewStl.h"
+#include "Corrade/Containers/Pair.h"
 #include "Corrade/Containers/String.h"
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
 #include "Corrade/Utility/Algorithms.h"
 
 namespace Corrade { namespace Utility { namespace Test { namespace {
@@ -83,6 +89,38 @@ struct AlgorithmsTest: TestSuite::Tester {
     template<class T> void flipInPlaceThirdDimension();
     void flipInPlaceZeroSize();
     void flipInPlaceNonContigous();
+
+    template<class T> void sortInPlace();
+    void sortInPlaceFloatTotalOrder();
+    void sortInPlaceAdversarial();
+    template<class T> void sortInPlaceKeyValue();
+    void sortInPlaceKeyValueTypeErased();
+    void sortInPlaceKeyValueInvalid();
+    template<class T> void argsortInto();
+    void argsortIntoAdversarial();
+    void argsortIntoInvalid();
+    template<class T> void nthElementInPlace();
+    void nthElementInPlaceRepeated();
+    void nthElementInPlaceAdversarial();
+    void nthElementInPlaceInvalid();
+    template<class T> void lowerUpperBound();
+    void lowerUpperBoundEmpty();
+    void lowerUpperBoundStrided();
+
+    void sortBenchmarkStl();
+    void sortBenchmark();
+    void sortBenchmarkStridedStl();
+    void sortBenchmarkStrided();
+    void sortBenchmarkFloatStl();
+    void sortBenchmarkFloat();
+    void sortBenchmarkKeyValueStl();
+    void sortBenchmarkKeyValue();
+    void argsortBenchmarkStl();
+    void argsortBenchmark();
+    void nthElementBenchmarkStl();
+    void nthElementBenchmark();
+    void lowerBoundBenchmarkStl();
+    void lowerBoundBenchmark();
 };
 
 const struct {
@@ -179,6 +217,30 @@ template<> struct TypeName<char> {
 template<> struct TypeName<int> {
     static const char* name() { return "int"; }
 };
+template<> struct TypeName<std::uint8_t> {
+    static const char* name() { return "std::uint8_t"; }
+};
+template<> struct TypeName<std::int8_t> {
+    static const char* name() { return "std::int8_t"; }
+};
+template<> struct TypeName<std::int16_t> {
+    static const char* name() { return "std::int16_t"; }
+};
+template<> struct TypeName<std::uint32_t> {
+    static const char* name() { return "std::uint32_t"; }
+};
+template<> struct TypeName<std::int64_t> {
+    static const char* name() { return "std::int64_t"; }
+};
+template<> struct TypeName<std::uint64_t> {
+    static const char* name() { return "std::uint64_t"; }
+};
+template<> struct TypeName<float> {
+    static const char* name() { return "float"; }
+};
+template<> struct TypeName<double> {
+    static const char* name() { return "double"; }
+};
 template<> struct TypeName<Data<1>> {
     static const char* name() { return "1B"; }
 };
@@ -200,6 +262,172 @@ struct Struct {
     int a;
 };
 
+const struct {
+    const char* name;
+    std::size_t size;
+    std::size_t stride;
+} SortData[]{
+    {"empty", 0, 1},
+    {"single item", 1, 1},
+    {"insertion sort", 17, 1},
+    {"insertion sort, strided", 17, 3},
+    /* Quicksort for 16-bit and larger keys, radix sort for 8-bit keys. With
+       100 items it'd be a radix sort for 16-bit keys as well. */
+    {"quicksort", 60, 1},
+    {"quicksort, strided", 60, 3},
+    {"radix sort", 1000, 1},
+    {"radix sort, strided", 1000, 3},
+};
+
+const struct {
+    const char* name;
+    std::size_t size;
+    std::size_t nth;
+} NthElementData[]{
+    {"single item", 1, 0},
+    {"insertion sort, first", 17, 0},
+    {"insertion sort, middle", 17, 8},
+    {"insertion sort, last", 17, 16},
+    {"quickselect, first", 1000, 0},
+    {"quickselect, middle", 1000, 500},
+    {"quickselect, last", 1000, 999},
+};
+
+/* Deterministic pseudorandom values covering the whole range of the type */
+template<class T> typename std::enable_if<std::is_integral<T>::value, T>::type randomValue(std::uint64_t& state) {
+    state = state*6364136223846793005ull + 1442695040888963407ull;
+    return T(state ^ (state >> 29));
+}
+template<class T> typename std::enable_if<std::is_floating_point<T>::value, T>::type randomValue(std::uint64_t& state) {
+    state = state*6364136223846793005ull + 1442695040888963407ull;
+    return T(std::int32_t(state >> 32))/T(65536);
+}
+
+template<class T> Containers::Array<T> randomData(const std::size_t size, std::uint64_t seed = 1) {
+    Containers::Array<T> out{NoInit, size};
+    for(T& i: out) i = randomValue<T>(seed);
+    return out;
+}
+
+/* Generates an input on which the median-of-three quicksort and quickselect
+   in Algorithms.cpp run out of their partition budget, using the adversary
+   from M. D. McIlroy's "A Killer Adversary for Quicksort". The partitioning
+   is replicated here on item positions, values get assigned to the items
+   lazily as they're compared. All compared values are distinct, so the
+   input is adversarial for the index tie-breaking in argsortInto() as well.
+   If the implementation changes, this has to be updated, otherwise the
+   tests fail on the exhausted() check. */
+struct QuicksortAdversary {
+    explicit QuicksortAdversary(const std::size_t size): _values{NoInit, size}, _positions{NoInit, size}, _gas{std::uint32_t(size)} {
+        for(std::size_t i = 0; i != size; ++i) {
+            _values[i] = _gas;
+            _positions[i] = i;
+        }
+    }
+
+    bool exhausted() const { return _exhausted; }
+
+    /* Values for items that were never compared stay at the maximum */
+    Containers::ArrayView<const std::uint32_t> values() const { return _values; }
+
+    void sort() {
+        quickSort(_positions, _positions.size(), partitionBudget(_positions.size()));
+    }
+
+    void select(const std::size_t nth) {
+        std::size_t budget = partitionBudget(_positions.size());
+        std::size_t begin = 0, end = _positions.size();
+        while(end - begin > InsertionSortThreshold) {
+            if(!budget--) {
+                _exhausted = true;
+                return;
+            }
+
+            const std::size_t split = begin + partition(_positions + begin, end - begin) + 1;
+            if(nth < split) end = split;
+            else begin = split;
+        }
+    }
+
+    private:
+        enum: std::size_t { InsertionSortThreshold = 32 };
+
+        static std::size_t partitionBudget(const std::size_t size) {
+            std::size_t budget = 0;
+            for(std::size_t i = size; i; i >>= 1) budget += 2;
+            return budget;
+        }
+
+        bool less(const std::uint32_t a, const std::uint32_t b) {
+            if(_values[a] == _gas && _values[b] == _gas)
+                _values[a == _candidate ? a : b] = _solid++;
+            if(_values[a] == _gas) _candidate = a;
+            else if(_values[b] == _gas) _candidate = b;
+            return _values[a] < _values[b];
+        }
+
+        std::size_t partition(std::uint32_t* const data, const std::size_t size) {
+            std::uint32_t& a = data[0];
+            std::uint32_t& b = data[size/2];
+            std::uint32_t& c = data[size - 1];
+            if(less(b, a)) std::swap(a, b);
+            if(less(c, b)) {
+                std::swap(b, c);
+                if(less(b, a)) std::swap(a, b);
+            }
+            const std::uint32_t pivot = b;
+
+            std::size_t i = 0, j = size - 1;
+            for(;;) {
+                while(less(data[i], pivot)) ++i;
+                while(less(pivot, data[j])) --j;
+                if(i >= j) return j;
+                std::swap(data[i], data[j]);
+                ++i;
+                --j;
+            }
+        }
+
+        void insertionSort(std::uint32_t* const data, const std::size_t size) {
+            for(std::size_t i = 1; i < size; ++i) {
+                const std::uint32_t item = data[i];
+                std::size_t j = i;
+                for(; j && less(item, data[j - 1]); --j)
+                    data[j] = data[j - 1];
+                data[j] = item;
+            }
+        }
+
+        /* Stops at the first exhausted budget, the comparisons done by the
+           implementation until that point are the same */
+        void quickSort(std::uint32_t* data, std::size_t size, std::size_t budget) {
+            while(size > InsertionSortThreshold) {
+                if(!budget--) {
+                    _exhausted = true;
+                    return;
+                }
+
+                const std::size_t split = partition(data, size) + 1;
+                if(split < size - split) {
+                    quickSort(data, split, budget);
+                    if(_exhausted) return;
+                    data += split;
+                    size -= split;
+                } else {
+                    quickSort(data + split, size - split, budget);
+                    if(_exhausted) return;
+                    size = split;
+                }
+            }
+
+            insertionSort(data, size);
+        }
+
+        Containers::Array<std::uint32_t> _values, _positions;
+        std::uint32_t _gas, _solid{}, _candidate{};
+        bool _exhausted{};
+};
+
 AlgorithmsTest::AlgorithmsTest() {
     addTests({&AlgorithmsTest::copy,
               &AlgorithmsTest::copyConstVoidToVoid,
@@ -275,6 +503,73 @@ AlgorithmsTest::AlgorithmsTest() {
 
               &AlgorithmsTest::flipInPlaceZeroSize,
               &AlgorithmsTest::flipInPlaceNonContigous});
+
+    addInstancedTests<AlgorithmsTest>({
+        &AlgorithmsTest::sortInPlace<std::uint8_t>,
+        &AlgorithmsTest::sortInPlace<std::int8_t>,
+        &AlgorithmsTest::sortInPlace<std::int16_t>,
+        &AlgorithmsTest::sortInPlace<std::uint32_t>,
+        &AlgorithmsTest::sortInPlace<int>,
+        &AlgorithmsTest::sortInPlace<std::uint64_t>,
+        &AlgorithmsTest::sortInPlace<std::int64_t>,
+        &AlgorithmsTest::sortInPlace<float>,
+        &AlgorithmsTest::sortInPlace<double>,
+        }, Containers::arraySize(SortData));
+
+    addTests({&AlgorithmsTest::sortInPlaceFloatTotalOrder,
+              &AlgorithmsTest::sortInPlaceAdversarial});
+
+    addInstancedTests<AlgorithmsTest>({
+        &AlgorithmsTest::sortInPlaceKeyValue<std::uint8_t>,
+        &AlgorithmsTest::sortInPlaceKeyValue<int>,
+        &AlgorithmsTest::sortInPlaceKeyValue<float>,
+        }, Containers::arraySize(SortData));
+
+    addTests({&AlgorithmsTest::sortInPlaceKeyValueTypeErased,
+              &AlgorithmsTest::sortInPlaceKeyValueInvalid});
+
+    addInstancedTests<AlgorithmsTest>({
+        &AlgorithmsTest::argsortInto<std::int16_t>,
+        &AlgorithmsTest::argsortInto<std::uint64_t>,
+        &AlgorithmsTest::argsortInto<double>,
+        }, Containers::arraySize(SortData));
+
+    addTests({&AlgorithmsTest::argsortIntoAdversarial,
+              &AlgorithmsTest::argsortIntoInvalid});
+
+    addInstancedTests<AlgorithmsTest>({
+        &AlgorithmsTest::nthElementInPlace<std::int8_t>,
+        &AlgorithmsTest::nthElementInPlace<std::uint32_t>,
+        &AlgorithmsTest::nthElementInPlace<float>,
+        }, Containers::arraySize(NthElementData));
+
+    addTests({&AlgorithmsTest::nthElementInPlaceRepeated,
+              &AlgorithmsTest::nthElementInPlaceAdversarial,
+              &AlgorithmsTest::nthElementInPlaceInvalid});
+
+    addInstancedTests<AlgorithmsTest>({
+        &AlgorithmsTest::lowerUpperBound<std::uint8_t>,
+        &AlgorithmsTest::lowerUpperBound<int>,
+        &AlgorithmsTest::lowerUpperBound<double>,
+        }, Containers::arraySize(SortData));
+
+    addTests({&AlgorithmsTest::lowerUpperBoundEmpty,
+              &AlgorithmsTest::lowerUpperBoundStrided});
+
+    addBenchmarks({&AlgorithmsTest::sortBenchmarkStl,
+                   &AlgorithmsTest::sortBenchmark,
+                   &AlgorithmsTest::sortBenchmarkStridedStl,
+                   &AlgorithmsTest::sortBenchmarkStrided,
+                   &AlgorithmsTest::sortBenchmarkFloatStl,
+                   &AlgorithmsTest::sortBenchmarkFloat,
+                   &AlgorithmsTest::sortBenchmarkKeyValueStl,
+                   &AlgorithmsTest::sortBenchmarkKeyValue,
+                   &AlgorithmsTest::argsortBenchmarkStl,
+                   &AlgorithmsTest::argsortBenchmark,
+                   &AlgorithmsTest::nthElementBenchmarkStl,
+                   &AlgorithmsTest::nthElementBenchmark,
+                   &AlgorithmsTest::lowerBoundBenchmarkStl,
+                   &AlgorithmsTest::lowerBoundBenchmark}, 10);
 }
 
 void AlgorithmsTest::copy() {
@@ -1156,6 +1451,479 @@ void AlgorithmsTest::flipInPlaceNonContigous() {
         "Utility::flipInPlace(): the view is not contiguous after dimension 1\n");
 }
 
+template<class T> void AlgorithmsTest::sortInPlace() {
+    auto&& data = SortData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Every stride-th item gets sorted, the rest has to stay untouched */
+    Containers::Array<T> values = randomData<T>(data.size*data.stride);
+    Containers::Array<T> expected{NoInit, values.size()};
+    Utility::copy(values, expected);
+    std::vector<T> sorted;
+    for(std::size_t i = 0; i < values.size(); i += data.stride)
+        sorted.push_back(values[i]);
+    std::sort(sorted.begin(), sorted.end());
+    for(std::size_t i = 0; i != sorted.size(); ++i)
+        expected[i*data.stride] = sorted[i];
+
+    Utility::sortInPlace(Containers::stridedArrayView(values).every(data.stride));
+    CORRADE_COMPARE_AS(values, expected, TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::sortInPlaceFloatTotalOrder() {
+    const float inf = 1.0f/0.0f;
+    const float nan = 0.0f/0.0f;
+    float values[]{1.0f, -nan, 0.0f, inf, -1.0f, -0.0f, nan, -inf, -0.0f, 0.0f};
+    Utility::sortInPlace<float>(values);
+
+    CORRADE_COMPARE(values[0] != values[0], true);
+    CORRADE_VERIFY(std::signbit(values[0]));
+    CORRADE_COMPARE(values[1], -inf);
+    CORRADE_COMPARE(values[2], -1.0f);
+    CORRADE_VERIFY(std::signbit(values[3]));
+    CORRADE_VERIFY(std::signbit(values[4]));
+    CORRADE_COMPARE(values[4], 0.0f);
+    CORRADE_VERIFY(!std::signbit(values[5]));
+    CORRADE_VERIFY(!std::signbit(values[6]));
+    CORRADE_COMPARE(values[6], 0.0f);
+    CORRADE_COMPARE(values[7], 1.0f);
+    CORRADE_COMPARE(values[8], inf);
+    CORRADE_COMPARE(values[9] != values[9], true);
+    CORRADE_VERIFY(!std::signbit(values[9]));
+}
+
+void AlgorithmsTest::sortInPlaceAdversarial() {
+    /* 128 32-bit keys is the largest size that still goes through the
+       quicksort and not directly to the radix sort */
+    QuicksortAdversary adversary{128};
+    adversary.sort();
+    CORRADE_VERIFY(adversary.exhausted());
+
+    Containers::Array<std::uint32_t> values{NoInit, adversary.values().size()};
+    Utility::copy(adversary.values(), values);
+    std::vector<std::uint32_t> expected{values.begin(), values.end()};
+    std::sort(expected.begin(), expected.end());
+
+    /* The radix sort fallback handles the rest */
+    Utility::sortInPlace(Containers::stridedArrayView(values));
+    CORRADE_COMPARE_AS(Containers::arrayView(values), Containers::arrayView(expected), TestSuite::Compare::Container);
+}
+
+template<class T> void AlgorithmsTest::sortInPlaceKeyValue() {
+    auto&& data = SortData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Few distinct keys to verify the sort is stable */
+    Containers::Array<T> keys{NoInit, data.size};
+    Containers::Array<Containers::Pair<int, short>> values{NoInit, data.size*data.stride};
+    std::vector<std::pair<T, int>> expected;
+    std::uint64_t state = 1;
+    for(std::size_t i = 0; i != data.size; ++i) {
+        keys[i] = T(randomValue<std::uint32_t>(state) % 7);
+        values[i*data.stride] = {int(i), short(-int(i))};
+        expected.emplace_back(keys[i], int(i));
+    }
+    std::stable_sort(expected.begin(), expected.end(), [](const std::pair<T, int>& a, const std::pair<T, int>& b) {
+        return a.first < b.first;
+    });
+
+    Utility::sortInPlace(Containers::stridedArrayView(keys), Containers::stridedArrayView(values).every(data.stride));
+    CORRADE_VERIFY(std::is_sorted(keys.begin(), keys.end()));
+    for(std::size_t i = 0; i != data.size; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(keys[i], expected[i].first);
+        CORRADE_COMPARE(values[i*data.stride].first(), expected[i].second);
+        CORRADE_COMPARE(values[i*data.stride].second(), -expected[i].second);
+    }
+}
+
+void AlgorithmsTest::sortInPlaceKeyValueTypeErased() {
+    int keys[]{3, -1, 2, -1};
+    char values[]{'d', 'D', 'a', 'A', 'c', 'C', 'b', 'B'};
+
+    Utility::sortInPlace(Containers::stridedArrayView(keys), Containers::StridedArrayView2D<char>{values, {4, 2}});
+    CORRADE_COMPARE_AS(Containers::arrayView(keys),
+        Containers::arrayView({-1, -1, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(values),
+        Containers::arrayView({'a', 'A', 'b', 'B', 'c', 'C', 'd', 'D'}),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::sortInPlaceKeyValueInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    int keys[3]{};
+    char values[8]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    Utility::sortInPlace(Containers::stridedArrayView(keys), Containers::StridedArrayView2D<char>{values, {4, 2}});
+    Utility::sortInPlace(Containers::stridedArrayView(keys), Containers::StridedArrayView2D<char>{values, {3, 2}, {2, 3}});
+    CORRADE_COMPARE(out,
+        "Utility::sortInPlace(): expected 3 values but got 4\n"
+        "Utility::sortInPlace(): second value dimension is not contiguous\n");
+}
+
+template<class T> void AlgorithmsTest::argsortInto() {
+    auto&& data = SortData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Containers::Array<T> values = randomData<T>(data.size*data.stride);
+    /* Repeat some values to verify the ordering is stable */
+    for(std::size_t i = 1; i < values.size(); i += 5)
+        values[i] = values[i - 1];
+    Containers::StridedArrayView1D<const T> view = Containers::stridedArrayView(values).every(data.stride);
+
+    std::vector<std::uint32_t> expected(data.size);
+    for(std::size_t i = 0; i != data.size; ++i) expected[i] = i;
+    std::stable_sort(expected.begin(), expected.end(), [&](std::uint32_t a, std::uint32_t b) {
+        return view[a] < view[b];
+    });
+
+    Containers::Array<std::uint32_t> indices{NoInit, data.size};
+    Utility::argsortInto(view, Containers::stridedArrayView(indices));
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView(expected), TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::argsortIntoAdversarial() {
+    QuicksortAdversary adversary{128};
+    adversary.sort();
+    CORRADE_VERIFY(adversary.exhausted());
+
+    Containers::ArrayView<const std::uint32_t> values = adversary.values();
+    std::vector<std::uint32_t> expected(values.size());
+    for(std::size_t i = 0; i != values.size(); ++i) expected[i] = i;
+    std::stable_sort(expected.begin(), expected.end(), [&](std::uint32_t a, std::uint32_t b) {
+        return values[a] < values[b];
+    });
+
+    Containers::Array<std::uint32_t> indices{NoInit, values.size()};
+    Utility::argsortInto(Containers::stridedArrayView(values), Containers::stridedArrayView(indices));
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView(expected), TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::argsortIntoInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    int values[3]{};
+    std::uint32_t indices[4];
+
+    Containers::String out;
+    Error redirectError{&out};
+    Utility::argsortInto(Containers::stridedArrayView(values), Containers::stridedArrayView(indices));
+    CORRADE_COMPARE(out, "Utility::argsortInto(): expected 3 indices but got 4\n");
+}
+
+template<class T> void AlgorithmsTest::nthElementInPlace() {
+    auto&& data = NthElementData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    Containers::Array<T> values = randomData<T>(data.size);
+    std::vector<T> sorted{values.begin(), values.end()};
+    std::sort(sorted.begin(), sorted.end());
+
+    Utility::nthElementInPlace(Containers::stridedArrayView(values), data.nth);
+    CORRADE_COMPARE(values[data.nth], sorted[data.nth]);
+    for(std::size_t i = 0; i != data.nth; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(!(values[data.nth] < values[i]));
+    }
+    for(std::size_t i = data.nth + 1; i != data.size; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(!(values[i] < values[data.nth]));
+    }
+
+    /* The set of values is the same */
+    std::sort(values.begin(), values.end());
+    CORRADE_COMPARE_AS(Containers::arrayView(values), Containers::arrayView(sorted), TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::nthElementInPlaceRepeated() {
+    /* A lot of repeated values, which would make a two-way partitioning
+       degenerate */
+    Containers::Array<int> values{NoInit, 1000};
+    for(std::size_t i = 0; i != values.size(); ++i)
+        values[i] = i % 3 ? 5 : int(i % 7);
+
+    std::vector<int> sorted{values.begin(), values.end()};
+    std::sort(sorted.begin(), sorted.end());
+
+    Utility::nthElementInPlace(Containers::stridedArrayView(values), 300);
+    CORRADE_COMPARE(values[300], sorted[300]);
+    for(std::size_t i = 0; i != 300; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(values[i], values[300], TestSuite::Compare::LessOrEqual);
+    }
+    for(std::size_t i = 301; i != values.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(values[i], values[300], TestSuite::Compare::GreaterOrEqual);
+    }
+}
+
+void AlgorithmsTest::nthElementInPlaceAdversarial() {
+    QuicksortAdversary adversary{1000};
+    adversary.select(500);
+    CORRADE_VERIFY(adversary.exhausted());
+
+    Containers::Array<std::uint32_t> values{NoInit, adversary.values().size()};
+    Utility::copy(adversary.values(), values);
+    std::vector<std::uint32_t> sorted{values.begin(), values.end()};
+    std::sort(sorted.begin(), sorted.end());
+
+    /* The remaining range gets sorted by the radix sort fallback */
+    Utility::nthElementInPlace(Containers::stridedArrayView(values), 500);
+    CORRADE_COMPARE(values[500], sorted[500]);
+    for(std::size_t i = 0; i != 500; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(values[i], values[500], TestSuite::Compare::LessOrEqual);
+    }
+    for(std::size_t i = 501; i != values.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(values[i], values[500], TestSuite::Compare::GreaterOrEqual);
+    }
+}
+
+void AlgorithmsTest::nthElementInPlaceInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    int values[3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    Utility::nthElementInPlace(Containers::stridedArrayView(values), 3);
+    CORRADE_COMPARE(out, "Utility::nthElementInPlace(): index 3 out of range for 3 items\n");
+}
+
+template<class T> void AlgorithmsTest::lowerUpperBound() {
+    auto&& data = SortData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    /* Sorted data with a lot of repeated values */
+    std::vector<T> values;
+    std::uint64_t state = 1;
+    for(std::size_t i = 0; i != data.size; ++i)
+        values.push_back(T(randomValue<std::uint32_t>(state) % 50));
+    std::sort(values.begin(), values.end());
+
+    for(int value = -1; value != 52; ++value) {
+        CORRADE_ITERATION(value);
+        CORRADE_COMPARE(Utility::lowerBound<T>(values, T(value)),
+            std::size_t(std::lower_bound(values.begin(), values.end(), T(value)) - values.begin()));
+        CORRADE_COMPARE(Utility::upperBound<T>(values, T(value)),
+            std::size_t(std::upper_bound(values.begin(), values.end(), T(value)) - values.begin()));
+    }
+}
+
+void AlgorithmsTest::lowerUpperBoundEmpty() {
+    CORRADE_COMPARE(Utility::lowerBound(Containers::StridedArrayView1D<const int>{}, 5), 0);
+    CORRADE_COMPARE(Utility::upperBound(Containers::StridedArrayView1D<const int>{}, 5), 0);
+}
+
+void AlgorithmsTest::lowerUpperBoundStrided() {
+    const Containers::Pair<float, int> values[]{
+        {-1.0f, 0}, {2.0f, 1}, {2.0f, 2}, {2.0f, 3}, {7.5f, 4}
+    };
+    Containers::StridedArrayView1D<const float> view = Containers::stridedArrayView(values).slice(&Containers::Pair<float, int>::first);
+    CORRADE_COMPARE(Utility::lowerBound(view, 2.0f), 1);
+    CORRADE_COMPARE(Utility::upperBound(view, 2.0f), 4);
+    CORRADE_COMPARE(Utility::lowerBound(view, -5.0f), 0);
+    CORRADE_COMPARE(Utility::upperBound(view, 7.5f), 5);
+}
+
+constexpr std::size_t SortBenchmarkSize = 100000;
+
+void AlgorithmsTest::sortBenchmarkStl() {
+    const Containers::Array<std::uint32_t> data = randomData<std::uint32_t>(SortBenchmarkSize);
+    Containers::Array<std::uint32_t> values{NoInit, data.size()};
+
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(data, values);
+        std::sort(values.begin(), values.end());
+    }
+
+    CORRADE_VERIFY(std::is_sorted(values.begin(), values.end()));
+}
+
+void AlgorithmsTest::sortBenchmark() {
+    const Containers::Array<std::uint32_t> data = randomData<std::uint32_t>(SortBenchmarkSize);
+    Containers::Array<std::uint32_t> values{NoInit, data.size()};
+
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(data, values);
+        Utility::sortInPlace<std::uint32_t>(values);
+    }
+
+    CORRADE_VERIFY(std::is_sorted(values.begin(), values.end()));
+}
+
+void AlgorithmsTest::sortBenchmarkStridedStl() {
+    const Containers::Array<std::uint32_t> data = randomData<std::uint32_t>(SortBenchmarkSize*4);
+    Containers::Array<std::uint32_t> values{NoInit, data.size()};
+
+    /* What one has to do without strided sort -- copy to a contiguous
+       location, sort there and copy back */
+    Containers::StridedArrayView1D<std::uint32_t> view = Containers::stridedArrayView(values).every(4);
+    std::vector<std::uint32_t> contiguous(view.size());
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(data, values);
+        Utility::copy(view, Containers::stridedArrayView(contiguous));
+        std::sort(contiguous.begin(), contiguous.end());
+        Utility::copy(Containers::stridedArrayView(contiguous), view);
+    }
+
+    CORRADE_VERIFY(std::is_sorted(contiguous.begin(), contiguous.end()));
+}
+
+void AlgorithmsTest::sortBenchmarkStrided() {
+    const Containers::Array<std::uint32_t> data = randomData<std::uint32_t>(SortBenchmarkSize*4);
+    Containers::Array<std::uint32_t> values{NoInit, data.size()};
+
+    Containers::StridedArrayView1D<std::uint32_t> view = Containers::stridedArrayView(values).every(4);
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(data, values);
+        Utility::sortInPlace(view);
+    }
+
+    CORRADE_VERIFY(std::is_sorted(view.begin(), view.end()));
+}
+
+void AlgorithmsTest::sortBenchmarkFloatStl() {
+    const Containers::Array<float> data = randomData<float>(SortBenchmarkSize);
+    Containers::Array<float> values{NoInit, data.size()};
+
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(data, values);
+        std::sort(values.begin(), values.end());
+    }
+
+    CORRADE_VERIFY(std::is_sorted(values.begin(), values.end()));
+}
+
+void AlgorithmsTest::sortBenchmarkFloat() {
+    const Containers::Array<float> data = randomData<float>(SortBenchmarkSize);
+    Containers::Array<float> values{NoInit, data.size()};
+
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(data, values);
+        Utility::sortInPlace<float>(values);
+    }
+
+    CORRADE_VERIFY(std::is_sorted(values.begin(), values.end()));
+}
+
+void AlgorithmsTest::sortBenchmarkKeyValueStl() {
+    const Containers::Array<float> data = randomData<float>(SortBenchmarkSize);
+    std::vector<std::pair<float, std::uint64_t>> values(data.size());
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != data.size(); ++i)
+            values[i] = {data[i], i};
+        std::sort(values.begin(), values.end(), [](const std::pair<float, std::uint64_t>& a, const std::pair<float, std::uint64_t>& b) {
+            return a.first < b.first;
+        });
+    }
+
+    CORRADE_VERIFY(std::is_sorted(values.begin(), values.end(), [](const std::pair<float, std::uint64_t>& a, const std::pair<float, std::uint64_t>& b) {
+        return a.first < b.first;
+    }));
+}
+
+void AlgorithmsTest::sortBenchmarkKeyValue() {
+    const Containers::Array<float> data = randomData<float>(SortBenchmarkSize);
+    Containers::Array<float> keys{NoInit, data.size()};
+    Containers::Array<std::uint64_t> values{NoInit, data.size()};
+
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(data, keys);
+        for(std::size_t i = 0; i != data.size(); ++i)
+            values[i] = i;
+        Utility::sortInPlace(Containers::stridedArrayView(keys), Containers::stridedArrayView(values));
+    }
+
+    CORRADE_VERIFY(std::is_sorted(keys.begin(), keys.end()));
+}
+
+void AlgorithmsTest::argsortBenchmarkStl() {
+    const Containers::Array<float> data = randomData<float>(SortBenchmarkSize);
+    Containers::Array<std::uint32_t> indices{NoInit, data.size()};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != data.size(); ++i)
+            indices[i] = i;
+        std::sort(indices.begin(), indices.end(), [&](std::uint32_t a, std::uint32_t b) {
+            return data[a] < data[b];
+        });
+    }
+
+    CORRADE_COMPARE_AS(data[indices[0]], data[indices[1]], TestSuite::Compare::LessOrEqual);
+}
+
+void AlgorithmsTest::argsortBenchmark() {
+    const Containers::Array<float> data = randomData<float>(SortBenchmarkSize);
+    Containers::Array<std::uint32_t> indices{NoInit, data.size()};
+
+    CORRADE_BENCHMARK(1)
+        Utility::argsortInto<float>(data, indices);
+
+    CORRADE_COMPARE_AS(data[indices[0]], data[indices[1]], TestSuite::Compare::LessOrEqual);
+}
+
+void AlgorithmsTest::nthElementBenchmarkStl() {
+    const Containers::Array<float> data = randomData<float>(SortBenchmarkSize);
+    Containers::Array<float> values{NoInit, data.size()};
+
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(data, values);
+        std::nth_element(values.begin(), values.begin() + values.size()/2, values.end());
+    }
+
+    CORRADE_COMPARE_AS(values[0], values[values.size()/2], TestSuite::Compare::LessOrEqual);
+}
+
+void AlgorithmsTest::nthElementBenchmark() {
+    const Containers::Array<float> data = randomData<float>(SortBenchmarkSize);
+    Containers::Array<float> values{NoInit, data.size()};
+
+    CORRADE_BENCHMARK(1) {
+        Utility::copy(data, values);
+        Utility::nthElementInPlace<float>(values, values.size()/2);
+    }
+
+    CORRADE_COMPARE_AS(values[0], values[values.size()/2], TestSuite::Compare::LessOrEqual);
+}
+
+void AlgorithmsTest::lowerBoundBenchmarkStl() {
+    Containers::Array<std::uint32_t> values = randomData<std::uint32_t>(SortBenchmarkSize);
+    std::sort(values.begin(), values.end());
+    const Containers::Array<std::uint32_t> queries = randomData<std::uint32_t>(1000, 2);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::uint32_t query: queries)
+            sum += std::lower_bound(values.begin(), values.end(), query) - values.begin();
+
+    CORRADE_VERIFY(sum);
+}
+
+void AlgorithmsTest::lowerBoundBenchmark() {
+    Containers::Array<std::uint32_t> values = randomData<std::uint32_t>(SortBenchmarkSize);
+    std::sort(values.begin(), values.end());
+    const Containers::Array<std::uint32_t> queries = randomData<std::uint32_t>(1000, 2);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::uint32_t query: queries)
+            sum += Utility::lowerBound<std::uint32_t>(values, query);
+
+    CORRADE_VERIFY(sum);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::Utility::Test::AlgorithmsTest)
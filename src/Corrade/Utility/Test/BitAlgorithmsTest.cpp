@@ -32,6 +32,7 @@
 #include "Corrade/Containers/String.h"
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
 #include "Corrade/Utility/BitAlgorithms.h"
 #include "Corrade/Utility/Format.h"
 
@@ -49,8 +50,27 @@ struct BitAlgorithmsTest: TestSuite::Tester {
     void copyMaskedDifferentTypeSize();
     void copyMaskedNotContiguous();
 
+    template<std::size_t size> void copyMaskedTypeSize();
+    template<std::size_t size> void expandMaskedTypeSize();
+
+    void expandMasked();
+    void expandMaskedZeroSize();
+    void expandMaskedZeroBitsSet();
+
+    void expandMaskedDifferentSize();
+    void expandMaskedDifferentBitsSet();
+    void expandMaskedDifferentTypeSize();
+    void expandMaskedNotContiguous();
+
+    void maskFromPredicate();
+    void maskFromPredicateDifferentSize();
+
     void copyMaskedBenchmarkNaive();
     void copyMaskedBenchmark();
+    void expandMaskedBenchmarkNaive();
+    void expandMaskedBenchmark();
+    void maskFromPredicateBenchmarkNaive();
+    void maskFromPredicateBenchmark();
 };
 
 const struct {
@@ -65,6 +85,31 @@ const struct {
     {"negative dst stride", false, true, false, false},
 };
 
+const struct {
+    const char* name;
+    std::size_t maskOffset;
+    std::size_t stride;
+} CopyMaskedTypeSizeData[]{
+    {"", 0, 1},
+    {"mask offset", 5, 1},
+    {"strided", 0, 3},
+    {"mask offset, strided", 3, 2},
+};
+
+const struct {
+    const char* name;
+    std::size_t offset;
+    std::size_t size;
+} MaskFromPredicateData[]{
+    {"", 0, 133},
+    {"offset", 3, 133},
+    {"offset, ending in the first byte", 2, 5},
+    {"offset, ending at the first byte boundary", 1, 7},
+    {"less than a byte", 0, 6},
+    {"exactly a byte", 0, 8},
+    {"empty", 0, 0},
+};
+
 const struct {
     float density;
 } CopyMaskedBenchmarkData[]{
@@ -86,10 +131,51 @@ BitAlgorithmsTest::BitAlgorithmsTest() {
               &BitAlgorithmsTest::copyMaskedDifferentTypeSize,
               &BitAlgorithmsTest::copyMaskedNotContiguous});
 
+    addInstancedTests<BitAlgorithmsTest>({
+        &BitAlgorithmsTest::copyMaskedTypeSize<1>,
+        &BitAlgorithmsTest::copyMaskedTypeSize<2>,
+        &BitAlgorithmsTest::copyMaskedTypeSize<3>,
+        &BitAlgorithmsTest::copyMaskedTypeSize<4>,
+        &BitAlgorithmsTest::copyMaskedTypeSize<8>,
+        &BitAlgorithmsTest::copyMaskedTypeSize<12>,
+        &BitAlgorithmsTest::copyMaskedTypeSize<16>,
+        &BitAlgorithmsTest::copyMaskedTypeSize<24>,
+        &BitAlgorithmsTest::expandMaskedTypeSize<1>,
+        &BitAlgorithmsTest::expandMaskedTypeSize<2>,
+        &BitAlgorithmsTest::expandMaskedTypeSize<3>,
+        &BitAlgorithmsTest::expandMaskedTypeSize<4>,
+        &BitAlgorithmsTest::expandMaskedTypeSize<8>,
+        &BitAlgorithmsTest::expandMaskedTypeSize<12>,
+        &BitAlgorithmsTest::expandMaskedTypeSize<16>,
+        &BitAlgorithmsTest::expandMaskedTypeSize<24>},
+        Containers::arraySize(CopyMaskedTypeSizeData));
+
+    addInstancedTests({&BitAlgorithmsTest::expandMasked},
+        Containers::arraySize(CopyMaskedData));
+
+    addTests({&BitAlgorithmsTest::expandMaskedZeroSize,
+              &BitAlgorithmsTest::expandMaskedZeroBitsSet,
+
+              &BitAlgorithmsTest::expandMaskedDifferentSize,
+              &BitAlgorithmsTest::expandMaskedDifferentBitsSet,
+              &BitAlgorithmsTest::expandMaskedDifferentTypeSize,
+              &BitAlgorithmsTest::expandMaskedNotContiguous});
+
+    addInstancedTests({&BitAlgorithmsTest::maskFromPredicate},
+        Containers::arraySize(MaskFromPredicateData));
+
+    addTests({&BitAlgorithmsTest::maskFromPredicateDifferentSize});
+
     addInstancedBenchmarks({
         &BitAlgorithmsTest::copyMaskedBenchmarkNaive,
-        &BitAlgorithmsTest::copyMaskedBenchmark}, 100,
+        &BitAlgorithmsTest::copyMaskedBenchmark,
+        &BitAlgorithmsTest::expandMaskedBenchmarkNaive,
+        &BitAlgorithmsTest::expandMaskedBenchmark}, 100,
         Containers::arraySize(CopyMaskedBenchmarkData));
+
+    addBenchmarks({
+        &BitAlgorithmsTest::maskFromPredicateBenchmarkNaive,
+        &BitAlgorithmsTest::maskFromPredicateBenchmark}, 100);
 }
 
 void BitAlgorithmsTest::copyMasked() {
@@ -214,6 +300,284 @@ void BitAlgorithmsTest::copyMaskedNotContiguous() {
         "Utility::copyMasked(): second destination view dimension is not contiguous\n");
 }
 
+template<std::size_t size> struct Item {
+    char data[size];
+};
+
+/* A mask that has both fully set and fully unset 64-bit words as well as
+   sparse and dense parts, and a random part at the end */
+Containers::BitArray typeSizeMask(std::size_t offset) {
+    Containers::BitArray mask{ValueInit, offset + 1000};
+    for(std::size_t i = 64; i != 192; ++i)
+        mask.set(offset + i);
+    for(std::size_t i = 320; i < 500; i += 7)
+        mask.set(offset + i);
+    for(std::size_t i = 500; i != 600; ++i)
+        if(i % 5) mask.set(offset + i);
+    std::mt19937 g{1337};
+    for(std::size_t i = 600; i != 1000; ++i)
+        if(g() % 2) mask.set(offset + i);
+    return mask;
+}
+
+template<std::size_t size> void BitAlgorithmsTest::copyMaskedTypeSize() {
+    auto&& data = CopyMaskedTypeSizeData[testCaseInstanceId()];
+    setTestCaseTemplateName(Utility::format("{}", size));
+    setTestCaseDescription(data.name);
+
+    const Containers::BitArray maskData = typeSizeMask(data.maskOffset);
+    const Containers::BitArrayView mask = maskData.exceptPrefix(data.maskOffset);
+    CORRADE_COMPARE(mask.offset(), data.maskOffset);
+
+    Containers::Array<Item<size>> srcData{NoInit, mask.size()*data.stride};
+    for(std::size_t i = 0; i != srcData.size(); ++i)
+        for(std::size_t j = 0; j != size; ++j)
+            srcData[i].data[j] = char(i*size + j);
+    const Containers::StridedArrayView1D<const Item<size>> src = Containers::stridedArrayView(srcData).every(data.stride);
+
+    const std::size_t count = mask.count();
+    Containers::Array<Item<size>> dstData{ValueInit, count*data.stride};
+    const Containers::StridedArrayView1D<Item<size>> dst = Containers::stridedArrayView(dstData).every(data.stride);
+
+    Utility::copyMasked(src, mask, dst);
+
+    std::size_t j = 0;
+    for(std::size_t i = 0; i != mask.size(); ++i) {
+        if(!mask[i]) continue;
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(Containers::arrayView(dst[j].data),
+            Containers::arrayView(src[i].data),
+            TestSuite::Compare::Container);
+        ++j;
+    }
+    CORRADE_COMPARE(j, count);
+}
+
+template<std::size_t size> void BitAlgorithmsTest::expandMaskedTypeSize() {
+    auto&& data = CopyMaskedTypeSizeData[testCaseInstanceId()];
+    setTestCaseTemplateName(Utility::format("{}", size));
+    setTestCaseDescription(data.name);
+
+    const Containers::BitArray maskData = typeSizeMask(data.maskOffset);
+    const Containers::BitArrayView mask = maskData.exceptPrefix(data.maskOffset);
+    CORRADE_COMPARE(mask.offset(), data.maskOffset);
+
+    const std::size_t count = mask.count();
+    Containers::Array<Item<size>> srcData{NoInit, count*data.stride};
+    for(std::size_t i = 0; i != srcData.size(); ++i)
+        for(std::size_t j = 0; j != size; ++j)
+            srcData[i].data[j] = char(i*size + j + 1);
+    const Containers::StridedArrayView1D<const Item<size>> src = Containers::stridedArrayView(srcData).every(data.stride);
+
+    Containers::Array<Item<size>> dstData{ValueInit, mask.size()*data.stride};
+    const Containers::StridedArrayView1D<Item<size>> dst = Containers::stridedArrayView(dstData).every(data.stride);
+
+    Utility::expandMasked(src, dst, mask);
+
+    const Item<size> zero{};
+    std::size_t j = 0;
+    for(std::size_t i = 0; i != mask.size(); ++i) {
+        CORRADE_ITERATION(i);
+        if(mask[i]) {
+            CORRADE_COMPARE_AS(Containers::arrayView(dst[i].data),
+                Containers::arrayView(src[j].data),
+                TestSuite::Compare::Container);
+            ++j;
+        } else CORRADE_COMPARE_AS(Containers::arrayView(dst[i].data),
+            Containers::arrayView(zero.data),
+            TestSuite::Compare::Container);
+    }
+    CORRADE_COMPARE(j, count);
+}
+
+void BitAlgorithmsTest::expandMasked() {
+    auto&& data = CopyMaskedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const std::uint64_t srcData[]{
+        2567, 28962786, 72652329, 926742716872
+    };
+    std::uint64_t dstData[]{
+        0, 0, 1, 2, 3, 0, 4, 5, 0, 0, 6, 7
+    };
+
+    Containers::StridedArrayView1D<const std::uint64_t> src = srcData;
+    Containers::StridedArrayView1D<std::uint64_t> dst = dstData;
+
+    if(data.flipSrc) src = src.flipped<0>();
+    if(data.flipDst) dst = dst.flipped<0>();
+
+    /* The mask is always in the destination order, so it's flipped together
+       with it */
+    Containers::BitArray dstMask{ValueInit, dst.size()};
+    if(data.flipDst) {
+        dstMask.set(2);
+        dstMask.set(3);
+        dstMask.set(6);
+        dstMask.set(11);
+    } else {
+        dstMask.set(0);
+        dstMask.set(5);
+        dstMask.set(8);
+        dstMask.set(9);
+    }
+    Utility::expandMasked(src, dst, dstMask);
+
+    /* Compared to copyMasked(), here flipping just one of the views changes
+       the order in which the items end up in the output */
+    if(data.flipSrc != data.flipDst) CORRADE_COMPARE_AS(Containers::arrayView(dstData), Containers::arrayView<std::uint64_t>({
+        926742716872, 0, 1, 2, 3, 72652329, 4, 5, 28962786, 2567, 6, 7
+    }), TestSuite::Compare::Container);
+    else CORRADE_COMPARE_AS(Containers::arrayView(dstData), Containers::arrayView<std::uint64_t>({
+        2567, 0, 1, 2, 3, 28962786, 4, 5, 72652329, 926742716872, 6, 7
+    }), TestSuite::Compare::Container);
+}
+
+void BitAlgorithmsTest::expandMaskedZeroSize() {
+    /* Just verify it doesn't crash or something */
+
+    Containers::ArrayView<std::uint16_t> dst;
+    Utility::expandMasked(
+        Containers::ArrayView<const std::uint16_t>{}, dst,
+        Containers::BitArrayView{});
+    CORRADE_COMPARE(dst.data(), nullptr);
+}
+
+void BitAlgorithmsTest::expandMaskedZeroBitsSet() {
+    std::uint16_t dst[567];
+    for(std::size_t i = 0; i != Containers::arraySize(dst); ++i)
+        dst[i] = i;
+
+    Utility::expandMasked(Containers::ArrayView<const std::uint16_t>{}, dst,
+        Containers::BitArray{ValueInit, Containers::arraySize(dst)});
+
+    /* The destination should stay untouched */
+    for(std::size_t i = 0; i != Containers::arraySize(dst); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], i);
+    }
+}
+
+void BitAlgorithmsTest::expandMaskedDifferentSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char src[3]{};
+    char dst[15]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    Utility::expandMasked(src, dst, Containers::BitArray{ValueInit, 14});
+    CORRADE_COMPARE(out, "Utility::expandMasked(): expected destination mask size to be 15 but got 14\n");
+}
+
+void BitAlgorithmsTest::expandMaskedDifferentBitsSet() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char src[3]{};
+    char dst[15]{};
+    Containers::BitArray dstMask{ValueInit, 15};
+    dstMask.set(7);
+    dstMask.set(9);
+
+    Containers::String out;
+    Error redirectError{&out};
+    Utility::expandMasked(src, dst, dstMask);
+    CORRADE_COMPARE(out, "Utility::expandMasked(): expected 2 source items but got 3\n");
+}
+
+void BitAlgorithmsTest::expandMaskedDifferentTypeSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const std::uint16_t src[3]{};
+    std::uint64_t dst[15]{};
+    Containers::BitArray dstMask{ValueInit, 15};
+    dstMask.set(7);
+    dstMask.set(9);
+    dstMask.set(11);
+
+    Containers::String out;
+    Error redirectError{&out};
+    Utility::expandMasked(
+        Containers::arrayCast<2, const char>(Containers::stridedArrayView(src)),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(dst)),
+        dstMask);
+    CORRADE_COMPARE(out, "Utility::expandMasked(): expected second destination dimension size to be 2 but got 8\n");
+}
+
+void BitAlgorithmsTest::expandMaskedNotContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::uint16_t a[3]{};
+    std::uint8_t b[3]{};
+    Containers::BitArray dstMask{DirectInit, 3, true};
+
+    Containers::String out;
+    Error redirectError{&out};
+    Utility::expandMasked(
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(a)).every({1, 2}),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(b)),
+        dstMask);
+    Utility::expandMasked(
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(b)),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(a)).every({1, 2}),
+        dstMask);
+    CORRADE_COMPARE(out,
+        "Utility::expandMasked(): second source view dimension is not contiguous\n"
+        "Utility::expandMasked(): second destination view dimension is not contiguous\n");
+}
+
+void BitAlgorithmsTest::maskFromPredicate() {
+    auto&& data = MaskFromPredicateData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<int> src{NoInit, data.size};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = (i*7) % 5;
+
+    /* Set all bits to verify the ones outside of the range aren't touched and
+       the ones inside are overwritten */
+    Containers::BitArray dstData{DirectInit, data.offset + data.size + 11, true};
+    Containers::MutableBitArrayView dst = dstData.sliceSize(data.offset, data.size);
+    CORRADE_COMPARE(dst.offset(), data.offset);
+
+    std::size_t expectedCount = 0;
+    for(std::size_t i = 0; i != src.size(); ++i)
+        if(src[i] > 2) ++expectedCount;
+
+    /* Passing an ArrayView to test the automagic overload */
+    CORRADE_COMPARE(Utility::maskFromPredicate(src, [](int a) {
+        return a > 2;
+    }, dst), expectedCount);
+
+    for(std::size_t i = 0; i != data.offset; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(dstData[i]);
+    }
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], src[i] > 2);
+    }
+    for(std::size_t i = data.offset + data.size; i != dstData.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(dstData[i]);
+    }
+    CORRADE_COMPARE(dst.count(), expectedCount);
+}
+
+void BitAlgorithmsTest::maskFromPredicateDifferentSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const int src[15]{};
+    Containers::BitArray dst{ValueInit, 14};
+
+    Containers::String out;
+    Error redirectError{&out};
+    Utility::maskFromPredicate(Containers::stridedArrayView(src), [](int) {
+        return true;
+    }, dst);
+    CORRADE_COMPARE(out, "Utility::maskFromPredicate(): expected destination mask size to be 15 but got 14\n");
+}
+
 CORRADE_NEVER_INLINE void copyMaskedNaive(Containers::ArrayView<const std::size_t> src, Containers::BitArrayView srcMask, Containers::ArrayView<std::size_t> dst) {
     std::size_t offset = 0;
     for(std::size_t i = 0; i != src.size(); ++i) {
@@ -278,6 +642,113 @@ void BitAlgorithmsTest::copyMaskedBenchmark() {
     CORRADE_VERIFY(out[0] || out[1]);
 }
 
+CORRADE_NEVER_INLINE void expandMaskedNaive(Containers::ArrayView<const std::size_t> src, Containers::ArrayView<std::size_t> dst, Containers::BitArrayView dstMask) {
+    std::size_t offset = 0;
+    for(std::size_t i = 0; i != dst.size(); ++i) {
+        if(!dstMask[i]) continue;
+        dst[i] = src[offset++];
+    }
+}
+
+void BitAlgorithmsTest::expandMaskedBenchmarkNaive() {
+    auto&& data = CopyMaskedBenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(format("density {}", data.density));
+
+    std::size_t positions[BenchmarkBitCount];
+    for(std::size_t i = 0; i != BenchmarkBitCount; ++i)
+        positions[i] = i;
+
+    std::random_device rd;
+    std::mt19937 g{rd()};
+    std::shuffle(positions, positions + BenchmarkBitCount, g);
+
+    Containers::BitArray dstMask{ValueInit, BenchmarkBitCount};
+    std::size_t bitCount = BenchmarkBitCount*data.density;
+    for(std::size_t i = 0; i != bitCount; ++i)
+        dstMask.set(positions[i]);
+    CORRADE_COMPARE(dstMask.count(), bitCount);
+
+    Containers::Array<std::size_t> out{ValueInit, BenchmarkBitCount};
+    CORRADE_BENCHMARK(100) {
+        expandMaskedNaive(Containers::arrayView(positions).prefix(bitCount), out, dstMask);
+    }
+
+    /* So the benchmark isn't completely discarded. At most one of the copied
+       positions is zero. */
+    std::size_t nonZeroCount = 0;
+    for(std::size_t i: out) if(i) ++nonZeroCount;
+    CORRADE_COMPARE_AS(nonZeroCount, bitCount - 1, TestSuite::Compare::GreaterOrEqual);
+}
+
+void BitAlgorithmsTest::expandMaskedBenchmark() {
+    auto&& data = CopyMaskedBenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(format("density {}", data.density));
+
+    std::size_t positions[BenchmarkBitCount];
+    for(std::size_t i = 0; i != BenchmarkBitCount; ++i)
+        positions[i] = i;
+
+    std::random_device rd;
+    std::mt19937 g{rd()};
+    std::shuffle(positions, positions + BenchmarkBitCount, g);
+
+    Containers::BitArray dstMask{ValueInit, BenchmarkBitCount};
+    std::size_t bitCount = BenchmarkBitCount*data.density;
+    for(std::size_t i = 0; i != bitCount; ++i)
+        dstMask.set(positions[i]);
+    CORRADE_COMPARE(dstMask.count(), bitCount);
+
+    Containers::Array<std::size_t> out{ValueInit, BenchmarkBitCount};
+    CORRADE_BENCHMARK(100)
+        Utility::expandMasked(Containers::arrayView(positions).prefix(bitCount), out, dstMask);
+
+    /* So the benchmark isn't completely discarded. At most one of the copied
+       positions is zero. */
+    std::size_t nonZeroCount = 0;
+    for(std::size_t i: out) if(i) ++nonZeroCount;
+    CORRADE_COMPARE_AS(nonZeroCount, bitCount - 1, TestSuite::Compare::GreaterOrEqual);
+}
+
+CORRADE_NEVER_INLINE std::size_t maskFromPredicateNaive(Containers::StridedArrayView1D<const float> src, Containers::MutableBitArrayView dst) {
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        const bool value = src[i] > 0.5f;
+        dst.set(i, value);
+        count += value;
+    }
+    return count;
+}
+
+void BitAlgorithmsTest::maskFromPredicateBenchmarkNaive() {
+    std::mt19937 g{1337};
+    std::uniform_real_distribution<float> dist;
+    float values[BenchmarkBitCount];
+    for(float& i: values) i = dist(g);
+
+    Containers::BitArray out{NoInit, BenchmarkBitCount};
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(100)
+        count += maskFromPredicateNaive(values, out);
+
+    CORRADE_COMPARE_AS(count, 0, TestSuite::Compare::Greater);
+}
+
+void BitAlgorithmsTest::maskFromPredicateBenchmark() {
+    std::mt19937 g{1337};
+    std::uniform_real_distribution<float> dist;
+    float values[BenchmarkBitCount];
+    for(float& i: values) i = dist(g);
+
+    Containers::BitArray out{NoInit, BenchmarkBitCount};
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(100)
+        count += Utility::maskFromPredicate(values, [](float a) {
+            return a > 0.5f;
+        }, out);
+
+    CORRADE_COMPARE_AS(count, 0, TestSuite::Compare::Greater);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::Utility::Test::BitAlgorithmsTest)
@@ -0,0 +1,100 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+
+#include "Corrade/Containers/Pair.h"
+#include "Corrade/Containers/Reference.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Arguments.h"
+#include "Corrade/Utility/Configuration.h"
+#include "Corrade/Utility/Format.h"
+#include "Corrade/Utility/Path.h"
+
+#include "configure.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct ConfigurationBenchmark: TestSuite::Tester {
+    explicit ConfigurationBenchmark();
+
+    void load();
+
+    private:
+        std::size_t _groupCount;
+        Containers::String _filename;
+};
+
+const struct {
+    const char* name;
+    Configuration::Flags flags;
+} LoadData[]{
+    {"", {}},
+    {"in-place", Configuration::Flag::ParseInPlace}
+};
+
+ConfigurationBenchmark::ConfigurationBenchmark(): TestSuite::Tester{TesterConfiguration{}.setSkippedArgumentPrefixes({"load"})} {
+    addInstancedBenchmarks({&ConfigurationBenchmark::load}, 3,
+        Containers::arraySize(LoadData));
+
+    /* The default makes the benchmark fast enough to be run as a part of the
+       test suite. Pass --load-groups 3000 to benchmark on a ~10 MB file. */
+    Arguments args{"load"};
+    args.addOption("groups", "100").setHelp("groups", "count of groups with 100 values each in the loaded file", "N")
+        .parse(arguments().first(), arguments().second());
+
+    _groupCount = args.value<std::size_t>("groups");
+
+    /* Generate the file upfront so it's shared by all instances. Named by
+       the group count to not reuse a file of a different size. */
+    Path::make(CONFIGURATION_WRITE_TEST_DIR);
+    _filename = Path::join(CONFIGURATION_WRITE_TEST_DIR, format("benchmark{}.conf", _groupCount));
+    std::string out;
+    for(std::size_t i = 0; i != _groupCount; ++i) {
+        out += format("# Group {}\n[group]\n", i);
+        for(std::size_t j = 0; j != 100; ++j)
+            out += format("someKey{} = a value that's long enough to not fit into SSO {}\n", j, i*100 + j);
+    }
+    Path::write(_filename, Containers::StringView{out});
+}
+
+void ConfigurationBenchmark::load() {
+    auto&& data = LoadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1) {
+        Configuration conf{_filename, data.flags|Configuration::Flag::ReadOnly};
+        count += conf.groupCount();
+    }
+
+    CORRADE_COMPARE(count, _groupCount);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::ConfigurationBenchmark)
@@ -69,6 +69,10 @@ struct ConfigurationTest: TestSuite::Tester {
     void parseHierarchicEmptySubgroup();
     void parseHierarchicMissingBracket();
     void utf8Filename();
+    void parseInPlace();
+    void parseInPlaceNoTrailingNewline();
+    void parseInPlaceStream();
+    void parseInPlaceMove();
 
     void groupIndex();
     void valueIndex();
@@ -101,21 +105,50 @@ struct ConfigurationTest: TestSuite::Tester {
     void iterateValuesEmpty();
     void iterateValuesCommentsOnly();
     void iterateValuesComments();
+
+    void indexed();
+    void indexedNonNullTerminated();
+    void indexedModify();
+    void indexedCopyMove();
+    void indexedSave();
+    void indexedDisable();
+
+    void setup();
+    void teardown();
+
+    void benchmarkLookupLinear();
+    void benchmarkLookupIndexed();
+
+    Configuration _benchmarkConfiguration;
 };
 
 using namespace Containers::Literals;
 
+const struct {
+    const char* name;
+    Configuration::Flags flags;
+} ParseData[]{
+    {"", {}},
+    {"in-place", Configuration::Flag::ParseInPlace}
+};
+
 ConfigurationTest::ConfigurationTest() {
-    addTests({&ConfigurationTest::parse,
-              &ConfigurationTest::parseMissingEquals,
-              &ConfigurationTest::parseMissingQuote,
-              &ConfigurationTest::parseMissingMultiLineQuote,
-              &ConfigurationTest::parseHierarchic,
-              &ConfigurationTest::parseHierarchicShortcuts,
-              &ConfigurationTest::parseHierarchicEmptyGroup,
+    addInstancedTests({&ConfigurationTest::parse,
+                       &ConfigurationTest::parseMissingEquals,
+                       &ConfigurationTest::parseMissingQuote,
+                       &ConfigurationTest::parseMissingMultiLineQuote,
+                       &ConfigurationTest::parseHierarchic,
+                       &ConfigurationTest::parseHierarchicShortcuts},
+        Containers::arraySize(ParseData));
+
+    addTests({&ConfigurationTest::parseHierarchicEmptyGroup,
               &ConfigurationTest::parseHierarchicEmptySubgroup,
               &ConfigurationTest::parseHierarchicMissingBracket,
               &ConfigurationTest::utf8Filename,
+              &ConfigurationTest::parseInPlace,
+              &ConfigurationTest::parseInPlaceNoTrailingNewline,
+              &ConfigurationTest::parseInPlaceStream,
+              &ConfigurationTest::parseInPlaceMove,
 
               &ConfigurationTest::groupIndex,
               &ConfigurationTest::valueIndex,
@@ -125,17 +158,21 @@ ConfigurationTest::ConfigurationTest() {
               &ConfigurationTest::readonly,
               &ConfigurationTest::readError,
               &ConfigurationTest::nonexistentFile,
-              &ConfigurationTest::truncate,
+              &ConfigurationTest::truncate});
 
-              &ConfigurationTest::whitespaces,
-              &ConfigurationTest::bom,
-              &ConfigurationTest::eol,
-              &ConfigurationTest::stripComments,
+    addInstancedTests({&ConfigurationTest::whitespaces},
+        Containers::arraySize(ParseData));
 
-              &ConfigurationTest::multiLineValue,
-              &ConfigurationTest::multiLineValueCrlf,
+    addTests({&ConfigurationTest::bom,
+              &ConfigurationTest::eol});
 
-              &ConfigurationTest::standaloneGroup,
+    addInstancedTests({&ConfigurationTest::stripComments,
+
+                       &ConfigurationTest::multiLineValue,
+                       &ConfigurationTest::multiLineValueCrlf},
+        Containers::arraySize(ParseData));
+
+    addTests({&ConfigurationTest::standaloneGroup,
               &ConfigurationTest::copy,
               &ConfigurationTest::move,
 
@@ -147,7 +184,19 @@ ConfigurationTest::ConfigurationTest() {
               &ConfigurationTest::iterateValuesRangeFor,
               &ConfigurationTest::iterateValuesEmpty,
               &ConfigurationTest::iterateValuesCommentsOnly,
-              &ConfigurationTest::iterateValuesComments});
+              &ConfigurationTest::iterateValuesComments,
+
+              &ConfigurationTest::indexed,
+              &ConfigurationTest::indexedNonNullTerminated,
+              &ConfigurationTest::indexedModify,
+              &ConfigurationTest::indexedCopyMove,
+              &ConfigurationTest::indexedSave,
+              &ConfigurationTest::indexedDisable});
+
+    addBenchmarks({&ConfigurationTest::benchmarkLookupLinear,
+                   &ConfigurationTest::benchmarkLookupIndexed}, 10,
+        &ConfigurationTest::setup,
+        &ConfigurationTest::teardown);
 
     /* Create testing dir */
     Path::make(CONFIGURATION_WRITE_TEST_DIR);
@@ -160,7 +209,10 @@ ConfigurationTest::ConfigurationTest() {
 }
 
 void ConfigurationTest::parse() {
-    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "parse.conf"));
+    auto&& data = ParseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "parse.conf"), data.flags);
     conf.setFilename(Path::join(CONFIGURATION_WRITE_TEST_DIR, "parse.conf"));
     CORRADE_VERIFY(conf.configuration() == &conf);
     CORRADE_VERIFY(conf.isValid());
@@ -215,9 +267,12 @@ void ConfigurationTest::parse() {
 }
 
 void ConfigurationTest::parseMissingEquals() {
+    auto&& data = ParseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
     Containers::String out;
     Error redirectError{&out};
-    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "missing-equals.conf"));
+    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "missing-equals.conf"), data.flags);
 
     /* Nothing remains, filename is empty and valid bit is not set */
     CORRADE_VERIFY(!conf.isValid());
@@ -227,9 +282,12 @@ void ConfigurationTest::parseMissingEquals() {
 }
 
 void ConfigurationTest::parseMissingQuote() {
+    auto&& data = ParseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
     Containers::String out;
     Error redirectError{&out};
-    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "missing-quote.conf"));
+    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "missing-quote.conf"), data.flags);
 
     /* Nothing remains, filename is empty and valid bit is not set */
     CORRADE_VERIFY(!conf.isValid());
@@ -239,9 +297,12 @@ void ConfigurationTest::parseMissingQuote() {
 }
 
 void ConfigurationTest::parseMissingMultiLineQuote() {
+    auto&& data = ParseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
     Containers::String out;
     Error redirectError{&out};
-    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "missing-multiline-quote.conf"));
+    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "missing-multiline-quote.conf"), data.flags);
 
     /* Nothing remains, filename is empty and valid bit is not set */
     CORRADE_VERIFY(!conf.isValid());
@@ -251,7 +312,10 @@ void ConfigurationTest::parseMissingMultiLineQuote() {
 }
 
 void ConfigurationTest::parseHierarchic() {
-    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "hierarchic.conf"));
+    auto&& data = ParseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "hierarchic.conf"), data.flags);
     conf.setFilename(Path::join(CONFIGURATION_WRITE_TEST_DIR, "hierarchic.conf"));
     CORRADE_VERIFY(conf.isValid());
     CORRADE_VERIFY(!conf.isEmpty());
@@ -285,7 +349,10 @@ void ConfigurationTest::parseHierarchic() {
 }
 
 void ConfigurationTest::parseHierarchicShortcuts() {
-    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "hierarchic-shortcuts.conf"));
+    auto&& data = ParseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "hierarchic-shortcuts.conf"), data.flags);
     conf.setFilename(Path::join(CONFIGURATION_WRITE_TEST_DIR, "hierarchic-shortcuts.conf"));
     CORRADE_VERIFY(conf.isValid());
     CORRADE_VERIFY(!conf.isEmpty());
@@ -366,6 +433,73 @@ void ConfigurationTest::utf8Filename() {
                        TestSuite::Compare::File);
 }
 
+void ConfigurationTest::parseInPlace() {
+    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "parse.conf"), Configuration::Flag::ParseInPlace|Configuration::Flag::ReadOnly);
+    CORRADE_VERIFY(conf.isValid());
+
+    /* The values are null-terminated even though they reference the file
+       contents */
+    Containers::StringView value = conf.group("group", 1)->value<Containers::StringView>("c", 1);
+    CORRADE_COMPARE(value, "value5");
+    CORRADE_VERIFY(value.flags() & Containers::StringViewFlag::NullTerminated);
+    CORRADE_COMPARE(value.data()[value.size()], '\0');
+
+    /* Setting a value makes a copy, the other values stay untouched */
+    conf.group("group", 1)->setValue("c", "a much longer value that doesn't fit into the original", 1);
+    CORRADE_COMPARE(conf.group("group", 1)->value("c", 1), "a much longer value that doesn't fit into the original");
+    CORRADE_COMPARE(conf.group("group", 1)->value("c", 0), "value4");
+    CORRADE_COMPARE(conf.value("key"), "value");
+
+    /* A copied group owns its data, so it outlives the configuration */
+    ConfigurationGroup copy;
+    {
+        Configuration another(Path::join(CONFIGURATION_TEST_DIR, "parse.conf"), Configuration::Flag::ParseInPlace);
+        copy = *another.group("group", 1);
+    }
+    CORRADE_COMPARE_AS(copy.values("c"),
+        (std::vector<std::string>{"value4", "value5"}), TestSuite::Compare::Container);
+}
+
+void ConfigurationTest::parseInPlaceNoTrailingNewline() {
+    /* The last value has no space for a null terminator after, so it has to
+       be copied */
+    Containers::String filename = Path::join(CONFIGURATION_WRITE_TEST_DIR, "no-trailing-newline.conf");
+    CORRADE_VERIFY(Path::write(filename, "a=hello\n# comment\nb=  \"world \""_s));
+
+    Configuration conf(filename, Configuration::Flag::ParseInPlace|Configuration::Flag::ReadOnly);
+    CORRADE_VERIFY(conf.isValid());
+    CORRADE_COMPARE(conf.value("a"), "hello");
+    CORRADE_COMPARE(conf.value("b"), "world ");
+    CORRADE_VERIFY(conf.value<Containers::StringView>("b").flags() & Containers::StringViewFlag::NullTerminated);
+
+    std::ostringstream out;
+    conf.save(out);
+    CORRADE_COMPARE(out.str(), "a=hello\n# comment\nb=\"world \"\n");
+}
+
+void ConfigurationTest::parseInPlaceStream() {
+    /* Parsing from a stream ignores the flag as there's no memory that could
+       be referenced */
+    std::istringstream in("a=hello\nb=world\n");
+    Configuration conf{in, Configuration::Flag::ParseInPlace};
+    CORRADE_VERIFY(conf.isValid());
+    CORRADE_COMPARE(conf.value("a"), "hello");
+    CORRADE_COMPARE(conf.value("b"), "world");
+}
+
+void ConfigurationTest::parseInPlaceMove() {
+    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "hierarchic.conf"), Configuration::Flag::ParseInPlace|Configuration::Flag::ReadOnly);
+    CORRADE_VERIFY(conf.isValid());
+
+    /* Moving the configuration moves the referenced data as well */
+    Configuration moved{Utility::move(conf)};
+    CORRADE_COMPARE(moved.group("a", 1)->group("b")->value("key2"), "val5");
+
+    Configuration assigned;
+    assigned = Utility::move(moved);
+    CORRADE_COMPARE(assigned.group("z")->group("x")->group("c")->group("v")->value("key1"), "val1");
+}
+
 void ConfigurationTest::groupIndex() {
     std::istringstream in("[a]\n[a]\n");
     Configuration conf(in);
@@ -490,7 +624,10 @@ void ConfigurationTest::truncate() {
 }
 
 void ConfigurationTest::whitespaces() {
-    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "whitespaces.conf"));
+    auto&& data = ParseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "whitespaces.conf"), data.flags);
     conf.setFilename(Path::join(CONFIGURATION_WRITE_TEST_DIR, "whitespaces.conf"));
     conf.save();
 
@@ -573,7 +710,10 @@ void ConfigurationTest::eol() {
 }
 
 void ConfigurationTest::stripComments() {
-    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "comments.conf"), Configuration::Flag::SkipComments);
+    auto&& data = ParseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "comments.conf"), Configuration::Flag::SkipComments|data.flags);
     CORRADE_VERIFY(conf.isValid());
     CORRADE_VERIFY(!conf.isEmpty());
 
@@ -587,11 +727,14 @@ void ConfigurationTest::stripComments() {
 }
 
 void ConfigurationTest::multiLineValue() {
+    auto&& data = ParseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
     /* Remove previous saved file */
     if(Path::exists(Path::join(CONFIGURATION_WRITE_TEST_DIR, "multiLine.conf")))
         CORRADE_VERIFY(Path::remove(Path::join(CONFIGURATION_WRITE_TEST_DIR, "multiLine.conf")));
 
-    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "multiLine.conf"));
+    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "multiLine.conf"), data.flags);
     conf.setFilename(Path::join(CONFIGURATION_WRITE_TEST_DIR, "multiLine.conf"));
     CORRADE_VERIFY(conf.isValid());
     CORRADE_VERIFY(!conf.isEmpty());
@@ -608,11 +751,14 @@ void ConfigurationTest::multiLineValue() {
 }
 
 void ConfigurationTest::multiLineValueCrlf() {
+    auto&& data = ParseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
     /* Remove previous saved file */
     if(Path::exists(Path::join(CONFIGURATION_WRITE_TEST_DIR, "multiLine-crlf.conf")))
         CORRADE_VERIFY(Path::remove(Path::join(CONFIGURATION_WRITE_TEST_DIR, "multiLine-crlf.conf")));
 
-    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "multiLine-crlf.conf"));
+    Configuration conf(Path::join(CONFIGURATION_TEST_DIR, "multiLine-crlf.conf"), data.flags);
     conf.setFilename(Path::join(CONFIGURATION_WRITE_TEST_DIR, "multiLine-crlf.conf"));
     CORRADE_VERIFY(conf.isValid());
     CORRADE_VERIFY(!conf.isEmpty());
@@ -878,6 +1024,277 @@ void ConfigurationTest::iterateValuesComments() {
     CORRADE_VERIFY(++it == valuesComments.end());
 }
 
+void ConfigurationTest::indexed() {
+    std::istringstream in(
+        "# A comment\n"
+        "a=1\n"
+        "b=2\n"
+        "a=3\n"
+        "[group]\n"
+        "[another]\n"
+        "[group]\n"
+        "c=4\n");
+    Configuration conf(in);
+    CORRADE_VERIFY(conf.isValid());
+    CORRADE_VERIFY(!conf.isIndexed());
+
+    conf.setIndexed(true);
+    CORRADE_VERIFY(conf.isIndexed());
+
+    CORRADE_VERIFY(conf.hasValue("a"));
+    CORRADE_VERIFY(conf.hasValue("a", 1));
+    CORRADE_VERIFY(!conf.hasValue("a", 2));
+    CORRADE_VERIFY(conf.hasValue("b"));
+    CORRADE_VERIFY(!conf.hasValue("b", 1));
+    CORRADE_VERIFY(!conf.hasValue("c"));
+    CORRADE_COMPARE(conf.valueCount("a"), 2);
+    CORRADE_COMPARE(conf.valueCount("c"), 0);
+    CORRADE_COMPARE(conf.value<int>("a"), 1);
+    CORRADE_COMPARE(conf.value<int>("a", 1), 3);
+    CORRADE_COMPARE(conf.value<int>("b"), 2);
+    CORRADE_COMPARE(conf.value("c"), "");
+    CORRADE_COMPARE_AS(conf.values<int>("a"),
+        (std::vector<int>{1, 3}),
+        TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(conf.hasGroup("group"));
+    CORRADE_VERIFY(conf.hasGroup("group", 1));
+    CORRADE_VERIFY(!conf.hasGroup("group", 2));
+    CORRADE_VERIFY(conf.hasGroup("another"));
+    CORRADE_VERIFY(!conf.hasGroup("c"));
+    CORRADE_COMPARE(conf.groupCount("group"), 2);
+    CORRADE_COMPARE(conf.groups("group").size(), 2);
+    CORRADE_VERIFY(!conf.group("c"));
+    CORRADE_VERIFY(!conf.group("group")->hasValue("c"));
+    CORRADE_COMPARE(conf.group("group", 1)->value<int>("c"), 4);
+
+    /* Comments aren't in the index, but looking them up still works the same
+       as without the index */
+    CORRADE_VERIFY(conf.hasValue(""));
+    CORRADE_COMPARE(conf.value(""), "# A comment");
+}
+
+void ConfigurationTest::indexedNonNullTerminated() {
+    ConfigurationGroup group;
+    group.setIndexed(true);
+    group.setValue("key", 3);
+    group.setValue("keys", 4);
+    group.addGroup("keyring");
+
+    /* The lookup takes a view, so a non-null-terminated slice is fine */
+    Containers::StringView view = "keysandkeyrings"_s;
+    CORRADE_VERIFY(!(view.prefix(4).flags() & Containers::StringViewFlag::NullTerminated));
+    CORRADE_COMPARE(group.value<int>(view.prefix(3)), 3);
+    CORRADE_COMPARE(group.value<int>(view.prefix(4)), 4);
+    CORRADE_VERIFY(!group.hasValue(view.prefix(2)));
+    CORRADE_VERIFY(group.hasGroup(view.slice(7, 14)));
+    CORRADE_VERIFY(!group.hasGroup(view.slice(7, 15)));
+}
+
+void ConfigurationTest::indexedModify() {
+    ConfigurationGroup group;
+    group.setIndexed(true);
+
+    /* Enough values to make the table grow several times */
+    for(std::size_t i = 0; i != 100; ++i) {
+        group.setValue(Utility::format("value{}", i), i);
+        group.addGroup(Utility::format("group{}", i))->setValue("id", i);
+    }
+    group.addValue("value50", 1050);
+    group.addGroup("group50")->setValue("id", 1050);
+    CORRADE_COMPARE(group.valueCount(), 101);
+    CORRADE_COMPARE(group.value<int>("value0"), 0);
+    CORRADE_COMPARE(group.value<int>("value99"), 99);
+    CORRADE_COMPARE(group.value<int>("value50", 1), 1050);
+    CORRADE_COMPARE(group.group("group73")->value<int>("id"), 73);
+    CORRADE_COMPARE(group.group("group50", 1)->value<int>("id"), 1050);
+    CORRADE_VERIFY(!group.hasValue("value100"));
+
+    /* Setting an existing value doesn't add anything, setting a new appends */
+    CORRADE_VERIFY(group.setValue("value50", 2050, 1));
+    CORRADE_VERIFY(group.setValue("value50", 3050, 2));
+    CORRADE_COMPARE(group.valueCount("value50"), 3);
+    CORRADE_COMPARE(group.value<int>("value50", 1), 2050);
+    CORRADE_COMPARE(group.value<int>("value50", 2), 3050);
+
+    /* Removing shifts positions of the remaining items, so the index has to
+       be rebuilt */
+    CORRADE_VERIFY(group.removeValue("value50"));
+    CORRADE_VERIFY(group.removeValue("value10"));
+    CORRADE_COMPARE(group.valueCount("value50"), 2);
+    CORRADE_COMPARE(group.value<int>("value50"), 2050);
+    CORRADE_COMPARE(group.value<int>("value11"), 11);
+    CORRADE_VERIFY(!group.hasValue("value10"));
+    CORRADE_COMPARE(group.value<int>("value99"), 99);
+
+    group.removeAllValues("value50");
+    CORRADE_VERIFY(!group.hasValue("value50"));
+    CORRADE_COMPARE(group.value<int>("value51"), 51);
+
+    CORRADE_VERIFY(group.removeGroup("group0"));
+    CORRADE_VERIFY(group.removeGroup(group.group("group1")));
+    group.removeAllGroups("group50");
+    CORRADE_VERIFY(!group.hasGroup("group0"));
+    CORRADE_VERIFY(!group.hasGroup("group1"));
+    CORRADE_VERIFY(!group.hasGroup("group50"));
+    CORRADE_COMPARE(group.group("group2")->value<int>("id"), 2);
+    CORRADE_COMPARE(group.group("group99")->value<int>("id"), 99);
+
+    group.clear();
+    CORRADE_VERIFY(group.isIndexed());
+    CORRADE_VERIFY(!group.hasValue("value99"));
+    CORRADE_VERIFY(!group.hasGroup("group99"));
+
+    group.setValue("value99", 99);
+    CORRADE_COMPARE(group.value<int>("value99"), 99);
+}
+
+void ConfigurationTest::indexedCopyMove() {
+    ConfigurationGroup group;
+    group.setIndexed(true);
+    group.setValue("a", 1);
+    group.addGroup("b")->setValue("c", 2);
+
+    ConfigurationGroup copy{group};
+    CORRADE_VERIFY(copy.isIndexed());
+    /* Subgroups aren't indexed unless asked to */
+    CORRADE_VERIFY(!copy.group("b")->isIndexed());
+    copy.setValue("d", 3);
+    CORRADE_COMPARE(copy.value<int>("a"), 1);
+    CORRADE_COMPARE(copy.value<int>("d"), 3);
+    CORRADE_COMPARE(copy.group("b")->value<int>("c"), 2);
+    CORRADE_VERIFY(!group.hasValue("d"));
+
+    ConfigurationGroup copyAssigned;
+    copyAssigned = copy;
+    CORRADE_VERIFY(copyAssigned.isIndexed());
+    CORRADE_COMPARE(copyAssigned.value<int>("d"), 3);
+
+    ConfigurationGroup moved{Utility::move(copy)};
+    CORRADE_VERIFY(moved.isIndexed());
+    CORRADE_VERIFY(!copy.isIndexed());
+    CORRADE_VERIFY(!copy.hasValue("a"));
+    CORRADE_COMPARE(moved.value<int>("d"), 3);
+
+    ConfigurationGroup moveAssigned;
+    moveAssigned = Utility::move(moved);
+    CORRADE_VERIFY(moveAssigned.isIndexed());
+    CORRADE_COMPARE(moveAssigned.value<int>("d"), 3);
+    CORRADE_COMPARE(moveAssigned.group("b")->value<int>("c"), 2);
+
+    /* Move assignment to an indexed instance with values shouldn't leave the
+       moved-from instance with an index of those */
+    ConfigurationGroup moveAssignedIndexed;
+    moveAssignedIndexed.setIndexed(true);
+    moveAssignedIndexed.setValue("e", 4);
+    moveAssignedIndexed.setValue("f", 5);
+    moveAssignedIndexed.addGroup("g");
+    ConfigurationGroup source{copyAssigned};
+    moveAssignedIndexed = Utility::move(source);
+    CORRADE_VERIFY(moveAssignedIndexed.isIndexed());
+    CORRADE_VERIFY(!moveAssignedIndexed.hasValue("e"));
+    CORRADE_COMPARE(moveAssignedIndexed.value<int>("d"), 3);
+    CORRADE_VERIFY(!source.isIndexed());
+    CORRADE_VERIFY(!source.hasValue("e"));
+    CORRADE_VERIFY(!source.hasValue("f"));
+    CORRADE_VERIFY(!source.hasGroup("g"));
+
+    /* The moved-from instance is still usable */
+    source.setValue("f", 6);
+    CORRADE_COMPARE(source.value<int>("f"), 6);
+}
+
+void ConfigurationTest::indexedSave() {
+    std::stringstream in(
+        "# A comment\n"
+        "b=2\n"
+        "a=1\n"
+        "b=3\n"
+        "[z]\n"
+        "[y]\n");
+    Configuration conf{in};
+    CORRADE_VERIFY(conf.isValid());
+    conf.setIndexed(true);
+
+    conf.addValue("a", 4);
+    conf.addGroup("x");
+    conf.addGroup("z");
+    CORRADE_VERIFY(conf.removeValue("b"));
+
+    /* The index doesn't affect the order in which values are saved */
+    std::stringstream out;
+    conf.save(out);
+    CORRADE_COMPARE(out.str(),
+        "# A comment\n"
+        "a=1\n"
+        "b=3\n"
+        "a=4\n"
+        "[z]\n"
+        "[y]\n"
+        "[x]\n"
+        "[z]\n");
+}
+
+void ConfigurationTest::indexedDisable() {
+    ConfigurationGroup group;
+    group.setIndexed(true);
+    group.setValue("a", 1);
+
+    group.setIndexed(false);
+    CORRADE_VERIFY(!group.isIndexed());
+    group.setValue("b", 2);
+    CORRADE_COMPARE(group.value<int>("a"), 1);
+    CORRADE_COMPARE(group.value<int>("b"), 2);
+
+    /* Enabling again picks up values added in the meantime */
+    group.setIndexed(true);
+    CORRADE_COMPARE(group.value<int>("b"), 2);
+}
+
+constexpr std::size_t BenchmarkValueCount = 5000;
+
+void ConfigurationTest::setup() {
+    _benchmarkConfiguration.clear();
+    /* The keys are unique, so addValue() can be used. setValue() would search
+       for an existing key each time, making the setup quadratic. */
+    for(std::size_t i = 0; i != BenchmarkValueCount; ++i)
+        _benchmarkConfiguration.addValue(Utility::format("a.rather.long.key.{}", i), i);
+}
+
+void ConfigurationTest::teardown() {
+    _benchmarkConfiguration.setIndexed(false);
+    _benchmarkConfiguration.clear();
+}
+
+void ConfigurationTest::benchmarkLookupLinear() {
+    /* Look up every 50th key, which should give a representative average */
+    std::vector<std::string> keys;
+    for(std::size_t i = 0; i < BenchmarkValueCount; i += 50)
+        keys.push_back(Utility::format("a.rather.long.key.{}", i));
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(const std::string& key: keys)
+            sum += _benchmarkConfiguration.value<std::size_t>(key);
+
+    CORRADE_COMPARE(sum, 247500);
+}
+
+void ConfigurationTest::benchmarkLookupIndexed() {
+    _benchmarkConfiguration.setIndexed(true);
+
+    std::vector<std::string> keys;
+    for(std::size_t i = 0; i < BenchmarkValueCount; i += 50)
+        keys.push_back(Utility::format("a.rather.long.key.{}", i));
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(const std::string& key: keys)
+            sum += _benchmarkConfiguration.value<std::size_t>(key);
+
+    CORRADE_COMPARE(sum, 247500);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::Utility::Test::ConfigurationTest)
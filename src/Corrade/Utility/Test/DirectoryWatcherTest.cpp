@@ -0,0 +1,439 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/Optional.h"
+#include "Corrade/Containers/Pair.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
+#include "Corrade/TestSuite/Compare/String.h"
+#include "Corrade/Utility/DirectoryWatcher.h"
+#include "Corrade/Utility/Path.h"
+#include "Corrade/Utility/System.h"
+
+#include "configure.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct DirectoryWatcherTest: TestSuite::Tester {
+    explicit DirectoryWatcherTest();
+
+    void nonexistent();
+
+    void setup();
+    void teardown();
+
+    void empty();
+    void created();
+    void modified();
+    void deleted();
+    void subdirectoryCreated();
+    void subdirectoryDeleted();
+    void fileReplacedWithDirectory();
+    void rootDeleted();
+
+    void debounce();
+    void debounceCoalesce();
+
+    void waitForChanges();
+    void waitForChangesTimeout();
+
+    void move();
+
+    void debugChange();
+
+    private:
+        Containers::String _path;
+};
+
+typedef Containers::Pair<Containers::String, DirectoryWatcher::Change> Change;
+
+DirectoryWatcherTest::DirectoryWatcherTest() {
+    addTests({&DirectoryWatcherTest::nonexistent});
+
+    addTests({&DirectoryWatcherTest::empty,
+              &DirectoryWatcherTest::created,
+              &DirectoryWatcherTest::modified,
+              &DirectoryWatcherTest::deleted,
+              &DirectoryWatcherTest::subdirectoryCreated,
+              &DirectoryWatcherTest::subdirectoryDeleted,
+              &DirectoryWatcherTest::fileReplacedWithDirectory,
+              &DirectoryWatcherTest::rootDeleted,
+
+              &DirectoryWatcherTest::debounce,
+              &DirectoryWatcherTest::debounceCoalesce,
+
+              &DirectoryWatcherTest::waitForChanges,
+              &DirectoryWatcherTest::waitForChangesTimeout,
+
+              &DirectoryWatcherTest::move},
+             &DirectoryWatcherTest::setup, &DirectoryWatcherTest::teardown);
+
+    addTests({&DirectoryWatcherTest::debugChange});
+
+    _path = Path::join(DIRECTORYWATCHER_WRITE_TEST_DIR, "watched");
+}
+
+using namespace Containers::Literals;
+
+/* There's no Path API for recursive removal, and the tree is shallow */
+void removeRecursive(const Containers::StringView path) {
+    if(!Path::exists(path)) return;
+    if(Path::isDirectory(path)) {
+        if(Containers::Optional<Containers::Array<Containers::String>> list = Path::list(path, Path::ListFlag::SkipDotAndDotDot))
+            for(const Containers::String& name: *list)
+                removeRecursive(Path::join(path, name));
+    }
+    Path::remove(path);
+}
+
+/* So we don't write at the same nanosecond, see FileWatcherTest for details */
+void waitForTimestampChange() {
+    #if defined(CORRADE_TARGET_APPLE) || defined(CORRADE_TARGET_WINDOWS) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    System::sleep(1100);
+    #else
+    System::sleep(10);
+    #endif
+}
+
+void DirectoryWatcherTest::nonexistent() {
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        DirectoryWatcher watcher{"nonexistent"};
+        CORRADE_COMPARE(watcher.path(), "nonexistent");
+        CORRADE_VERIFY(!watcher.isValid());
+        CORRADE_COMPARE_AS(watcher.changes(),
+            Containers::arrayView<Change>({}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(watcher.waitForChanges(1000),
+            Containers::arrayView<Change>({}),
+            TestSuite::Compare::Container);
+    }
+
+    /* Error reported only once */
+    CORRADE_COMPARE_AS(out,
+        "Utility::Path::list(): can't list nonexistent: error ",
+        TestSuite::Compare::StringHasPrefix);
+    CORRADE_COMPARE(out.count('\n'), 1);
+}
+
+void DirectoryWatcherTest::setup() {
+    removeRecursive(_path);
+    Path::make(Path::join(_path, "sub/deep"));
+    Path::write(Path::join(_path, "a.txt"), "hello"_s);
+    Path::write(Path::join(_path, "sub/b.txt"), "hello"_s);
+    Path::write(Path::join(_path, "sub/deep/c.txt"), "hello"_s);
+}
+
+void DirectoryWatcherTest::teardown() {
+    removeRecursive(_path);
+}
+
+void DirectoryWatcherTest::empty() {
+    DirectoryWatcher watcher{_path};
+    CORRADE_COMPARE(watcher.path(), _path);
+    CORRADE_VERIFY(watcher.isValid());
+    CORRADE_COMPARE(watcher.debounce(), 0);
+
+    /* Nothing is reported for the initial state */
+    CORRADE_COMPARE_AS(watcher.changes(),
+        Containers::arrayView<Change>({}),
+        TestSuite::Compare::Container);
+
+    /* Reading a file isn't a change */
+    CORRADE_COMPARE(Path::readString(Path::join(_path, "sub/b.txt")), Containers::String{"hello"});
+    CORRADE_COMPARE_AS(watcher.changes(),
+        Containers::arrayView<Change>({}),
+        TestSuite::Compare::Container);
+}
+
+void DirectoryWatcherTest::created() {
+    DirectoryWatcher watcher{_path};
+
+    CORRADE_VERIFY(Path::write(Path::join(_path, "sub/deep/new.txt"), "ahoy"_s));
+    CORRADE_VERIFY(Path::write(Path::join(_path, "new.txt"), "ahoy"_s));
+
+    /* Sorted by path */
+    CORRADE_COMPARE_AS(watcher.changes(), Containers::arrayView<Change>({
+        {"new.txt"_s, DirectoryWatcher::Change::Created},
+        {"sub/deep/new.txt"_s, DirectoryWatcher::Change::Created},
+    }), TestSuite::Compare::Container);
+
+    /* Nothing changed second time */
+    CORRADE_COMPARE_AS(watcher.changes(),
+        Containers::arrayView<Change>({}),
+        TestSuite::Compare::Container);
+}
+
+void DirectoryWatcherTest::modified() {
+    DirectoryWatcher watcher{_path};
+
+    waitForTimestampChange();
+    CORRADE_VERIFY(Path::write(Path::join(_path, "sub/b.txt"), "ahoy"_s));
+
+    CORRADE_COMPARE_AS(watcher.changes(), Containers::arrayView<Change>({
+        {"sub/b.txt"_s, DirectoryWatcher::Change::Modified},
+    }), TestSuite::Compare::Container);
+
+    /* Replacing a file by moving another over it is a modification as well */
+    waitForTimestampChange();
+    CORRADE_VERIFY(Path::write(Path::join(DIRECTORYWATCHER_WRITE_TEST_DIR, "replacement.txt"), "hello again"_s));
+    CORRADE_VERIFY(Path::move(Path::join(DIRECTORYWATCHER_WRITE_TEST_DIR, "replacement.txt"), Path::join(_path, "a.txt")));
+
+    CORRADE_COMPARE_AS(watcher.changes(), Containers::arrayView<Change>({
+        {"a.txt"_s, DirectoryWatcher::Change::Modified},
+    }), TestSuite::Compare::Container);
+}
+
+void DirectoryWatcherTest::deleted() {
+    DirectoryWatcher watcher{_path};
+
+    CORRADE_VERIFY(Path::remove(Path::join(_path, "sub/deep/c.txt")));
+    CORRADE_VERIFY(Path::remove(Path::join(_path, "a.txt")));
+
+    CORRADE_COMPARE_AS(watcher.changes(), Containers::arrayView<Change>({
+        {"a.txt"_s, DirectoryWatcher::Change::Deleted},
+        {"sub/deep/c.txt"_s, DirectoryWatcher::Change::Deleted},
+    }), TestSuite::Compare::Container);
+}
+
+void DirectoryWatcherTest::subdirectoryCreated() {
+    DirectoryWatcher watcher{_path};
+
+    CORRADE_VERIFY(Path::make(Path::join(_path, "sub/new/deeper")));
+    CORRADE_VERIFY(Path::write(Path::join(_path, "sub/new/d.txt"), "ahoy"_s));
+    CORRADE_VERIFY(Path::write(Path::join(_path, "sub/new/deeper/e.txt"), "ahoy"_s));
+
+    /* The directories themselves aren't reported */
+    CORRADE_COMPARE_AS(watcher.changes(), Containers::arrayView<Change>({
+        {"sub/new/d.txt"_s, DirectoryWatcher::Change::Created},
+        {"sub/new/deeper/e.txt"_s, DirectoryWatcher::Change::Created},
+    }), TestSuite::Compare::Container);
+
+    /* Changes in the new directories are detected as well */
+    waitForTimestampChange();
+    CORRADE_VERIFY(Path::write(Path::join(_path, "sub/new/deeper/e.txt"), "hello"_s));
+    CORRADE_COMPARE_AS(watcher.changes(), Containers::arrayView<Change>({
+        {"sub/new/deeper/e.txt"_s, DirectoryWatcher::Change::Modified},
+    }), TestSuite::Compare::Container);
+}
+
+void DirectoryWatcherTest::subdirectoryDeleted() {
+    DirectoryWatcher watcher{_path};
+
+    removeRecursive(Path::join(_path, "sub"));
+
+    CORRADE_COMPARE_AS(watcher.changes(), Containers::arrayView<Change>({
+        {"sub/b.txt"_s, DirectoryWatcher::Change::Deleted},
+        {"sub/deep/c.txt"_s, DirectoryWatcher::Change::Deleted},
+    }), TestSuite::Compare::Container);
+    CORRADE_VERIFY(watcher.isValid());
+
+    /* Recreating it again works */
+    CORRADE_VERIFY(Path::make(Path::join(_path, "sub")));
+    CORRADE_VERIFY(Path::write(Path::join(_path, "sub/b.txt"), "hello"_s));
+    CORRADE_COMPARE_AS(watcher.changes(), Containers::arrayView<Change>({
+        {"sub/b.txt"_s, DirectoryWatcher::Change::Created},
+    }), TestSuite::Compare::Container);
+}
+
+void DirectoryWatcherTest::fileReplacedWithDirectory() {
+    DirectoryWatcher watcher{_path};
+
+    CORRADE_VERIFY(Path::remove(Path::join(_path, "a.txt")));
+    CORRADE_VERIFY(Path::make(Path::join(_path, "a.txt")));
+    CORRADE_VERIFY(Path::write(Path::join(_path, "a.txt/f.txt"), "ahoy"_s));
+
+    CORRADE_COMPARE_AS(watcher.changes(), Containers::arrayView<Change>({
+        {"a.txt"_s, DirectoryWatcher::Change::Deleted},
+        {"a.txt/f.txt"_s, DirectoryWatcher::Change::Created},
+    }), TestSuite::Compare::Container);
+}
+
+void DirectoryWatcherTest::rootDeleted() {
+    DirectoryWatcher watcher{_path};
+
+    removeRecursive(_path);
+
+    /* All files are reported as deleted and the watcher gets invalid. Print
+       of the error is expected. */
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        CORRADE_COMPARE_AS(watcher.changes(), Containers::arrayView<Change>({
+            {"a.txt"_s, DirectoryWatcher::Change::Deleted},
+            {"sub/b.txt"_s, DirectoryWatcher::Change::Deleted},
+            {"sub/deep/c.txt"_s, DirectoryWatcher::Change::Deleted},
+        }), TestSuite::Compare::Container);
+    }
+    CORRADE_VERIFY(!watcher.isValid());
+    CORRADE_COMPARE_AS(out,
+        "Utility::Path::list(): can't list ",
+        TestSuite::Compare::StringHasPrefix);
+
+    /* And it won't recover from it */
+    setup();
+    CORRADE_COMPARE_AS(watcher.changes(),
+        Containers::arrayView<Change>({}),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(!watcher.isValid());
+}
+
+void DirectoryWatcherTest::debounce() {
+    DirectoryWatcher watcher{_path};
+    watcher.setDebounce(200);
+    CORRADE_COMPARE(watcher.debounce(), 200);
+
+    CORRADE_VERIFY(Path::write(Path::join(_path, "new.txt"), "ahoy"_s));
+
+    /* Held back until the debounce duration passes */
+    CORRADE_COMPARE_AS(watcher.changes(),
+        Containers::arrayView<Change>({}),
+        TestSuite::Compare::Container);
+
+    /* Another change resets the duration */
+    System::sleep(100);
+    CORRADE_VERIFY(Path::write(Path::join(_path, "sub/new.txt"), "ahoy"_s));
+    CORRADE_COMPARE_AS(watcher.changes(),
+        Containers::arrayView<Change>({}),
+        TestSuite::Compare::Container);
+
+    System::sleep(250);
+    CORRADE_COMPARE_AS(watcher.changes(), Containers::arrayView<Change>({
+        {"new.txt"_s, DirectoryWatcher::Change::Created},
+        {"sub/new.txt"_s, DirectoryWatcher::Change::Created},
+    }), TestSuite::Compare::Container);
+}
+
+void DirectoryWatcherTest::debounceCoalesce() {
+    DirectoryWatcher watcher{_path};
+    watcher.setDebounce(200);
+
+    /* Created and modified is reported as created */
+    CORRADE_VERIFY(Path::write(Path::join(_path, "new.txt"), "ahoy"_s));
+    CORRADE_COMPARE_AS(watcher.changes(),
+        Containers::arrayView<Change>({}),
+        TestSuite::Compare::Container);
+    waitForTimestampChange();
+    CORRADE_VERIFY(Path::write(Path::join(_path, "new.txt"), "ahoy again"_s));
+
+    /* Created and deleted isn't reported at all */
+    CORRADE_VERIFY(Path::write(Path::join(_path, "temporary.txt"), "ahoy"_s));
+    CORRADE_COMPARE_AS(watcher.changes(),
+        Containers::arrayView<Change>({}),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(Path::remove(Path::join(_path, "temporary.txt")));
+
+    /* Deleted and created again is reported as modified */
+    CORRADE_VERIFY(Path::remove(Path::join(_path, "sub/b.txt")));
+    CORRADE_COMPARE_AS(watcher.changes(),
+        Containers::arrayView<Change>({}),
+        TestSuite::Compare::Container);
+    waitForTimestampChange();
+    CORRADE_VERIFY(Path::write(Path::join(_path, "sub/b.txt"), "hello again"_s));
+
+    /* Modified and deleted is reported as deleted */
+    waitForTimestampChange();
+    CORRADE_VERIFY(Path::write(Path::join(_path, "a.txt"), "ahoy"_s));
+    CORRADE_COMPARE_AS(watcher.changes(),
+        Containers::arrayView<Change>({}),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(Path::remove(Path::join(_path, "a.txt")));
+    CORRADE_COMPARE_AS(watcher.changes(),
+        Containers::arrayView<Change>({}),
+        TestSuite::Compare::Container);
+
+    System::sleep(250);
+    CORRADE_COMPARE_AS(watcher.changes(), Containers::arrayView<Change>({
+        {"a.txt"_s, DirectoryWatcher::Change::Deleted},
+        {"new.txt"_s, DirectoryWatcher::Change::Created},
+        {"sub/b.txt"_s, DirectoryWatcher::Change::Modified},
+    }), TestSuite::Compare::Container);
+}
+
+void DirectoryWatcherTest::waitForChanges() {
+    DirectoryWatcher watcher{_path};
+    watcher.setDebounce(50);
+
+    CORRADE_VERIFY(Path::write(Path::join(_path, "sub/deep/new.txt"), "ahoy"_s));
+
+    /* Waits for the debounce duration, but not for the whole timeout */
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    CORRADE_COMPARE_AS(watcher.waitForChanges(5000), Containers::arrayView<Change>({
+        {"sub/deep/new.txt"_s, DirectoryWatcher::Change::Created},
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count(),
+        50,
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE_AS(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count(),
+        2500,
+        TestSuite::Compare::Less);
+}
+
+void DirectoryWatcherTest::waitForChangesTimeout() {
+    DirectoryWatcher watcher{_path};
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    CORRADE_COMPARE_AS(watcher.waitForChanges(150),
+        Containers::arrayView<Change>({}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count(),
+        150,
+        TestSuite::Compare::GreaterOrEqual);
+}
+
+void DirectoryWatcherTest::move() {
+    DirectoryWatcher a{_path};
+    a.setDebounce(0);
+
+    DirectoryWatcher b = Utility::move(a);
+    CORRADE_COMPARE(b.path(), _path);
+    CORRADE_VERIFY(b.isValid());
+
+    DirectoryWatcher c{Path::join(_path, "sub")};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.path(), _path);
+
+    CORRADE_VERIFY(Path::write(Path::join(_path, "new.txt"), "ahoy"_s));
+    CORRADE_COMPARE_AS(c.changes(), Containers::arrayView<Change>({
+        {"new.txt"_s, DirectoryWatcher::Change::Created},
+    }), TestSuite::Compare::Container);
+}
+
+void DirectoryWatcherTest::debugChange() {
+    Containers::String out;
+    Debug{&out} << DirectoryWatcher::Change::Modified << DirectoryWatcher::Change(0xde);
+    CORRADE_COMPARE(out, "Utility::DirectoryWatcher::Change::Modified Utility::DirectoryWatcher::Change(0xde)\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::DirectoryWatcherTest)
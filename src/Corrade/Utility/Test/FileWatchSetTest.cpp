@@ -0,0 +1,322 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/Utility/FileWatchSet.h"
+#include "Corrade/Utility/Format.h"
+#include "Corrade/Utility/Path.h"
+#include "Corrade/Utility/System.h"
+
+#include "configure.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct FileWatchSetTest: TestSuite::Tester {
+    explicit FileWatchSetTest();
+
+    void empty();
+    void nonexistent();
+
+    void setup();
+    void teardown();
+    void setupBenchmark();
+    void teardownBenchmark();
+
+    void changed();
+    void changedMultiple();
+    void changedDeletedRecreated();
+
+    void move();
+
+    void flagsInvalidId();
+    void isValidInvalidId();
+
+    void benchmarkFileWatchers();
+    void benchmarkFileWatchSet();
+
+    private:
+        Containers::String _filenames[3];
+};
+
+FileWatchSetTest::FileWatchSetTest() {
+    addTests({&FileWatchSetTest::empty,
+              &FileWatchSetTest::nonexistent});
+
+    addTests({&FileWatchSetTest::changed,
+              &FileWatchSetTest::changedMultiple,
+              &FileWatchSetTest::changedDeletedRecreated,
+              &FileWatchSetTest::move,
+
+              &FileWatchSetTest::flagsInvalidId,
+              &FileWatchSetTest::isValidInvalidId},
+             &FileWatchSetTest::setup, &FileWatchSetTest::teardown);
+
+    addBenchmarks({&FileWatchSetTest::benchmarkFileWatchers,
+                   &FileWatchSetTest::benchmarkFileWatchSet}, 10,
+                  &FileWatchSetTest::setupBenchmark,
+                  &FileWatchSetTest::teardownBenchmark);
+
+    Path::make(FILEWATCHSET_WRITE_TEST_DIR);
+    _filenames[0] = Path::join(FILEWATCHSET_WRITE_TEST_DIR, "a.txt");
+    _filenames[1] = Path::join(FILEWATCHSET_WRITE_TEST_DIR, "b.txt");
+    _filenames[2] = Path::join(FILEWATCHSET_WRITE_TEST_DIR, "c.txt");
+}
+
+using namespace Containers::Literals;
+
+void FileWatchSetTest::empty() {
+    FileWatchSet watchers;
+    CORRADE_COMPARE(watchers.fileCount(), 0);
+    CORRADE_COMPARE_AS(watchers.changedFiles(),
+        Containers::arrayView<std::size_t>({}),
+        TestSuite::Compare::Container);
+}
+
+void FileWatchSetTest::nonexistent() {
+    FileWatchSet watchers;
+
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        CORRADE_COMPARE(watchers.add("nonexistent"), 0);
+    }
+    CORRADE_COMPARE(watchers.fileCount(), 1);
+    CORRADE_COMPARE(watchers.flags(0), FileWatcher::Flags{});
+    CORRADE_VERIFY(!watchers.isValid(0));
+    CORRADE_COMPARE_AS(watchers.changedFiles(),
+        Containers::arrayView<std::size_t>({}),
+        TestSuite::Compare::Container);
+
+    /* The error is the same as with a FileWatcher directly, not testing the
+       exact message as it's done in FileWatcherTest already */
+    CORRADE_VERIFY(out.contains("Utility::FileWatcher: can't stat nonexistent, aborting watch"));
+}
+
+void FileWatchSetTest::setup() {
+    for(const Containers::String& filename: _filenames)
+        Path::write(filename, "hello"_s);
+}
+
+void FileWatchSetTest::teardown() {
+    for(const Containers::String& filename: _filenames)
+        Path::remove(filename);
+}
+
+constexpr std::size_t BenchmarkFileCount = 100;
+
+void FileWatchSetTest::setupBenchmark() {
+    for(std::size_t i = 0; i != BenchmarkFileCount; ++i)
+        Path::write(Path::join(FILEWATCHSET_WRITE_TEST_DIR, Utility::format("benchmark{}.txt", i)), "hello"_s);
+}
+
+void FileWatchSetTest::teardownBenchmark() {
+    for(std::size_t i = 0; i != BenchmarkFileCount; ++i)
+        Path::remove(Path::join(FILEWATCHSET_WRITE_TEST_DIR, Utility::format("benchmark{}.txt", i)));
+}
+
+void FileWatchSetTest::changed() {
+    FileWatchSet watchers;
+    CORRADE_COMPARE(watchers.add(_filenames[0]), 0);
+    CORRADE_COMPARE(watchers.add(_filenames[1], FileWatcher::Flag::IgnoreChangeIfEmpty), 1);
+    CORRADE_COMPARE(watchers.add(_filenames[2]), 2);
+    CORRADE_COMPARE(watchers.fileCount(), 3);
+    CORRADE_COMPARE(watchers.flags(0), FileWatcher::Flags{});
+    CORRADE_COMPARE(watchers.flags(1), FileWatcher::Flag::IgnoreChangeIfEmpty);
+    CORRADE_VERIFY(watchers.isValid(0));
+    CORRADE_VERIFY(watchers.isValid(1));
+    CORRADE_VERIFY(watchers.isValid(2));
+    CORRADE_COMPARE_AS(watchers.changedFiles(),
+        Containers::arrayView<std::size_t>({}),
+        TestSuite::Compare::Container);
+
+    /* So we don't write at the same nanosecond, see FileWatcherTest for
+       details */
+    #if defined(CORRADE_TARGET_APPLE) || defined(CORRADE_TARGET_WINDOWS) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    System::sleep(1100);
+    #else
+    System::sleep(10);
+    #endif
+    CORRADE_VERIFY(Path::write(_filenames[1], "ahoy"_s));
+
+    CORRADE_COMPARE_AS(watchers.changedFiles(),
+        Containers::arrayView<std::size_t>({1}),
+        TestSuite::Compare::Container);
+
+    /* Nothing changed second time */
+    CORRADE_COMPARE_AS(watchers.changedFiles(),
+        Containers::arrayView<std::size_t>({}),
+        TestSuite::Compare::Container);
+}
+
+void FileWatchSetTest::changedMultiple() {
+    FileWatchSet watchers;
+    watchers.add(_filenames[0]);
+    watchers.add(_filenames[1]);
+    watchers.add(_filenames[2]);
+
+    /* See above for details */
+    #if defined(CORRADE_TARGET_APPLE) || defined(CORRADE_TARGET_WINDOWS) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    System::sleep(1100);
+    #else
+    System::sleep(10);
+    #endif
+    CORRADE_VERIFY(Path::write(_filenames[2], "ahoy"_s));
+    CORRADE_VERIFY(Path::write(_filenames[0], "ahoy"_s));
+
+    /* The IDs are always in ascending order, regardless of the order in which
+       the files were modified */
+    CORRADE_COMPARE_AS(watchers.changedFiles(),
+        Containers::arrayView<std::size_t>({0, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(watchers.changedFiles(),
+        Containers::arrayView<std::size_t>({}),
+        TestSuite::Compare::Container);
+}
+
+void FileWatchSetTest::changedDeletedRecreated() {
+    FileWatchSet watchers;
+    watchers.add(_filenames[0]);
+    watchers.add(_filenames[1], FileWatcher::Flag::IgnoreErrors);
+
+    CORRADE_VERIFY(Path::remove(_filenames[0]));
+    CORRADE_VERIFY(Path::remove(_filenames[1]));
+
+    /* The first watch gets invalidated, the second ignores the error */
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        CORRADE_COMPARE_AS(watchers.changedFiles(),
+            Containers::arrayView<std::size_t>({}),
+            TestSuite::Compare::Container);
+    }
+    CORRADE_VERIFY(!watchers.isValid(0));
+    CORRADE_VERIFY(watchers.isValid(1));
+    CORRADE_VERIFY(out.contains("aborting watch"));
+    CORRADE_VERIFY(out.contains("ignoring"));
+
+    /* See above for details */
+    #if defined(CORRADE_TARGET_APPLE) || defined(CORRADE_TARGET_WINDOWS) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    System::sleep(1100);
+    #else
+    System::sleep(10);
+    #endif
+    CORRADE_VERIFY(Path::write(_filenames[0], "hello again"_s));
+    CORRADE_VERIFY(Path::write(_filenames[1], "hello again"_s));
+
+    /* Only the second recovers */
+    CORRADE_COMPARE_AS(watchers.changedFiles(),
+        Containers::arrayView<std::size_t>({1}),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(!watchers.isValid(0));
+    CORRADE_VERIFY(watchers.isValid(1));
+}
+
+void FileWatchSetTest::move() {
+    FileWatchSet a;
+    a.add(_filenames[0]);
+    a.add(_filenames[1]);
+
+    FileWatchSet b = Utility::move(a);
+    CORRADE_COMPARE(a.fileCount(), 0);
+    CORRADE_COMPARE(b.fileCount(), 2);
+
+    FileWatchSet c;
+    c.add(_filenames[2]);
+    c = Utility::move(b);
+    CORRADE_COMPARE(b.fileCount(), 1);
+    CORRADE_COMPARE(c.fileCount(), 2);
+
+    /* See above for details */
+    #if defined(CORRADE_TARGET_APPLE) || defined(CORRADE_TARGET_WINDOWS) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    System::sleep(1100);
+    #else
+    System::sleep(10);
+    #endif
+    CORRADE_VERIFY(Path::write(_filenames[1], "ahoy"_s));
+
+    CORRADE_COMPARE_AS(c.changedFiles(),
+        Containers::arrayView<std::size_t>({1}),
+        TestSuite::Compare::Container);
+}
+
+void FileWatchSetTest::flagsInvalidId() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FileWatchSet watchers;
+    watchers.add(_filenames[0]);
+
+    Containers::String out;
+    Error redirectError{&out};
+    watchers.flags(1);
+    CORRADE_COMPARE(out, "Utility::FileWatchSet::flags(): id 1 out of range for 1 files\n");
+}
+
+void FileWatchSetTest::isValidInvalidId() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FileWatchSet watchers;
+    watchers.add(_filenames[0]);
+
+    Containers::String out;
+    Error redirectError{&out};
+    watchers.isValid(1);
+    CORRADE_COMPARE(out, "Utility::FileWatchSet::isValid(): id 1 out of range for 1 files\n");
+}
+
+void FileWatchSetTest::benchmarkFileWatchers() {
+    Containers::Array<FileWatcher> watchers;
+    for(std::size_t i = 0; i != BenchmarkFileCount; ++i)
+        arrayAppend(watchers, InPlaceInit, Path::join(FILEWATCHSET_WRITE_TEST_DIR, Utility::format("benchmark{}.txt", i)));
+
+    /* Each hasChanged() call drains the inotify queue on Linux or queries
+       the modification time elsewhere */
+    std::size_t changed = 0;
+    CORRADE_BENCHMARK(10) {
+        for(FileWatcher& watcher: watchers)
+            changed += watcher.hasChanged();
+    }
+
+    CORRADE_COMPARE(changed, 0);
+}
+
+void FileWatchSetTest::benchmarkFileWatchSet() {
+    FileWatchSet watchers;
+    for(std::size_t i = 0; i != BenchmarkFileCount; ++i)
+        watchers.add(Path::join(FILEWATCHSET_WRITE_TEST_DIR, Utility::format("benchmark{}.txt", i)));
+
+    std::size_t changed = 0;
+    CORRADE_BENCHMARK(10)
+        changed += watchers.changedFiles().size();
+
+    CORRADE_COMPARE(changed, 0);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::FileWatchSetTest)
@@ -54,6 +54,9 @@ struct FileWatcherTest: TestSuite::Tester {
     void changedRecreatedLateIgnoreErrors();
     void changedCleared();
     void changedClearedIgnoreEmpty();
+    void changedReplacedByRename();
+    void changedMultipleWatchers();
+    void changedMoved();
 
     void debugFlag();
     void debugFlags();
@@ -76,7 +79,10 @@ FileWatcherTest::FileWatcherTest() {
               &FileWatcherTest::changedRecreatedLate,
               &FileWatcherTest::changedRecreatedLateIgnoreErrors,
               &FileWatcherTest::changedCleared,
-              &FileWatcherTest::changedClearedIgnoreEmpty},
+              &FileWatcherTest::changedClearedIgnoreEmpty,
+              &FileWatcherTest::changedReplacedByRename,
+              &FileWatcherTest::changedMultipleWatchers,
+              &FileWatcherTest::changedMoved},
              &FileWatcherTest::setup, &FileWatcherTest::teardown);
 
     addTests({&FileWatcherTest::debugFlag,
@@ -341,6 +347,99 @@ void FileWatcherTest::changedClearedIgnoreEmpty() {
     }
 }
 
+void FileWatcherTest::changedReplacedByRename() {
+    CORRADE_VERIFY(Path::exists(_filename));
+
+    FileWatcher watcher{_filename};
+    CORRADE_VERIFY(watcher.isValid());
+    CORRADE_VERIFY(!watcher.hasChanged());
+
+    /* See above for details */
+    /** @todo get rid of this once proper FS inode etc. watching is implemented */
+    #if defined(CORRADE_TARGET_APPLE) || defined(CORRADE_TARGET_WINDOWS) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    System::sleep(1100);
+    #else
+    System::sleep(10);
+    #endif
+
+    /* Editors often write to a temporary file and then move it over the
+       original, which replaces the original file (and, with inotify, its
+       watch) with a new one */
+    Containers::String temporary = Path::join(FILEWATCHER_WRITE_TEST_DIR, "file.txt.tmp");
+    CORRADE_VERIFY(Path::write(temporary, "ahoy"_s));
+    CORRADE_VERIFY(Path::move(temporary, _filename));
+
+    CORRADE_VERIFY(watcher.hasChanged());
+    CORRADE_VERIFY(!watcher.hasChanged()); /* Nothing changed second time */
+
+    /* Modifying the new file in-place is detected as well */
+    #if defined(CORRADE_TARGET_APPLE) || defined(CORRADE_TARGET_WINDOWS) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    System::sleep(1100);
+    #else
+    System::sleep(10);
+    #endif
+    CORRADE_VERIFY(Path::write(_filename, "hello again"_s));
+    CORRADE_VERIFY(watcher.hasChanged());
+    CORRADE_VERIFY(watcher.isValid());
+}
+
+void FileWatcherTest::changedMultipleWatchers() {
+    CORRADE_VERIFY(Path::exists(_filename));
+
+    /* On Linux these share the same inotify watch descriptors, destroying one
+       shouldn't affect the other */
+    FileWatcher watcher{_filename};
+    {
+        FileWatcher another{_filename};
+        CORRADE_VERIFY(another.isValid());
+        CORRADE_VERIFY(!another.hasChanged());
+    }
+    CORRADE_VERIFY(watcher.isValid());
+    CORRADE_VERIFY(!watcher.hasChanged());
+
+    /* See above for details */
+    /** @todo get rid of this once proper FS inode etc. watching is implemented */
+    #if defined(CORRADE_TARGET_APPLE) || defined(CORRADE_TARGET_WINDOWS) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    System::sleep(1100);
+    #else
+    System::sleep(10);
+    #endif
+    CORRADE_VERIFY(Path::write(_filename, "ahoy"_s));
+
+    CORRADE_VERIFY(watcher.hasChanged());
+    CORRADE_VERIFY(!watcher.hasChanged()); /* Nothing changed second time */
+}
+
+void FileWatcherTest::changedMoved() {
+    CORRADE_VERIFY(Path::exists(_filename));
+
+    FileWatcher a{_filename, FileWatcher::Flag::IgnoreErrors};
+    CORRADE_VERIFY(!a.hasChanged());
+
+    /* Move construction */
+    FileWatcher b = Utility::move(a);
+    CORRADE_COMPARE(b.flags(), FileWatcher::Flag::IgnoreErrors);
+    CORRADE_VERIFY(b.isValid());
+
+    /* Move assignment */
+    FileWatcher c{Path::join(FILEWATCHER_WRITE_TEST_DIR, "nonexistent"), FileWatcher::Flag::IgnoreErrors};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.flags(), FileWatcher::Flag::IgnoreErrors);
+    CORRADE_VERIFY(c.isValid());
+
+    /* See above for details */
+    /** @todo get rid of this once proper FS inode etc. watching is implemented */
+    #if defined(CORRADE_TARGET_APPLE) || defined(CORRADE_TARGET_WINDOWS) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    System::sleep(1100);
+    #else
+    System::sleep(10);
+    #endif
+    CORRADE_VERIFY(Path::write(_filename, "ahoy"_s));
+
+    CORRADE_VERIFY(c.hasChanged());
+    CORRADE_VERIFY(!c.hasChanged()); /* Nothing changed second time */
+}
+
 void FileWatcherTest::debugFlag() {
     Containers::String out;
 
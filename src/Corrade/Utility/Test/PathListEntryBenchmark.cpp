@@ -0,0 +1,143 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/Optional.h"
+#include "Corrade/Containers/Pair.h"
+#include "Corrade/Containers/Reference.h"
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringIterable.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Arguments.h"
+#include "Corrade/Utility/Format.h"
+#include "Corrade/Utility/Path.h"
+#include "Corrade/Utility/PathListEntry.h"
+
+#include "configure.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct PathListEntryBenchmark: TestSuite::Tester {
+    explicit PathListEntryBenchmark();
+
+    void prepareTree();
+    void listStat();
+    void listEntries();
+    void listEntriesThreaded();
+
+    private:
+        std::size_t _filesPerDirectory;
+        Containers::String _root;
+};
+
+using namespace Containers::Literals;
+
+PathListEntryBenchmark::PathListEntryBenchmark(): TestSuite::Tester{TesterConfiguration{}.setSkippedArgumentPrefixes({"tree"})} {
+    addBenchmarks({&PathListEntryBenchmark::listStat,
+                   &PathListEntryBenchmark::listEntries,
+                   &PathListEntryBenchmark::listEntriesThreaded}, 3,
+        &PathListEntryBenchmark::prepareTree,
+        &PathListEntryBenchmark::prepareTree);
+
+    /* The default makes the benchmark fast enough to be run as a part of the
+       test suite. Pass --tree-files-per-directory 1000 to benchmark on a tree
+       with 100k files. */
+    Arguments args{"tree"};
+    args.addOption("files-per-directory", "10").setHelp("files-per-directory", "count of files in each of the 100 directories", "N")
+        .parse(arguments().first(), arguments().second());
+
+    _filesPerDirectory = args.value<std::size_t>("files-per-directory");
+    /* Named by the file count to not reuse a tree of a different size */
+    _root = Path::join(PATH_WRITE_TEST_DIR, format("listEntryBenchmarkTree{}", _filesPerDirectory));
+}
+
+void PathListEntryBenchmark::prepareTree() {
+    Containers::String done = Path::join(_root, "done");
+    if(Path::exists(done))
+        return;
+
+    /* 10 directories with 10 subdirectories each. The marker file is written
+       last so an interrupted setup gets finished on the next run. */
+    for(std::size_t i = 0; i != 10; ++i) {
+        for(std::size_t j = 0; j != 10; ++j) {
+            Containers::String directory = Path::join({_root, format("{}", i), format("{}", j)});
+            Path::make(directory);
+            for(std::size_t k = 0; k != _filesPerDirectory; ++k)
+                Path::write(Path::join(directory, format("{}.dat", k)), Containers::arrayView(directory.data(), k % 64));
+        }
+    }
+
+    Path::write(done, "done"_s);
+}
+
+/* The traditional way -- Path::list() each directory and query the metadata
+   for every file separately */
+void listStatRecursive(const Containers::StringView root, const Containers::StringView prefix, std::size_t& count, std::size_t& size) {
+    Containers::String directory = Path::join(root, prefix);
+    for(const Containers::String& name: *Path::list(directory, Path::ListFlag::SkipDotAndDotDot)) {
+        const Containers::String path = Path::join(directory, name);
+        if(Path::isDirectory(path)) {
+            listStatRecursive(root, Path::join(prefix, name), count, size);
+        } else {
+            size += *Path::size(path);
+            count += *Path::lastModification(path) != 0;
+        }
+    }
+}
+
+void PathListEntryBenchmark::listStat() {
+    CORRADE_VERIFY(Path::exists(Path::join(_root, "done")));
+
+    std::size_t count = 0, size = 0;
+    CORRADE_BENCHMARK(1)
+        listStatRecursive(_root, {}, count, size);
+
+    CORRADE_COMPARE(count, 100*_filesPerDirectory + 1);
+}
+
+void PathListEntryBenchmark::listEntries() {
+    CORRADE_VERIFY(Path::exists(Path::join(_root, "done")));
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count += Path::listEntriesRecursive(_root, Path::ListFlag::SkipDirectories)->size();
+
+    CORRADE_COMPARE(count, 100*_filesPerDirectory + 1);
+}
+
+void PathListEntryBenchmark::listEntriesThreaded() {
+    CORRADE_VERIFY(Path::exists(Path::join(_root, "done")));
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count += Path::listEntriesRecursive(_root, Path::ListFlag::SkipDirectories, 0)->size();
+
+    CORRADE_COMPARE(count, 100*_filesPerDirectory + 1);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::PathListEntryBenchmark)
@@ -41,6 +41,7 @@
 #include "Corrade/Utility/Algorithms.h"
 #include "Corrade/Utility/Format.h"
 #include "Corrade/Utility/Path.h"
+#include "Corrade/Utility/PathListEntry.h"
 #include "Corrade/Utility/System.h"
 #ifdef CORRADE_TARGET_APPLE
 #include "Corrade/Utility/System.h" /* isSandboxed() */
@@ -54,6 +55,12 @@
 #include <unistd.h>
 #endif
 
+#if defined(CORRADE_BUILD_MULTITHREADED) && defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+/* For listEntriesRecursiveRemovedDuring() */
+#include <atomic>
+#include <thread>
+#endif
+
 /* The __EMSCRIPTEN_major__ etc macros used to be passed implicitly, version
    3.1.4 moved them to a version header and version 3.1.23 dropped the
    backwards compatibility. To work consistently on all versions, including the
@@ -175,6 +182,18 @@ struct PathTest: TestSuite::Tester {
     void listUtf8Result();
     void listUtf8Path();
 
+    void listEntries();
+    void listEntriesSymlinks();
+    void listEntriesSkip();
+    void listEntriesSort();
+    void listEntriesNonexistent();
+    void listEntriesRecursive();
+    void listEntriesRecursiveSkip();
+    void listEntriesRecursiveTree();
+    void listEntriesRecursiveRemovedDuring();
+    void listEntriesRecursiveNonexistent();
+    void debugListEntryType();
+
     void size();
     void sizeEmpty();
     void sizeNonSeekable();
@@ -272,6 +291,15 @@ struct PathTest: TestSuite::Tester {
 
 using namespace Containers::Literals;
 
+const struct {
+    const char* name;
+    std::size_t threadCount;
+} ListEntriesRecursiveData[]{
+    {"single thread", 1},
+    {"four threads", 4},
+    {"all cores", 0}
+};
+
 const struct {
     const char* name;
     const char* path;
@@ -574,6 +602,21 @@ PathTest::PathTest() {
               &PathTest::listUtf8Result,
               &PathTest::listUtf8Path,
 
+              &PathTest::listEntries,
+              &PathTest::listEntriesSymlinks,
+              &PathTest::listEntriesSkip,
+              &PathTest::listEntriesSort,
+              &PathTest::listEntriesNonexistent});
+
+    addInstancedTests({&PathTest::listEntriesRecursive,
+                       &PathTest::listEntriesRecursiveSkip,
+                       &PathTest::listEntriesRecursiveTree,
+                       &PathTest::listEntriesRecursiveRemovedDuring},
+        Containers::arraySize(ListEntriesRecursiveData));
+
+    addTests({&PathTest::listEntriesRecursiveNonexistent,
+              &PathTest::debugListEntryType,
+
               &PathTest::size,
               &PathTest::sizeEmpty,
               &PathTest::sizeNonSeekable,
@@ -2331,6 +2374,268 @@ void PathTest::listUtf8Path() {
    no issues */
 constexpr const char Data[]{'\xCA', '\xFE', '\xBA', '\xBE', '\x0D', '\x0A', '\x00', '\xDE', '\xAD', '\xBE', '\xEF'};
 
+Containers::Array<Containers::String> entryNames(const Containers::ArrayView<const Path::ListEntry> entries) {
+    Containers::Array<Containers::String> out;
+    for(const Path::ListEntry& entry: entries)
+        arrayAppend(out, entry.name);
+    return out;
+}
+
+Containers::Array<Path::ListEntryType> entryTypes(const Containers::ArrayView<const Path::ListEntry> entries) {
+    Containers::Array<Path::ListEntryType> out;
+    for(const Path::ListEntry& entry: entries)
+        arrayAppend(out, entry.type);
+    return out;
+}
+
+void PathTest::listEntries() {
+    Containers::Optional<Containers::Array<Path::ListEntry>> list = Path::listEntries(_testDir, Path::ListFlag::SortAscending);
+    CORRADE_VERIFY(list);
+
+    #if defined(CORRADE_TARGET_IOS) && defined(CORRADE_TESTSUITE_TARGET_XCTEST)
+    CORRADE_EXPECT_FAIL_IF(!std::getenv("SIMULATOR_UDID"),
+        "CTest is not able to run XCTest executables properly in the simulator.");
+    #endif
+    CORRADE_COMPARE_AS(entryNames(*list), Containers::array<Containers::String>({
+        ".", "..", "dir", "file"
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(entryTypes(*list), Containers::array<Path::ListEntryType>({
+        Path::ListEntryType::Directory,
+        Path::ListEntryType::Directory,
+        Path::ListEntryType::Directory,
+        Path::ListEntryType::File
+    }), TestSuite::Compare::Container);
+
+    /* The metadata should match what the per-file APIs return. Directories
+       have zero size. */
+    CORRADE_COMPARE((*list)[2].size, 0);
+    CORRADE_COMPARE((*list)[2].lastModification, Path::lastModification(Path::join(_testDir, "dir")));
+    CORRADE_COMPARE((*list)[3].size, 11);
+    CORRADE_COMPARE((*list)[3].lastModification, Path::lastModification(Path::join(_testDir, "file")));
+}
+
+void PathTest::listEntriesSymlinks() {
+    Containers::Optional<Containers::Array<Path::ListEntry>> list = Path::listEntries(_testDirSymlink, Path::ListFlag::SkipDotAndDotDot|Path::ListFlag::SortAscending);
+    CORRADE_VERIFY(list);
+
+    #if defined(CORRADE_TARGET_IOS) && defined(CORRADE_TESTSUITE_TARGET_XCTEST)
+    CORRADE_EXPECT_FAIL_IF(!std::getenv("SIMULATOR_UDID"),
+        "CTest is not able to run XCTest executables properly in the simulator.");
+    #endif
+    CORRADE_COMPARE_AS(entryNames(*list), Containers::array<Containers::String>({
+        "dir", "dir-symlink", "file", "file-symlink"
+    }), TestSuite::Compare::Container);
+
+    /* Symlinks are followed */
+    {
+        #if !defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+        CORRADE_EXPECT_FAIL("Symlink support is implemented only on Unix platforms and Emscripten.");
+        #endif
+        CORRADE_COMPARE_AS(entryTypes(*list), Containers::array<Path::ListEntryType>({
+            Path::ListEntryType::Directory,
+            Path::ListEntryType::Directory,
+            Path::ListEntryType::File,
+            Path::ListEntryType::File
+        }), TestSuite::Compare::Container);
+        CORRADE_COMPARE((*list)[3].size, 11);
+    }
+}
+
+void PathTest::listEntriesSkip() {
+    Containers::Optional<Containers::Array<Path::ListEntry>> list = Path::listEntries(_testDir, Path::ListFlag::SkipDirectories);
+    CORRADE_VERIFY(list);
+    CORRADE_COMPARE(list->size(), 1);
+    CORRADE_COMPARE((*list)[0].name, "file");
+    CORRADE_COMPARE((*list)[0].type, Path::ListEntryType::File);
+
+    Containers::Optional<Containers::Array<Path::ListEntry>> skipFiles = Path::listEntries(_testDir, Path::ListFlag::SkipDotAndDotDot|Path::ListFlag::SkipFiles);
+    CORRADE_VERIFY(skipFiles);
+    CORRADE_COMPARE(skipFiles->size(), 1);
+    CORRADE_COMPARE((*skipFiles)[0].name, "dir");
+    CORRADE_COMPARE((*skipFiles)[0].type, Path::ListEntryType::Directory);
+}
+
+void PathTest::listEntriesSort() {
+    Containers::Optional<Containers::Array<Path::ListEntry>> list = Path::listEntries(_testDir, Path::ListFlag::SortDescending);
+    CORRADE_VERIFY(list);
+    CORRADE_COMPARE_AS(entryNames(*list), Containers::array<Containers::String>({
+        "file", "dir", "..", "."
+    }), TestSuite::Compare::Container);
+}
+
+void PathTest::listEntriesNonexistent() {
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Path::listEntries("nonexistent"));
+    #ifdef CORRADE_TARGET_WINDOWS
+    /* Windows has its own code path and thus different errors */
+    CORRADE_COMPARE_AS(out,
+        "Utility::Path::listEntries(): can't list nonexistent: error 3 (",
+        TestSuite::Compare::StringHasPrefix);
+    #elif defined(CORRADE_TARGET_EMSCRIPTEN)
+    /* Emscripten uses a different errno for "No such file or directory" */
+    CORRADE_COMPARE_AS(out,
+        "Utility::Path::listEntries(): can't list nonexistent: error 44 (",
+        TestSuite::Compare::StringHasPrefix);
+    #else
+    CORRADE_COMPARE_AS(out,
+        "Utility::Path::listEntries(): can't list nonexistent: error 2 (",
+        TestSuite::Compare::StringHasPrefix);
+    #endif
+}
+
+void PathTest::listEntriesRecursive() {
+    auto&& data = ListEntriesRecursiveData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Optional<Containers::Array<Path::ListEntry>> list = Path::listEntriesRecursive(_testDirSymlink, Path::ListFlag::SortAscending, data.threadCount);
+    CORRADE_VERIFY(list);
+
+    /* The directory symlink is listed but not descended into */
+    #if defined(CORRADE_TARGET_IOS) && defined(CORRADE_TESTSUITE_TARGET_XCTEST)
+    CORRADE_EXPECT_FAIL_IF(!std::getenv("SIMULATOR_UDID"),
+        "CTest is not able to run XCTest executables properly in the simulator.");
+    #endif
+    CORRADE_COMPARE_AS(entryNames(*list), Containers::array<Containers::String>({
+        "dir", "dir-symlink", "dir/dummy", "file", "file-symlink"
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE((*list)[2].type, Path::ListEntryType::File);
+    CORRADE_COMPARE((*list)[2].size, 0);
+    CORRADE_COMPARE((*list)[2].lastModification, Path::lastModification(Path::join(_testDirSymlink, "dir/dummy")));
+}
+
+void PathTest::listEntriesRecursiveSkip() {
+    auto&& data = ListEntriesRecursiveData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Directories are skipped in the output but still listed */
+    Containers::Optional<Containers::Array<Path::ListEntry>> list = Path::listEntriesRecursive(_testDir, Path::ListFlag::SkipDirectories|Path::ListFlag::SortDescending, data.threadCount);
+    CORRADE_VERIFY(list);
+    CORRADE_COMPARE_AS(entryNames(*list), Containers::array<Containers::String>({
+        "file", "dir/dummy"
+    }), TestSuite::Compare::Container);
+
+    /* Only directories */
+    Containers::Optional<Containers::Array<Path::ListEntry>> skipFiles = Path::listEntriesRecursive(_testDir, Path::ListFlag::SkipFiles|Path::ListFlag::SortAscending, data.threadCount);
+    CORRADE_VERIFY(skipFiles);
+    CORRADE_COMPARE_AS(entryNames(*skipFiles), Containers::array<Containers::String>({
+        "dir"
+    }), TestSuite::Compare::Container);
+}
+
+void PathTest::listEntriesRecursiveTree() {
+    auto&& data = ListEntriesRecursiveData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Create a tree that's deep and wide enough for the work to get
+       distributed among threads. To be sure there's nothing else, recreate
+       it. */
+    Containers::String root = Path::join(_writeTestDir, "ListEntriesTree");
+    if(Path::exists(root)) {
+        Containers::Optional<Containers::Array<Path::ListEntry>> previous = Path::listEntriesRecursive(root, Path::ListFlag::SortDescending);
+        CORRADE_VERIFY(previous);
+        for(const Path::ListEntry& entry: *previous)
+            CORRADE_VERIFY(Path::remove(Path::join(root, entry.name)));
+        CORRADE_VERIFY(Path::remove(root));
+    }
+    Containers::Array<Containers::String> expected;
+    for(std::size_t i = 0; i != 4; ++i) {
+        Containers::String a = format("a{}", i);
+        CORRADE_VERIFY(Path::make(Path::join(root, a)));
+        arrayAppend(expected, a);
+        for(std::size_t j = 0; j != 3; ++j) {
+            Containers::String b = format("{}/b{}", a, j);
+            CORRADE_VERIFY(Path::make(Path::join(root, b)));
+            arrayAppend(expected, b);
+            for(std::size_t k = 0; k != 2; ++k) {
+                Containers::String c = format("{}/c{}", b, k);
+                CORRADE_VERIFY(Path::write(Path::join(root, c), Containers::arrayView(c.data(), i)));
+                arrayAppend(expected, c);
+            }
+        }
+    }
+
+    Containers::Optional<Containers::Array<Path::ListEntry>> list = Path::listEntriesRecursive(root, Path::ListFlag::SortAscending, data.threadCount);
+    CORRADE_VERIFY(list);
+    CORRADE_COMPARE_AS(entryNames(*list), expected, TestSuite::Compare::SortedContainer);
+    for(const Path::ListEntry& entry: *list) {
+        CORRADE_ITERATION(entry.name);
+        CORRADE_COMPARE(entry.type, entry.name.contains('c') ? Path::ListEntryType::File : Path::ListEntryType::Directory);
+        CORRADE_COMPARE(entry.size, entry.type == Path::ListEntryType::File ? std::size_t(entry.name[1] - '0') : 0);
+    }
+}
+
+void PathTest::listEntriesRecursiveRemovedDuring() {
+    auto&& data = ListEntriesRecursiveData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Windows doesn't allow removing a directory that's being listed, and
+       there are no threads on Emscripten */
+    #if defined(CORRADE_BUILD_MULTITHREADED) && defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+    Containers::String root = Path::join(_writeTestDir, "ListEntriesRemovedDuring");
+    CORRADE_VERIFY(Path::make(root));
+
+    /* Keep creating and removing directories on another thread while the
+       tree is listed. Directories that get removed after their parent was
+       listed should be skipped instead of failing the whole operation. */
+    std::atomic<bool> done{false};
+    std::thread thread{[&root, &done]() {
+        while(!done.load()) {
+            for(std::size_t i = 0; i != 16; ++i) {
+                const Containers::String directory = Path::join(root, format("{}", i));
+                Path::make(Path::join(directory, "nested"));
+            }
+            for(std::size_t i = 0; i != 16; ++i) {
+                const Containers::String directory = Path::join(root, format("{}", i));
+                Path::remove(Path::join(directory, "nested"));
+                Path::remove(directory);
+            }
+        }
+    }};
+
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        for(std::size_t i = 0; i != 500; ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_VERIFY(Path::listEntriesRecursive(root, {}, data.threadCount));
+        }
+    }
+    done = true;
+    thread.join();
+    CORRADE_COMPARE(out, "");
+    #else
+    CORRADE_SKIP("Not implemented on this platform.");
+    #endif
+}
+
+void PathTest::listEntriesRecursiveNonexistent() {
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Path::listEntriesRecursive("nonexistent"));
+    #ifdef CORRADE_TARGET_WINDOWS
+    /* Windows has its own code path and thus different errors */
+    CORRADE_COMPARE_AS(out,
+        "Utility::Path::listEntriesRecursive(): can't list nonexistent: error 3 (",
+        TestSuite::Compare::StringHasPrefix);
+    #elif defined(CORRADE_TARGET_EMSCRIPTEN)
+    /* Emscripten uses a different errno for "No such file or directory" */
+    CORRADE_COMPARE_AS(out,
+        "Utility::Path::listEntriesRecursive(): can't list nonexistent: error 44 (",
+        TestSuite::Compare::StringHasPrefix);
+    #else
+    CORRADE_COMPARE_AS(out,
+        "Utility::Path::listEntriesRecursive(): can't list nonexistent: error 2 (",
+        TestSuite::Compare::StringHasPrefix);
+    #endif
+}
+
+void PathTest::debugListEntryType() {
+    Containers::String out;
+    Debug{&out} << Path::ListEntryType::Special << Path::ListEntryType(0xfe);
+    CORRADE_COMPARE(out, "Utility::Path::ListEntryType::Special Utility::Path::ListEntryType(0xfe)\n");
+}
+
 void PathTest::size() {
     /* Existing file, containing the above data */
     CORRADE_COMPARE(Path::size(Path::join(_testDir, "file")),
@@ -0,0 +1,184 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <memory>
+
+#include "Corrade/Containers/Function.h"
+#include "Corrade/Containers/StaticArray.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/PoolAllocator.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct PoolAllocatorBenchmark: TestSuite::Tester {
+    explicit PoolAllocatorBenchmark();
+
+    void newDelete();
+    void poolAllocateDeallocate();
+
+    void pointerNew();
+    void pointerPooled();
+    void pointerStlUnique();
+
+    void functionHeap();
+    void functionPooled();
+
+    void churnNewDelete();
+    void churnPool();
+};
+
+PoolAllocatorBenchmark::PoolAllocatorBenchmark() {
+    addBenchmarks({&PoolAllocatorBenchmark::newDelete,
+                   &PoolAllocatorBenchmark::poolAllocateDeallocate,
+
+                   &PoolAllocatorBenchmark::pointerNew,
+                   &PoolAllocatorBenchmark::pointerPooled,
+                   &PoolAllocatorBenchmark::pointerStlUnique,
+
+                   &PoolAllocatorBenchmark::functionHeap,
+                   &PoolAllocatorBenchmark::functionPooled,
+
+                   &PoolAllocatorBenchmark::churnNewDelete,
+                   &PoolAllocatorBenchmark::churnPool}, 50);
+}
+
+constexpr std::size_t Repeats = 10000;
+
+struct Payload {
+    explicit Payload(std::size_t value): value{value} {}
+
+    std::size_t value;
+    char padding[40];
+};
+
+struct PooledPayload: Payload, PoolAllocated {
+    using Payload::Payload;
+};
+
+/* Prevent the compiler from optimizing the allocations away */
+CORRADE_NEVER_INLINE void consume(std::size_t& sum, const void* pointer) {
+    sum += reinterpret_cast<std::size_t>(pointer) & 0xff;
+}
+
+void PoolAllocatorBenchmark::newDelete() {
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        void* a = ::operator new(sizeof(Payload));
+        consume(sum, a);
+        ::operator delete(a);
+    }
+    CORRADE_VERIFY(sum || !sum);
+}
+
+void PoolAllocatorBenchmark::poolAllocateDeallocate() {
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        void* a = poolAllocate(sizeof(Payload));
+        consume(sum, a);
+        poolDeallocate(a, sizeof(Payload));
+    }
+    CORRADE_VERIFY(sum || !sum);
+}
+
+void PoolAllocatorBenchmark::pointerNew() {
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        Containers::Pointer<Payload> a = Containers::pointer<Payload>(sum);
+        consume(sum, a.get());
+    }
+    CORRADE_VERIFY(sum || !sum);
+}
+
+void PoolAllocatorBenchmark::pointerPooled() {
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        Containers::Pointer<PooledPayload> a = Containers::pointer<PooledPayload>(sum);
+        consume(sum, a.get());
+    }
+    CORRADE_VERIFY(sum || !sum);
+}
+
+void PoolAllocatorBenchmark::pointerStlUnique() {
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        std::unique_ptr<Payload> a{new Payload{sum}};
+        consume(sum, a.get());
+    }
+    CORRADE_VERIFY(sum || !sum);
+}
+
+CORRADE_NEVER_INLINE void call(Containers::Function<void()>& function) {
+    function();
+}
+
+void PoolAllocatorBenchmark::functionHeap() {
+    std::size_t a = 0;
+    Containers::StaticArray<5, std::size_t*> ptrs{&a, &a, &a, &a, &a};
+    CORRADE_BENCHMARK(Repeats) {
+        /* Too large to be stored inline */
+        Containers::Function<void()> f = [ptrs]{ *ptrs[2] += 1; };
+        call(f);
+    }
+    CORRADE_COMPARE(a, Repeats);
+}
+
+void PoolAllocatorBenchmark::functionPooled() {
+    std::size_t a = 0;
+    Containers::StaticArray<5, std::size_t*> ptrs{&a, &a, &a, &a, &a};
+    CORRADE_BENCHMARK(Repeats) {
+        Containers::Function<void()> f = pooled([ptrs]{ *ptrs[2] += 1; });
+        call(f);
+    }
+    CORRADE_COMPARE(a, Repeats);
+}
+
+/* Keeps a sliding window of live objects, which is closer to real-world
+   usage than an immediate alloc-free pair */
+constexpr std::size_t Window = 256;
+
+void PoolAllocatorBenchmark::churnNewDelete() {
+    Containers::Pointer<Payload> live[Window];
+    std::size_t i = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        live[i % Window] = Containers::pointer<Payload>(i);
+        ++i;
+    }
+    CORRADE_VERIFY(live[0]);
+}
+
+void PoolAllocatorBenchmark::churnPool() {
+    Containers::Pointer<PooledPayload> live[Window];
+    std::size_t i = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        live[i % Window] = Containers::pointer<PooledPayload>(i);
+        ++i;
+    }
+    CORRADE_VERIFY(live[0]);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::PoolAllocatorBenchmark)
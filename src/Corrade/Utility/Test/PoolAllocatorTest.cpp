@@ -0,0 +1,431 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <cstring>
+
+#include "Corrade/Containers/Function.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/PoolAllocator.h"
+
+#if defined(CORRADE_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#include <thread>
+#endif
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+struct PoolAllocatorTest: TestSuite::Tester {
+    explicit PoolAllocatorTest();
+
+    void allocate();
+    void allocateZeroSize();
+    void allocateLarge();
+    void deallocateNull();
+    void reuse();
+    void reuseSameSizeClass();
+    void manyChunks();
+
+    void poolAllocated();
+    void poolAllocatedDerived();
+
+    void pooledInPlace();
+    void pooledInPlaceDefault();
+    void pooledCopy();
+    void pooledMoveOnly();
+    void poolPointer();
+    void poolPointerConvertToBase();
+    void pooledFunction();
+
+    #if defined(CORRADE_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+    void deallocateFromAnotherThread();
+    void reuseAfterThreadExit();
+    void multithreaded();
+    #endif
+};
+
+PoolAllocatorTest::PoolAllocatorTest() {
+    addTests({&PoolAllocatorTest::allocate,
+              &PoolAllocatorTest::allocateZeroSize,
+              &PoolAllocatorTest::allocateLarge,
+              &PoolAllocatorTest::deallocateNull,
+              &PoolAllocatorTest::reuse,
+              &PoolAllocatorTest::reuseSameSizeClass,
+              &PoolAllocatorTest::manyChunks,
+
+              &PoolAllocatorTest::poolAllocated,
+              &PoolAllocatorTest::poolAllocatedDerived,
+
+              &PoolAllocatorTest::pooledInPlace,
+              &PoolAllocatorTest::pooledInPlaceDefault,
+              &PoolAllocatorTest::pooledCopy,
+              &PoolAllocatorTest::pooledMoveOnly,
+              &PoolAllocatorTest::poolPointer,
+              &PoolAllocatorTest::poolPointerConvertToBase,
+              &PoolAllocatorTest::pooledFunction,
+
+              #if defined(CORRADE_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+              &PoolAllocatorTest::deallocateFromAnotherThread,
+              &PoolAllocatorTest::reuseAfterThreadExit,
+              &PoolAllocatorTest::multithreaded
+              #endif
+              });
+}
+
+/* Each test case uses a different size class, as freed blocks of given class
+   stay in the free list of the main thread across test cases */
+
+void PoolAllocatorTest::allocate() {
+    void* a = poolAllocate(8);
+    void* b = poolAllocate(8);
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(b);
+    CORRADE_VERIFY(a != b);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(a) % PoolAllocatorAlignment, 0);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(b) % PoolAllocatorAlignment, 0);
+
+    /* The memory should be usable */
+    std::memset(a, 0x55, 8);
+    std::memset(b, 0xaa, 8);
+    CORRADE_COMPARE(static_cast<unsigned char*>(a)[7], 0x55);
+    CORRADE_COMPARE(static_cast<unsigned char*>(b)[0], 0xaa);
+
+    poolDeallocate(a, 8);
+    poolDeallocate(b, 8);
+}
+
+void PoolAllocatorTest::allocateZeroSize() {
+    /* Same as with operator new, zero-size allocations return a unique
+       non-null pointer */
+    void* a = poolAllocate(0);
+    void* b = poolAllocate(0);
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(b);
+    CORRADE_VERIFY(a != b);
+    poolDeallocate(a, 0);
+    poolDeallocate(b, 0);
+}
+
+void PoolAllocatorTest::allocateLarge() {
+    void* a = poolAllocate(PoolAllocatorMaxSize + 1);
+    CORRADE_VERIFY(a);
+    std::memset(a, 0x33, PoolAllocatorMaxSize + 1);
+    /* Goes through the global operator delete, which would blow up in ASan
+       if it was pool memory */
+    poolDeallocate(a, PoolAllocatorMaxSize + 1);
+
+    void* b = poolAllocate(PoolAllocatorMaxSize);
+    CORRADE_VERIFY(b);
+    std::memset(b, 0x33, PoolAllocatorMaxSize);
+    poolDeallocate(b, PoolAllocatorMaxSize);
+}
+
+void PoolAllocatorTest::deallocateNull() {
+    /* Shouldn't crash */
+    poolDeallocate(nullptr, 32);
+    poolDeallocate(nullptr, PoolAllocatorMaxSize + 1);
+    CORRADE_VERIFY(true);
+}
+
+void PoolAllocatorTest::reuse() {
+    void* a = poolAllocate(40);
+    poolDeallocate(a, 40);
+    void* b = poolAllocate(40);
+    CORRADE_COMPARE(b, a);
+    poolDeallocate(b, 40);
+}
+
+void PoolAllocatorTest::reuseSameSizeClass() {
+    /* 49 to 64 bytes is the same size class */
+    void* a = poolAllocate(49);
+    poolDeallocate(a, 49);
+    void* b = poolAllocate(64);
+    CORRADE_COMPARE(b, a);
+    poolDeallocate(b, 64);
+}
+
+void PoolAllocatorTest::manyChunks() {
+    /* Allocating way more than fits into a single chunk */
+    constexpr std::size_t Count = 10000;
+    void* pointers[Count];
+    for(std::size_t i = 0; i != Count; ++i) {
+        pointers[i] = poolAllocate(72);
+        *static_cast<std::size_t*>(pointers[i]) = i;
+    }
+
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(*static_cast<std::size_t*>(pointers[i]), i);
+    }
+
+    for(std::size_t i = 0; i != Count; ++i)
+        poolDeallocate(pointers[i], 72);
+}
+
+int destructed = 0;
+
+struct Event: PoolAllocated {
+    explicit Event(int value): value{value} {}
+    ~Event() { ++destructed; }
+
+    int value;
+    char padding[84];
+};
+
+void PoolAllocatorTest::poolAllocated() {
+    destructed = 0;
+
+    void* pointer;
+    {
+        Containers::Pointer<Event> a = Containers::pointer<Event>(5);
+        CORRADE_COMPARE(a->value, 5);
+        pointer = a.get();
+    }
+    CORRADE_COMPARE(destructed, 1);
+
+    /* The memory got returned to the pool, so allocating the same size class
+       gives back the same pointer */
+    void* b = poolAllocate(sizeof(Event));
+    CORRADE_COMPARE(b, pointer);
+    poolDeallocate(b, sizeof(Event));
+}
+
+struct Base: PoolAllocated {
+    virtual ~Base() = default;
+    virtual int value() const = 0;
+};
+
+struct Derived: Base {
+    explicit Derived(int value): _value{value} {}
+    int value() const override { return _value; }
+
+    int _value;
+    char padding[100];
+};
+
+void PoolAllocatorTest::poolAllocatedDerived() {
+    void* pointer;
+    {
+        Containers::Pointer<Base> a = Containers::pointer<Derived>(7);
+        CORRADE_COMPARE(a->value(), 7);
+        pointer = a.get();
+    }
+
+    /* The virtual destructor makes the deallocation get the derived size, so
+       it should get returned to the right size class */
+    void* b = poolAllocate(sizeof(Derived));
+    CORRADE_COMPARE(b, pointer);
+    poolDeallocate(b, sizeof(Derived));
+}
+
+struct Aggregate {
+    int a;
+    float b;
+};
+
+void PoolAllocatorTest::pooledInPlace() {
+    Pooled<Aggregate> a{Corrade::InPlaceInit, 3, 4.5f};
+    CORRADE_COMPARE(a.a, 3);
+    CORRADE_COMPARE(a.b, 4.5f);
+    CORRADE_VERIFY(!std::is_trivially_destructible<Pooled<Aggregate>>::value);
+}
+
+struct ExplicitDefault {
+    explicit ExplicitDefault() = default;
+    int a = 17;
+};
+
+void PoolAllocatorTest::pooledInPlaceDefault() {
+    Pooled<ExplicitDefault> a{Corrade::InPlaceInit};
+    CORRADE_COMPARE(a.a, 17);
+}
+
+void PoolAllocatorTest::pooledCopy() {
+    Aggregate a{6, 0.25f};
+    Pooled<Aggregate> b = a;
+    Pooled<Aggregate> c = b;
+    CORRADE_COMPARE(c.a, 6);
+    CORRADE_COMPARE(c.b, 0.25f);
+}
+
+struct MoveOnly {
+    explicit MoveOnly(int a): a{a} {}
+    MoveOnly(const MoveOnly&) = delete;
+    MoveOnly(MoveOnly&& other) noexcept: a{other.a} { other.a = 0; }
+
+    int a;
+};
+
+void PoolAllocatorTest::pooledMoveOnly() {
+    Pooled<MoveOnly> a = MoveOnly{15};
+    Pooled<MoveOnly> b = Utility::move(a);
+    CORRADE_COMPARE(a.a, 0);
+    CORRADE_COMPARE(b.a, 15);
+}
+
+void PoolAllocatorTest::poolPointer() {
+    void* pointer;
+    {
+        Containers::Pointer<Pooled<Aggregate>> a = Utility::poolPointer<Aggregate>(8, 1.5f);
+        CORRADE_COMPARE(a->a, 8);
+        CORRADE_COMPARE(a->b, 1.5f);
+        pointer = a.get();
+    }
+
+    void* b = poolAllocate(sizeof(Pooled<Aggregate>));
+    CORRADE_COMPARE(b, pointer);
+    poolDeallocate(b, sizeof(Pooled<Aggregate>));
+}
+
+struct VirtualBase {
+    virtual ~VirtualBase() = default;
+    virtual int value() const = 0;
+};
+
+struct VirtualDerived: VirtualBase {
+    explicit VirtualDerived(int value): _value{value} {}
+    int value() const override { return _value; }
+
+    int _value;
+    char padding[120];
+};
+
+void PoolAllocatorTest::poolPointerConvertToBase() {
+    void* pointer;
+    {
+        Containers::Pointer<VirtualBase> a = Utility::poolPointer<VirtualDerived>(22);
+        CORRADE_COMPARE(a->value(), 22);
+        pointer = a.get();
+    }
+
+    /* Deleting through the base calls the Pooled operator delete, so it
+       should get back to the pool */
+    void* b = poolAllocate(sizeof(Pooled<VirtualDerived>));
+    CORRADE_COMPARE(b, pointer);
+    poolDeallocate(b, sizeof(Pooled<VirtualDerived>));
+}
+
+void PoolAllocatorTest::pooledFunction() {
+    int a = 0;
+    int* ptrs[5]{nullptr, nullptr, &a, nullptr, nullptr};
+    auto lambda = [ptrs](int b) { *ptrs[2] += b; };
+    typedef Pooled<decltype(lambda)> PooledLambda;
+
+    /* Find out what the next allocation of given size would return */
+    void* pointer = poolAllocate(sizeof(PooledLambda));
+    poolDeallocate(pointer, sizeof(PooledLambda));
+
+    {
+        Containers::Function<void(int)> f = Utility::pooled(lambda);
+        CORRADE_VERIFY(f.isAllocated());
+
+        /* The allocation took the block, so a new allocation is different */
+        void* b = poolAllocate(sizeof(PooledLambda));
+        CORRADE_VERIFY(b != pointer);
+        poolDeallocate(b, sizeof(PooledLambda));
+
+        f(3);
+        f(4);
+        CORRADE_COMPARE(a, 7);
+    }
+
+    /* And it got returned back */
+    void* c = poolAllocate(sizeof(PooledLambda));
+    CORRADE_COMPARE(c, pointer);
+    poolDeallocate(c, sizeof(PooledLambda));
+}
+
+#if defined(CORRADE_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+void PoolAllocatorTest::deallocateFromAnotherThread() {
+    void* a = poolAllocate(136);
+
+    std::thread t{[a]{
+        poolDeallocate(a, 136);
+    }};
+    t.join();
+
+    /* The block got returned to this thread, so it gets reused */
+    void* b = poolAllocate(136);
+    CORRADE_COMPARE(b, a);
+    poolDeallocate(b, 136);
+}
+
+void PoolAllocatorTest::reuseAfterThreadExit() {
+    void* a;
+    std::thread t1{[&a]{
+        a = poolAllocate(152);
+        poolDeallocate(a, 152);
+    }};
+    t1.join();
+
+    /* The cache of the exited thread gets adopted by the next thread, which
+       then reuses the block */
+    void* b;
+    std::thread t2{[&b]{
+        b = poolAllocate(152);
+        poolDeallocate(b, 152);
+    }};
+    t2.join();
+
+    CORRADE_COMPARE(b, a);
+}
+
+void PoolAllocatorTest::multithreaded() {
+    /* Each thread allocates and fills a batch, which is then freed by the
+       next thread */
+    constexpr std::size_t ThreadCount = 4;
+    constexpr std::size_t Count = 5000;
+    static std::size_t* pointers[ThreadCount][Count];
+
+    std::thread allocators[ThreadCount];
+    for(std::size_t i = 0; i != ThreadCount; ++i) allocators[i] = std::thread{[i]{
+        for(std::size_t j = 0; j != Count; ++j) {
+            pointers[i][j] = static_cast<std::size_t*>(poolAllocate(168));
+            *pointers[i][j] = i*Count + j;
+        }
+    }};
+    for(std::thread& t: allocators) t.join();
+
+    std::size_t mismatches[ThreadCount]{};
+    std::thread deallocators[ThreadCount];
+    for(std::size_t i = 0; i != ThreadCount; ++i) deallocators[i] = std::thread{[i, &mismatches]{
+        const std::size_t other = (i + 1) % ThreadCount;
+        for(std::size_t j = 0; j != Count; ++j) {
+            if(*pointers[other][j] != other*Count + j) ++mismatches[i];
+            poolDeallocate(pointers[other][j], 168);
+        }
+    }};
+    for(std::thread& t: deallocators) t.join();
+
+    for(std::size_t i = 0; i != ThreadCount; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(mismatches[i], 0);
+    }
+}
+#endif
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::PoolAllocatorTest)
@@ -26,8 +26,11 @@
 
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/TestSuite/Compare/FileToString.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
 #include "Corrade/TestSuite/Compare/String.h"
 #include "Corrade/TestSuite/Compare/StringToFile.h"
+#include "Corrade/Utility/Algorithms.h"
 #include "Corrade/Utility/Implementation/ResourceCompile.h"
 #ifdef CORRADE_TARGET_EMSCRIPTEN
 #include "Corrade/Utility/Test/nodeJsVersionHelpers.h"
@@ -47,6 +50,8 @@
 
 namespace Corrade { namespace Utility { namespace Test { namespace {
 
+using namespace Containers::Literals;
+
 struct ResourceCompileTest: TestSuite::Tester {
     explicit ResourceCompileTest();
 
@@ -69,9 +74,37 @@ struct ResourceCompileTest: TestSuite::Tester {
 
     void compileFromInvalid();
 
+    void compress();
+    void decompressInvalid();
+    void compileFromCompressed();
+    void compileCompressedIncompressible();
+
+    void compileFromCache();
+    void compileFromCacheForeignFiles();
+    void compileFromCacheCorrupted();
+    void compileFromCacheNothingCompressed();
+
+    void compileFromBlob();
+    void compileBlobEmptyFile();
+    void compileBlobInvalidFilename();
+
     void compileSingle();
     void compileSingleNonexistentFile();
     void compileSingleEmptyFile();
+
+    void hashTable();
+    void hashTableEmpty();
+    void hashTableDuplicateFilenames();
+
+    void benchmarkLookupBinarySearch();
+    void benchmarkLookupHashed();
+
+    private:
+        Containers::Array<Containers::String> _filenames;
+        Containers::Array<Implementation::FileData> _files;
+        Containers::Array<unsigned int> _positions;
+        Containers::String _filenameData;
+        Containers::Array<unsigned int> _hash;
 };
 
 const struct {
@@ -107,6 +140,54 @@ const struct {
         "alignment of file 2 in group broken required to be a power-of-two value between 1 and 128, got 256"},
 };
 
+/* Removes a cache directory left over from previous test runs. It contains
+   only files, so there's no need for a recursive removal. */
+void removeCacheDirectory(const Containers::StringView directory) {
+    if(!Path::exists(directory))
+        return;
+    Containers::Optional<Containers::Array<Containers::String>> entries = Path::list(directory, Path::ListFlag::SkipDotAndDotDot);
+    CORRADE_INTERNAL_ASSERT(entries);
+    for(const Containers::String& entry: *entries)
+        CORRADE_INTERNAL_ASSERT_OUTPUT(Path::remove(Path::join(directory, entry)));
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Path::remove(directory));
+}
+
+/* Deterministic pseudo-random data that can't be compressed */
+Containers::Array<char> randomData(const std::size_t size) {
+    Containers::Array<char> out{NoInit, size};
+    unsigned int state = 0x12345678u;
+    for(char& i: out) {
+        state = state*1664525u + 1013904223u;
+        i = char(state >> 24);
+    }
+    return out;
+}
+
+const struct {
+    const char* name;
+    Containers::Array<char>(*data)();
+    bool compressible;
+} CompressData[]{
+    {"empty", []() { return Containers::Array<char>{}; }, false},
+    {"shorter than minimal match", []() {
+        return Containers::Array<char>{InPlaceInit, {'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a'}};
+    }, false},
+    {"text", []() {
+        return *Path::read(Path::join(RESOURCE_TEST_DIR, "compressible.txt"));
+    }, true},
+    /* Overlapping matches with lengths extended over many bytes */
+    {"long run", []() {
+        return Containers::Array<char>{DirectInit, 100000, 'x'};
+    }, true},
+    /* Literal counts extended over many bytes */
+    {"random", []() { return randomData(4000); }, false},
+    {"random with repeats", []() {
+        Containers::Array<char> out = randomData(3000);
+        Utility::copy(out.sliceSize(1000, 500), out.sliceSize(2000, 500));
+        return out;
+    }, true},
+};
+
 ResourceCompileTest::ResourceCompileTest() {
     addTests({&ResourceCompileTest::compile,
               &ResourceCompileTest::compileNothing,
@@ -128,9 +209,46 @@ ResourceCompileTest::ResourceCompileTest() {
     addInstancedTests({&ResourceCompileTest::compileFromInvalid},
         Containers::arraySize(CompileFromInvalidData));
 
+    addInstancedTests({&ResourceCompileTest::compress},
+        Containers::arraySize(CompressData));
+
+    addTests({&ResourceCompileTest::decompressInvalid,
+              &ResourceCompileTest::compileFromCompressed,
+              &ResourceCompileTest::compileCompressedIncompressible,
+
+              &ResourceCompileTest::compileFromCache,
+              &ResourceCompileTest::compileFromCacheForeignFiles,
+              &ResourceCompileTest::compileFromCacheCorrupted,
+              &ResourceCompileTest::compileFromCacheNothingCompressed,
+
+              &ResourceCompileTest::compileFromBlob,
+              &ResourceCompileTest::compileBlobEmptyFile,
+              &ResourceCompileTest::compileBlobInvalidFilename});
+
     addTests({&ResourceCompileTest::compileSingle,
               &ResourceCompileTest::compileSingleNonexistentFile,
-              &ResourceCompileTest::compileSingleEmptyFile});
+              &ResourceCompileTest::compileSingleEmptyFile,
+
+              &ResourceCompileTest::hashTable,
+              &ResourceCompileTest::hashTableEmpty,
+              &ResourceCompileTest::hashTableDuplicateFilenames});
+
+    addBenchmarks({&ResourceCompileTest::benchmarkLookupBinarySearch,
+                   &ResourceCompileTest::benchmarkLookupHashed}, 100);
+
+    /* A thousand files with filenames sorted, and with positions and filename
+       data laid out the same way as in a compiled resource file, to test and
+       benchmark the lookup on */
+    _filenames = Containers::Array<Containers::String>{1000};
+    _files = Containers::Array<Implementation::FileData>{_filenames.size()};
+    _positions = Containers::Array<unsigned int>{ValueInit, _filenames.size()*2};
+    for(std::size_t i = 0; i != _filenames.size(); ++i) {
+        _filenames[i] = format("data/file{:.4}.bin", i);
+        _files[i].filename = _filenames[i];
+        _filenameData = _filenameData + _filenames[i];
+        _positions[2*i] = _filenameData.size();
+    }
+    _hash = Implementation::resourceHashTable(_files);
 }
 
 void ResourceCompileTest::compile() {
@@ -140,8 +258,8 @@ void ResourceCompileTest::compile() {
     CORRADE_VERIFY(consequence);
     CORRADE_VERIFY(predisposition);
     const Implementation::FileData input[]{
-        {"consequence.bin", false, 1, *Utility::move(consequence)},
-        {"predisposition.bin", false, 1, *Utility::move(predisposition)}
+        {"consequence.bin", false, 1, false, *Utility::move(consequence)},
+        {"predisposition.bin", false, 1, false, *Utility::move(predisposition)}
     };
     CORRADE_COMPARE_AS(Implementation::resourceCompile("ResourceTestData", "test", input),
         Path::join(RESOURCE_TEST_DIR, "compiled.cpp"),
@@ -156,7 +274,7 @@ void ResourceCompileTest::compileNothing() {
 
 void ResourceCompileTest::compileEmptyFile() {
     const Implementation::FileData input[]{
-        {"empty.bin", false, 1, {}}
+        {"empty.bin", false, 1, false, {}}
     };
     CORRADE_COMPARE_AS(Implementation::resourceCompile("ResourceTestData", "test", input),
         Path::join(RESOURCE_TEST_DIR, "compiled-empty.cpp"),
@@ -189,38 +307,38 @@ void ResourceCompileTest::compileNullTerminatedAligned() {
     const Implementation::FileData input[]{
         /* This one is null-terminated so there should be exactly one byte
            after */
-        {"0-null-terminated.bin", true, 1,
+        {"0-null-terminated.bin", true, 1, false,
             Containers::Array<char>{*data17bytes66, [](char*, std::size_t){}}},
         /* This one is neither aligned nor null-terminated */
-        {"1.bin", false, 1,
+        {"1.bin", false, 1, false,
             Containers::Array<char>{*data17bytes33, [](char*, std::size_t){}}},
         /* This one is 16-byte aligned so there should be padding before */
-        {"2-align16.bin", false, 16,
+        {"2-align16.bin", false, 16, false,
             Containers::Array<char>{*data17bytes66, [](char*, std::size_t){}}},
         /* An aligned empty file. There's padding before, but no actual
            content. */
-        {"3-align4-empty.bin", false, 4,
+        {"3-align4-empty.bin", false, 4, false,
             {}},
         /* A null-terminated empty file. A single byte, plus padding for the
            next which is aligned again. */
-        {"4-null-terminated-empty.bin", true, 1,
+        {"4-null-terminated-empty.bin", true, 1, false,
             {}},
         /* A null-terminated aligned empty file. A single byte. */
-        {"5-null-terminated-align8-empty.bin", true, 8,
+        {"5-null-terminated-align8-empty.bin", true, 8, false,
             {}},
         /* This one is exactly 64 bytes, but because it is null-terminated,
            the next one has to be padded by another 64 bytes */
-        {"6-null-terminated-align64.bin", true, 64,
+        {"6-null-terminated-align64.bin", true, 64, false,
             Containers::Array<char>{*data64bytes33, [](char*, std::size_t){}}},
         /* This one is 64-byte aligned but smaller than that, which is fine
            -- the next files will start right after */
-        {"7-align64.bin", false, 64,
+        {"7-align64.bin", false, 64, false,
             Containers::Array<char>{*data55bytes66, [](char*, std::size_t){}}},
         /* A non-null-terminated non-aligned file at the end. There should be
            no padding after. If any alignment extends beyond the data end,
            there would be -- that's tested in
            compileAlignmentLargerThanDataSize() */
-        {"8.bin", false, 1,
+        {"8.bin", false, 1, false,
             Containers::Array<char>{*data17bytes33, [](char*, std::size_t){}}}
     };
 
@@ -241,7 +359,7 @@ void ResourceCompileTest::compileNullTerminatedLastFile() {
 
     /* There should be exactly one byte after, and no alignment specifier */
     const Implementation::FileData input[]{
-        {"0-null-terminated.bin", true, 1,
+        {"0-null-terminated.bin", true, 1, false,
             Containers::Array<char>{*data17bytes66, [](char*, std::size_t){}}}
     };
 
@@ -267,11 +385,11 @@ void ResourceCompileTest::compileAlignmentLargerThanDataSize() {
 
     /* There should be 46 padding bytes after the last (empty) file */
     const Implementation::FileData input[]{
-        {"0-align128.bin", false, 128,
+        {"0-align128.bin", false, 128, false,
             Containers::Array<char>{*data17bytes66, [](char*, std::size_t){}}},
-        {"1.bin", false, 1,
+        {"1.bin", false, 1, false,
             Containers::Array<char>{*data64bytes33, [](char*, std::size_t){}}},
-        {"2-align2-empty.bin", false, 2,
+        {"2-align2-empty.bin", false, 2, false,
             {}},
     };
 
@@ -400,6 +518,271 @@ void ResourceCompileTest::compileFromInvalid() {
     else CORRADE_COMPARE(out, format("    Error: {}\n", data.message));
 }
 
+void ResourceCompileTest::compress() {
+    auto&& data = CompressData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<char> input = data.data();
+    const Containers::Array<char> compressed = Implementation::resourceCompress(input);
+    if(data.compressible)
+        CORRADE_COMPARE_AS(compressed.size(), input.size(),
+            TestSuite::Compare::Less);
+
+    Containers::Array<char> decompressed{NoInit, input.size()};
+    CORRADE_VERIFY(Implementation::resourceDecompress(compressed, decompressed));
+    CORRADE_COMPARE_AS(decompressed, input,
+        TestSuite::Compare::Container);
+
+    /* Decompressing into a smaller or larger output fails */
+    if(input.size()) {
+        Containers::Array<char> smaller{NoInit, input.size() - 1};
+        CORRADE_VERIFY(!Implementation::resourceDecompress(compressed, smaller));
+    }
+    Containers::Array<char> larger{NoInit, input.size() + 1};
+    CORRADE_VERIFY(!Implementation::resourceDecompress(compressed, larger));
+}
+
+void ResourceCompileTest::decompressInvalid() {
+    char out[16];
+
+    /* Literal count extension byte missing */
+    CORRADE_VERIFY(!Implementation::resourceDecompress(Containers::arrayView({'\xf0'}), out));
+    /* Literals past the end */
+    CORRADE_VERIFY(!Implementation::resourceDecompress(Containers::arrayView({'\x30', 'a', 'b'}), out));
+    /* Offset truncated */
+    CORRADE_VERIFY(!Implementation::resourceDecompress(Containers::arrayView({'\x10', 'a', '\x01'}), out));
+    /* Zero offset */
+    CORRADE_VERIFY(!Implementation::resourceDecompress(Containers::arrayView({'\x10', 'a', '\x00', '\x00', '\x00'}), out));
+    /* Offset before the output start */
+    CORRADE_VERIFY(!Implementation::resourceDecompress(Containers::arrayView({'\x10', 'a', '\x02', '\x00', '\x00'}), out));
+    /* Match length extension byte missing */
+    CORRADE_VERIFY(!Implementation::resourceDecompress(Containers::arrayView({'\x1f', 'a', '\x01', '\x00'}), out));
+    /* Match past the output end */
+    CORRADE_VERIFY(!Implementation::resourceDecompress(Containers::arrayView({'\x1f', 'a', '\x01', '\x00', '\x10'}), out));
+
+    /* A valid input for comparison, one literal plus a 15-byte match */
+    CORRADE_VERIFY(Implementation::resourceDecompress(Containers::arrayView({'\x1b', 'a', '\x01', '\x00', '\x00'}), out));
+    CORRADE_COMPARE((Containers::StringView{out, 16}), "aaaaaaaaaaaaaaaa");
+}
+
+void ResourceCompileTest::compileFromCompressed() {
+    Containers::String conf = Path::join(RESOURCE_TEST_DIR, "resources-compressed.conf");
+    Containers::String out = Implementation::resourceCompileFrom("ResourceTestCompressedData", conf);
+    CORRADE_COMPARE_AS(out,
+        Path::join(RESOURCE_TEST_DIR, "compiled-compressed.cpp"),
+        TestSuite::Compare::StringToFile);
+
+    /* The compressed files are significantly smaller than the uncompressed
+       one, verify that by counting the data bytes */
+    std::size_t compressedSize = 0, uncompressedSize = 0;
+    for(const Containers::StringView section: out.split("\n    /* ")) {
+        if(section.hasPrefix("2-compressed.txt (compressed) */"))
+            compressedSize = section.count(',');
+        if(section.hasPrefix("3-uncompressed.txt */"))
+            uncompressedSize = section.count(',');
+    }
+    CORRADE_VERIFY(compressedSize);
+    CORRADE_COMPARE_AS(compressedSize*2, uncompressedSize,
+        TestSuite::Compare::Less);
+}
+
+void ResourceCompileTest::compileCompressedIncompressible() {
+    const Implementation::FileData input[]{
+        {"random.bin", false, 1, true, randomData(1000)}
+    };
+    Containers::String out = Implementation::resourceCompile("ResourceTestData", "test", input);
+
+    /* The data is stored as-is as the compression wouldn't save anything */
+    CORRADE_COMPARE_AS(out,
+        "    resource.compression = nullptr;\n",
+        TestSuite::Compare::StringContains);
+    CORRADE_COMPARE_AS(out,
+        "(compressed)",
+        TestSuite::Compare::StringNotContains);
+}
+
+void ResourceCompileTest::compileFromCache() {
+    Containers::String cacheDirectory = Path::join(RESOURCE_WRITE_TEST_DIR, "cache");
+    removeCacheDirectory(cacheDirectory);
+
+    /* The cache directory gets created and populated on first use, giving the
+       same output as without a cache */
+    Containers::String conf = Path::join(RESOURCE_TEST_DIR, "resources-compressed.conf");
+    CORRADE_COMPARE_AS(Implementation::resourceCompileFrom("ResourceTestCompressedData", conf, {}, nullptr, cacheDirectory),
+        Path::join(RESOURCE_TEST_DIR, "compiled-compressed.cpp"),
+        TestSuite::Compare::StringToFile);
+
+    Containers::Optional<Containers::Array<Containers::String>> entries = Path::list(cacheDirectory, Path::ListFlag::SkipDotAndDotDot|Path::ListFlag::SortAscending);
+    CORRADE_VERIFY(entries);
+    /* The compressed file is there twice with the same contents, so it's
+       compressed just once. The remaining two files aren't compressed and
+       thus not cached at all. */
+    CORRADE_COMPARE(entries->size(), 1);
+    CORRADE_VERIFY((*entries)[0].hasSuffix(".lz4"));
+
+    /* Add an unused entry and a temporary file left over from an interrupted
+       write, they should get removed by the next run that produces the same
+       output again */
+    CORRADE_VERIFY(Path::write(Path::join(cacheDirectory, "0123456789abcdef-100.lz4"), "garbage"_s));
+    CORRADE_VERIFY(Path::write(Path::join(cacheDirectory, "0123456789abcdef-100.lz4.3.tmp"), "garbage"_s));
+    CORRADE_COMPARE_AS(Implementation::resourceCompileFrom("ResourceTestCompressedData", conf, {}, nullptr, cacheDirectory),
+        Path::join(RESOURCE_TEST_DIR, "compiled-compressed.cpp"),
+        TestSuite::Compare::StringToFile);
+    CORRADE_VERIFY(!Path::exists(Path::join(cacheDirectory, "0123456789abcdef-100.lz4")));
+    CORRADE_VERIFY(!Path::exists(Path::join(cacheDirectory, "0123456789abcdef-100.lz4.3.tmp")));
+    Containers::Optional<Containers::Array<Containers::String>> entriesAfter = Path::list(cacheDirectory, Path::ListFlag::SkipDotAndDotDot|Path::ListFlag::SortAscending);
+    CORRADE_VERIFY(entriesAfter);
+    CORRADE_COMPARE_AS(*entriesAfter, *entries,
+        TestSuite::Compare::Container);
+}
+
+void ResourceCompileTest::compileFromCacheForeignFiles() {
+    Containers::String cacheDirectory = Path::join(RESOURCE_WRITE_TEST_DIR, "cache-foreign");
+    removeCacheDirectory(cacheDirectory);
+
+    /* Files that don't look like cache entries, such as when the cache
+       directory is shared with something else or is pointed to a wrong
+       location by accident, should be left untouched */
+    const Containers::StringView foreign[]{
+        "CMakeLists.txt"_s,
+        "data.lz4"_s,
+        "0123456789abcdef-.lz4"_s,
+        "0123456789ABCDEF-100.lz4"_s,
+        "0123456789abcdef-100.hex"_s,
+        "0123456789abcdef-100.lz4.tmp"_s,
+        "0123456789abcdef-100.lz4.x.tmp"_s,
+    };
+    CORRADE_VERIFY(Path::make(cacheDirectory));
+    for(const Containers::StringView filename: foreign)
+        CORRADE_VERIFY(Path::write(Path::join(cacheDirectory, filename), "hello"_s));
+
+    Containers::String conf = Path::join(RESOURCE_TEST_DIR, "resources-compressed.conf");
+    CORRADE_COMPARE_AS(Implementation::resourceCompileFrom("ResourceTestCompressedData", conf, {}, nullptr, cacheDirectory),
+        Path::join(RESOURCE_TEST_DIR, "compiled-compressed.cpp"),
+        TestSuite::Compare::StringToFile);
+
+    for(const Containers::StringView filename: foreign) {
+        CORRADE_ITERATION(filename);
+        CORRADE_COMPARE_AS(Path::join(cacheDirectory, filename),
+            "hello",
+            TestSuite::Compare::FileToString);
+    }
+
+    /* Besides these there's just the one compressed file */
+    Containers::Optional<Containers::Array<Containers::String>> entries = Path::list(cacheDirectory, Path::ListFlag::SkipDotAndDotDot);
+    CORRADE_VERIFY(entries);
+    CORRADE_COMPARE(entries->size(), Containers::arraySize(foreign) + 1);
+}
+
+void ResourceCompileTest::compileFromCacheCorrupted() {
+    Containers::String cacheDirectory = Path::join(RESOURCE_WRITE_TEST_DIR, "cache-corrupted");
+    removeCacheDirectory(cacheDirectory);
+
+    Containers::String conf = Path::join(RESOURCE_TEST_DIR, "resources-compressed.conf");
+    CORRADE_VERIFY(Implementation::resourceCompileFrom("ResourceTestCompressedData", conf, {}, nullptr, cacheDirectory));
+
+    Containers::Optional<Containers::Array<Containers::String>> entries = Path::list(cacheDirectory, Path::ListFlag::SkipDotAndDotDot);
+    CORRADE_VERIFY(entries);
+
+    CORRADE_COMPARE(entries->size(), 1);
+
+    /* Replace the compressed data with garbage, it should get detected and
+       compressed again */
+    const Containers::String entry = Path::join(cacheDirectory, (*entries)[0]);
+    CORRADE_VERIFY(Path::write(entry, "0x00,"_s));
+    CORRADE_COMPARE_AS(Implementation::resourceCompileFrom("ResourceTestCompressedData", conf, {}, nullptr, cacheDirectory),
+        Path::join(RESOURCE_TEST_DIR, "compiled-compressed.cpp"),
+        TestSuite::Compare::StringToFile);
+
+    /* Valid compressed data of different contents, such as in case of a hash
+       collision, should get detected as well */
+    Containers::Array<char> different{InPlaceInit, {'a', 'b', 'c'}};
+    CORRADE_VERIFY(Path::write(entry, Implementation::resourceCompress(different)));
+    CORRADE_COMPARE_AS(Implementation::resourceCompileFrom("ResourceTestCompressedData", conf, {}, nullptr, cacheDirectory),
+        Path::join(RESOURCE_TEST_DIR, "compiled-compressed.cpp"),
+        TestSuite::Compare::StringToFile);
+
+    /* The entry got replaced with a valid one again */
+    Containers::Optional<Containers::Array<char>> compressible = Path::read(Path::join(RESOURCE_TEST_DIR, "compressible.txt"));
+    CORRADE_VERIFY(compressible);
+    CORRADE_COMPARE_AS(entry,
+        Containers::StringView{Implementation::resourceCompress(*compressible)},
+        TestSuite::Compare::FileToString);
+}
+
+void ResourceCompileTest::compileFromCacheNothingCompressed() {
+    Containers::String cacheDirectory = Path::join(RESOURCE_WRITE_TEST_DIR, "cache-nothing-compressed");
+    removeCacheDirectory(cacheDirectory);
+
+    /* Only compressed data are cached, so if there's nothing to compress the
+       directory isn't even created */
+    Containers::String conf = Path::join(RESOURCE_TEST_DIR, "resources.conf");
+    CORRADE_COMPARE_AS(Implementation::resourceCompileFrom("ResourceTestData", conf, {}, nullptr, cacheDirectory),
+        Path::join(RESOURCE_TEST_DIR, "compiled.cpp"),
+        TestSuite::Compare::StringToFile);
+    CORRADE_VERIFY(!Path::exists(cacheDirectory));
+
+    /* If it exists from a previous run where some files were compressed, the
+       stale entries get removed */
+    CORRADE_VERIFY(Path::make(cacheDirectory));
+    CORRADE_VERIFY(Path::write(Path::join(cacheDirectory, "0123456789abcdef-100.lz4"), "garbage"_s));
+    CORRADE_COMPARE_AS(Implementation::resourceCompileFrom("ResourceTestData", conf, {}, nullptr, cacheDirectory),
+        Path::join(RESOURCE_TEST_DIR, "compiled.cpp"),
+        TestSuite::Compare::StringToFile);
+    CORRADE_VERIFY(!Path::exists(Path::join(cacheDirectory, "0123456789abcdef-100.lz4")));
+}
+
+void ResourceCompileTest::compileFromBlob() {
+    /* Reusing the configuration with compression, alignment and null
+       termination to verify the blob has all padding and compressed data as
+       expected */
+    Containers::String conf = Path::join(RESOURCE_TEST_DIR, "resources-compressed.conf");
+    Containers::Array<char> blob;
+    Containers::String out = Implementation::resourceCompileFrom("ResourceTestCompressedData", conf, "/path/to/resource_ResourceTestCompressedData.bin", &blob);
+    CORRADE_COMPARE_AS(out,
+        Path::join(RESOURCE_TEST_DIR, "compiled-blob.cpp"),
+        TestSuite::Compare::StringToFile);
+    CORRADE_COMPARE_AS(Containers::StringView{blob},
+        Path::join(RESOURCE_TEST_DIR, "compiled-blob.bin"),
+        TestSuite::Compare::StringToFile);
+
+    /* The data should be nowhere in the C++ file */
+    CORRADE_COMPARE_AS(out,
+        "resourceData",
+        TestSuite::Compare::StringNotContains);
+}
+
+void ResourceCompileTest::compileBlobEmptyFile() {
+    const Implementation::FileData input[]{
+        {"empty.bin", false, 1, false, {}}
+    };
+
+    /* There's no data, so the output is the same as without a blob and the
+       blob is empty */
+    Containers::Array<char> blob;
+    CORRADE_COMPARE_AS(Implementation::resourceCompile("ResourceTestData", "test", input, "/path/to/resource.bin", &blob),
+        Path::join(RESOURCE_TEST_DIR, "compiled-empty.cpp"),
+        TestSuite::Compare::StringToFile);
+    CORRADE_COMPARE(blob.size(), 0);
+}
+
+void ResourceCompileTest::compileBlobInvalidFilename() {
+    const Implementation::FileData input[]{
+        {"consequence.bin", false, 1, false, randomData(16)}
+    };
+
+    Containers::Array<char> blob;
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        CORRADE_VERIFY(!Implementation::resourceCompile("ResourceTestData", "test", input, "C:\\resource.bin", &blob));
+        CORRADE_VERIFY(!Implementation::resourceCompile("ResourceTestData", "test", input, "/path/to/\"resource\".bin", &blob));
+    }
+    CORRADE_COMPARE(out,
+        "    Error: blob filename C:\\resource.bin contains characters that can't be used in an assembler string\n"
+        "    Error: blob filename /path/to/\"resource\".bin contains characters that can't be used in an assembler string\n");
+}
+
 void ResourceCompileTest::compileSingle() {
     CORRADE_COMPARE_AS(Implementation::resourceCompileSingle("ResourceTestData", Path::join(RESOURCE_TEST_DIR, "consequence.bin")),
         Path::join(RESOURCE_TEST_DIR, "compiled-single.cpp"),
@@ -439,6 +822,82 @@ void ResourceCompileTest::compileSingleEmptyFile() {
         TestSuite::Compare::StringToFile);
 }
 
+void ResourceCompileTest::hashTable() {
+    CORRADE_COMPARE(_hash.size(), _filenames.size()*2);
+
+    /* Each file is in exactly one slot */
+    Containers::Array<unsigned int> slotCounts{ValueInit, _filenames.size()};
+    for(std::size_t i = 0; i != _filenames.size(); ++i)
+        ++slotCounts[_hash[2*i + 1]];
+    for(std::size_t i = 0; i != _filenames.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(slotCounts[i], 1);
+    }
+
+    /* All filenames are found at the same index as with a binary search */
+    const unsigned char* const filenames = reinterpret_cast<const unsigned char*>(_filenameData.data());
+    for(std::size_t i = 0; i != _filenames.size(); ++i) {
+        CORRADE_ITERATION(_filenames[i]);
+        CORRADE_COMPARE(Implementation::resourceLookup(_filenames.size(), _positions, _hash, filenames, _filenames[i]), i);
+        CORRADE_COMPARE(Implementation::resourceLookup(_filenames.size(), _positions, filenames, _filenames[i]), i);
+    }
+
+    /* Nonexistent filenames give back the count */
+    CORRADE_COMPARE(Implementation::resourceLookup(_filenames.size(), _positions, _hash, filenames, "data/file1000.bin"), _filenames.size());
+    CORRADE_COMPARE(Implementation::resourceLookup(_filenames.size(), _positions, _hash, filenames, "data/file0000.bin\0"_s), _filenames.size());
+    CORRADE_COMPARE(Implementation::resourceLookup(_filenames.size(), _positions, _hash, filenames, ""), _filenames.size());
+}
+
+void ResourceCompileTest::hashTableEmpty() {
+    CORRADE_COMPARE(Implementation::resourceHashTable({}).size(), 0);
+
+    /* Lookup in an empty table doesn't crash */
+    const unsigned int hash[1]{};
+    CORRADE_COMPARE(Implementation::resourceLookup(0, nullptr, hash, nullptr, "file.bin"), 0);
+}
+
+void ResourceCompileTest::hashTableDuplicateFilenames() {
+    /* Two files with the same name can't be put into distinct slots, so the
+       construction gives up and the lookup falls back to a binary search */
+    const Implementation::FileData input[]{
+        {"a.bin", false, 1, false, {}},
+        {"b.bin", false, 1, false, {}},
+        {"b.bin", false, 1, false, {}}
+    };
+    CORRADE_COMPARE(Implementation::resourceHashTable(input).size(), 0);
+
+    /* The generated file has no table at all */
+    Containers::String out = Implementation::resourceCompile("ResourceTestData", "test", input);
+    CORRADE_COMPARE_AS(out,
+        "resourceHash",
+        TestSuite::Compare::StringNotContains);
+    CORRADE_COMPARE_AS(out,
+        "    resource.hash = nullptr;\n",
+        TestSuite::Compare::StringContains);
+}
+
+void ResourceCompileTest::benchmarkLookupBinarySearch() {
+    const unsigned char* const filenames = reinterpret_cast<const unsigned char*>(_filenameData.data());
+    std::size_t out = 0;
+    CORRADE_BENCHMARK(1) {
+        for(const Containers::String& filename: _filenames)
+            out += Implementation::resourceLookup(_filenames.size(), _positions, filenames, filename);
+    }
+
+    CORRADE_COMPARE(out, _filenames.size()*(_filenames.size() - 1)/2);
+}
+
+void ResourceCompileTest::benchmarkLookupHashed() {
+    const unsigned char* const filenames = reinterpret_cast<const unsigned char*>(_filenameData.data());
+    std::size_t out = 0;
+    CORRADE_BENCHMARK(1) {
+        for(const Containers::String& filename: _filenames)
+            out += Implementation::resourceLookup(_filenames.size(), _positions, _hash, filenames, filename);
+    }
+
+    CORRADE_COMPARE(out, _filenames.size()*(_filenames.size() - 1)/2);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Corrade::Utility::Test::ResourceCompileTest)
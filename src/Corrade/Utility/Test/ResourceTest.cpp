@@ -70,8 +70,10 @@ struct ResourceTest: TestSuite::Tester {
     void resourceFilenameAt();
     void resourceDataAt();
     void resourceLookup();
+    void resourceLookupHashed();
 
     void benchmarkLookupInPlace();
+    void benchmarkLookupInPlaceHashed();
     void benchmarkLookupStdMap();
 
     void hasGroup();
@@ -92,6 +94,8 @@ struct ResourceTest: TestSuite::Tester {
     void nullTerminatedAligned();
     void nullTerminatedLastFile();
     void alignmentLargerThanDataSize();
+    void compressed();
+    void blob();
 
     void overrideGroup();
     void overrideGroupNonexistent();
@@ -107,9 +111,11 @@ struct ResourceTest: TestSuite::Tester {
 ResourceTest::ResourceTest() {
     addTests({&ResourceTest::resourceFilenameAt,
               &ResourceTest::resourceDataAt,
-              &ResourceTest::resourceLookup});
+              &ResourceTest::resourceLookup,
+              &ResourceTest::resourceLookupHashed});
 
     addBenchmarks({&ResourceTest::benchmarkLookupInPlace,
+                   &ResourceTest::benchmarkLookupInPlaceHashed,
                    &ResourceTest::benchmarkLookupStdMap}, 100);
 
     addTests({&ResourceTest::hasGroup,
@@ -130,6 +136,8 @@ ResourceTest::ResourceTest() {
               &ResourceTest::nullTerminatedAligned,
               &ResourceTest::nullTerminatedLastFile,
               &ResourceTest::alignmentLargerThanDataSize,
+              &ResourceTest::compressed,
+              &ResourceTest::blob,
 
               &ResourceTest::overrideGroup,
               &ResourceTest::overrideGroupNonexistent,
@@ -160,6 +168,16 @@ constexpr unsigned char Filenames[] =
     "license.md"    // 10   40
     ;
 
+/* Generated by the same algorithm as in corrade-rc, pair `i` is a seed for
+   bucket `i` and index of a file hashed to slot `i` */
+constexpr unsigned int Hash[] {
+    4, 4,
+    1, 1,
+    4, 0,
+    0, 3,
+    1, 2
+};
+
 constexpr unsigned char Data[] =
     "Don't."                    // 6    6
     "hello world"               // 11   17
@@ -251,10 +269,38 @@ void ResourceTest::resourceLookup() {
     CORRADE_COMPARE(Implementation::resourceLookup(5, Positions, Filenames, "termcap.info"), 5);
 }
 
+void ResourceTest::resourceLookupHashed() {
+    /* Those exist, at the same index as with the binary search */
+    CORRADE_COMPARE(Implementation::resourceLookup(5, Positions, Hash, Filenames,
+        "TOC"), 0);
+    CORRADE_COMPARE(Implementation::resourceLookup(5, Positions, Hash, Filenames,
+        "data.txt"), 1);
+    CORRADE_COMPARE(Implementation::resourceLookup(5, Positions, Hash, Filenames,
+        "image.png"), 2);
+    CORRADE_COMPARE(Implementation::resourceLookup(5, Positions, Hash, Filenames,
+        "image2.png"), 3);
+    CORRADE_COMPARE(Implementation::resourceLookup(5, Positions, Hash, Filenames,
+        "license.md"), 4);
+
+    /* The hash table gives back some index for any input, the final filename
+       comparison discards those */
+    CORRADE_COMPARE(Implementation::resourceLookup(5, Positions, Hash, Filenames, "TOC\0"_s), 5);
+    CORRADE_COMPARE(Implementation::resourceLookup(5, Positions, Hash, Filenames, "image3.png"), 5);
+    CORRADE_COMPARE(Implementation::resourceLookup(5, Positions, Hash, Filenames, ""), 5);
+
+    /* Null hash table falls back to the binary search */
+    CORRADE_COMPARE(Implementation::resourceLookup(5, Positions, nullptr, Filenames, "image2.png"), 3);
+    CORRADE_COMPARE(Implementation::resourceLookup(5, Positions, nullptr, Filenames, "image3.png"), 5);
+}
+
 CORRADE_NEVER_INLINE unsigned int lookupInPlace(Containers::StringView key) {
     return Implementation::resourceLookup(5, Positions, Filenames, key);
 }
 
+CORRADE_NEVER_INLINE unsigned int lookupInPlaceHashed(Containers::StringView key) {
+    return Implementation::resourceLookup(5, Positions, Hash, Filenames, key);
+}
+
 CORRADE_NEVER_INLINE unsigned int lookupStdMap(const std::map<std::string, unsigned int>& map, const std::string& key) {
     return map.at(key);
 }
@@ -268,6 +314,15 @@ void ResourceTest::benchmarkLookupInPlace() {
     CORRADE_COMPARE(out, 40);
 }
 
+void ResourceTest::benchmarkLookupInPlaceHashed() {
+    const Containers::StringView key = "license.md";
+    unsigned int out = 0;
+    CORRADE_BENCHMARK(10)
+        out += lookupInPlaceHashed(key);
+
+    CORRADE_COMPARE(out, 40);
+}
+
 void ResourceTest::benchmarkLookupStdMap() {
     std::map<std::string, unsigned int> map{
         {"TOC", 0},
@@ -600,6 +655,84 @@ void ResourceTest::alignmentLargerThanDataSize() {
     }
 }
 
+void ResourceTest::compressed() {
+    Resource rs{"compressed"};
+
+    {
+        Containers::StringView file = rs.getString("0-compressed-null-terminated-align16.txt");
+        CORRADE_COMPARE_AS(file,
+            Path::join(RESOURCE_TEST_DIR, "compressible.txt"),
+            TestSuite::Compare::StringToFile);
+        /* Null termination and alignment is applied to the decompressed
+           data. It's not global, as it gets freed on unregistration. */
+        CORRADE_COMPARE(file.flags(), Containers::StringViewFlag::NullTerminated);
+        CORRADE_COMPARE(file[file.size()], '\0');
+        CORRADE_COMPARE_AS(file.data(), 16, TestSuite::Compare::Aligned);
+
+        /* Second access gives back the same decompressed data, both through
+           the string and the raw API */
+        CORRADE_COMPARE(rs.getString("0-compressed-null-terminated-align16.txt").data(), file.data());
+        CORRADE_COMPARE(rs.getRaw("0-compressed-null-terminated-align16.txt").data(), file.data());
+    } {
+        Containers::StringView file = rs.getString("1-too-small.bin");
+        CORRADE_COMPARE_AS(file,
+            Path::join(RESOURCE_TEST_DIR, "consequence.bin"),
+            TestSuite::Compare::StringToFile);
+        CORRADE_COMPARE_AS(file.flags(),
+            Containers::StringViewFlag::Global,
+            TestSuite::Compare::GreaterOrEqual);
+    } {
+        Containers::StringView file = rs.getString("2-compressed.txt");
+        CORRADE_COMPARE_AS(file,
+            Path::join(RESOURCE_TEST_DIR, "compressible.txt"),
+            TestSuite::Compare::StringToFile);
+        CORRADE_VERIFY(!(file.flags() & Containers::StringViewFlag::Global));
+    } {
+        Containers::StringView file = rs.getString("3-uncompressed.txt");
+        CORRADE_COMPARE_AS(file,
+            Path::join(RESOURCE_TEST_DIR, "compressible.txt"),
+            TestSuite::Compare::StringToFile);
+        CORRADE_COMPARE_AS(file.flags(),
+            Containers::StringViewFlag::Global,
+            TestSuite::Compare::GreaterOrEqual);
+    }
+
+    /* The compressed files are decompressed into separate memory, the
+       uncompressed one points directly to the compiled-in data */
+    CORRADE_VERIFY(rs.getString("0-compressed-null-terminated-align16.txt").data() != rs.getString("2-compressed.txt").data());
+}
+
+void ResourceTest::blob() {
+    #ifndef TEST_RESOURCE_BLOB
+    CORRADE_SKIP("Resource blobs are supported only with GCC or Clang on Unix platforms.");
+    #else
+    Resource rs{"blob"};
+
+    {
+        Containers::StringView file = rs.getString("0-consequence.bin");
+        CORRADE_COMPARE_AS(file,
+            Path::join(RESOURCE_TEST_DIR, "consequence.bin"),
+            TestSuite::Compare::StringToFile);
+        CORRADE_COMPARE_AS(file.flags(),
+            Containers::StringViewFlag::Global,
+            TestSuite::Compare::GreaterOrEqual);
+    } {
+        Containers::StringView file = rs.getString("1-null-terminated-align64.bin");
+        CORRADE_COMPARE_AS(file,
+            Path::join(RESOURCE_TEST_DIR, "17bytes-66.bin"),
+            TestSuite::Compare::StringToFile);
+        CORRADE_COMPARE(file.flags(), Containers::StringViewFlag::NullTerminated|Containers::StringViewFlag::Global);
+        CORRADE_COMPARE(file[file.size()], '\0');
+        CORRADE_COMPARE_AS(file.data(), 64, TestSuite::Compare::Aligned);
+    } {
+        Containers::StringView file = rs.getString("2-compressed.txt");
+        CORRADE_COMPARE_AS(file,
+            Path::join(RESOURCE_TEST_DIR, "compressible.txt"),
+            TestSuite::Compare::StringToFile);
+    }
+    #endif
+}
+
 void ResourceTest::overrideGroup() {
     Resource::overrideGroup("test", Path::join(RESOURCE_TEST_DIR, "resources-overridden.conf"));
 
@@ -4,11 +4,11 @@
 #include "Corrade/Utility/Macros.h"
 #include "Corrade/Utility/Resource.h"
 
-#if CORRADE_RESOURCE_VERSION != 2
+#if CORRADE_RESOURCE_VERSION != 4
 #ifdef CORRADE_TARGET_CLANG
-#pragma GCC error "resource file compiled in version 2 but version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected, update your corrade-rc binary"
+#pragma GCC error "resource file compiled in version 4 but version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected, update your corrade-rc binary"
 #else
-#error resource file compiled in unexpected version 2, update your corrade-rc binary
+#error resource file compiled in unexpected version 4, update your corrade-rc binary
 #if defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_MSVC)
 #pragma message("resource file version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected instead")
 #endif
@@ -26,6 +26,14 @@ const unsigned int resourcePositions[] = {
     0x2e000025,0x00000080
 };
 
+/* Pair `i` is a seed for bucket `i` and index of a file hashed to slot `i`
+   in a minimal perfect hash table of the filenames. */
+const unsigned int resourceHash[] = {
+    0x00000000,0x00000002,
+    0x00000002,0x00000001,
+    0x00000001,0x00000000
+};
+
 const unsigned char resourceFilenames[] = {
     /* 0-align128.bin */
     0x30,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x31,0x32,0x38,0x2e,0x62,0x69,0x6e,
@@ -68,6 +76,9 @@ int corradeResourceInitializer_ResourceTestAlignmentLargerThanDataSizeData() {
     resource.positions = resourcePositions;
     resource.filenames = resourceFilenames;
     resource.data = resourceData;
+    resource.hash = resourceHash;
+    resource.compression = nullptr;
+    resource.decompressed = nullptr;
     Corrade::Utility::Resource::registerData(resource);
     return 1;
 } CORRADE_AUTOMATIC_INITIALIZER(corradeResourceInitializer_ResourceTestAlignmentLargerThanDataSizeData)
@@ -0,0 +1,122 @@
+/* Compiled resource file. DO NOT EDIT! */
+
+#include "Corrade/Corrade.h"
+#include "Corrade/Utility/Macros.h"
+#include "Corrade/Utility/Resource.h"
+
+#if CORRADE_RESOURCE_VERSION != 4
+#ifdef CORRADE_TARGET_CLANG
+#pragma GCC error "resource file compiled in version 4 but version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected, update your corrade-rc binary"
+#else
+#error resource file compiled in unexpected version 4, update your corrade-rc binary
+#if defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_MSVC)
+#pragma message("resource file version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected instead")
+#endif
+#endif
+#endif
+
+/* The data are in an external binary file, included by the assembler in order
+   to avoid the compiler overhead of parsing a huge array literal. Hash of the
+   blob contents is 0x4bc2c38cba89222a, ensuring this file changes every time
+   the blob does, which triggers a recompilation. */
+#if !defined(CORRADE_TARGET_UNIX) || !defined(CORRADE_TARGET_GCC)
+#error resource data in an external blob are supported only with GCC or Clang on Unix platforms
+#endif
+extern "C" __attribute__((visibility("hidden"))) const unsigned char corradeResourceBlob_ResourceTestCompressedData[];
+#ifdef CORRADE_TARGET_APPLE
+__asm__(
+    ".section __TEXT,__const\n"
+    ".globl _corradeResourceBlob_ResourceTestCompressedData\n"
+    ".private_extern _corradeResourceBlob_ResourceTestCompressedData\n"
+    ".balign 1\n"
+    "_corradeResourceBlob_ResourceTestCompressedData:\n"
+    ".incbin \"/path/to/resource_ResourceTestCompressedData.bin\"\n"
+    ".text\n");
+#else
+__asm__(
+    ".pushsection .rodata\n"
+    ".globl corradeResourceBlob_ResourceTestCompressedData\n"
+    ".hidden corradeResourceBlob_ResourceTestCompressedData\n"
+    ".type corradeResourceBlob_ResourceTestCompressedData, STT_OBJECT\n"
+    ".balign 1\n"
+    "corradeResourceBlob_ResourceTestCompressedData:\n"
+    ".incbin \"/path/to/resource_ResourceTestCompressedData.bin\"\n"
+    ".size corradeResourceBlob_ResourceTestCompressedData, 5752\n"
+    ".popsection\n");
+#endif
+
+namespace {
+
+/* Pair `i` is offset of filename `i + 1` in the low 24 bits, padding after
+   data `i` in the upper 8 bits, and a 32bit offset of data `i + 1`. Offset of
+   the first filename and data is implicitly 0. */
+const unsigned int resourcePositions[] = {
+    0x00000028,0x0000057e,
+    0x00000037,0x00000586,
+    0x00000047,0x00000b04,
+    0x00000059,0x00001678
+};
+
+/* Pair `i` is a seed for bucket `i` and index of a file hashed to slot `i`
+   in a minimal perfect hash table of the filenames. */
+const unsigned int resourceHash[] = {
+    0x00000000,0x00000003,
+    0x00000001,0x00000000,
+    0x00000000,0x00000002,
+    0x00000001,0x00000001
+};
+
+const unsigned char resourceFilenames[] = {
+    /* 0-compressed-null-terminated-align16.txt */
+    0x30,0x2d,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x65,0x64,0x2d,0x6e,0x75,
+    0x6c,0x6c,0x2d,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x74,0x65,0x64,0x2d,0x61,
+    0x6c,0x69,0x67,0x6e,0x31,0x36,0x2e,0x74,0x78,0x74,
+
+    /* 1-too-small.bin */
+    0x31,0x2d,0x74,0x6f,0x6f,0x2d,0x73,0x6d,0x61,0x6c,0x6c,0x2e,0x62,0x69,0x6e,
+
+    /* 2-compressed.txt */
+    0x32,0x2d,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x65,0x64,0x2e,0x74,0x78,
+    0x74,
+
+    /* 3-uncompressed.txt */
+    0x33,0x2d,0x75,0x6e,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x65,0x64,0x2e,
+    0x74,0x78,0x74
+};
+
+/* Pair `i` is size of file `i` after decompression and its alignment in the
+   lower 8 bits together with null termination in bit 8. Both are zero if the
+   file isn't compressed. */
+const unsigned int resourceCompression[] = {
+    0x00000b74,0x00000110,
+    0x00000000,0x00000000,
+    0x00000b74,0x00000001,
+    0x00000000,0x00000000
+};
+
+/* Compressed files get decompressed here on first access */
+const char* resourceDecompressed[4]{};
+
+Corrade::Utility::Implementation::ResourceGroup resource;
+
+}
+
+int corradeResourceInitializer_ResourceTestCompressedData();
+int corradeResourceInitializer_ResourceTestCompressedData() {
+    resource.name = "compressed";
+    resource.count = 4;
+    resource.positions = resourcePositions;
+    resource.filenames = resourceFilenames;
+    resource.data = corradeResourceBlob_ResourceTestCompressedData;
+    resource.hash = resourceHash;
+    resource.compression = resourceCompression;
+    resource.decompressed = resourceDecompressed;
+    Corrade::Utility::Resource::registerData(resource);
+    return 1;
+} CORRADE_AUTOMATIC_INITIALIZER(corradeResourceInitializer_ResourceTestCompressedData)
+
+int corradeResourceFinalizer_ResourceTestCompressedData();
+int corradeResourceFinalizer_ResourceTestCompressedData() {
+    Corrade::Utility::Resource::unregisterData(resource);
+    return 1;
+} CORRADE_AUTOMATIC_FINALIZER(corradeResourceFinalizer_ResourceTestCompressedData)
@@ -0,0 +1,487 @@
+/* Compiled resource file. DO NOT EDIT! */
+
+#include "Corrade/Corrade.h"
+#include "Corrade/Utility/Macros.h"
+#include "Corrade/Utility/Resource.h"
+
+#if CORRADE_RESOURCE_VERSION != 4
+#ifdef CORRADE_TARGET_CLANG
+#pragma GCC error "resource file compiled in version 4 but version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected, update your corrade-rc binary"
+#else
+#error resource file compiled in unexpected version 4, update your corrade-rc binary
+#if defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_MSVC)
+#pragma message("resource file version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected instead")
+#endif
+#endif
+#endif
+
+namespace {
+
+/* Pair `i` is offset of filename `i + 1` in the low 24 bits, padding after
+   data `i` in the upper 8 bits, and a 32bit offset of data `i + 1`. Offset of
+   the first filename and data is implicitly 0. */
+const unsigned int resourcePositions[] = {
+    0x00000028,0x0000057e,
+    0x00000037,0x00000586,
+    0x00000047,0x00000b04,
+    0x00000059,0x00001678
+};
+
+/* Pair `i` is a seed for bucket `i` and index of a file hashed to slot `i`
+   in a minimal perfect hash table of the filenames. */
+const unsigned int resourceHash[] = {
+    0x00000000,0x00000003,
+    0x00000001,0x00000000,
+    0x00000000,0x00000002,
+    0x00000001,0x00000001
+};
+
+const unsigned char resourceFilenames[] = {
+    /* 0-compressed-null-terminated-align16.txt */
+    0x30,0x2d,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x65,0x64,0x2d,0x6e,0x75,
+    0x6c,0x6c,0x2d,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x74,0x65,0x64,0x2d,0x61,
+    0x6c,0x69,0x67,0x6e,0x31,0x36,0x2e,0x74,0x78,0x74,
+
+    /* 1-too-small.bin */
+    0x31,0x2d,0x74,0x6f,0x6f,0x2d,0x73,0x6d,0x61,0x6c,0x6c,0x2e,0x62,0x69,0x6e,
+
+    /* 2-compressed.txt */
+    0x32,0x2d,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x65,0x64,0x2e,0x74,0x78,
+    0x74,
+
+    /* 3-uncompressed.txt */
+    0x33,0x2d,0x75,0x6e,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x65,0x64,0x2e,
+    0x74,0x78,0x74
+};
+
+/* Pair `i` is size of file `i` after decompression and its alignment in the
+   lower 8 bits together with null termination in bit 8. Both are zero if the
+   file isn't compressed. */
+const unsigned int resourceCompression[] = {
+    0x00000b74,0x00000110,
+    0x00000000,0x00000000,
+    0x00000b74,0x00000001,
+    0x00000000,0x00000000
+};
+
+/* Compressed files get decompressed here on first access */
+const char* resourceDecompressed[4]{};
+
+const unsigned char resourceData[] = {
+    /* 0-compressed-null-terminated-align16.txt (compressed) */
+    0xf3,0x19,0x6f,0x76,0x65,0x72,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x6c,0x61,
+    0x7a,0x79,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x71,
+    0x75,0x69,0x63,0x6b,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x0f,0x00,0x20,
+    0x0a,0x6f,0x30,0x00,0xb1,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,
+    0x6e,0x2a,0x00,0x05,0x24,0x00,0x31,0x66,0x6f,0x78,0x11,0x00,0x02,0x3b,0x00,
+    0x00,0x51,0x00,0x10,0x0a,0x05,0x00,0x03,0x4b,0x00,0x00,0x1e,0x00,0x02,0x1a,
+    0x00,0x05,0x31,0x00,0x01,0x1e,0x00,0x00,0x6d,0x00,0x07,0x53,0x00,0x12,0x0a,
+    0x24,0x00,0x00,0x2e,0x00,0x03,0x8e,0x00,0x03,0x07,0x00,0x07,0x24,0x00,0x01,
+    0x66,0x00,0x08,0x10,0x00,0x07,0x0c,0x00,0x02,0x73,0x00,0x00,0x55,0x00,0x00,
+    0x43,0x00,0x00,0x08,0x00,0x05,0x6f,0x00,0x02,0xe9,0x00,0x51,0x6a,0x75,0x6d,
+    0x70,0x73,0xef,0x00,0x12,0x0a,0x11,0x00,0x05,0x20,0x00,0x02,0x7a,0x00,0x07,
+    0x4c,0x00,0x12,0x20,0x2c,0x00,0x05,0x21,0x00,0x03,0x8a,0x00,0x01,0x37,0x00,
+    0x03,0xa8,0x00,0x08,0x2e,0x00,0x08,0x0c,0x00,0x03,0x2b,0x00,0x00,0x84,0x00,
+    0x01,0x35,0x01,0x02,0x5c,0x00,0x04,0x4a,0x00,0x53,0x0a,0x66,0x6f,0x6e,0x74,
+    0x18,0x01,0x08,0x36,0x00,0x00,0xaf,0x00,0x08,0x10,0x00,0x00,0x3f,0x00,0x33,
+    0x64,0x6f,0x67,0x98,0x01,0x14,0x0a,0x3f,0x00,0x01,0xbe,0x00,0x61,0x20,0x64,
+    0x61,0x74,0x61,0x20,0x5d,0x00,0x00,0x23,0x00,0x08,0x37,0x00,0x00,0x10,0x00,
+    0x00,0x19,0x00,0x12,0x0a,0xc0,0x00,0x01,0x46,0x00,0x00,0x2d,0x00,0x01,0xb9,
+    0x00,0x11,0x20,0x7c,0x00,0x01,0x3d,0x00,0x00,0x19,0x00,0x01,0x99,0x00,0x18,
+    0x0a,0x3e,0x00,0x02,0x35,0x00,0x05,0x6c,0x00,0x04,0x4d,0x00,0x03,0x38,0x00,
+    0x22,0x6f,0x67,0x16,0x01,0x09,0x33,0x00,0x01,0x45,0x00,0x03,0xd0,0x00,0x05,
+    0x39,0x00,0x01,0xde,0x01,0x02,0x73,0x00,0x01,0x6e,0x00,0x01,0x92,0x00,0x03,
+    0x10,0x00,0x22,0x6f,0x67,0xc4,0x00,0x00,0xf1,0x00,0x03,0x2b,0x01,0x02,0x44,
+    0x00,0x01,0x2a,0x00,0x04,0x43,0x00,0x09,0x64,0x00,0x01,0x1a,0x00,0x00,0x44,
+    0x00,0x02,0xf4,0x00,0x01,0xc6,0x00,0x01,0x0f,0x00,0x08,0xbc,0x00,0x3e,0x64,
+    0x6f,0x67,0x35,0x00,0x00,0xc2,0x00,0x02,0x5e,0x00,0x02,0x06,0x00,0x02,0xe1,
+    0x00,0x00,0x16,0x00,0x00,0x45,0x00,0x19,0x0a,0x80,0x00,0x00,0x91,0x00,0x00,
+    0x16,0x00,0x02,0xee,0x00,0x02,0x2a,0x00,0x03,0x21,0x00,0x07,0x68,0x00,0x04,
+    0x34,0x00,0x00,0x44,0x00,0x02,0x24,0x00,0x01,0x34,0x00,0x01,0xf2,0x00,0x03,
+    0x2e,0x00,0x01,0x9b,0x00,0x40,0x74,0x68,0x65,0x0a,0x24,0x00,0x01,0x0d,0x00,
+    0x02,0xfb,0x00,0x07,0x46,0x00,0x03,0x31,0x01,0x00,0x21,0x00,0x02,0x77,0x00,
+    0x21,0x78,0x0a,0xe5,0x00,0x02,0x52,0x00,0x02,0x2f,0x00,0x01,0x58,0x00,0x00,
+    0xa8,0x01,0x01,0x5c,0x00,0x01,0x05,0x00,0x00,0xe4,0x00,0x02,0xc9,0x00,0x02,
+    0x23,0x00,0x00,0x40,0x00,0x01,0x19,0x00,0x04,0x37,0x01,0x02,0xa1,0x01,0x07,
+    0xd8,0x03,0x06,0x39,0x02,0x02,0x5b,0x00,0x01,0x55,0x00,0x01,0x33,0x00,0x01,
+    0x99,0x00,0x03,0xb2,0x00,0x01,0x11,0x00,0x33,0x66,0x6f,0x78,0x17,0x03,0x08,
+    0x63,0x00,0x02,0x69,0x00,0x00,0x87,0x00,0x03,0x2c,0x00,0x00,0x0b,0x00,0x04,
+    0xdd,0x00,0x08,0xd2,0x00,0x02,0x29,0x00,0x02,0x66,0x00,0x02,0x06,0x00,0x00,
+    0xda,0x00,0x02,0x16,0x00,0x00,0x60,0x00,0x06,0x8a,0x00,0x01,0x7a,0x00,0x08,
+    0x3b,0x00,0x08,0x0c,0x00,0x01,0x1d,0x00,0x02,0x36,0x00,0x01,0xac,0x00,0x04,
+    0xda,0x00,0x09,0xdc,0x01,0x03,0x8b,0x00,0x03,0x07,0x00,0x01,0x28,0x00,0x00,
+    0x6d,0x00,0x00,0x0f,0x01,0x01,0x47,0x01,0x02,0x19,0x00,0x02,0x53,0x01,0x04,
+    0x41,0x00,0x02,0x76,0x02,0x00,0x8a,0x00,0x07,0x0a,0x00,0x02,0xea,0x00,0x00,
+    0x57,0x01,0x02,0x33,0x00,0x02,0x1b,0x00,0x00,0x4c,0x00,0x00,0xe7,0x00,0x02,
+    0x1e,0x00,0x00,0x0a,0x00,0x00,0x5a,0x00,0x01,0x95,0x00,0x03,0xfc,0x03,0x01,
+    0xa6,0x00,0x08,0xb7,0x00,0x00,0x33,0x00,0x02,0x2f,0x00,0x00,0x0a,0x00,0x08,
+    0x1a,0x00,0x02,0x37,0x00,0x05,0x86,0x00,0x02,0x25,0x00,0x0f,0x40,0x00,0x08,
+    0x00,0x6f,0x00,0x07,0x40,0x00,0x02,0xd5,0x04,0x01,0x45,0x00,0x03,0x0c,0x04,
+    0x03,0xe4,0x01,0x0d,0x43,0x00,0x01,0x11,0x00,0x00,0xcb,0x00,0x02,0x63,0x00,
+    0x02,0x06,0x00,0x00,0xb9,0x00,0x08,0x04,0x00,0x02,0x9a,0x01,0x01,0x1c,0x00,
+    0x09,0xed,0x01,0x01,0x44,0x01,0x01,0x42,0x00,0x01,0x0a,0x00,0x02,0x27,0x00,
+    0x00,0x39,0x00,0x00,0x0f,0x00,0x03,0x2a,0x00,0x05,0xc4,0x00,0x00,0xe3,0x00,
+    0x00,0xa7,0x00,0x05,0x11,0x00,0x01,0x39,0x00,0x02,0xa4,0x00,0x01,0x30,0x00,
+    0x05,0x19,0x00,0x00,0x2a,0x00,0x01,0x92,0x01,0x05,0x12,0x00,0x02,0x5a,0x00,
+    0x03,0x6e,0x01,0x01,0x88,0x00,0x01,0x70,0x03,0x03,0xb0,0x04,0x05,0x27,0x00,
+    0x07,0x52,0x00,0x01,0x0b,0x00,0x01,0x45,0x00,0x08,0x74,0x00,0x06,0x4f,0x02,
+    0x01,0x1b,0x00,0x0a,0x39,0x00,0x03,0x5f,0x00,0x00,0x30,0x00,0x07,0x4b,0x01,
+    0x01,0x37,0x05,0x02,0x15,0x02,0x01,0x34,0x00,0x00,0x1f,0x00,0x05,0x09,0x00,
+    0x01,0x19,0x02,0x00,0xbd,0x00,0x02,0x26,0x00,0x00,0x1c,0x00,0x00,0x04,0x00,
+    0x05,0x58,0x00,0x00,0x0c,0x01,0x01,0x8a,0x00,0x01,0x24,0x00,0x00,0xd8,0x00,
+    0x01,0x05,0x03,0x00,0x5c,0x05,0x02,0xd3,0x00,0x00,0x21,0x00,0x02,0x0a,0x00,
+    0x00,0x38,0x00,0x01,0x26,0x00,0x08,0x7c,0x00,0x00,0x3c,0x00,0x01,0x11,0x04,
+    0x03,0x72,0x00,0x22,0x6e,0x74,0xcd,0x04,0x00,0x18,0x00,0x03,0x0e,0x04,0x00,
+    0x38,0x00,0x01,0x12,0x01,0x10,0x0a,0x0a,0x00,0x00,0x50,0x00,0x00,0x08,0x00,
+    0x01,0x21,0x00,0x00,0x09,0x00,0x00,0x11,0x00,0x08,0x52,0x00,0x07,0x0c,0x00,
+    0x10,0x0a,0x90,0x00,0x00,0x20,0x00,0x03,0xf9,0x00,0x01,0x34,0x00,0x01,0x69,
+    0x00,0x03,0x11,0x00,0x01,0x57,0x00,0x03,0x40,0x02,0x03,0xc3,0x02,0x01,0xf1,
+    0x00,0x01,0x24,0x00,0x01,0xac,0x00,0x03,0x0a,0x00,0x20,0x78,0x20,0x47,0x00,
+    0x01,0xcb,0x01,0x02,0x7a,0x02,0x01,0x18,0x00,0x03,0x46,0x00,0x01,0x57,0x00,
+    0x02,0x4b,0x00,0x01,0x17,0x00,0x01,0x39,0x00,0x00,0x48,0x00,0x01,0xd9,0x00,
+    0x00,0x09,0x00,0x01,0xcc,0x01,0x05,0xcf,0x00,0x23,0x6e,0x74,0x8a,0x04,0x01,
+    0x50,0x00,0x02,0x0c,0x00,0x01,0xab,0x00,0x02,0x10,0x00,0x07,0xc1,0x00,0x01,
+    0x76,0x00,0x01,0x54,0x00,0x03,0x6b,0x00,0x0d,0x22,0x00,0x09,0x00,0x04,0x00,
+    0xa4,0x00,0x03,0x29,0x00,0x01,0x94,0x00,0x02,0x2e,0x00,0x05,0xac,0x01,0x05,
+    0x09,0x00,0x01,0x18,0x00,0x01,0x72,0x00,0x01,0x21,0x01,0x00,0xad,0x01,0x01,
+    0xb4,0x00,0x03,0x3c,0x00,0x02,0xcb,0x00,0x05,0x2e,0x00,0x00,0x1b,0x00,0x03,
+    0xeb,0x02,0x03,0xcc,0x00,0x20,0x78,0x20,0x79,0x01,0x00,0x3c,0x00,0x06,0xda,
+    0x01,0x01,0x0a,0x00,0x06,0x7e,0x02,0x00,0x21,0x00,0x01,0xb9,0x00,0x08,0xce,
+    0x00,0x01,0x95,0x00,0x01,0x29,0x00,0x15,0x20,0x5e,0x00,0x00,0x53,0x00,0x03,
+    0x5e,0x00,0x00,0x51,0x00,0x00,0x6d,0x00,0x02,0x02,0x02,0x07,0xcd,0x00,0x08,
+    0x44,0x00,0x04,0x39,0x00,0x02,0x87,0x01,0x04,0x0e,0x00,0x02,0x45,0x01,0x06,
+    0x56,0x00,0x01,0xe2,0x00,0x06,0x0f,0x00,0x05,0x27,0x00,0x01,0x9d,0x02,0x21,
+    0x6f,0x67,0xcd,0x02,0x03,0x34,0x00,0x08,0x5d,0x00,0x00,0x82,0x00,0x01,0xb6,
+    0x00,0x01,0x05,0x00,0x01,0x45,0x00,0x03,0x9c,0x00,0x01,0x0c,0x00,0x01,0x8f,
+    0x01,0x08,0x30,0x00,0x01,0xae,0x00,0x0b,0x2f,0x01,0x00,0x63,0x00,0x10,0x6f,
+    0x16,0x0a,0x03,0x4e,0x01,0x05,0x7c,0x00,0x0e,0x09,0x00,0x00,0xe3,0x00,0x01,
+    0x6a,0x00,0x00,0x05,0x00,0x03,0x80,0x02,0x05,0x26,0x00,0x00,0x8c,0x00,0x00,
+    0x46,0x01,0x00,0x04,0x00,0x02,0x34,0x01,0x00,0x12,0x00,0x0f,0x2a,0x00,0x01,
+    0x00,0x47,0x00,0x09,0x37,0x00,0x00,0x25,0x00,0x03,0x6e,0x02,0x00,0xf9,0x04,
+    0x01,0x8e,0x00,0x08,0xb7,0x00,0x05,0x2d,0x00,0x0f,0x15,0x00,0x02,0x00,0x71,
+    0x00,0x01,0xd9,0x00,0x01,0x76,0x00,0x01,0xc4,0x02,0x05,0x31,0x00,0x05,0x09,
+    0x00,0x01,0x63,0x00,0x09,0x79,0x00,0x04,0x37,0x00,0x06,0x04,0x02,0x01,0x40,
+    0x00,0x15,0x20,0x33,0x00,0x00,0x21,0x00,0x00,0x32,0x00,0x02,0x4b,0x01,0xb0,
+    0x6c,0x61,0x7a,0x79,0x20,0x71,0x75,0x69,0x63,0x6b,0x0a,
+
+    /* 1-too-small.bin */
+    0xd1,0x5e,0xa5,0xed,0xea,0xdd,0x00,0x0d,
+
+    /* 2-compressed.txt (compressed) */
+    0xf3,0x19,0x6f,0x76,0x65,0x72,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x6c,0x61,
+    0x7a,0x79,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x71,
+    0x75,0x69,0x63,0x6b,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x0f,0x00,0x20,
+    0x0a,0x6f,0x30,0x00,0xb1,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,
+    0x6e,0x2a,0x00,0x05,0x24,0x00,0x31,0x66,0x6f,0x78,0x11,0x00,0x02,0x3b,0x00,
+    0x00,0x51,0x00,0x10,0x0a,0x05,0x00,0x03,0x4b,0x00,0x00,0x1e,0x00,0x02,0x1a,
+    0x00,0x05,0x31,0x00,0x01,0x1e,0x00,0x00,0x6d,0x00,0x07,0x53,0x00,0x12,0x0a,
+    0x24,0x00,0x00,0x2e,0x00,0x03,0x8e,0x00,0x03,0x07,0x00,0x07,0x24,0x00,0x01,
+    0x66,0x00,0x08,0x10,0x00,0x07,0x0c,0x00,0x02,0x73,0x00,0x00,0x55,0x00,0x00,
+    0x43,0x00,0x00,0x08,0x00,0x05,0x6f,0x00,0x02,0xe9,0x00,0x51,0x6a,0x75,0x6d,
+    0x70,0x73,0xef,0x00,0x12,0x0a,0x11,0x00,0x05,0x20,0x00,0x02,0x7a,0x00,0x07,
+    0x4c,0x00,0x12,0x20,0x2c,0x00,0x05,0x21,0x00,0x03,0x8a,0x00,0x01,0x37,0x00,
+    0x03,0xa8,0x00,0x08,0x2e,0x00,0x08,0x0c,0x00,0x03,0x2b,0x00,0x00,0x84,0x00,
+    0x01,0x35,0x01,0x02,0x5c,0x00,0x04,0x4a,0x00,0x53,0x0a,0x66,0x6f,0x6e,0x74,
+    0x18,0x01,0x08,0x36,0x00,0x00,0xaf,0x00,0x08,0x10,0x00,0x00,0x3f,0x00,0x33,
+    0x64,0x6f,0x67,0x98,0x01,0x14,0x0a,0x3f,0x00,0x01,0xbe,0x00,0x61,0x20,0x64,
+    0x61,0x74,0x61,0x20,0x5d,0x00,0x00,0x23,0x00,0x08,0x37,0x00,0x00,0x10,0x00,
+    0x00,0x19,0x00,0x12,0x0a,0xc0,0x00,0x01,0x46,0x00,0x00,0x2d,0x00,0x01,0xb9,
+    0x00,0x11,0x20,0x7c,0x00,0x01,0x3d,0x00,0x00,0x19,0x00,0x01,0x99,0x00,0x18,
+    0x0a,0x3e,0x00,0x02,0x35,0x00,0x05,0x6c,0x00,0x04,0x4d,0x00,0x03,0x38,0x00,
+    0x22,0x6f,0x67,0x16,0x01,0x09,0x33,0x00,0x01,0x45,0x00,0x03,0xd0,0x00,0x05,
+    0x39,0x00,0x01,0xde,0x01,0x02,0x73,0x00,0x01,0x6e,0x00,0x01,0x92,0x00,0x03,
+    0x10,0x00,0x22,0x6f,0x67,0xc4,0x00,0x00,0xf1,0x00,0x03,0x2b,0x01,0x02,0x44,
+    0x00,0x01,0x2a,0x00,0x04,0x43,0x00,0x09,0x64,0x00,0x01,0x1a,0x00,0x00,0x44,
+    0x00,0x02,0xf4,0x00,0x01,0xc6,0x00,0x01,0x0f,0x00,0x08,0xbc,0x00,0x3e,0x64,
+    0x6f,0x67,0x35,0x00,0x00,0xc2,0x00,0x02,0x5e,0x00,0x02,0x06,0x00,0x02,0xe1,
+    0x00,0x00,0x16,0x00,0x00,0x45,0x00,0x19,0x0a,0x80,0x00,0x00,0x91,0x00,0x00,
+    0x16,0x00,0x02,0xee,0x00,0x02,0x2a,0x00,0x03,0x21,0x00,0x07,0x68,0x00,0x04,
+    0x34,0x00,0x00,0x44,0x00,0x02,0x24,0x00,0x01,0x34,0x00,0x01,0xf2,0x00,0x03,
+    0x2e,0x00,0x01,0x9b,0x00,0x40,0x74,0x68,0x65,0x0a,0x24,0x00,0x01,0x0d,0x00,
+    0x02,0xfb,0x00,0x07,0x46,0x00,0x03,0x31,0x01,0x00,0x21,0x00,0x02,0x77,0x00,
+    0x21,0x78,0x0a,0xe5,0x00,0x02,0x52,0x00,0x02,0x2f,0x00,0x01,0x58,0x00,0x00,
+    0xa8,0x01,0x01,0x5c,0x00,0x01,0x05,0x00,0x00,0xe4,0x00,0x02,0xc9,0x00,0x02,
+    0x23,0x00,0x00,0x40,0x00,0x01,0x19,0x00,0x04,0x37,0x01,0x02,0xa1,0x01,0x07,
+    0xd8,0x03,0x06,0x39,0x02,0x02,0x5b,0x00,0x01,0x55,0x00,0x01,0x33,0x00,0x01,
+    0x99,0x00,0x03,0xb2,0x00,0x01,0x11,0x00,0x33,0x66,0x6f,0x78,0x17,0x03,0x08,
+    0x63,0x00,0x02,0x69,0x00,0x00,0x87,0x00,0x03,0x2c,0x00,0x00,0x0b,0x00,0x04,
+    0xdd,0x00,0x08,0xd2,0x00,0x02,0x29,0x00,0x02,0x66,0x00,0x02,0x06,0x00,0x00,
+    0xda,0x00,0x02,0x16,0x00,0x00,0x60,0x00,0x06,0x8a,0x00,0x01,0x7a,0x00,0x08,
+    0x3b,0x00,0x08,0x0c,0x00,0x01,0x1d,0x00,0x02,0x36,0x00,0x01,0xac,0x00,0x04,
+    0xda,0x00,0x09,0xdc,0x01,0x03,0x8b,0x00,0x03,0x07,0x00,0x01,0x28,0x00,0x00,
+    0x6d,0x00,0x00,0x0f,0x01,0x01,0x47,0x01,0x02,0x19,0x00,0x02,0x53,0x01,0x04,
+    0x41,0x00,0x02,0x76,0x02,0x00,0x8a,0x00,0x07,0x0a,0x00,0x02,0xea,0x00,0x00,
+    0x57,0x01,0x02,0x33,0x00,0x02,0x1b,0x00,0x00,0x4c,0x00,0x00,0xe7,0x00,0x02,
+    0x1e,0x00,0x00,0x0a,0x00,0x00,0x5a,0x00,0x01,0x95,0x00,0x03,0xfc,0x03,0x01,
+    0xa6,0x00,0x08,0xb7,0x00,0x00,0x33,0x00,0x02,0x2f,0x00,0x00,0x0a,0x00,0x08,
+    0x1a,0x00,0x02,0x37,0x00,0x05,0x86,0x00,0x02,0x25,0x00,0x0f,0x40,0x00,0x08,
+    0x00,0x6f,0x00,0x07,0x40,0x00,0x02,0xd5,0x04,0x01,0x45,0x00,0x03,0x0c,0x04,
+    0x03,0xe4,0x01,0x0d,0x43,0x00,0x01,0x11,0x00,0x00,0xcb,0x00,0x02,0x63,0x00,
+    0x02,0x06,0x00,0x00,0xb9,0x00,0x08,0x04,0x00,0x02,0x9a,0x01,0x01,0x1c,0x00,
+    0x09,0xed,0x01,0x01,0x44,0x01,0x01,0x42,0x00,0x01,0x0a,0x00,0x02,0x27,0x00,
+    0x00,0x39,0x00,0x00,0x0f,0x00,0x03,0x2a,0x00,0x05,0xc4,0x00,0x00,0xe3,0x00,
+    0x00,0xa7,0x00,0x05,0x11,0x00,0x01,0x39,0x00,0x02,0xa4,0x00,0x01,0x30,0x00,
+    0x05,0x19,0x00,0x00,0x2a,0x00,0x01,0x92,0x01,0x05,0x12,0x00,0x02,0x5a,0x00,
+    0x03,0x6e,0x01,0x01,0x88,0x00,0x01,0x70,0x03,0x03,0xb0,0x04,0x05,0x27,0x00,
+    0x07,0x52,0x00,0x01,0x0b,0x00,0x01,0x45,0x00,0x08,0x74,0x00,0x06,0x4f,0x02,
+    0x01,0x1b,0x00,0x0a,0x39,0x00,0x03,0x5f,0x00,0x00,0x30,0x00,0x07,0x4b,0x01,
+    0x01,0x37,0x05,0x02,0x15,0x02,0x01,0x34,0x00,0x00,0x1f,0x00,0x05,0x09,0x00,
+    0x01,0x19,0x02,0x00,0xbd,0x00,0x02,0x26,0x00,0x00,0x1c,0x00,0x00,0x04,0x00,
+    0x05,0x58,0x00,0x00,0x0c,0x01,0x01,0x8a,0x00,0x01,0x24,0x00,0x00,0xd8,0x00,
+    0x01,0x05,0x03,0x00,0x5c,0x05,0x02,0xd3,0x00,0x00,0x21,0x00,0x02,0x0a,0x00,
+    0x00,0x38,0x00,0x01,0x26,0x00,0x08,0x7c,0x00,0x00,0x3c,0x00,0x01,0x11,0x04,
+    0x03,0x72,0x00,0x22,0x6e,0x74,0xcd,0x04,0x00,0x18,0x00,0x03,0x0e,0x04,0x00,
+    0x38,0x00,0x01,0x12,0x01,0x10,0x0a,0x0a,0x00,0x00,0x50,0x00,0x00,0x08,0x00,
+    0x01,0x21,0x00,0x00,0x09,0x00,0x00,0x11,0x00,0x08,0x52,0x00,0x07,0x0c,0x00,
+    0x10,0x0a,0x90,0x00,0x00,0x20,0x00,0x03,0xf9,0x00,0x01,0x34,0x00,0x01,0x69,
+    0x00,0x03,0x11,0x00,0x01,0x57,0x00,0x03,0x40,0x02,0x03,0xc3,0x02,0x01,0xf1,
+    0x00,0x01,0x24,0x00,0x01,0xac,0x00,0x03,0x0a,0x00,0x20,0x78,0x20,0x47,0x00,
+    0x01,0xcb,0x01,0x02,0x7a,0x02,0x01,0x18,0x00,0x03,0x46,0x00,0x01,0x57,0x00,
+    0x02,0x4b,0x00,0x01,0x17,0x00,0x01,0x39,0x00,0x00,0x48,0x00,0x01,0xd9,0x00,
+    0x00,0x09,0x00,0x01,0xcc,0x01,0x05,0xcf,0x00,0x23,0x6e,0x74,0x8a,0x04,0x01,
+    0x50,0x00,0x02,0x0c,0x00,0x01,0xab,0x00,0x02,0x10,0x00,0x07,0xc1,0x00,0x01,
+    0x76,0x00,0x01,0x54,0x00,0x03,0x6b,0x00,0x0d,0x22,0x00,0x09,0x00,0x04,0x00,
+    0xa4,0x00,0x03,0x29,0x00,0x01,0x94,0x00,0x02,0x2e,0x00,0x05,0xac,0x01,0x05,
+    0x09,0x00,0x01,0x18,0x00,0x01,0x72,0x00,0x01,0x21,0x01,0x00,0xad,0x01,0x01,
+    0xb4,0x00,0x03,0x3c,0x00,0x02,0xcb,0x00,0x05,0x2e,0x00,0x00,0x1b,0x00,0x03,
+    0xeb,0x02,0x03,0xcc,0x00,0x20,0x78,0x20,0x79,0x01,0x00,0x3c,0x00,0x06,0xda,
+    0x01,0x01,0x0a,0x00,0x06,0x7e,0x02,0x00,0x21,0x00,0x01,0xb9,0x00,0x08,0xce,
+    0x00,0x01,0x95,0x00,0x01,0x29,0x00,0x15,0x20,0x5e,0x00,0x00,0x53,0x00,0x03,
+    0x5e,0x00,0x00,0x51,0x00,0x00,0x6d,0x00,0x02,0x02,0x02,0x07,0xcd,0x00,0x08,
+    0x44,0x00,0x04,0x39,0x00,0x02,0x87,0x01,0x04,0x0e,0x00,0x02,0x45,0x01,0x06,
+    0x56,0x00,0x01,0xe2,0x00,0x06,0x0f,0x00,0x05,0x27,0x00,0x01,0x9d,0x02,0x21,
+    0x6f,0x67,0xcd,0x02,0x03,0x34,0x00,0x08,0x5d,0x00,0x00,0x82,0x00,0x01,0xb6,
+    0x00,0x01,0x05,0x00,0x01,0x45,0x00,0x03,0x9c,0x00,0x01,0x0c,0x00,0x01,0x8f,
+    0x01,0x08,0x30,0x00,0x01,0xae,0x00,0x0b,0x2f,0x01,0x00,0x63,0x00,0x10,0x6f,
+    0x16,0x0a,0x03,0x4e,0x01,0x05,0x7c,0x00,0x0e,0x09,0x00,0x00,0xe3,0x00,0x01,
+    0x6a,0x00,0x00,0x05,0x00,0x03,0x80,0x02,0x05,0x26,0x00,0x00,0x8c,0x00,0x00,
+    0x46,0x01,0x00,0x04,0x00,0x02,0x34,0x01,0x00,0x12,0x00,0x0f,0x2a,0x00,0x01,
+    0x00,0x47,0x00,0x09,0x37,0x00,0x00,0x25,0x00,0x03,0x6e,0x02,0x00,0xf9,0x04,
+    0x01,0x8e,0x00,0x08,0xb7,0x00,0x05,0x2d,0x00,0x0f,0x15,0x00,0x02,0x00,0x71,
+    0x00,0x01,0xd9,0x00,0x01,0x76,0x00,0x01,0xc4,0x02,0x05,0x31,0x00,0x05,0x09,
+    0x00,0x01,0x63,0x00,0x09,0x79,0x00,0x04,0x37,0x00,0x06,0x04,0x02,0x01,0x40,
+    0x00,0x15,0x20,0x33,0x00,0x00,0x21,0x00,0x00,0x32,0x00,0x02,0x4b,0x01,0xb0,
+    0x6c,0x61,0x7a,0x79,0x20,0x71,0x75,0x69,0x63,0x6b,0x0a,
+
+    /* 3-uncompressed.txt */
+    0x6f,0x76,0x65,0x72,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x6c,0x61,0x7a,0x79,
+    0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x71,0x75,0x69,
+    0x63,0x6b,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x71,0x75,0x69,
+    0x63,0x6b,0x0a,0x6f,0x76,0x65,0x72,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,
+    0x73,0x69,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x20,0x66,0x6f,0x78,0x20,0x74,0x68,0x65,0x20,0x71,0x75,0x69,0x63,
+    0x6b,0x20,0x6c,0x61,0x7a,0x79,0x0a,0x6c,0x61,0x7a,0x79,0x20,0x71,0x75,0x69,
+    0x63,0x6b,0x20,0x66,0x6f,0x78,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x72,0x65,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x6c,0x61,0x7a,0x79,0x20,0x74,0x68,0x65,
+    0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x0a,0x71,0x75,
+    0x69,0x63,0x6b,0x20,0x66,0x6f,0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,
+    0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,
+    0x69,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,
+    0x73,0x69,0x6f,0x6e,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,
+    0x6e,0x0a,0x6c,0x61,0x7a,0x79,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x78,0x20,
+    0x74,0x68,0x65,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x62,0x72,
+    0x6f,0x77,0x6e,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x6c,0x61,0x7a,0x79,0x0a,
+    0x62,0x72,0x6f,0x77,0x6e,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,
+    0x71,0x75,0x69,0x63,0x6b,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,
+    0x6f,0x6e,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x62,0x72,0x6f,0x77,0x6e,
+    0x0a,0x71,0x75,0x69,0x63,0x6b,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,
+    0x69,0x6f,0x6e,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,
+    0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x66,0x6f,0x78,0x20,0x6f,0x76,0x65,
+    0x72,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x0a,0x66,0x6f,0x6e,0x74,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x63,0x6f,
+    0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x63,
+    0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x66,0x6f,0x78,0x20,
+    0x64,0x6f,0x67,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x0a,0x72,0x65,0x73,0x6f,
+    0x75,0x72,0x63,0x65,0x20,0x6c,0x61,0x7a,0x79,0x20,0x64,0x61,0x74,0x61,0x20,
+    0x6f,0x76,0x65,0x72,0x20,0x64,0x6f,0x67,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,
+    0x73,0x73,0x69,0x6f,0x6e,0x20,0x64,0x6f,0x67,0x20,0x6f,0x76,0x65,0x72,0x0a,
+    0x6a,0x75,0x6d,0x70,0x73,0x20,0x66,0x6f,0x78,0x20,0x64,0x61,0x74,0x61,0x20,
+    0x62,0x72,0x6f,0x77,0x6e,0x20,0x66,0x6f,0x6e,0x74,0x20,0x64,0x61,0x74,0x61,
+    0x20,0x66,0x6f,0x78,0x20,0x71,0x75,0x69,0x63,0x6b,0x0a,0x63,0x6f,0x6d,0x70,
+    0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x72,
+    0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x64,0x6f,0x67,0x20,0x6f,0x76,0x65,
+    0x72,0x20,0x66,0x6f,0x6e,0x74,0x20,0x64,0x6f,0x67,0x20,0x6a,0x75,0x6d,0x70,
+    0x73,0x0a,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x71,
+    0x75,0x69,0x63,0x6b,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x72,0x65,0x73,0x6f,
+    0x75,0x72,0x63,0x65,0x20,0x6c,0x61,0x7a,0x79,0x20,0x62,0x72,0x6f,0x77,0x6e,
+    0x20,0x64,0x61,0x74,0x61,0x20,0x6f,0x76,0x65,0x72,0x0a,0x62,0x72,0x6f,0x77,
+    0x6e,0x20,0x64,0x6f,0x67,0x20,0x6c,0x61,0x7a,0x79,0x20,0x74,0x68,0x65,0x20,
+    0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x64,0x61,
+    0x74,0x61,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x0a,0x63,0x6f,0x6d,
+    0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x64,0x61,0x74,0x61,0x20,0x6f,
+    0x76,0x65,0x72,0x20,0x6f,0x76,0x65,0x72,0x20,0x66,0x6f,0x6e,0x74,0x20,0x6f,
+    0x76,0x65,0x72,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,
+    0x20,0x64,0x6f,0x67,0x0a,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,
+    0x6e,0x20,0x64,0x61,0x74,0x61,0x20,0x64,0x6f,0x67,0x20,0x71,0x75,0x69,0x63,
+    0x6b,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x64,
+    0x6f,0x67,0x20,0x66,0x6f,0x6e,0x74,0x0a,0x73,0x68,0x61,0x64,0x65,0x72,0x20,
+    0x71,0x75,0x69,0x63,0x6b,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6e,0x74,0x20,
+    0x66,0x6f,0x6e,0x74,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x73,0x68,0x61,0x64,
+    0x65,0x72,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x0a,
+    0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x64,0x6f,0x67,0x20,0x6a,0x75,0x6d,0x70,
+    0x73,0x20,0x66,0x6f,0x6e,0x74,0x20,0x6c,0x61,0x7a,0x79,0x20,0x73,0x68,0x61,
+    0x64,0x65,0x72,0x20,0x6f,0x76,0x65,0x72,0x20,0x74,0x68,0x65,0x0a,0x64,0x6f,
+    0x67,0x20,0x6f,0x76,0x65,0x72,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x63,0x6f,
+    0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x71,0x75,0x69,0x63,0x6b,
+    0x20,0x64,0x6f,0x67,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x78,0x0a,0x64,0x61,
+    0x74,0x61,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,
+    0x66,0x6f,0x6e,0x74,0x20,0x66,0x6f,0x78,0x20,0x6c,0x61,0x7a,0x79,0x20,0x6c,
+    0x61,0x7a,0x79,0x20,0x64,0x6f,0x67,0x0a,0x71,0x75,0x69,0x63,0x6b,0x20,0x62,
+    0x72,0x6f,0x77,0x6e,0x20,0x64,0x6f,0x67,0x20,0x6c,0x61,0x7a,0x79,0x20,0x72,
+    0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x62,
+    0x72,0x6f,0x77,0x6e,0x20,0x6c,0x61,0x7a,0x79,0x0a,0x72,0x65,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x66,0x6f,0x6e,0x74,0x20,
+    0x6c,0x61,0x7a,0x79,0x20,0x6f,0x76,0x65,0x72,0x20,0x73,0x68,0x61,0x64,0x65,
+    0x72,0x20,0x6c,0x61,0x7a,0x79,0x20,0x66,0x6f,0x78,0x0a,0x62,0x72,0x6f,0x77,
+    0x6e,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x62,
+    0x72,0x6f,0x77,0x6e,0x20,0x66,0x6f,0x78,0x20,0x73,0x68,0x61,0x64,0x65,0x72,
+    0x20,0x66,0x6f,0x78,0x20,0x74,0x68,0x65,0x0a,0x64,0x6f,0x67,0x20,0x63,0x6f,
+    0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x62,0x72,0x6f,0x77,0x6e,
+    0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x74,0x68,
+    0x65,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x6c,0x61,0x7a,0x79,0x0a,0x72,0x65,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x6f,0x76,0x65,0x72,0x20,0x63,0x6f,0x6d,
+    0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,
+    0x73,0x73,0x69,0x6f,0x6e,0x20,0x6f,0x76,0x65,0x72,0x20,0x62,0x72,0x6f,0x77,
+    0x6e,0x20,0x66,0x6f,0x6e,0x74,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x0a,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x73,0x68,
+    0x61,0x64,0x65,0x72,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x66,0x6f,0x6e,
+    0x74,0x20,0x74,0x68,0x65,0x20,0x64,0x6f,0x67,0x20,0x64,0x61,0x74,0x61,0x20,
+    0x73,0x68,0x61,0x64,0x65,0x72,0x0a,0x64,0x61,0x74,0x61,0x20,0x72,0x65,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x20,0x6c,0x61,0x7a,0x79,0x20,0x6c,0x61,0x7a,0x79,
+    0x20,0x6c,0x61,0x7a,0x79,0x20,0x6c,0x61,0x7a,0x79,0x20,0x71,0x75,0x69,0x63,
+    0x6b,0x20,0x64,0x6f,0x67,0x0a,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x6c,0x61,
+    0x7a,0x79,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x78,0x20,0x71,0x75,0x69,0x63,
+    0x6b,0x20,0x66,0x6f,0x78,0x20,0x64,0x6f,0x67,0x20,0x62,0x72,0x6f,0x77,0x6e,
+    0x0a,0x71,0x75,0x69,0x63,0x6b,0x20,0x6f,0x76,0x65,0x72,0x20,0x63,0x6f,0x6d,
+    0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x71,0x75,
+    0x69,0x63,0x6b,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,
+    0x73,0x69,0x6f,0x6e,0x20,0x62,0x72,0x6f,0x77,0x6e,0x0a,0x72,0x65,0x73,0x6f,
+    0x75,0x72,0x63,0x65,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x6f,0x76,0x65,0x72,
+    0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x74,0x68,
+    0x65,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x66,0x6f,0x78,0x20,0x63,0x6f,0x6d,
+    0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x0a,0x6c,0x61,0x7a,0x79,0x20,0x62,
+    0x72,0x6f,0x77,0x6e,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x6a,0x75,0x6d,
+    0x70,0x73,0x20,0x6f,0x76,0x65,0x72,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,
+    0x73,0x69,0x6f,0x6e,0x20,0x6f,0x76,0x65,0x72,0x20,0x64,0x6f,0x67,0x0a,0x71,
+    0x75,0x69,0x63,0x6b,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x64,0x6f,0x67,0x20,
+    0x64,0x6f,0x67,0x20,0x64,0x6f,0x67,0x20,0x64,0x6f,0x67,0x20,0x6a,0x75,0x6d,
+    0x70,0x73,0x20,0x71,0x75,0x69,0x63,0x6b,0x0a,0x62,0x72,0x6f,0x77,0x6e,0x20,
+    0x71,0x75,0x69,0x63,0x6b,0x20,0x66,0x6f,0x6e,0x74,0x20,0x6f,0x76,0x65,0x72,
+    0x20,0x66,0x6f,0x6e,0x74,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x64,0x6f,0x67,
+    0x20,0x66,0x6f,0x6e,0x74,0x0a,0x62,0x72,0x6f,0x77,0x6e,0x20,0x72,0x65,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x78,0x20,0x72,
+    0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x6f,0x76,0x65,0x72,0x20,0x62,0x72,
+    0x6f,0x77,0x6e,0x20,0x66,0x6f,0x6e,0x74,0x0a,0x72,0x65,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x64,0x61,0x74,0x61,0x20,0x72,0x65,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x73,0x68,0x61,
+    0x64,0x65,0x72,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x66,0x6f,0x6e,0x74,0x0a,
+    0x6a,0x75,0x6d,0x70,0x73,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,
+    0x6f,0x76,0x65,0x72,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x6f,0x76,0x65,0x72,
+    0x20,0x64,0x61,0x74,0x61,0x20,0x66,0x6f,0x78,0x20,0x72,0x65,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x0a,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x64,0x61,
+    0x74,0x61,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x6f,0x76,0x65,
+    0x72,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x66,0x6f,0x78,0x20,0x63,0x6f,
+    0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x64,0x61,0x74,0x61,0x0a,
+    0x64,0x61,0x74,0x61,0x20,0x64,0x61,0x74,0x61,0x20,0x66,0x6f,0x78,0x20,0x64,
+    0x61,0x74,0x61,0x20,0x66,0x6f,0x78,0x20,0x6c,0x61,0x7a,0x79,0x20,0x66,0x6f,
+    0x6e,0x74,0x20,0x64,0x61,0x74,0x61,0x0a,0x66,0x6f,0x78,0x20,0x66,0x6f,0x78,
+    0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x64,0x6f,0x67,0x20,0x6f,
+    0x76,0x65,0x72,0x20,0x66,0x6f,0x6e,0x74,0x20,0x74,0x68,0x65,0x20,0x74,0x68,
+    0x65,0x0a,0x64,0x61,0x74,0x61,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x64,0x6f,
+    0x67,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x66,0x6f,0x78,0x20,0x66,0x6f,0x6e,
+    0x74,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x6f,
+    0x76,0x65,0x72,0x0a,0x64,0x6f,0x67,0x20,0x64,0x61,0x74,0x61,0x20,0x66,0x6f,
+    0x6e,0x74,0x20,0x6f,0x76,0x65,0x72,0x20,0x6f,0x76,0x65,0x72,0x20,0x71,0x75,
+    0x69,0x63,0x6b,0x20,0x66,0x6f,0x78,0x20,0x71,0x75,0x69,0x63,0x6b,0x0a,0x66,
+    0x6f,0x78,0x20,0x64,0x6f,0x67,0x20,0x66,0x6f,0x78,0x20,0x6f,0x76,0x65,0x72,
+    0x20,0x66,0x6f,0x78,0x20,0x64,0x6f,0x67,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,
+    0x73,0x73,0x69,0x6f,0x6e,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,
+    0x6f,0x6e,0x0a,0x74,0x68,0x65,0x20,0x64,0x6f,0x67,0x20,0x73,0x68,0x61,0x64,
+    0x65,0x72,0x20,0x6f,0x76,0x65,0x72,0x20,0x64,0x61,0x74,0x61,0x20,0x73,0x68,
+    0x61,0x64,0x65,0x72,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x73,0x68,0x61,0x64,
+    0x65,0x72,0x0a,0x71,0x75,0x69,0x63,0x6b,0x20,0x6c,0x61,0x7a,0x79,0x20,0x64,
+    0x61,0x74,0x61,0x20,0x66,0x6f,0x6e,0x74,0x20,0x64,0x61,0x74,0x61,0x20,0x66,
+    0x6f,0x78,0x20,0x64,0x6f,0x67,0x20,0x62,0x72,0x6f,0x77,0x6e,0x0a,0x6c,0x61,
+    0x7a,0x79,0x20,0x64,0x61,0x74,0x61,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,
+    0x6f,0x76,0x65,0x72,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x64,0x61,0x74,0x61,
+    0x20,0x66,0x6f,0x6e,0x74,0x20,0x6c,0x61,0x7a,0x79,0x0a,0x64,0x6f,0x67,0x20,
+    0x6c,0x61,0x7a,0x79,0x20,0x66,0x6f,0x6e,0x74,0x20,0x71,0x75,0x69,0x63,0x6b,
+    0x20,0x66,0x6f,0x6e,0x74,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x62,0x72,0x6f,
+    0x77,0x6e,0x20,0x62,0x72,0x6f,0x77,0x6e,0x0a,0x74,0x68,0x65,0x20,0x62,0x72,
+    0x6f,0x77,0x6e,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,
+    0x20,0x64,0x6f,0x67,0x20,0x64,0x61,0x74,0x61,0x20,0x73,0x68,0x61,0x64,0x65,
+    0x72,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,
+    0x73,0x69,0x6f,0x6e,0x0a,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,
+    0x6e,0x20,0x64,0x6f,0x67,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x6f,0x76,
+    0x65,0x72,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x62,0x72,0x6f,
+    0x77,0x6e,0x0a,0x74,0x68,0x65,0x20,0x74,0x68,0x65,0x20,0x64,0x61,0x74,0x61,
+    0x20,0x66,0x6f,0x6e,0x74,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x71,0x75,
+    0x69,0x63,0x6b,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x66,0x6f,
+    0x6e,0x74,0x0a,0x62,0x72,0x6f,0x77,0x6e,0x20,0x6c,0x61,0x7a,0x79,0x20,0x66,
+    0x6f,0x78,0x20,0x66,0x6f,0x78,0x20,0x74,0x68,0x65,0x20,0x6a,0x75,0x6d,0x70,
+    0x73,0x20,0x66,0x6f,0x78,0x20,0x6a,0x75,0x6d,0x70,0x73,0x0a,0x72,0x65,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x20,0x66,0x6f,0x78,0x20,0x64,0x61,0x74,0x61,0x20,
+    0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x6f,0x76,0x65,
+    0x72,0x20,0x6a,0x75,0x6d,0x70,0x73,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x20,0x6c,0x61,0x7a,0x79,0x0a,0x62,0x72,0x6f,0x77,0x6e,0x20,0x74,0x68,
+    0x65,0x20,0x66,0x6f,0x6e,0x74,0x20,0x6f,0x76,0x65,0x72,0x20,0x64,0x6f,0x67,
+    0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,
+    0x73,0x69,0x6f,0x6e,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x0a,0x6c,
+    0x61,0x7a,0x79,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x62,0x72,
+    0x6f,0x77,0x6e,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x62,0x72,
+    0x6f,0x77,0x6e,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x72,0x65,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x74,0x68,0x65,0x0a,0x64,0x6f,0x67,0x20,
+    0x64,0x61,0x74,0x61,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x63,0x6f,0x6d,0x70,
+    0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x64,0x61,0x74,
+    0x61,0x20,0x64,0x61,0x74,0x61,0x20,0x62,0x72,0x6f,0x77,0x6e,0x0a,0x62,0x72,
+    0x6f,0x77,0x6e,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x64,0x6f,0x67,0x20,0x63,
+    0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x66,0x6f,0x6e,0x74,
+    0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,
+    0x20,0x74,0x68,0x65,0x0a,0x6f,0x76,0x65,0x72,0x20,0x73,0x68,0x61,0x64,0x65,
+    0x72,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x72,0x65,0x73,0x6f,
+    0x75,0x72,0x63,0x65,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x64,
+    0x6f,0x67,0x20,0x64,0x61,0x74,0x61,0x20,0x64,0x61,0x74,0x61,0x0a,0x71,0x75,
+    0x69,0x63,0x6b,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x74,0x68,
+    0x65,0x20,0x66,0x6f,0x78,0x20,0x66,0x6f,0x78,0x20,0x6a,0x75,0x6d,0x70,0x73,
+    0x20,0x74,0x68,0x65,0x20,0x64,0x61,0x74,0x61,0x0a,0x71,0x75,0x69,0x63,0x6b,
+    0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x64,0x6f,0x67,0x20,0x72,
+    0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x64,0x61,0x74,
+    0x61,0x20,0x71,0x75,0x69,0x63,0x6b,0x20,0x64,0x6f,0x67,0x0a,0x6f,0x76,0x65,
+    0x72,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x20,0x72,
+    0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,
+    0x73,0x69,0x6f,0x6e,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x66,
+    0x6f,0x78,0x20,0x66,0x6f,0x6e,0x74,0x20,0x6a,0x75,0x6d,0x70,0x73,0x0a,0x64,
+    0x6f,0x67,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x72,0x65,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x20,0x64,0x61,0x74,0x61,0x20,0x64,0x6f,0x67,0x20,
+    0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x66,0x6f,0x78,0x20,0x66,0x6f,
+    0x6e,0x74,0x0a,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x6a,0x75,0x6d,
+    0x70,0x73,0x20,0x72,0x65,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x66,0x6f,0x78,
+    0x20,0x64,0x6f,0x67,0x20,0x62,0x72,0x6f,0x77,0x6e,0x20,0x6c,0x61,0x7a,0x79,
+    0x20,0x71,0x75,0x69,0x63,0x6b,0x0a
+};
+
+Corrade::Utility::Implementation::ResourceGroup resource;
+
+}
+
+int corradeResourceInitializer_ResourceTestCompressedData();
+int corradeResourceInitializer_ResourceTestCompressedData() {
+    resource.name = "compressed";
+    resource.count = 4;
+    resource.positions = resourcePositions;
+    resource.filenames = resourceFilenames;
+    resource.data = resourceData;
+    resource.hash = resourceHash;
+    resource.compression = resourceCompression;
+    resource.decompressed = resourceDecompressed;
+    Corrade::Utility::Resource::registerData(resource);
+    return 1;
+} CORRADE_AUTOMATIC_INITIALIZER(corradeResourceInitializer_ResourceTestCompressedData)
+
+int corradeResourceFinalizer_ResourceTestCompressedData();
+int corradeResourceFinalizer_ResourceTestCompressedData() {
+    Corrade::Utility::Resource::unregisterData(resource);
+    return 1;
+} CORRADE_AUTOMATIC_FINALIZER(corradeResourceFinalizer_ResourceTestCompressedData)
@@ -4,11 +4,11 @@
 #include "Corrade/Utility/Macros.h"
 #include "Corrade/Utility/Resource.h"
 
-#if CORRADE_RESOURCE_VERSION != 2
+#if CORRADE_RESOURCE_VERSION != 4
 #ifdef CORRADE_TARGET_CLANG
-#pragma GCC error "resource file compiled in version 2 but version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected, update your corrade-rc binary"
+#pragma GCC error "resource file compiled in version 4 but version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected, update your corrade-rc binary"
 #else
-#error resource file compiled in unexpected version 2, update your corrade-rc binary
+#error resource file compiled in unexpected version 4, update your corrade-rc binary
 #if defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_MSVC)
 #pragma message("resource file version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected instead")
 #endif
@@ -24,6 +24,12 @@ const unsigned int resourcePositions[] = {
     0x00000009,0x00000000
 };
 
+/* Pair `i` is a seed for bucket `i` and index of a file hashed to slot `i`
+   in a minimal perfect hash table of the filenames. */
+const unsigned int resourceHash[] = {
+    0x00000001,0x00000000
+};
+
 const unsigned char resourceFilenames[] = {
     /* empty.bin */
     0x65,0x6d,0x70,0x74,0x79,0x2e,0x62,0x69,0x6e
@@ -44,6 +50,9 @@ int corradeResourceInitializer_ResourceTestData() {
     resource.positions = resourcePositions;
     resource.filenames = resourceFilenames;
     resource.data = nullptr;
+    resource.hash = resourceHash;
+    resource.compression = nullptr;
+    resource.decompressed = nullptr;
     Corrade::Utility::Resource::registerData(resource);
     return 1;
 } CORRADE_AUTOMATIC_INITIALIZER(corradeResourceInitializer_ResourceTestData)
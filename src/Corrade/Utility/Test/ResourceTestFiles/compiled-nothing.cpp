@@ -4,11 +4,11 @@
 #include "Corrade/Utility/Macros.h"
 #include "Corrade/Utility/Resource.h"
 
-#if CORRADE_RESOURCE_VERSION != 2
+#if CORRADE_RESOURCE_VERSION != 4
 #ifdef CORRADE_TARGET_CLANG
-#pragma GCC error "resource file compiled in version 2 but version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected, update your corrade-rc binary"
+#pragma GCC error "resource file compiled in version 4 but version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected, update your corrade-rc binary"
 #else
-#error resource file compiled in unexpected version 2, update your corrade-rc binary
+#error resource file compiled in unexpected version 4, update your corrade-rc binary
 #if defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_MSVC)
 #pragma message("resource file version " _CORRADE_HELPER_STR2(CORRADE_RESOURCE_VERSION) " expected instead")
 #endif
@@ -28,6 +28,9 @@ int corradeResourceInitializer_ResourceTestNothingData() {
     resource.positions = nullptr;
     resource.filenames = nullptr;
     resource.data = nullptr;
+    resource.hash = nullptr;
+    resource.compression = nullptr;
+    resource.decompressed = nullptr;
     Corrade::Utility::Resource::registerData(resource);
     return 1;
 } CORRADE_AUTOMATIC_INITIALIZER(corradeResourceInitializer_ResourceTestNothingData)
@@ -0,0 +1,238 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/String.h"
+#include "Corrade/Containers/StringView.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/String.h"
+#include "Corrade/Utility/Format.h"
+#include "Corrade/Utility/Resource.h"
+#include "Corrade/Utility/StartupProfile.h"
+#include "Corrade/Utility/Implementation/Resource.h"
+
+namespace Corrade { namespace Utility { namespace Test { namespace {
+
+using namespace Containers::Literals;
+
+struct StartupProfileTest: TestSuite::Tester {
+    explicit StartupProfileTest();
+
+    void resourceGroup();
+    void resourceFirstLookup();
+    void report();
+    void reportEnclosingEvent();
+    void disabled();
+
+    void debugEventType();
+};
+
+StartupProfileTest::StartupProfileTest() {
+    addTests({&StartupProfileTest::resourceGroup,
+              &StartupProfileTest::resourceFirstLookup,
+              &StartupProfileTest::report,
+              &StartupProfileTest::reportEnclosingEvent,
+              &StartupProfileTest::disabled,
+
+              &StartupProfileTest::debugEventType});
+}
+
+/* Zero-initialized apart from what's specified, like with groups generated by
+   corrade-rc */
+Implementation::ResourceGroup resourceGroupData{"startup-profile-test", 0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+
+void StartupProfileTest::resourceGroup() {
+    #ifndef CORRADE_BUILD_STARTUP_PROFILING
+    CORRADE_SKIP("CORRADE_BUILD_STARTUP_PROFILING not enabled, can't test");
+    #else
+    const std::size_t eventCount = startupProfileEvents().size();
+    const std::size_t registerCount = startupProfileEventCount(StartupProfileEventType::ResourceGroupRegister);
+    const std::size_t unregisterCount = startupProfileEventCount(StartupProfileEventType::ResourceGroupUnregister);
+
+    Resource::registerData(resourceGroupData);
+    CORRADE_COMPARE(startupProfileEvents().size(), eventCount + 1);
+    CORRADE_COMPARE(startupProfileEventCount(StartupProfileEventType::ResourceGroupRegister), registerCount + 1);
+    CORRADE_COMPARE(startupProfileEventCount(StartupProfileEventType::ResourceGroupUnregister), unregisterCount);
+    {
+        const StartupProfileEvent& event = startupProfileEvents().back();
+        CORRADE_COMPARE(event.type, StartupProfileEventType::ResourceGroupRegister);
+        CORRADE_COMPARE(event.name, "startup-profile-test"_s);
+        /* The timestamp is from a monotonic clock, thus never zero */
+        CORRADE_VERIFY(event.timestamp);
+    }
+
+    Resource::unregisterData(resourceGroupData);
+    CORRADE_COMPARE(startupProfileEvents().size(), eventCount + 2);
+    CORRADE_COMPARE(startupProfileEventCount(StartupProfileEventType::ResourceGroupRegister), registerCount + 1);
+    CORRADE_COMPARE(startupProfileEventCount(StartupProfileEventType::ResourceGroupUnregister), unregisterCount + 1);
+    {
+        const StartupProfileEvent& event = startupProfileEvents().back();
+        CORRADE_COMPARE(event.type, StartupProfileEventType::ResourceGroupUnregister);
+        CORRADE_COMPARE(event.name, "startup-profile-test"_s);
+        CORRADE_VERIFY(event.timestamp >= startupProfileEvents()[eventCount].timestamp);
+    }
+
+    CORRADE_COMPARE(startupProfileDroppedEventCount(), 0);
+    #endif
+}
+
+void StartupProfileTest::resourceFirstLookup() {
+    #ifndef CORRADE_BUILD_STARTUP_PROFILING
+    CORRADE_SKIP("CORRADE_BUILD_STARTUP_PROFILING not enabled, can't test");
+    #else
+    /* Nothing in this executable does a resource lookup before this test
+       case */
+    CORRADE_COMPARE(startupProfileEventCount(StartupProfileEventType::ResourceFirstLookup), 0);
+
+    Resource::registerData(resourceGroupData);
+    const std::size_t eventCount = startupProfileEvents().size();
+
+    CORRADE_VERIFY(Resource::hasGroup("startup-profile-test"));
+    CORRADE_COMPARE(startupProfileEvents().size(), eventCount + 1);
+    CORRADE_COMPARE(startupProfileEventCount(StartupProfileEventType::ResourceFirstLookup), 1);
+    {
+        const StartupProfileEvent& event = startupProfileEvents().back();
+        CORRADE_COMPARE(event.type, StartupProfileEventType::ResourceFirstLookup);
+        /* Points to the group name, not to the view passed to hasGroup() */
+        CORRADE_COMPARE(static_cast<const void*>(event.name), resourceGroupData.name);
+    }
+
+    /* Subsequent lookups aren't recorded */
+    CORRADE_VERIFY(Resource::hasGroup("startup-profile-test"));
+    CORRADE_VERIFY(!Resource::hasGroup("nonexistent"));
+    CORRADE_COMPARE(startupProfileEvents().size(), eventCount + 1);
+    CORRADE_COMPARE(startupProfileEventCount(StartupProfileEventType::ResourceFirstLookup), 1);
+
+    Resource::unregisterData(resourceGroupData);
+    #endif
+}
+
+void StartupProfileTest::report() {
+    #ifndef CORRADE_BUILD_STARTUP_PROFILING
+    CORRADE_SKIP("CORRADE_BUILD_STARTUP_PROFILING not enabled, can't test");
+    #else
+    /* Ensure there's at least one event with a name and one without */
+    Resource::registerData(resourceGroupData);
+    Resource::unregisterData(resourceGroupData);
+
+    const Containers::String report = startupProfileReport();
+    CORRADE_COMPARE_AS(report,
+        "{\n"
+        "  \"events\": [\n"
+        "    {\n"
+        "      \"type\": \"", TestSuite::Compare::StringHasPrefix);
+    /* The first event is the reference point */
+    CORRADE_COMPARE_AS(report,
+        "      \"timestamp\": 0,\n",
+        TestSuite::Compare::StringContains);
+    CORRADE_COMPARE_AS(report,
+        "      \"type\": \"ResourceGroupUnregister\",\n"
+        "      \"name\": \"startup-profile-test\",\n",
+        TestSuite::Compare::StringContains);
+    CORRADE_COMPARE_AS(report, Utility::format(
+        "  \"counts\": {{\n"
+        "    \"StaticPluginImport\": {},\n"
+        "    \"StaticPluginEject\": {},\n"
+        "    \"ResourceGroupRegister\": {},\n"
+        "    \"ResourceGroupUnregister\": {},\n"
+        "    \"ResourceFirstLookup\": {}\n"
+        "  }},\n"
+        "  \"droppedEvents\": 0\n"
+        "}}\n",
+        startupProfileEventCount(StartupProfileEventType::StaticPluginImport),
+        startupProfileEventCount(StartupProfileEventType::StaticPluginEject),
+        startupProfileEventCount(StartupProfileEventType::ResourceGroupRegister),
+        startupProfileEventCount(StartupProfileEventType::ResourceGroupUnregister),
+        startupProfileEventCount(StartupProfileEventType::ResourceFirstLookup)),
+        TestSuite::Compare::StringHasSuffix);
+    #endif
+}
+
+void StartupProfileTest::reportEnclosingEvent() {
+    #ifndef CORRADE_BUILD_STARTUP_PROFILING
+    CORRADE_SKIP("CORRADE_BUILD_STARTUP_PROFILING not enabled, can't test");
+    #else
+    /* Ensure there's at least one event already */
+    Resource::registerData(resourceGroupData);
+    Resource::unregisterData(resourceGroupData);
+
+    std::uint64_t earliest = ~std::uint64_t{};
+    for(const StartupProfileEvent& event: startupProfileEvents())
+        if(event.timestamp < earliest) earliest = event.timestamp;
+
+    /* An event that started before all others but got recorded last, such
+       as one enclosing other events. It's the reference point instead of the
+       first event. */
+    Implementation::recordStartupProfileEvent(StartupProfileEventType::StaticPluginImport, "enclosing", earliest - 1000000);
+    CORRADE_COMPARE(startupProfileEvents().back().timestamp, earliest - 1000000);
+
+    const Containers::String report = startupProfileReport();
+    CORRADE_COMPARE_AS(report,
+        "      \"type\": \"StaticPluginImport\",\n"
+        "      \"name\": \"enclosing\",\n"
+        "      \"timestamp\": 0,\n",
+        TestSuite::Compare::StringContains);
+    CORRADE_COMPARE_AS(report,
+        "      \"timestamp\": 1000000,\n",
+        TestSuite::Compare::StringContains);
+    #endif
+}
+
+void StartupProfileTest::disabled() {
+    #ifdef CORRADE_BUILD_STARTUP_PROFILING
+    CORRADE_SKIP("CORRADE_BUILD_STARTUP_PROFILING enabled, can't test");
+    #else
+    Resource::registerData(resourceGroupData);
+    CORRADE_VERIFY(Resource::hasGroup("startup-profile-test"));
+    Resource::unregisterData(resourceGroupData);
+
+    CORRADE_VERIFY(startupProfileEvents().isEmpty());
+    CORRADE_COMPARE(startupProfileEventCount(StartupProfileEventType::ResourceGroupRegister), 0);
+    CORRADE_COMPARE(startupProfileEventCount(StartupProfileEventType::ResourceFirstLookup), 0);
+    CORRADE_COMPARE(startupProfileDroppedEventCount(), 0);
+    CORRADE_COMPARE(startupProfileReport(),
+        "{\n"
+        "  \"events\": [],\n"
+        "  \"counts\": {\n"
+        "    \"StaticPluginImport\": 0,\n"
+        "    \"StaticPluginEject\": 0,\n"
+        "    \"ResourceGroupRegister\": 0,\n"
+        "    \"ResourceGroupUnregister\": 0,\n"
+        "    \"ResourceFirstLookup\": 0\n"
+        "  },\n"
+        "  \"droppedEvents\": 0\n"
+        "}\n");
+    #endif
+}
+
+void StartupProfileTest::debugEventType() {
+    Containers::String out;
+    Debug{&out} << StartupProfileEventType::ResourceGroupRegister << StartupProfileEventType(0xde);
+    CORRADE_COMPARE(out, "Utility::StartupProfileEventType::ResourceGroupRegister Utility::StartupProfileEventType(0xde)\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::StartupProfileTest)
@@ -28,6 +28,7 @@
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/Utility/DebugStl.h" /** @todo remove once Tweakable internals are std::string-free */
 #include "Corrade/Utility/Format.h"
+#include "Corrade/Utility/String.h"
 #include "Corrade/Utility/Tweakable.h"
 
 #include "Corrade/Utility/Implementation/tweakable.h"
@@ -69,10 +70,18 @@ struct TweakableTest: TestSuite::Tester {
 
     void parseCustomDifferentReturnType();
 
+    void parseIncremental();
+    void parseIncrementalRecompile();
+    void parseIncrementalUnknown();
+    void parseIncrementalNoAnnotations();
+
     void benchmarkBase();
     void benchmarkDisabled();
     void benchmarkEnabled();
 
+    void benchmarkUpdateFull();
+    void benchmarkUpdateIncremental();
+
     void debugState();
 };
 
@@ -219,12 +228,20 @@ TweakableTest::TweakableTest() {
     addInstancedTests({&TweakableTest::parseSpecialsError},
         Containers::arraySize(ParseSpecialsErrorData));
 
-    addTests({&TweakableTest::parseCustomDifferentReturnType});
+    addTests({&TweakableTest::parseCustomDifferentReturnType,
+
+              &TweakableTest::parseIncremental,
+              &TweakableTest::parseIncrementalRecompile,
+              &TweakableTest::parseIncrementalUnknown,
+              &TweakableTest::parseIncrementalNoAnnotations});
 
     addBenchmarks({&TweakableTest::benchmarkBase,
                    &TweakableTest::benchmarkDisabled,
                    &TweakableTest::benchmarkEnabled}, 200);
 
+    addBenchmarks({&TweakableTest::benchmarkUpdateFull,
+                   &TweakableTest::benchmarkUpdateIncremental}, 20);
+
     addTests({&TweakableTest::debugState});
 }
 
@@ -424,6 +441,195 @@ void TweakableTest::parseCustomDifferentReturnType() {
     CORRADE_COMPARE(*reinterpret_cast<unsigned*>(variables[0].storage), 35);
 }
 
+int parseCount = 0;
+
+TweakableState countingIntParser(const Containers::StringView value, const Containers::StaticArrayView<Implementation::TweakableStorageSize, char> storage) {
+    ++parseCount;
+    return Implementation::TweakableTraits<int>::parse(value, storage);
+}
+
+void TweakableTest::parseIncremental() {
+    const char* data = R"CPP(/* line 1 */
+int a = _(1);
+// _(comment)
+int b = _(2); /* a block
+   comment */
+const char* c = "_(string)";
+int d = _(3);
+int e = _(4);
+
+int f = _(5);
+)CPP";
+
+    std::vector<Implementation::TweakableVariable> variables{5};
+    variables[0].line = 2;
+    variables[1].line = 4;
+    variables[2].line = 7;
+    variables[3].line = 8;
+    variables[4].line = 10;
+    for(Implementation::TweakableVariable& variable: variables)
+        variable.parser = countingIntParser;
+
+    std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>> scopes;
+    Implementation::TweakableParseCache cache;
+
+    /* The first pass goes through the whole file */
+    {
+        Debug redirectOutput{nullptr};
+        parseCount = 0;
+        CORRADE_COMPARE(Implementation::parseTweakables("_", "a.cpp", data, cache, variables, scopes), TweakableState::Success);
+        CORRADE_COMPARE(parseCount, 5);
+    }
+    CORRADE_VERIFY(cache.valid);
+    CORRADE_COMPARE(cache.name, "_");
+    CORRADE_COMPARE(cache.data, data);
+    CORRADE_COMPARE(cache.annotations.size(), 5);
+    CORRADE_COMPARE(cache.annotations[2], (std::pair<std::size_t, int>{117, 7}));
+    CORRADE_COMPARE(cache.annotations[4], (std::pair<std::size_t, int>{146, 10}));
+
+    /* Changing a single value parses only the corresponding annotation, with
+       the others taken from the previous pass and shifted */
+    {
+        Containers::String out;
+        Debug redirectOutput{&out};
+        parseCount = 0;
+        CORRADE_COMPARE(Implementation::parseTweakables("_", "a.cpp", String::replaceFirst(data, "_(3)", "_(1337)"), cache, variables, scopes), TweakableState::Success);
+        CORRADE_COMPARE(parseCount, 1);
+        CORRADE_COMPARE(out, "Utility::Tweakable::update(): updating _(1337) in a.cpp:7\n");
+    }
+    CORRADE_VERIFY(cache.valid);
+    CORRADE_COMPARE(cache.annotations.size(), 5);
+    CORRADE_COMPARE(cache.annotations[2], (std::pair<std::size_t, int>{117, 7}));
+    CORRADE_COMPARE(cache.annotations[4], (std::pair<std::size_t, int>{149, 10}));
+    CORRADE_COMPARE(*reinterpret_cast<int*>(variables[2].storage), 1337);
+
+    /* Changing the first and the last value parses everything in between,
+       the last one is found at the shifted offset */
+    {
+        Containers::String out;
+        Debug redirectOutput{&out};
+        parseCount = 0;
+        CORRADE_COMPARE(Implementation::parseTweakables("_", "a.cpp", String::replaceFirst(String::replaceFirst(String::replaceFirst(data, "_(3)", "_(1337)"), "_(1)", "_(-1)"), "_(5)", "_(55)"), cache, variables, scopes), TweakableState::Success);
+        CORRADE_COMPARE(parseCount, 5);
+        CORRADE_COMPARE(out,
+            "Utility::Tweakable::update(): updating _(-1) in a.cpp:2\n"
+            "Utility::Tweakable::update(): updating _(55) in a.cpp:10\n");
+    }
+    CORRADE_VERIFY(cache.valid);
+    CORRADE_COMPARE(cache.annotations[4], (std::pair<std::size_t, int>{150, 10}));
+    CORRADE_COMPARE(*reinterpret_cast<int*>(variables[0].storage), -1);
+    CORRADE_COMPARE(*reinterpret_cast<int*>(variables[4].storage), 55);
+
+    /* Passing the same data again doesn't parse anything except for the last
+       annotation, which is right at the end */
+    {
+        Containers::String out;
+        Debug redirectOutput{&out};
+        parseCount = 0;
+        CORRADE_COMPARE(Implementation::parseTweakables("_", "a.cpp", Containers::String{cache.data}, cache, variables, scopes), TweakableState::NoChange);
+        CORRADE_COMPARE(parseCount, 1);
+        CORRADE_COMPARE(out, "");
+    }
+    CORRADE_VERIFY(cache.valid);
+
+    /* A different alias scans everything again */
+    {
+        Debug redirectOutput{nullptr};
+        parseCount = 0;
+        CORRADE_COMPARE(Implementation::parseTweakables("TW", "a.cpp", Containers::String{cache.data}, cache, variables, scopes), TweakableState::NoChange);
+        CORRADE_COMPARE(parseCount, 0);
+    }
+    CORRADE_VERIFY(cache.valid);
+    CORRADE_COMPARE(cache.name, "TW");
+    CORRADE_COMPARE(cache.annotations.size(), 0);
+}
+
+void TweakableTest::parseIncrementalRecompile() {
+    const char* data = R"(int a = _(1);
+int b = _(2);
+)";
+
+    std::vector<Implementation::TweakableVariable> variables{2};
+    variables[0].line = 1;
+    variables[0].parser = Implementation::TweakableTraits<int>::parse;
+    variables[1].line = 2;
+    variables[1].parser = Implementation::TweakableTraits<int>::parse;
+
+    std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>> scopes;
+    Implementation::TweakableParseCache cache;
+    {
+        Debug redirectOutput{nullptr};
+        CORRADE_COMPARE(Implementation::parseTweakables("_", "a.cpp", data, cache, variables, scopes), TweakableState::Success);
+    }
+    CORRADE_VERIFY(cache.valid);
+
+    /* A newline added before the second annotation moves it to a different
+       line, which needs a recompile. As the file wasn't scanned to the end,
+       the cache is discarded. */
+    {
+        Containers::String out;
+        Warning redirectWarning{&out};
+        CORRADE_COMPARE(Implementation::parseTweakables("_", "a.cpp", String::replaceFirst(data, "\nint b", "\n\nint b"), cache, variables, scopes), TweakableState::Recompile);
+        CORRADE_COMPARE(out, "Utility::Tweakable::update(): code changed around _(2) in a.cpp:3, requesting a recompile\n");
+    }
+    CORRADE_VERIFY(!cache.valid);
+    CORRADE_COMPARE(cache.data, "");
+    CORRADE_COMPARE(cache.annotations.size(), 0);
+}
+
+void TweakableTest::parseIncrementalUnknown() {
+    const char* data = R"(int a = _(1);
+int b = _(2);
+)";
+
+    std::vector<Implementation::TweakableVariable> variables{2};
+    variables[0].line = 1;
+    variables[0].parser = Implementation::TweakableTraits<int>::parse;
+    variables[1].line = 2;
+
+    std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>> scopes;
+    Implementation::TweakableParseCache cache;
+    {
+        Containers::String out;
+        Debug redirectOutput{nullptr};
+        Warning redirectWarning{&out};
+        CORRADE_COMPARE(Implementation::parseTweakables("_", "a.cpp", data, cache, variables, scopes), TweakableState::Success);
+        CORRADE_COMPARE(out, "Utility::Tweakable::update(): ignoring unknown new value _(2) in a.cpp:2\n");
+    }
+
+    /* The second variable wasn't known, so the next pass can't rely on the
+       result */
+    CORRADE_VERIFY(!cache.valid);
+
+    /* Once it gets known, it's picked up even though it didn't change */
+    variables[1].parser = Implementation::TweakableTraits<int>::parse;
+    {
+        Containers::String out;
+        Debug redirectOutput{&out};
+        CORRADE_COMPARE(Implementation::parseTweakables("_", "a.cpp", data, cache, variables, scopes), TweakableState::Success);
+        CORRADE_COMPARE(out, "Utility::Tweakable::update(): updating _(2) in a.cpp:2\n");
+    }
+    CORRADE_VERIFY(cache.valid);
+    CORRADE_COMPARE(*reinterpret_cast<int*>(variables[1].storage), 2);
+}
+
+void TweakableTest::parseIncrementalNoAnnotations() {
+    std::vector<Implementation::TweakableVariable> variables;
+    std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>> scopes;
+    Implementation::TweakableParseCache cache;
+
+    /* If the alias isn't present anywhere, the file isn't even scanned, so
+       not even the unterminated comment gets reported */
+    {
+        Containers::String out;
+        Error redirectError{&out};
+        CORRADE_COMPARE(Implementation::parseTweakables("TW", "a.cpp", "int a = 3; /* TV(4)", cache, variables, scopes), TweakableState::NoChange);
+        CORRADE_COMPARE(out, "");
+    }
+    CORRADE_VERIFY(cache.valid);
+    CORRADE_COMPARE(cache.annotations.size(), 0);
+}
+
 void TweakableTest::benchmarkBase() {
     float dt = 1/60.0f;
     float velocity = 0.0f;
@@ -486,6 +692,82 @@ void TweakableTest::benchmarkEnabled() {
     CORRADE_COMPARE(position.y, 19.7835f);
 }
 
+Containers::String updateBenchmarkData(std::vector<Implementation::TweakableVariable>& variables, const int middleValue) {
+    /* A 20k-line file with a tweakable annotation every ten lines, with
+       comments and strings in between */
+    std::string data;
+    variables.clear();
+    int line = 1;
+    for(std::size_t i = 0; i != 2000; ++i) {
+        data += "/* A block comment that\n   spans two lines */\n";
+        data += "const char* string = \"a string literal\";\n";
+        data += "// A line comment\n";
+        data += "int a = computeSomething() + ";
+        data += "_(" + std::to_string(i == 1000 ? middleValue : int(i)) + ")";
+        data += ";\n";
+        data += "\n";
+        data += "for(int i = 0; i != 10; ++i) {\n";
+        data += "    doSomething(i, 'c');\n";
+        data += "}\n";
+        data += "\n";
+
+        variables.emplace_back();
+        variables.back().line = line + 4;
+        variables.back().parser = Implementation::TweakableTraits<int>::parse;
+        line += 10;
+    }
+
+    return data;
+}
+
+void TweakableTest::benchmarkUpdateFull() {
+    std::vector<Implementation::TweakableVariable> variables;
+    const Containers::String data[]{
+        updateBenchmarkData(variables, 1),
+        updateBenchmarkData(variables, 2)
+    };
+    CORRADE_COMPARE(Containers::StringView{data[0]}.count('\n'), 20000);
+
+    std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>> scopes;
+    Debug redirectOutput{nullptr};
+    Implementation::parseTweakables("_", "a.cpp", data[0], variables, scopes);
+
+    /* Each iteration changes the annotation in the middle of the file */
+    int states = 0;
+    std::size_t i = 0;
+    CORRADE_BENCHMARK(10) {
+        states += int(Implementation::parseTweakables("_", "a.cpp", data[++i % 2], variables, scopes));
+    }
+
+    CORRADE_COMPARE(states, 10*int(TweakableState::Success));
+}
+
+void TweakableTest::benchmarkUpdateIncremental() {
+    std::vector<Implementation::TweakableVariable> variables;
+    const Containers::String data[]{
+        updateBenchmarkData(variables, 1),
+        updateBenchmarkData(variables, 2)
+    };
+    CORRADE_COMPARE(Containers::StringView{data[0]}.count('\n'), 20000);
+
+    std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>> scopes;
+    Debug redirectOutput{nullptr};
+    Implementation::TweakableParseCache cache;
+    Implementation::parseTweakables("_", "a.cpp", Containers::String{data[0]}, cache, variables, scopes);
+
+    /* Each iteration changes the annotation in the middle of the file. The
+       copy is included in the measurement, as Tweakable::update() reads the
+       file into a new string every time as well. */
+    int states = 0;
+    std::size_t i = 0;
+    CORRADE_BENCHMARK(10) {
+        states += int(Implementation::parseTweakables("_", "a.cpp", Containers::String{data[++i % 2]}, cache, variables, scopes));
+    }
+
+    CORRADE_COMPARE(states, 10*int(TweakableState::Success));
+    CORRADE_VERIFY(cache.valid);
+}
+
 void TweakableTest::debugState() {
     Containers::String out;
     Debug{&out} << TweakableState::NoChange << TweakableState(0xde);
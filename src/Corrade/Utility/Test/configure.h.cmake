@@ -40,8 +40,11 @@
 
 #define FORMAT_WRITE_TEST_DIR "${UTILITY_BINARY_TEST_DIR}"
 #define RESOURCE_TEST_DIR "${UTILITY_TEST_DIR}/ResourceTestFiles/"
+#define RESOURCE_WRITE_TEST_DIR "${UTILITY_BINARY_TEST_DIR}/ResourceTestFiles"
 
 #define FILEWATCHER_WRITE_TEST_DIR "${UTILITY_BINARY_TEST_DIR}/FileWatcherTestFiles"
+#define DIRECTORYWATCHER_WRITE_TEST_DIR "${UTILITY_BINARY_TEST_DIR}/DirectoryWatcherTestFiles"
+#define FILEWATCHSET_WRITE_TEST_DIR "${UTILITY_BINARY_TEST_DIR}/FileWatchSetTestFiles"
 
 #define TWEAKABLE_TEST_DIR "${UTILITY_TEST_DIR}"
 #define TWEAKABLE_WRITE_TEST_DIR "${UTILITY_BINARY_TEST_DIR}/TweakableTestFiles"
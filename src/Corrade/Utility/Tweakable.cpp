@@ -26,6 +26,7 @@
 
 #include "Tweakable.h"
 
+#include <algorithm> /* std::upper_bound() */
 #include <cstring>
 #include <set>
 #include <unordered_map>
@@ -34,8 +35,11 @@
 #include "Corrade/Containers/StringStl.h"
 #include "Corrade/Utility/Assert.h"
 #include "Corrade/Utility/DebugStl.h"
-#include "Corrade/Utility/FileWatcher.h"
+#include "Corrade/Utility/FileWatchSet.h"
+#include "Corrade/Utility/Math.h"
+#include "Corrade/Utility/Move.h"
 #include "Corrade/Utility/Path.h"
+#include "Corrade/Utility/String.h"
 
 #include "Corrade/Utility/Implementation/tweakable.h"
 
@@ -46,8 +50,11 @@ namespace {
 
     struct File {
         std::string watchPath;
-        FileWatcher watcher;
+        /* ID in Tweakable::Data::watchers */
+        std::size_t watcher;
         std::vector<Implementation::TweakableVariable> variables;
+        /* Annotations found in the last update, used for the next one */
+        Implementation::TweakableParseCache cache;
     };
 }
 
@@ -56,6 +63,10 @@ struct Tweakable::Data {
 
     std::string prefix, replace;
     std::unordered_map<std::string, File> files;
+    /* All files are checked for changes with a single call, pointers to the
+       files map entries (which are stable) are indexed by the watcher ID */
+    FileWatchSet watchers;
+    std::vector<std::pair<const std::string, File>*> watchedFiles;
 
     void(*currentScopeLambda)(void(*)(), void*) = nullptr;
     void(*currentScopeUserCall)() = nullptr;
@@ -127,7 +138,10 @@ Containers::Pair<bool, void*> Tweakable::registerVariable(const char* const file
         /* Ignore errors and do not signal changes if the file is empty in
            order to make everything more robust -- editors are known to be
            doing both */
-        found = _data->files.emplace(file, File{watchPath, FileWatcher{watchPath, FileWatcher::Flag::IgnoreChangeIfEmpty|FileWatcher::Flag::IgnoreErrors}, {}}).first;
+        const std::size_t watcher = _data->watchers.add(watchPath, FileWatcher::Flag::IgnoreChangeIfEmpty|FileWatcher::Flag::IgnoreErrors);
+        found = _data->files.emplace(file, File{watchPath, watcher, {}, {}}).first;
+        CORRADE_INTERNAL_ASSERT(watcher == _data->watchedFiles.size());
+        _data->watchedFiles.push_back(&*found);
     }
 
     /* Extend the variable list to contain this one as well */
@@ -154,18 +168,55 @@ namespace Implementation {
 namespace {
     /* This doesn't eat newlines ATM because it would break the line counter.
        Also, for findTweakableAlias(), it *can't* eat newlines. */
-    void eatWhitespace(const std::string& data, std::size_t& pos) {
+    void eatWhitespace(const Containers::StringView data, std::size_t& pos) {
         while(pos < data.size() && (data[pos] == ' ' || data[pos] == '\t'))
             ++pos;
     }
+
+    /* Like std::string::substr(), clamping the size to what's available.
+       Used for printing parts of the input in messages. */
+    Containers::StringView substr(const Containers::StringView data, const std::size_t pos, const std::size_t count) {
+        return data.slice(pos, pos + Utility::min(count, data.size() - pos));
+    }
+
+    /* Quick check whether the data contain given name anywhere. Jumps over the
+       data using the SIMD single-character find, which is significantly
+       faster than a substring search. */
+    bool containsName(Containers::StringView data, const Containers::StringView name) {
+        while(const Containers::StringView found = data.find(name[0])) {
+            data = data.suffix(found.begin());
+            if(data.hasPrefix(name)) return true;
+            data = data.exceptPrefix(1);
+        }
+        return false;
+    }
+
+    /* Size of a common suffix of two strings. Compares whole blocks with
+       memcmp() first, which is significantly faster than a loop. */
+    std::size_t commonSuffixSize(const Containers::StringView a, const Containers::StringView b) {
+        const std::size_t max = Utility::min(a.size(), b.size());
+        constexpr std::size_t BlockSize = 256;
+        std::size_t size = 0;
+        while(size + BlockSize <= max && std::memcmp(a.end() - size - BlockSize, b.end() - size - BlockSize, BlockSize) == 0)
+            size += BlockSize;
+        while(size != max && a[a.size() - size - 1] == b[b.size() - size - 1])
+            ++size;
+        return size;
+    }
 }
 
-std::string findTweakableAlias(const std::string& data) {
+std::string findTweakableAlias(const Containers::StringView data) {
     using namespace Containers::Literals;
 
     std::string name = "CORRADE_TWEAKABLE";
     std::size_t pos = 0;
-    while((pos = data.find("#define", pos)) != std::string::npos) {
+    while(const Containers::StringView found = data.exceptPrefix(pos).find('#')) {
+        pos = found.data() - data.data();
+        if(!data.exceptPrefix(pos).hasPrefix("#define"_s)) {
+            ++pos;
+            continue;
+        }
+
         /* Eat all whitespace before */
         std::size_t prev = pos;
         while(prev && (data[prev - 1] == ' ' || data[prev - 1] == '\t'))
@@ -184,19 +235,18 @@ std::string findTweakableAlias(const std::string& data) {
 
         /* Consume the name */
         std::size_t end = beg;
-        while((data[end] >= 'A' && data[end] <= 'Z') ||
+        while(end < data.size() &&
+             ((data[end] >= 'A' && data[end] <= 'Z') ||
               (data[end] >= 'a' && data[end] <= 'z') ||
               (data[end] >= '0' && data[end] <= '9' && end != pos) ||
-              (data[end] == '_')) ++end;
+              (data[end] == '_'))) ++end;
 
         /* Get rid of whitespace after */
         pos = end;
         eatWhitespace(data, pos);
 
         /* If the rest doesn't read CORRADE_TWEAKABLE, nope */
-        /** @todo convert all this to operate on StringViews when we have
-            find() as well */
-        if(!Containers::StringView{data}.exceptPrefix(pos).hasPrefix("CORRADE_TWEAKABLE"_s))
+        if(!data.exceptPrefix(pos).hasPrefix("CORRADE_TWEAKABLE"_s))
             continue;
 
         /* Get rid of whitespace at the end of the line */
@@ -208,16 +258,16 @@ std::string findTweakableAlias(const std::string& data) {
             continue;
 
         /* Save the name */
-        name = data.substr(beg, end - beg);
+        name = data.slice(beg, end);
         break;
     }
 
     return name;
 }
 
-TweakableState parseTweakables(const std::string& name, const std::string& filename, const std::string& data, std::vector<TweakableVariable>& variables, std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>>& scopes) {
+TweakableState parseTweakablesFrom(const Containers::StringView name, const Containers::StringView filename, const Containers::StringView data, std::size_t pos, int line, std::size_t variable, TweakableParseRecord* const record, std::vector<TweakableVariable>& variables, std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>>& scopes) {
     /* Prepare "matchers" */
-    CORRADE_INTERNAL_ASSERT(!name.empty());
+    CORRADE_INTERNAL_ASSERT(!name.isEmpty());
     const char findAnything[] = { '/', '\'', '"', '\n', name[0], 0 };
     constexpr const char findLineCommentEnd[] = "\n";
     constexpr const char findBlockCommentEnd[] = "\n*";
@@ -225,10 +275,6 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
     constexpr const char findCharEnd[] = "\n'";
     constexpr const char findRawStringEnd[] = "\n)";
 
-    /* Count the lines, count the variables */
-    int line = 1;
-    std::size_t variable = 0;
-
     /* State controlling which matchers we use */
     bool insideLineComment = false;
     bool insideBlockComment = false;
@@ -241,10 +287,11 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
     std::size_t rawStringEndDelimiterLength = 0;
 
     /* Parse the file */
-    std::size_t pos = 0;
     const char* find = findAnything;
     TweakableState state = TweakableState::NoChange;
-    while((pos = data.find_first_of(find, pos)) != std::string::npos) {
+    while(const Containers::StringView found = data.exceptPrefix(pos).findAny(find)) {
+        pos = found.data() - data.data();
+
         /* We should be only in one of these at a time */
         CORRADE_INTERNAL_ASSERT(int(insideLineComment) + int(insideBlockComment)  + int(insideChar) + int(insideString) <= 1);
 
@@ -406,7 +453,7 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
             CORRADE_INTERNAL_ASSERT(insideString && rawStringEndDelimiterLength);
 
             /* If the delimiter end matches, end the string */
-            if(data.compare(pos, rawStringEndDelimiterLength, rawStringEndDelimiter, rawStringEndDelimiterLength) == 0) {
+            if(data.exceptPrefix(pos).hasPrefix({rawStringEndDelimiter, rawStringEndDelimiterLength})) {
                 pos += rawStringEndDelimiterLength;
                 insideString = false;
                 rawStringEndDelimiterLength = 0;
@@ -418,7 +465,7 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
         /* Got a potential tweakable macro */
         } else if(data[pos] == name[0]) {
             /* Not a tweakable macro, continue */
-            if(data.compare(pos, name.size(), name) != 0) {
+            if(!data.exceptPrefix(pos).hasPrefix(name)) {
                 ++pos;
                 continue;
             }
@@ -436,6 +483,21 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
                 continue;
             }
 
+            /* If we're in the part that didn't change since the previous scan
+               and the previous scan found the same annotation here, at the
+               same line, everything after parses the same as before. Take
+               the remaining annotations from there and stop. */
+            if(record && record->previous && pos >= record->suffixBegin) {
+                const std::vector<std::pair<std::size_t, int>>& previous = *record->previous;
+                if(variable < previous.size() &&
+                   previous[variable].first == pos - record->suffixBegin + record->previousSuffixBegin &&
+                   previous[variable].second == line) {
+                    for(std::size_t i = variable; i != previous.size(); ++i)
+                        record->annotations.emplace_back(previous[i].first - record->previousSuffixBegin + record->suffixBegin, previous[i].second);
+                    return state;
+                }
+            }
+
             /* Skip what we found */
             std::size_t beg = pos + name.size();
 
@@ -453,7 +515,7 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
                 const std::size_t paren = ++beg;
                 eatWhitespace(data, beg);
                 if(beg == data.size()) {
-                    Error{} << "Utility::Tweakable::update(): unterminated" << data.substr(pos, paren) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
+                    Error{} << "Utility::Tweakable::update(): unterminated" << substr(data, pos, paren) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
                     return TweakableState::Error;
                 }
             }
@@ -467,12 +529,14 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
                     for multiline strings (which are a syntax error) */
             if(data[beg] == '"') {
                 end = beg + 1;
-                while((end = data.find('"', end)) != std::string::npos) {
+                Containers::StringView quote;
+                while((quote = data.exceptPrefix(end).find('"'))) {
+                    end = quote.data() - data.data();
                     if(data[end - 1] != '\\') break;
                     ++end;
                 }
-                if(end == std::string::npos) {
-                    Error{} << "Utility::Tweakable::update(): unterminated string" << data.substr(pos, end - pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
+                if(!quote) {
+                    Error{} << "Utility::Tweakable::update(): unterminated string" << data.exceptPrefix(pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
                     return TweakableState::Error;
                 }
 
@@ -484,12 +548,14 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
                     for multiline chars (which are a syntax error) */
             } else if(data[beg] == '\'') {
                 end = beg + 1;
-                while((end = data.find('\'', end)) != std::string::npos) {
+                Containers::StringView quote;
+                while((quote = data.exceptPrefix(end).find('\''))) {
+                    end = quote.data() - data.data();
                     if(data[end - 1] != '\\') break;
                     ++end;
                 }
-                if(end == std::string::npos) {
-                    Error{} << "Utility::Tweakable::update(): unterminated char" << data.substr(pos, end - pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
+                if(!quote) {
+                    Error{} << "Utility::Tweakable::update(): unterminated char" << data.exceptPrefix(pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
                     return TweakableState::Error;
                 }
 
@@ -497,14 +563,14 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
 
             /* I will *never* implement this awful thing */
             } else if(data[beg] == 'L') {
-                Error{} << "Utility::Tweakable::update(): unsupported wide char/string literal" << data.substr(pos, end + 1 - pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
+                Error{} << "Utility::Tweakable::update(): unsupported wide char/string literal" << substr(data, pos, end + 1 - pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
                 return TweakableState::Error;
 
             /** @todo once string parsers are possible (they need heap alloc),
                     combine this with the global (raw) string ignore, then also
                     test for raw strings */
             } else if(data[beg] == 'u' || data[beg] == 'U' || data[beg] == 'R') {
-                Error{} << "Utility::Tweakable::update(): unsupported unicode/raw char/string literal" << data.substr(pos, end + 1 - pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
+                Error{} << "Utility::Tweakable::update(): unsupported unicode/raw char/string literal" << substr(data, pos, end + 1 - pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
                 return TweakableState::Error;
 
             /* Something else, simply take everything that makes sense in a literal */
@@ -523,13 +589,13 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
             }
 
             /* Save the value range */
-            const Containers::ArrayView<const char> value{data.data() + beg, end - beg};
+            const Containers::StringView value = data.slice(beg, end);
 
             /* Get rid of whitespace after, after that there should be the
                ending parenthesis */
             eatWhitespace(data, end);
             if(end == data.size() || data[end] != ')') {
-                Error{} << "Utility::Tweakable::update(): unterminated" << data.substr(pos, end - pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
+                Error{} << "Utility::Tweakable::update(): unterminated" << data.slice(pos, end) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
                 return TweakableState::Error;
             }
 
@@ -537,8 +603,11 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
 
             /* If the variable doesn't have a parser assigned, it means the app
                haven't run this code path yet. That's not a critical problem. */
+            const Containers::StringView annotation = data.slice(pos, end);
+            if(record) record->annotations.emplace_back(pos, line);
             if(variables.size() <= variable || !variables[variable].parser) {
-                Warning{} << "Utility::Tweakable::update(): ignoring unknown new value" << data.substr(pos, end - pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
+                Warning{} << "Utility::Tweakable::update(): ignoring unknown new value" << annotation << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
+                if(record) record->allKnown = false;
 
             /* Otherwise we should have a parser that can convert the string
                representation to the target type */
@@ -549,7 +618,7 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
                    changed. Request a recompile. */
                 /** @todo SHA-1 the source (minus tweakables) and compare that for full verification */
                 if(v.line != line) {
-                    Warning{} << "Utility::Tweakable::update(): code changed around" << data.substr(pos, end - pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line << Debug::nospace << ", requesting a recompile";
+                    Warning{} << "Utility::Tweakable::update(): code changed around" << annotation << "in" << filename << Debug::nospace << ":" << Debug::nospace << line << Debug::nospace << ", requesting a recompile";
                     return TweakableState::Recompile;
                 }
 
@@ -557,18 +626,18 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
                    occurred, exit immediately. */
                 const TweakableState variableState = v.parser(value, Containers::staticArrayView(v.storage));
                 if(variableState == TweakableState::Recompile) {
-                    Warning{} << "Utility::Tweakable::update(): change of" << data.substr(pos, end - pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line << "requested a recompile";
+                    Warning{} << "Utility::Tweakable::update(): change of" << annotation << "in" << filename << Debug::nospace << ":" << Debug::nospace << line << "requested a recompile";
                     return TweakableState::Recompile;
                 }
                 if(variableState == TweakableState::Error) {
-                    Error{} << "Utility::Tweakable::update(): error parsing" << data.substr(pos, end - pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
+                    Error{} << "Utility::Tweakable::update(): error parsing" << annotation << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
                     return TweakableState::Error;
                 }
 
                 /* If a change occurred, add a corresponding scope to update */
                 if(variableState != TweakableState::NoChange) {
                     CORRADE_INTERNAL_ASSERT(variableState == TweakableState::Success);
-                    Debug{} << "Utility::Tweakable::update(): updating" << data.substr(pos, end - pos) << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
+                    Debug{} << "Utility::Tweakable::update(): updating" << annotation << "in" << filename << Debug::nospace << ":" << Debug::nospace << line;
                     if(v.scopeLambda) scopes.emplace(v.scopeLambda, v.scopeUserCall, v.scopeUserData);
                     state = TweakableState::Success;
                 }
@@ -604,6 +673,64 @@ TweakableState parseTweakables(const std::string& name, const std::string& filen
     return state;
 }
 
+TweakableState parseTweakables(const Containers::StringView name, const Containers::StringView filename, const Containers::StringView data, std::vector<TweakableVariable>& variables, std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>>& scopes) {
+    return parseTweakablesFrom(name, filename, data, 0, 1, 0, nullptr, variables, scopes);
+}
+
+TweakableState parseTweakables(const Containers::StringView name, const Containers::StringView filename, Containers::String&& data, TweakableParseCache& cache, std::vector<TweakableVariable>& variables, std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>>& scopes) {
+    TweakableParseRecord record;
+
+    /* Files without any annotation have nothing to update */
+    TweakableState state = TweakableState::NoChange;
+    if(containsName(data, name)) {
+        /* Scan the whole file by default */
+        std::size_t pos = 0;
+        int line = 1;
+        std::size_t variable = 0;
+
+        /* If there's a usable result from the previous scan, restart from the
+           last annotation that begins before the first changed byte. The
+           lexer is outside of any comment or literal there and annotations
+           before parse the same as the last time. Their values didn't change,
+           so it's enough to only remember them. */
+        if(cache.valid && Containers::StringView{cache.name} == name) {
+            const std::size_t prefix = String::commonPrefix(data, cache.data).size();
+            const std::size_t suffix = Utility::min(commonSuffixSize(data, cache.data), Utility::min(data.size(), cache.data.size()) - prefix);
+
+            std::size_t restart = std::upper_bound(cache.annotations.begin(), cache.annotations.end(), prefix, [](const std::size_t prefix, const std::pair<std::size_t, int>& annotation) {
+                return prefix < annotation.first;
+            }) - cache.annotations.begin();
+            if(restart) {
+                --restart;
+                pos = cache.annotations[restart].first;
+                line = cache.annotations[restart].second;
+                variable = restart;
+            }
+
+            record.annotations.assign(cache.annotations.begin(), cache.annotations.begin() + restart);
+            record.previous = &cache.annotations;
+            record.suffixBegin = data.size() - suffix;
+            record.previousSuffixBegin = cache.data.size() - suffix;
+        }
+
+        state = parseTweakablesFrom(name, filename, data, pos, line, variable, &record, variables, scopes);
+    }
+
+    /* If the scan didn't get through the whole file, the next one has to
+       start from scratch. Same if some annotations weren't known yet, as they
+       may become known before the next scan. */
+    if(state == TweakableState::Error || state == TweakableState::Recompile || !record.allKnown) {
+        cache = {};
+    } else {
+        cache.name = name;
+        cache.data = Utility::move(data);
+        cache.annotations = Utility::move(record.annotations);
+        cache.valid = true;
+    }
+
+    return state;
+}
+
 }
 
 TweakableState Tweakable::update() {
@@ -615,16 +742,16 @@ TweakableState Tweakable::update() {
        have a hash specialization. */
     std::set<std::tuple<void(*)(void(*)(), void*), void(*)(), void*>> scopes;
 
-    /* Go through all watchers and check for changes */
+    /* Go through all changed files */
+    /** @todo suggest recompile if the watcher is not valid anymore */
     TweakableState state = TweakableState::NoChange;
-    for(auto& file: _data->files) {
-        /** @todo suggest recompile if the watcher is not valid anymore */
-        if(!file.second.watcher.hasChanged()) continue;
+    for(const std::size_t id: _data->watchers.changedFiles()) {
+        auto& file = *_data->watchedFiles[id];
 
         /* Assume the file could be read -- if it got for example (temporarily)
            deleted, hasChanged() returns false and thus it shouldn't get here.
            If this asserts on you, please complain. */
-        const Containers::Optional<Containers::String> data = Path::readString(file.second.watchPath);
+        Containers::Optional<Containers::String> data = Path::readString(file.second.watchPath);
         CORRADE_INTERNAL_ASSERT(data);
 
         /* First go through all defines and search if there is any alias. There
@@ -640,8 +767,10 @@ TweakableState Tweakable::update() {
             Debug{} << "Utility::Tweakable::update(): looking for updated" << name << Debug::nospace << "() macros in" << file.first;
 
         /* Now find all annotated constants and update them. If there's a
-           problem, exit immediately, otherwise just accumulate the state. */
-        const TweakableState fileState = Implementation::parseTweakables(name, file.first, *data, file.second.variables, scopes);
+           problem, exit immediately, otherwise just accumulate the state. The
+           file contents get remembered so the next update can look only at
+           the parts that changed. */
+        const TweakableState fileState = Implementation::parseTweakables(name, file.first, Utility::move(*data), file.second.cache, file.second.variables, scopes);
         if(fileState == TweakableState::NoChange)
             continue;
         else if(fileState == TweakableState::Success)
@@ -197,8 +197,9 @@ For each literal annotated with @ref CORRADE_TWEAKABLE() or its alias, the
 class remembers its file, line and index (in order to correctly handle multiple
 literals on a single line) when the code is first executed, together with a
 @ref TweakableParser instance corresponding to type of the literal known at
-compile time. Affected source files are then monitored with @ref FileWatcher
-for changes
+compile time. Affected source files are then monitored with a
+@ref FileWatchSet for changes, which on Linux means @ref update() does just a
+single syscall if none of the files changed.
 
 Upon calling @ref update(), modified files are parsed for occurrences of the
 defined macro and arguments of each macro call are parsed at runtime. If there
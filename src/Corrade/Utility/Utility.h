@@ -49,7 +49,9 @@ enum class ConfigurationValueFlag: unsigned char;
 typedef Containers::EnumSet<ConfigurationValueFlag> ConfigurationValueFlags;
 template<class> struct ConfigurationValue;
 #if defined(DOXYGEN_GENERATING_OUTPUT) || defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)) || defined(CORRADE_TARGET_EMSCRIPTEN)
+class DirectoryWatcher;
 class FileWatcher;
+class FileWatchSet;
 #endif
 
 class Debug;
@@ -74,8 +76,13 @@ class JsonWriter;
 /* Endianness used only statically */
 class MurmurHash2;
 
+class PoolAllocated;
+template<class> class Pooled;
+
 class Resource;
 class Sha1;
+struct StartupProfileEvent;
+enum class StartupProfileEventType: unsigned char;
 class Translator;
 
 #if defined(DOXYGEN_GENERATING_OUTPUT) || defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)) || defined(CORRADE_TARGET_EMSCRIPTEN)
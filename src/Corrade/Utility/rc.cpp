@@ -24,6 +24,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "Corrade/Containers/Optional.h"
+#include "Corrade/Containers/StringStl.h" /** @todo drop once Arguments is STL-free */
 #include "Corrade/Utility/Arguments.h"
 #include "Corrade/Utility/DebugStl.h" /** @todo drop once Arguments is STL-free */
 #include "Corrade/Utility/Path.h"
@@ -58,7 +60,8 @@ for more information.
 @section corrade-rc-usage Usage
 
 @code{.sh}
-corrade-rc [-h|--help] [--single] [--] name input output.cpp
+corrade-rc [-h|--help] [--single] [--blob file.bin] [--cache-dir dir] [--]
+    name input output.cpp
 @endcode
 
 By default expects that `input` is a resource configuration file containing a
@@ -79,6 +82,41 @@ Arguments:
 -   `-h`, `--help` --- display this help message and exit
 -   `--single` --- compile a single file instead of parsing a configuration
     file
+-   `--blob file.bin` --- put the data into a binary file referenced by an
+    assembler directive instead of a hexadecimal array in the C++ file
+-   `--cache-dir dir` --- directory to cache compressed data of unchanged
+    files in
+
+@section corrade-rc-blob Binary blob output
+
+For large resource groups, compiling the hexadecimal representation takes a
+lot of time and memory. With `--blob`, the file data are instead saved into
+a separate binary file, which is then included into the generated C++ file
+using the assembler @cb{.s} .incbin @ce directive. The generated C++ file
+is thus small regardless of the data size and compiles in a fraction of the
+time. The runtime @ref Utility::Resource API stays the same.
+
+The generated file uses inline assembly and is thus supported only with GCC and
+Clang on Unix platforms including Apple, not on Windows or Emscripten. A
+relative `file.bin` path is made absolute with respect to the current working
+directory, as it's resolved by the assembler and not by this utility. The
+`--blob` option can't be combined with `--single`.
+
+@section corrade-rc-incremental Incremental compilation
+
+Files listed in the configuration file are read and processed in parallel if
+Corrade is built with @ref CORRADE_BUILD_MULTITHREADED enabled. If
+`--cache-dir` is specified, results of compression are additionally cached in
+given directory for each file, keyed by a hash of its contents. On the next
+invocation, only files that changed are compressed again, and cache entries
+not used anymore are removed. Other files in the directory are left
+untouched. The cache directory is created only if there are any files to be
+compressed, files that aren't compressed don't benefit from the cache. The
+`--cache-dir` option can't be combined with `--single`.
+
+The output file and the blob file are always written, even if their contents
+didn't change. Otherwise build systems that compare timestamps, such as Make,
+would consider them out of date and run `corrade-rc` again on every build.
 */
 
 }
@@ -92,6 +130,8 @@ int main(int argc, char** argv) {
         .addArgument("input").setHelp("input", "resource configuration file or a single file to process", "input")
         .addArgument("output").setHelp("output", "output file", "output.cpp")
         .addBooleanOption("single").setHelp("single", "compile a single file instead of parsing a configuration file")
+        .addOption("blob").setHelp("blob", "put the data into a binary file referenced by an assembler directive instead of a hexadecimal array", "file.bin")
+        .addOption("cache-dir").setHelp("cache-dir", "directory to cache compressed data of unchanged files in", "dir")
         .setCommand("corrade-rc")
         .setGlobalHelp(R"(Corrade resource compiler.
 
@@ -102,23 +142,56 @@ file, exposing the data under
 `extern const unsigned char corradeResourceData_<name>[]` and
 `extern const unsigned int corradeResourceSize_<name>` symbols, with only a
 preprocessor dependency on the Corrade/Utility/Resource.h header for a version
-compatibility check.)")
+compatibility check.
+
+If --blob is specified, the data are saved into a separate binary file which
+is included into the C++ file using the assembler .incbin directive, making
+the C++ file significantly faster to compile. Supported only with GCC and
+Clang on Unix platforms.
+
+If --cache-dir is specified, compressed data of each file are cached in given
+directory, keyed by a hash of file contents, and reused on the next invocation
+if the file didn't change. Files that aren't compressed aren't cached.)")
         .parse(argc, argv);
 
-    /* Remove previous output file. Only if it exists, to not print an error
-       message when compiling for the first time. If it fails, die as well --
-       we'd not succeed after either. */
-    if(Utility::Path::exists(args.value("output")) &&
-      !Utility::Path::remove(args.value("output")))
-        return 1;
+    /* The .incbin is resolved relative to wherever the assembler runs, make
+       the path absolute to not depend on that */
+    Containers::String blob = args.value("blob");
+    if(blob) {
+        if(args.isSet("single")) {
+            Utility::Error{} << "The --blob option can't be combined with --single";
+            return 4;
+        }
+
+        if(!blob.hasPrefix('/')) {
+            const Containers::Optional<Containers::String> currentDirectory = Utility::Path::currentDirectory();
+            if(!currentDirectory) return 1;
+            blob = Utility::Path::join(*currentDirectory, blob);
+        }
+    }
+
+    const Containers::String cacheDirectory = args.value("cache-dir");
+    if(cacheDirectory && args.isSet("single")) {
+        Utility::Error{} << "The --cache-dir option can't be combined with --single";
+        return 4;
+    }
 
     /* Compile file */
+    Containers::Array<char> blobData;
     const Containers::String compiled = args.isSet("single") ?
         Utility::Implementation::resourceCompileSingle(args.value("name"), args.value("input")) :
-        Utility::Implementation::resourceCompileFrom(args.value("name"), args.value("input"));
-
-    /* Compilation failed */
-    if(!compiled) return 2;
+        Utility::Implementation::resourceCompileFrom(args.value("name"), args.value("input"), blob, blob ? &blobData : nullptr, cacheDirectory);
+
+    /* Compilation failed. Remove previous output files so the build system
+       doesn't consider them up-to-date. Only if they exist, to not print an
+       error message when compiling for the first time. */
+    if(!compiled) {
+        if(Utility::Path::exists(args.value("output")))
+            Utility::Path::remove(args.value("output"));
+        if(blob && Utility::Path::exists(blob))
+            Utility::Path::remove(blob);
+        return 2;
+    }
 
     /* Save output */
     if(!Utility::Path::write(args.value("output"), compiled)) {
@@ -126,6 +199,13 @@ compatibility check.)")
         return 3;
     }
 
+    /* Save the blob, if requested. Written even if empty, as build systems
+       expect the file to exist. */
+    if(blob && !Utility::Path::write(blob, blobData)) {
+        Utility::Error{} << "Cannot write blob file" << blob;
+        return 3;
+    }
+
     return 0;
 }
 #endif /* LCOV_EXCL_STOP */
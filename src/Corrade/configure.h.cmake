@@ -35,6 +35,7 @@
 #cmakedefine CORRADE_BUILD_STATIC_UNIQUE_GLOBALS
 #cmakedefine CORRADE_BUILD_MULTITHREADED
 #cmakedefine CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+#cmakedefine CORRADE_BUILD_STARTUP_PROFILING
 
 #cmakedefine CORRADE_TARGET_APPLE
 #cmakedefine CORRADE_TARGET_IOS